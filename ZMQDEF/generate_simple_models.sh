@@ -249,6 +249,90 @@ create_validation_function() {
     fi
 }
 
+# Şema alanlarını sırasıyla oku: "alan c++tipi min max" (min/max setter doğrulamasıyla aynı)
+list_fields() {
+    local json_file="$1"
+    jq -r '.properties | to_entries[] | "\(.key) \(.value.type) \(.value.minimum // "null") \(.value.maximum // "null") \(.value.format // "null")"' "$json_file" | while read -r field_name json_type minimum maximum format; do
+        if [ "$minimum" = "null" ]; then minimum="0"; fi
+        if [ "$maximum" = "null" ]; then maximum="1000000"; fi
+        cpp_type=$(get_cpp_type "$json_type" "$minimum" "$maximum" "$format")
+        # Unsigned setter'lar yalnızca üst sınırı kontrol eder
+        if [[ "$cpp_type" =~ ^uint ]]; then minimum="0"; fi
+        echo "$field_name $cpp_type $minimum $maximum"
+    done
+}
+
+# Toplu, istisnasız doğrulama: her alan tek geçişte, erken çıkış olmadan kontrol edilir.
+# Her grup (reel / tamsayı) derleyicinin vektör karşılaştırmalarına çevirebileceği bir döngüdür.
+create_field_check() {
+    local title="$1"
+    local json_file="$2"
+    local position=0
+    local real_names=() real_min=() real_max=() real_bits=()
+    local int_names=() int_min=() int_max=() int_bits=()
+    local wide_checks=()
+
+    while read -r field_name cpp_type minimum maximum; do
+        case "$cpp_type" in
+            float|double)
+                real_names+=("${field_name}_"); real_min+=("$minimum"); real_max+=("$maximum"); real_bits+=("${position}U")
+                ;;
+            uint64_t)
+                wide_checks+=("    invalid |= static_cast<std::uint64_t>(${field_name}_ > ${maximum}ULL) << ${position}U;")
+                ;;
+            std::string)
+                ;;
+            *)
+                int_names+=("static_cast<std::int64_t>(${field_name}_)"); int_min+=("${minimum}LL"); int_max+=("${maximum}LL"); int_bits+=("${position}U")
+                ;;
+        esac
+        position=$((position + 1))
+    done < <(list_fields "$json_file")
+
+    echo "FieldError $title::firstInvalidField() const noexcept {"
+    echo "    // Bit i set: field i (schema order) is out of range"
+    echo "    std::uint64_t invalid = 0U;"
+    if [ ${#real_names[@]} -gt 0 ]; then
+        echo ""
+        echo "    // Floating point fields; an all-ones exponent (NaN, Inf) is rejected without std::isnan"
+        echo "    static constexpr std::size_t REAL_COUNT = ${#real_names[@]}U;"
+        echo "    static constexpr double REAL_MIN[REAL_COUNT] = {$(printf '%s, ' "${real_min[@]}" | sed 's/, $//')};"
+        echo "    static constexpr double REAL_MAX[REAL_COUNT] = {$(printf '%s, ' "${real_max[@]}" | sed 's/, $//')};"
+        echo "    static constexpr unsigned REAL_BIT[REAL_COUNT] = {$(printf '%s, ' "${real_bits[@]}" | sed 's/, $//')};"
+        echo "    const double reals[REAL_COUNT] = {$(printf '%s, ' "${real_names[@]}" | sed 's/, $//')};"
+        echo "    for (std::size_t i = 0U; i < REAL_COUNT; ++i) {"
+        echo "        std::uint64_t bits = 0U;"
+        echo "        std::memcpy(&bits, &reals[i], sizeof(bits));"
+        echo "        const bool outside = ((bits & 0x7FF0000000000000ULL) == 0x7FF0000000000000ULL) |"
+        echo "                             (reals[i] < REAL_MIN[i]) | (reals[i] > REAL_MAX[i]);"
+        echo "        invalid |= static_cast<std::uint64_t>(outside) << REAL_BIT[i];"
+        echo "    }"
+    fi
+    if [ ${#int_names[@]} -gt 0 ]; then
+        echo ""
+        echo "    // Integer fields, widened to int64_t"
+        echo "    static constexpr std::size_t INTEGER_COUNT = ${#int_names[@]}U;"
+        echo "    static constexpr std::int64_t INTEGER_MIN[INTEGER_COUNT] = {$(printf '%s, ' "${int_min[@]}" | sed 's/, $//')};"
+        echo "    static constexpr std::int64_t INTEGER_MAX[INTEGER_COUNT] = {$(printf '%s, ' "${int_max[@]}" | sed 's/, $//')};"
+        echo "    static constexpr unsigned INTEGER_BIT[INTEGER_COUNT] = {$(printf '%s, ' "${int_bits[@]}" | sed 's/, $//')};"
+        echo "    const std::int64_t integers[INTEGER_COUNT] = {$(printf '%s, ' "${int_names[@]}" | sed 's/, $//')};"
+        echo "    for (std::size_t i = 0U; i < INTEGER_COUNT; ++i) {"
+        echo "        const bool outside = (integers[i] < INTEGER_MIN[i]) | (integers[i] > INTEGER_MAX[i]);"
+        echo "        invalid |= static_cast<std::uint64_t>(outside) << INTEGER_BIT[i];"
+        echo "    }"
+    fi
+    for check in "${wide_checks[@]+"${wide_checks[@]}"}"; do
+        echo ""
+        echo "$check"
+    done
+    echo ""
+    echo "    if (invalid == 0U) {"
+    echo "        return FieldError::None;"
+    echo "    }"
+    echo "    return static_cast<FieldError>(static_cast<std::uint8_t>(__builtin_ctzll(invalid) + 1));"
+    echo "}"
+}
+
 # Tek JSON dosyasını işle (Gelişmiş sürüm - direction aware)
 process_json_file() {
     local json_file="$1"
@@ -268,6 +352,11 @@ process_json_file() {
     # x-service-metadata bilgilerini çıkar
     local multicast_address=$(jq -r '."x-service-metadata".multicast_address // "null"' "$json_file")
     local port=$(jq -r '."x-service-metadata".port // "null"' "$json_file")
+    local socket_profile=$(jq -r '."x-service-metadata".socket_profile // "null"' "$json_file")
+    local group_partitioning=$(jq -r '."x-service-metadata".group_partitioning // "null"' "$json_file")
+    local group_track_range_size=$(jq -r '."x-service-metadata".group_track_range_size // 1' "$json_file")
+    local group_cell_size_deg=$(jq -r '."x-service-metadata".group_cell_size_deg // 1' "$json_file")
+    local group_selection=$(jq -r '."x-service-metadata".group_selection // ""' "$json_file")
     
     cat > "$header_file" << EOF
 #pragma once
@@ -303,6 +392,21 @@ EOF
         echo "    static constexpr int PORT = $port;" >> "$header_file"
     fi
     
+    # UDP socket profili (common/UdpSocketProfile.h): latency | throughput | default
+    if [ "$socket_profile" != "null" ] && [ -n "$socket_profile" ]; then
+        echo "    static constexpr const char* SOCKET_PROFILE = \"$socket_profile\";" >> "$header_file"
+    fi
+    
+    # RADIO/DISH grup bölümleme (common/TrackGroups.h): none | track_range | geo_cell
+    if [ "$group_partitioning" != "null" ] && [ -n "$group_partitioning" ]; then
+        echo "    static constexpr const char* GROUP_PARTITIONING = \"$group_partitioning\";" >> "$header_file"
+        echo "    static constexpr int GROUP_TRACK_RANGE_SIZE = $group_track_range_size;" >> "$header_file"
+        # jq 1.0'ı 1 olarak basar; double sabit ondalıklı yazılsın
+        case "$group_cell_size_deg" in *.*|*e*|*E*) ;; *) group_cell_size_deg="$group_cell_size_deg.0" ;; esac
+        echo "    static constexpr double GROUP_CELL_SIZE_DEG = $group_cell_size_deg;" >> "$header_file"
+        echo "    static constexpr const char* GROUP_SELECTION = \"$group_selection\";" >> "$header_file"
+    fi
+    
     # Direction specific constants
     if [ "$model_direction" = "outgoing" ]; then
         cat >> "$header_file" << EOF
@@ -362,6 +466,41 @@ EOF
         echo "" >> "$header_file"
     done
     
+    # Alan hata kodları ve istisnasız toplu kurulum bildirimleri
+    echo "    // Validation result: the first out-of-range field, in schema order" >> "$header_file"
+    echo "    enum class FieldError : std::uint8_t {" >> "$header_file"
+    echo "        None = 0U," >> "$header_file"
+    list_fields "$json_file" | while read -r field_name cpp_type minimum maximum; do
+        field_name_cap="$(tr '[:lower:]' '[:upper:]' <<< ${field_name:0:1})${field_name:1}"
+        echo "        ${field_name_cap}," >> "$header_file"
+    done
+    echo "    };" >> "$header_file"
+    echo "    [[nodiscard]] static const char* fieldErrorName(FieldError error) noexcept;" >> "$header_file"
+    echo "" >> "$header_file"
+
+    local from_fields_params
+    from_fields_params=$(list_fields "$json_file" | while read -r field_name cpp_type minimum maximum; do
+        if [ "$cpp_type" = "std::string" ]; then
+            printf '%s, ' "const std::string& ${field_name}"
+        else
+            printf '%s, ' "$cpp_type ${field_name}"
+        fi
+    done | sed 's/, $//')
+    # String kopyası bellek ayırabilir; noexcept yalnızca sayısal şemalarda
+    local from_fields_noexcept=" noexcept"
+    if list_fields "$json_file" | grep -q " std::string "; then
+        from_fields_noexcept=""
+    fi
+
+    cat >> "$header_file" << EOF
+    // Exception-free construction - MISRA compliant
+    /// Sets every field, then checks the whole record once; on an error the record holds the rejected values
+    [[nodiscard]] FieldError fromFields(${from_fields_params})${from_fields_noexcept};
+    /// One pass over every field without exceptions; FieldError::None if the record is valid
+    [[nodiscard]] FieldError firstInvalidField() const noexcept;
+
+EOF
+
     # isValid method declaration
     cat >> "$header_file" << EOF
     // Validation - MISRA compliant
@@ -369,6 +508,8 @@ EOF
 
     // Binary Serialization - MISRA compliant
     [[nodiscard]] std::vector<uint8_t> serialize() const;
+    /// Writes the same bytes as serialize() into out; returns 0 if capacity is too small
+    std::size_t serializeTo(uint8_t* out, std::size_t capacity) const noexcept;
     bool deserialize(const std::vector<uint8_t>& data) noexcept;
     [[nodiscard]] std::size_t getSerializedSize() const noexcept;
 
@@ -466,26 +607,36 @@ EOF
         echo "" >> "$source_file"
     done
     
-    # isValid method implementation
-    cat >> "$source_file" << EOF
-bool $title::isValid() const noexcept {
-    try {
-EOF
-
-    jq -r '.properties | to_entries[] | "\(.key) \(.value.type) \(.value.format // "null")"' "$json_file" | while read -r field_name json_type format; do
-        cpp_type=$(get_cpp_type "$json_type" "0" "1000000" "$format")
+    # fieldErrorName, fromFields, firstInvalidField ve isValid implementasyonları
+    echo "const char* $title::fieldErrorName(FieldError error) noexcept {" >> "$source_file"
+    echo "    switch (error) {" >> "$source_file"
+    echo "        case FieldError::None:" >> "$source_file"
+    echo "            return \"none\";" >> "$source_file"
+    list_fields "$json_file" | while read -r field_name cpp_type minimum maximum; do
         field_name_cap="$(tr '[:lower:]' '[:upper:]' <<< ${field_name:0:1})${field_name:1}"
-        
-        if [ "$cpp_type" != "std::string" ]; then
-            echo "        validate${field_name_cap}(${field_name}_);" >> "$source_file"
-        fi
+        echo "        case FieldError::${field_name_cap}:" >> "$source_file"
+        echo "            return \"${field_name}\";" >> "$source_file"
     done
-    
+    echo "        default:" >> "$source_file"
+    echo "            return \"unknown\";" >> "$source_file"
+    echo "    }" >> "$source_file"
+    echo "}" >> "$source_file"
+    echo "" >> "$source_file"
+
+    echo "$title::FieldError $title::fromFields(${from_fields_params})${from_fields_noexcept} {" >> "$source_file"
+    list_fields "$json_file" | while read -r field_name cpp_type minimum maximum; do
+        echo "    ${field_name}_ = ${field_name};" >> "$source_file"
+    done
+    echo "    return firstInvalidField();" >> "$source_file"
+    echo "}" >> "$source_file"
+    echo "" >> "$source_file"
+
+    create_field_check "$title" "$json_file" | sed "s/^FieldError $title::/$title::FieldError $title::/" >> "$source_file"
+
     cat >> "$source_file" << EOF
-        return true;
-    } catch (const std::exception&) {
-        return false;
-    }
+
+bool $title::isValid() const noexcept {
+    return firstInvalidField() == FieldError::None;
 }
 
 // MISRA C++ 2023 compliant Binary Serialization Implementation
@@ -526,6 +677,47 @@ EOF
     return buffer;
 }
 
+// Serialization into caller memory (pooled send buffers) - MISRA compliant
+std::size_t $title::serializeTo(uint8_t* out, std::size_t capacity) const noexcept {
+    const std::size_t size = getSerializedSize();
+    if (out == nullptr || capacity < size) {
+        return 0U;
+    }
+
+    std::size_t offset = 0U;
+
+EOF
+
+    # Her field için serializeTo kodu oluştur
+    jq -r '.properties | to_entries[] | "\(.key) \(.value.type) \(.value.format // "null")"' "$json_file" | while read -r field_name json_type format; do
+        cpp_type=$(get_cpp_type "$json_type" "0" "1000000" "$format")
+
+        if [[ "$cpp_type" =~ int.*_t|float|double ]]; then
+            cat >> "$source_file" << EOF
+    // Serialize ${field_name}_
+    std::memcpy(&out[offset], &${field_name}_, sizeof(${field_name}_));
+    offset += sizeof(${field_name}_);
+
+EOF
+        elif [ "$cpp_type" = "std::string" ]; then
+            cat >> "$source_file" << EOF
+    // Serialize ${field_name}_ (string)
+    {
+        const std::uint32_t length = static_cast<std::uint32_t>(${field_name}_.length());
+        std::memcpy(&out[offset], &length, sizeof(length));
+        offset += sizeof(length);
+        std::memcpy(&out[offset], ${field_name}_.data(), ${field_name}_.length());
+        offset += ${field_name}_.length();
+    }
+
+EOF
+        fi
+    done
+
+    cat >> "$source_file" << EOF
+    return offset;
+}
+
 bool $title::deserialize(const std::vector<uint8_t>& data) noexcept {
     if (data.size() < getSerializedSize()) {
         return false;
@@ -603,6 +795,292 @@ EOF
 EOF
 
     echo -e "${GREEN}✅ ${title}.hpp ve ${title}.cpp oluşturuldu${NC}"
+
+    create_batch_files "$json_file" "$title"
+}
+
+# Alan tipinin paketli kayıttaki bayt sayısı
+wire_size_of() {
+    case "$1" in
+        int8_t|uint8_t) echo 1 ;;
+        int16_t|uint16_t) echo 2 ;;
+        int32_t|uint32_t|float) echo 4 ;;
+        *) echo 8 ;;
+    esac
+}
+
+# SoA toplu taşıyıcı: her alan hizalı ayrı bir sütun, satır vekilleri ve toplu wire codec
+create_batch_files() {
+    local json_file="$1"
+    local title="$2"
+    local filename
+    filename=$(basename "$json_file" .json)
+    local batch="${title}Batch"
+    local header_file="$MODEL_DIR/${batch}.hpp"
+    local source_file="$MODEL_DIR/${batch}.cpp"
+
+    # String alanlar sabit boyutlu sütuna sığmaz
+    if list_fields "$json_file" | grep -q " std::string "; then
+        echo -e "${YELLOW}⚠️  ${title} string alan içeriyor, ${batch} oluşturulmadı${NC}"
+        return
+    fi
+
+    local names=() types=() caps=() offsets=()
+    local offset=0
+    while read -r field_name cpp_type minimum maximum; do
+        names+=("$field_name")
+        types+=("$cpp_type")
+        caps+=("$(tr '[:lower:]' '[:upper:]' <<< ${field_name:0:1})${field_name:1}")
+        offsets+=("${offset}U")
+        offset=$((offset + $(wire_size_of "$cpp_type")))
+    done < <(list_fields "$json_file")
+    local count=${#names[@]}
+
+    cat > "$header_file" << EOF
+#pragma once
+
+// MISRA C++ 2023 compliant includes
+#include "${title}.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+
+/**
+ * @brief Column-per-field (SoA) batch of ${title} records
+ * Auto-generated from ${filename}.json
+ * Every field is one ${title}Batch::COLUMN_ALIGNMENT-byte aligned array of capacity() values,
+ * so batch kernels loop over a column instead of calling getters per record.
+ * decode()/encode() read and write the packed record layout of ${title}::serialize().
+ */
+class ${batch} final {
+public:
+    static constexpr std::size_t COLUMN_ALIGNMENT = 64U;
+    /// Bytes of one packed wire record
+    static constexpr std::size_t WIRE_SIZE = ${offset}U;
+
+    /// Row proxy: the batch and an index; accessors are references into the columns
+    class Row final {
+    public:
+        Row(${batch}* batch, std::size_t index) noexcept : batch_(batch), index_(index) {}
+        std::size_t index() const noexcept { return index_; }
+EOF
+    for ((i = 0; i < count; ++i)); do
+        echo "        ${types[$i]}& ${names[$i]}() const noexcept { return batch_->${names[$i]}_[index_]; }" >> "$header_file"
+    done
+    cat >> "$header_file" << EOF
+
+    private:
+        ${batch}* batch_;
+        std::size_t index_;
+    };
+
+    /// Read-only row proxy
+    class ConstRow final {
+    public:
+        ConstRow(const ${batch}* batch, std::size_t index) noexcept : batch_(batch), index_(index) {}
+        std::size_t index() const noexcept { return index_; }
+EOF
+    for ((i = 0; i < count; ++i)); do
+        echo "        ${types[$i]} ${names[$i]}() const noexcept { return batch_->${names[$i]}_[index_]; }" >> "$header_file"
+    done
+    cat >> "$header_file" << EOF
+
+    private:
+        const ${batch}* batch_;
+        std::size_t index_;
+    };
+
+    /// Forward iterator yielding row proxies by value
+    template <typename BatchPointer, typename RowProxy>
+    class RowIterator final {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = RowProxy;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = RowProxy;
+
+        RowIterator(BatchPointer batch, std::size_t index) noexcept : batch_(batch), index_(index) {}
+        RowProxy operator*() const noexcept { return RowProxy(batch_, index_); }
+        RowIterator& operator++() noexcept { ++index_; return *this; }
+        RowIterator operator++(int) noexcept { RowIterator previous = *this; ++index_; return previous; }
+        bool operator==(const RowIterator& other) const noexcept { return index_ == other.index_; }
+        bool operator!=(const RowIterator& other) const noexcept { return index_ != other.index_; }
+
+    private:
+        BatchPointer batch_;
+        std::size_t index_;
+    };
+
+    using iterator = RowIterator<${batch}*, Row>;
+    using const_iterator = RowIterator<const ${batch}*, ConstRow>;
+
+    /// One allocation holds every column; @throws std::invalid_argument for a zero capacity
+    explicit ${batch}(std::size_t capacity);
+
+    // Columns point into the arena: no copies, moves keep the arena
+    ${batch}(const ${batch}& other) = delete;
+    ${batch}& operator=(const ${batch}& other) = delete;
+    ${batch}(${batch}&& other) noexcept = default;
+    ${batch}& operator=(${batch}&& other) noexcept = default;
+    ~${batch}() = default;
+
+    std::size_t size() const noexcept { return size_; }
+    std::size_t capacity() const noexcept { return capacity_; }
+    bool empty() const noexcept { return size_ == 0U; }
+    bool full() const noexcept { return size_ == capacity_; }
+    void clear() noexcept { size_ = 0U; }
+
+    /// Adds up to count rows with unspecified values, for kernels that fill columns; returns rows added
+    std::size_t extend(std::size_t count) noexcept;
+
+    // Columns: capacity() values each, the first size() in use
+EOF
+    for ((i = 0; i < count; ++i)); do
+        echo "    ${types[$i]}* ${names[$i]}Column() noexcept { return ${names[$i]}_; }" >> "$header_file"
+        echo "    const ${types[$i]}* ${names[$i]}Column() const noexcept { return ${names[$i]}_; }" >> "$header_file"
+    done
+    cat >> "$header_file" << EOF
+
+    // Rows
+    Row operator[](std::size_t index) noexcept { return Row(this, index); }
+    ConstRow operator[](std::size_t index) const noexcept { return ConstRow(this, index); }
+    iterator begin() noexcept { return iterator(this, 0U); }
+    iterator end() noexcept { return iterator(this, size_); }
+    const_iterator begin() const noexcept { return const_iterator(this, 0U); }
+    const_iterator end() const noexcept { return const_iterator(this, size_); }
+
+    /// Appends one record; false if the batch is full
+    bool push(const ${title}& record) noexcept;
+
+    /// Builds the record of one row with ${title}::fromFields (one range check)
+    ${title}::FieldError record(std::size_t index, ${title}& out) const noexcept;
+
+    // Bulk wire codec, one column at a time
+    /// Appends up to count packed records from wire; returns records decoded (stops when full)
+    std::size_t decode(const uint8_t* wire, std::size_t count) noexcept;
+    /// Writes rows [first, first + count) packed into out; returns bytes written, 0 if out is too small
+    std::size_t encode(std::size_t first, std::size_t count, uint8_t* out, std::size_t outCapacity) const noexcept;
+
+private:
+    struct alignas(COLUMN_ALIGNMENT) Line {
+        uint8_t bytes[COLUMN_ALIGNMENT];
+    };
+
+    std::size_t capacity_;
+    std::size_t size_ = 0U;
+    std::unique_ptr<Line[]> arena_;
+
+    // Column pointers into arena_
+EOF
+    for ((i = 0; i < count; ++i)); do
+        echo "    ${types[$i]}* ${names[$i]}_ = nullptr;" >> "$header_file"
+    done
+    echo "};" >> "$header_file"
+
+    # Source dosyası
+    cat > "$source_file" << EOF
+#include "${batch}.hpp"
+
+#include <cstring>
+#include <stdexcept>
+
+namespace {
+
+// Offset of each field in a packed record, in schema order
+constexpr std::size_t WIRE_OFFSET[${count}U] = {$(printf '%s, ' "${offsets[@]}" | sed 's/, $//')};
+
+// Bytes of one column of capacity values, rounded up to whole aligned lines
+std::size_t columnLines(std::size_t capacity, std::size_t valueSize) noexcept {
+    const std::size_t bytes = capacity * valueSize;
+    return (bytes + ${batch}::COLUMN_ALIGNMENT - 1U) / ${batch}::COLUMN_ALIGNMENT;
+}
+
+} // namespace
+
+${batch}::${batch}(std::size_t capacity)
+    : capacity_(capacity) {
+    if (capacity == 0U) {
+        throw std::invalid_argument("${batch} capacity must be positive");
+    }
+    std::size_t lines = 0U;
+EOF
+    for ((i = 0; i < count; ++i)); do
+        echo "    lines += columnLines(capacity, sizeof(${types[$i]}));" >> "$source_file"
+    done
+    cat >> "$source_file" << EOF
+    arena_.reset(new Line[lines]);
+
+    std::size_t line = 0U;
+EOF
+    for ((i = 0; i < count; ++i)); do
+        echo "    ${names[$i]}_ = reinterpret_cast<${types[$i]}*>(&arena_[line]);" >> "$source_file"
+        if [ $i -lt $((count - 1)) ]; then
+            echo "    line += columnLines(capacity, sizeof(${types[$i]}));" >> "$source_file"
+        fi
+    done
+    cat >> "$source_file" << EOF
+}
+
+std::size_t ${batch}::extend(std::size_t count) noexcept {
+    const std::size_t room = capacity_ - size_;
+    const std::size_t added = count < room ? count : room;
+    size_ += added;
+    return added;
+}
+
+bool ${batch}::push(const ${title}& record) noexcept {
+    if (size_ == capacity_) {
+        return false;
+    }
+EOF
+    for ((i = 0; i < count; ++i)); do
+        echo "    ${names[$i]}_[size_] = record.get${caps[$i]}();" >> "$source_file"
+    done
+    cat >> "$source_file" << EOF
+    ++size_;
+    return true;
+}
+
+${title}::FieldError ${batch}::record(std::size_t index, ${title}& out) const noexcept {
+    return out.fromFields($(for ((i = 0; i < count; ++i)); do printf '%s, ' "${names[$i]}_[index]"; done | sed 's/, $//'));
+}
+
+std::size_t ${batch}::decode(const uint8_t* wire, std::size_t count) noexcept {
+    const std::size_t room = capacity_ - size_;
+    const std::size_t rows = count < room ? count : room;
+EOF
+    for ((i = 0; i < count; ++i)); do
+        cat >> "$source_file" << EOF
+    for (std::size_t row = 0U; row < rows; ++row) {
+        std::memcpy(&${names[$i]}_[size_ + row], &wire[row * WIRE_SIZE + WIRE_OFFSET[${i}U]], sizeof(${types[$i]}));
+    }
+EOF
+    done
+    cat >> "$source_file" << EOF
+    size_ += rows;
+    return rows;
+}
+
+std::size_t ${batch}::encode(std::size_t first, std::size_t count, uint8_t* out, std::size_t outCapacity) const noexcept {
+    if (first > size_ || count > size_ - first || out == nullptr || outCapacity / WIRE_SIZE < count) {
+        return 0U;
+    }
+EOF
+    for ((i = 0; i < count; ++i)); do
+        cat >> "$source_file" << EOF
+    for (std::size_t row = 0U; row < count; ++row) {
+        std::memcpy(&out[row * WIRE_SIZE + WIRE_OFFSET[${i}U]], &${names[$i]}_[first + row], sizeof(${types[$i]}));
+    }
+EOF
+    done
+    cat >> "$source_file" << EOF
+    return count * WIRE_SIZE;
+}
+EOF
+
+    echo -e "${GREEN}✅ ${batch}.hpp ve ${batch}.cpp oluşturuldu${NC}"
 }
 
 # Ana fonksiyon
@@ -656,6 +1134,11 @@ main() {
             echo -e "${RED}Hata: jq komutu bulunamadı. Lütfen jq'yu kurun: sudo apt-get install jq${NC}"
             exit 1
         fi
+        # jq 1.6 sayıları double'a çevirir: 1.0e+6 -> 1000000, 9223372036854775 -> ...776 (int64 sınırı bozulur)
+        if ! jq -e 'have_decnum' <<< 'null' &> /dev/null; then
+            echo -e "${RED}Hata: jq 1.7+ gerekli (sayı literal'leri birebir korunmalı). Bulunan: $(jq --version)${NC}"
+            exit 1
+        fi
         
         process_json_file "$json_file" "$direction"
         echo ""
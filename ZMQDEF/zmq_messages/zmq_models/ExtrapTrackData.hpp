@@ -19,6 +19,11 @@ public:
     // Network configuration constants
     static constexpr const char* MULTICAST_ADDRESS = "239.1.1.5";
     static constexpr int PORT = 9596;
+    static constexpr const char* SOCKET_PROFILE = "latency";
+    static constexpr const char* GROUP_PARTITIONING = "none";
+    static constexpr int GROUP_TRACK_RANGE_SIZE = 100;
+    static constexpr double GROUP_CELL_SIZE_DEG = 1.0;
+    static constexpr const char* GROUP_SELECTION = "";
     
     // ZeroMQ RADIO socket configuration (outgoing)
     static constexpr const char* ZMQ_SOCKET_TYPE = "RADIO";
@@ -73,11 +78,35 @@ public:
     int64_t getFirstHopSentTime() const noexcept;
     void setFirstHopSentTime(const int64_t& value);
 
+    // Validation result: the first out-of-range field, in schema order
+    enum class FieldError : std::uint8_t {
+        None = 0U,
+        TrackId,
+        XVelocityECEF,
+        YVelocityECEF,
+        ZVelocityECEF,
+        XPositionECEF,
+        YPositionECEF,
+        ZPositionECEF,
+        OriginalUpdateTime,
+        UpdateTime,
+        FirstHopSentTime,
+    };
+    [[nodiscard]] static const char* fieldErrorName(FieldError error) noexcept;
+
+    // Exception-free construction - MISRA compliant
+    /// Sets every field, then checks the whole record once; on an error the record holds the rejected values
+    [[nodiscard]] FieldError fromFields(int32_t trackId, double xVelocityECEF, double yVelocityECEF, double zVelocityECEF, double xPositionECEF, double yPositionECEF, double zPositionECEF, int64_t originalUpdateTime, int64_t updateTime, int64_t firstHopSentTime) noexcept;
+    /// One pass over every field without exceptions; FieldError::None if the record is valid
+    [[nodiscard]] FieldError firstInvalidField() const noexcept;
+
     // Validation - MISRA compliant
     [[nodiscard]] bool isValid() const noexcept;
 
     // Binary Serialization - MISRA compliant
     [[nodiscard]] std::vector<uint8_t> serialize() const;
+    /// Writes the same bytes as serialize() into out; returns 0 if capacity is too small
+    std::size_t serializeTo(uint8_t* out, std::size_t capacity) const noexcept;
     bool deserialize(const std::vector<uint8_t>& data) noexcept;
     [[nodiscard]] std::size_t getSerializedSize() const noexcept;
 
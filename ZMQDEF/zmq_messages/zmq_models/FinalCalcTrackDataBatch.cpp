@@ -0,0 +1,210 @@
+#include "FinalCalcTrackDataBatch.hpp"
+
+#include <cstring>
+#include <stdexcept>
+
+namespace {
+
+// Offset of each field in a packed record, in schema order
+constexpr std::size_t WIRE_OFFSET[15U] = {0U, 4U, 12U, 20U, 28U, 36U, 44U, 52U, 60U, 68U, 76U, 84U, 92U, 100U, 108U};
+
+// Bytes of one column of capacity values, rounded up to whole aligned lines
+std::size_t columnLines(std::size_t capacity, std::size_t valueSize) noexcept {
+    const std::size_t bytes = capacity * valueSize;
+    return (bytes + FinalCalcTrackDataBatch::COLUMN_ALIGNMENT - 1U) / FinalCalcTrackDataBatch::COLUMN_ALIGNMENT;
+}
+
+} // namespace
+
+FinalCalcTrackDataBatch::FinalCalcTrackDataBatch(std::size_t capacity)
+    : capacity_(capacity) {
+    if (capacity == 0U) {
+        throw std::invalid_argument("FinalCalcTrackDataBatch capacity must be positive");
+    }
+    std::size_t lines = 0U;
+    lines += columnLines(capacity, sizeof(int32_t));
+    lines += columnLines(capacity, sizeof(double));
+    lines += columnLines(capacity, sizeof(double));
+    lines += columnLines(capacity, sizeof(double));
+    lines += columnLines(capacity, sizeof(double));
+    lines += columnLines(capacity, sizeof(double));
+    lines += columnLines(capacity, sizeof(double));
+    lines += columnLines(capacity, sizeof(int64_t));
+    lines += columnLines(capacity, sizeof(int64_t));
+    lines += columnLines(capacity, sizeof(int64_t));
+    lines += columnLines(capacity, sizeof(int64_t));
+    lines += columnLines(capacity, sizeof(int64_t));
+    lines += columnLines(capacity, sizeof(int64_t));
+    lines += columnLines(capacity, sizeof(int64_t));
+    lines += columnLines(capacity, sizeof(int64_t));
+    arena_.reset(new Line[lines]);
+
+    std::size_t line = 0U;
+    trackId_ = reinterpret_cast<int32_t*>(&arena_[line]);
+    line += columnLines(capacity, sizeof(int32_t));
+    xVelocityECEF_ = reinterpret_cast<double*>(&arena_[line]);
+    line += columnLines(capacity, sizeof(double));
+    yVelocityECEF_ = reinterpret_cast<double*>(&arena_[line]);
+    line += columnLines(capacity, sizeof(double));
+    zVelocityECEF_ = reinterpret_cast<double*>(&arena_[line]);
+    line += columnLines(capacity, sizeof(double));
+    xPositionECEF_ = reinterpret_cast<double*>(&arena_[line]);
+    line += columnLines(capacity, sizeof(double));
+    yPositionECEF_ = reinterpret_cast<double*>(&arena_[line]);
+    line += columnLines(capacity, sizeof(double));
+    zPositionECEF_ = reinterpret_cast<double*>(&arena_[line]);
+    line += columnLines(capacity, sizeof(double));
+    originalUpdateTime_ = reinterpret_cast<int64_t*>(&arena_[line]);
+    line += columnLines(capacity, sizeof(int64_t));
+    updateTime_ = reinterpret_cast<int64_t*>(&arena_[line]);
+    line += columnLines(capacity, sizeof(int64_t));
+    firstHopSentTime_ = reinterpret_cast<int64_t*>(&arena_[line]);
+    line += columnLines(capacity, sizeof(int64_t));
+    firstHopDelayTime_ = reinterpret_cast<int64_t*>(&arena_[line]);
+    line += columnLines(capacity, sizeof(int64_t));
+    secondHopSentTime_ = reinterpret_cast<int64_t*>(&arena_[line]);
+    line += columnLines(capacity, sizeof(int64_t));
+    secondHopDelayTime_ = reinterpret_cast<int64_t*>(&arena_[line]);
+    line += columnLines(capacity, sizeof(int64_t));
+    totalDelayTime_ = reinterpret_cast<int64_t*>(&arena_[line]);
+    line += columnLines(capacity, sizeof(int64_t));
+    thirdHopSentTime_ = reinterpret_cast<int64_t*>(&arena_[line]);
+}
+
+std::size_t FinalCalcTrackDataBatch::extend(std::size_t count) noexcept {
+    const std::size_t room = capacity_ - size_;
+    const std::size_t added = count < room ? count : room;
+    size_ += added;
+    return added;
+}
+
+bool FinalCalcTrackDataBatch::push(const FinalCalcTrackData& record) noexcept {
+    if (size_ == capacity_) {
+        return false;
+    }
+    trackId_[size_] = record.getTrackId();
+    xVelocityECEF_[size_] = record.getXVelocityECEF();
+    yVelocityECEF_[size_] = record.getYVelocityECEF();
+    zVelocityECEF_[size_] = record.getZVelocityECEF();
+    xPositionECEF_[size_] = record.getXPositionECEF();
+    yPositionECEF_[size_] = record.getYPositionECEF();
+    zPositionECEF_[size_] = record.getZPositionECEF();
+    originalUpdateTime_[size_] = record.getOriginalUpdateTime();
+    updateTime_[size_] = record.getUpdateTime();
+    firstHopSentTime_[size_] = record.getFirstHopSentTime();
+    firstHopDelayTime_[size_] = record.getFirstHopDelayTime();
+    secondHopSentTime_[size_] = record.getSecondHopSentTime();
+    secondHopDelayTime_[size_] = record.getSecondHopDelayTime();
+    totalDelayTime_[size_] = record.getTotalDelayTime();
+    thirdHopSentTime_[size_] = record.getThirdHopSentTime();
+    ++size_;
+    return true;
+}
+
+FinalCalcTrackData::FieldError FinalCalcTrackDataBatch::record(std::size_t index, FinalCalcTrackData& out) const noexcept {
+    return out.fromFields(trackId_[index], xVelocityECEF_[index], yVelocityECEF_[index], zVelocityECEF_[index], xPositionECEF_[index], yPositionECEF_[index], zPositionECEF_[index], originalUpdateTime_[index], updateTime_[index], firstHopSentTime_[index], firstHopDelayTime_[index], secondHopSentTime_[index], secondHopDelayTime_[index], totalDelayTime_[index], thirdHopSentTime_[index]);
+}
+
+std::size_t FinalCalcTrackDataBatch::decode(const uint8_t* wire, std::size_t count) noexcept {
+    const std::size_t room = capacity_ - size_;
+    const std::size_t rows = count < room ? count : room;
+    for (std::size_t row = 0U; row < rows; ++row) {
+        std::memcpy(&trackId_[size_ + row], &wire[row * WIRE_SIZE + WIRE_OFFSET[0U]], sizeof(int32_t));
+    }
+    for (std::size_t row = 0U; row < rows; ++row) {
+        std::memcpy(&xVelocityECEF_[size_ + row], &wire[row * WIRE_SIZE + WIRE_OFFSET[1U]], sizeof(double));
+    }
+    for (std::size_t row = 0U; row < rows; ++row) {
+        std::memcpy(&yVelocityECEF_[size_ + row], &wire[row * WIRE_SIZE + WIRE_OFFSET[2U]], sizeof(double));
+    }
+    for (std::size_t row = 0U; row < rows; ++row) {
+        std::memcpy(&zVelocityECEF_[size_ + row], &wire[row * WIRE_SIZE + WIRE_OFFSET[3U]], sizeof(double));
+    }
+    for (std::size_t row = 0U; row < rows; ++row) {
+        std::memcpy(&xPositionECEF_[size_ + row], &wire[row * WIRE_SIZE + WIRE_OFFSET[4U]], sizeof(double));
+    }
+    for (std::size_t row = 0U; row < rows; ++row) {
+        std::memcpy(&yPositionECEF_[size_ + row], &wire[row * WIRE_SIZE + WIRE_OFFSET[5U]], sizeof(double));
+    }
+    for (std::size_t row = 0U; row < rows; ++row) {
+        std::memcpy(&zPositionECEF_[size_ + row], &wire[row * WIRE_SIZE + WIRE_OFFSET[6U]], sizeof(double));
+    }
+    for (std::size_t row = 0U; row < rows; ++row) {
+        std::memcpy(&originalUpdateTime_[size_ + row], &wire[row * WIRE_SIZE + WIRE_OFFSET[7U]], sizeof(int64_t));
+    }
+    for (std::size_t row = 0U; row < rows; ++row) {
+        std::memcpy(&updateTime_[size_ + row], &wire[row * WIRE_SIZE + WIRE_OFFSET[8U]], sizeof(int64_t));
+    }
+    for (std::size_t row = 0U; row < rows; ++row) {
+        std::memcpy(&firstHopSentTime_[size_ + row], &wire[row * WIRE_SIZE + WIRE_OFFSET[9U]], sizeof(int64_t));
+    }
+    for (std::size_t row = 0U; row < rows; ++row) {
+        std::memcpy(&firstHopDelayTime_[size_ + row], &wire[row * WIRE_SIZE + WIRE_OFFSET[10U]], sizeof(int64_t));
+    }
+    for (std::size_t row = 0U; row < rows; ++row) {
+        std::memcpy(&secondHopSentTime_[size_ + row], &wire[row * WIRE_SIZE + WIRE_OFFSET[11U]], sizeof(int64_t));
+    }
+    for (std::size_t row = 0U; row < rows; ++row) {
+        std::memcpy(&secondHopDelayTime_[size_ + row], &wire[row * WIRE_SIZE + WIRE_OFFSET[12U]], sizeof(int64_t));
+    }
+    for (std::size_t row = 0U; row < rows; ++row) {
+        std::memcpy(&totalDelayTime_[size_ + row], &wire[row * WIRE_SIZE + WIRE_OFFSET[13U]], sizeof(int64_t));
+    }
+    for (std::size_t row = 0U; row < rows; ++row) {
+        std::memcpy(&thirdHopSentTime_[size_ + row], &wire[row * WIRE_SIZE + WIRE_OFFSET[14U]], sizeof(int64_t));
+    }
+    size_ += rows;
+    return rows;
+}
+
+std::size_t FinalCalcTrackDataBatch::encode(std::size_t first, std::size_t count, uint8_t* out, std::size_t outCapacity) const noexcept {
+    if (first > size_ || count > size_ - first || out == nullptr || outCapacity / WIRE_SIZE < count) {
+        return 0U;
+    }
+    for (std::size_t row = 0U; row < count; ++row) {
+        std::memcpy(&out[row * WIRE_SIZE + WIRE_OFFSET[0U]], &trackId_[first + row], sizeof(int32_t));
+    }
+    for (std::size_t row = 0U; row < count; ++row) {
+        std::memcpy(&out[row * WIRE_SIZE + WIRE_OFFSET[1U]], &xVelocityECEF_[first + row], sizeof(double));
+    }
+    for (std::size_t row = 0U; row < count; ++row) {
+        std::memcpy(&out[row * WIRE_SIZE + WIRE_OFFSET[2U]], &yVelocityECEF_[first + row], sizeof(double));
+    }
+    for (std::size_t row = 0U; row < count; ++row) {
+        std::memcpy(&out[row * WIRE_SIZE + WIRE_OFFSET[3U]], &zVelocityECEF_[first + row], sizeof(double));
+    }
+    for (std::size_t row = 0U; row < count; ++row) {
+        std::memcpy(&out[row * WIRE_SIZE + WIRE_OFFSET[4U]], &xPositionECEF_[first + row], sizeof(double));
+    }
+    for (std::size_t row = 0U; row < count; ++row) {
+        std::memcpy(&out[row * WIRE_SIZE + WIRE_OFFSET[5U]], &yPositionECEF_[first + row], sizeof(double));
+    }
+    for (std::size_t row = 0U; row < count; ++row) {
+        std::memcpy(&out[row * WIRE_SIZE + WIRE_OFFSET[6U]], &zPositionECEF_[first + row], sizeof(double));
+    }
+    for (std::size_t row = 0U; row < count; ++row) {
+        std::memcpy(&out[row * WIRE_SIZE + WIRE_OFFSET[7U]], &originalUpdateTime_[first + row], sizeof(int64_t));
+    }
+    for (std::size_t row = 0U; row < count; ++row) {
+        std::memcpy(&out[row * WIRE_SIZE + WIRE_OFFSET[8U]], &updateTime_[first + row], sizeof(int64_t));
+    }
+    for (std::size_t row = 0U; row < count; ++row) {
+        std::memcpy(&out[row * WIRE_SIZE + WIRE_OFFSET[9U]], &firstHopSentTime_[first + row], sizeof(int64_t));
+    }
+    for (std::size_t row = 0U; row < count; ++row) {
+        std::memcpy(&out[row * WIRE_SIZE + WIRE_OFFSET[10U]], &firstHopDelayTime_[first + row], sizeof(int64_t));
+    }
+    for (std::size_t row = 0U; row < count; ++row) {
+        std::memcpy(&out[row * WIRE_SIZE + WIRE_OFFSET[11U]], &secondHopSentTime_[first + row], sizeof(int64_t));
+    }
+    for (std::size_t row = 0U; row < count; ++row) {
+        std::memcpy(&out[row * WIRE_SIZE + WIRE_OFFSET[12U]], &secondHopDelayTime_[first + row], sizeof(int64_t));
+    }
+    for (std::size_t row = 0U; row < count; ++row) {
+        std::memcpy(&out[row * WIRE_SIZE + WIRE_OFFSET[13U]], &totalDelayTime_[first + row], sizeof(int64_t));
+    }
+    for (std::size_t row = 0U; row < count; ++row) {
+        std::memcpy(&out[row * WIRE_SIZE + WIRE_OFFSET[14U]], &thirdHopSentTime_[first + row], sizeof(int64_t));
+    }
+    return count * WIRE_SIZE;
+}
@@ -0,0 +1,196 @@
+#pragma once
+
+// MISRA C++ 2023 compliant includes
+#include "FinalCalcTrackData.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+
+/**
+ * @brief Column-per-field (SoA) batch of FinalCalcTrackData records
+ * Auto-generated from FinalCalcTrackData.json
+ * Every field is one FinalCalcTrackDataBatch::COLUMN_ALIGNMENT-byte aligned array of capacity() values,
+ * so batch kernels loop over a column instead of calling getters per record.
+ * decode()/encode() read and write the packed record layout of FinalCalcTrackData::serialize().
+ */
+class FinalCalcTrackDataBatch final {
+public:
+    static constexpr std::size_t COLUMN_ALIGNMENT = 64U;
+    /// Bytes of one packed wire record
+    static constexpr std::size_t WIRE_SIZE = 116U;
+
+    /// Row proxy: the batch and an index; accessors are references into the columns
+    class Row final {
+    public:
+        Row(FinalCalcTrackDataBatch* batch, std::size_t index) noexcept : batch_(batch), index_(index) {}
+        std::size_t index() const noexcept { return index_; }
+        int32_t& trackId() const noexcept { return batch_->trackId_[index_]; }
+        double& xVelocityECEF() const noexcept { return batch_->xVelocityECEF_[index_]; }
+        double& yVelocityECEF() const noexcept { return batch_->yVelocityECEF_[index_]; }
+        double& zVelocityECEF() const noexcept { return batch_->zVelocityECEF_[index_]; }
+        double& xPositionECEF() const noexcept { return batch_->xPositionECEF_[index_]; }
+        double& yPositionECEF() const noexcept { return batch_->yPositionECEF_[index_]; }
+        double& zPositionECEF() const noexcept { return batch_->zPositionECEF_[index_]; }
+        int64_t& originalUpdateTime() const noexcept { return batch_->originalUpdateTime_[index_]; }
+        int64_t& updateTime() const noexcept { return batch_->updateTime_[index_]; }
+        int64_t& firstHopSentTime() const noexcept { return batch_->firstHopSentTime_[index_]; }
+        int64_t& firstHopDelayTime() const noexcept { return batch_->firstHopDelayTime_[index_]; }
+        int64_t& secondHopSentTime() const noexcept { return batch_->secondHopSentTime_[index_]; }
+        int64_t& secondHopDelayTime() const noexcept { return batch_->secondHopDelayTime_[index_]; }
+        int64_t& totalDelayTime() const noexcept { return batch_->totalDelayTime_[index_]; }
+        int64_t& thirdHopSentTime() const noexcept { return batch_->thirdHopSentTime_[index_]; }
+
+    private:
+        FinalCalcTrackDataBatch* batch_;
+        std::size_t index_;
+    };
+
+    /// Read-only row proxy
+    class ConstRow final {
+    public:
+        ConstRow(const FinalCalcTrackDataBatch* batch, std::size_t index) noexcept : batch_(batch), index_(index) {}
+        std::size_t index() const noexcept { return index_; }
+        int32_t trackId() const noexcept { return batch_->trackId_[index_]; }
+        double xVelocityECEF() const noexcept { return batch_->xVelocityECEF_[index_]; }
+        double yVelocityECEF() const noexcept { return batch_->yVelocityECEF_[index_]; }
+        double zVelocityECEF() const noexcept { return batch_->zVelocityECEF_[index_]; }
+        double xPositionECEF() const noexcept { return batch_->xPositionECEF_[index_]; }
+        double yPositionECEF() const noexcept { return batch_->yPositionECEF_[index_]; }
+        double zPositionECEF() const noexcept { return batch_->zPositionECEF_[index_]; }
+        int64_t originalUpdateTime() const noexcept { return batch_->originalUpdateTime_[index_]; }
+        int64_t updateTime() const noexcept { return batch_->updateTime_[index_]; }
+        int64_t firstHopSentTime() const noexcept { return batch_->firstHopSentTime_[index_]; }
+        int64_t firstHopDelayTime() const noexcept { return batch_->firstHopDelayTime_[index_]; }
+        int64_t secondHopSentTime() const noexcept { return batch_->secondHopSentTime_[index_]; }
+        int64_t secondHopDelayTime() const noexcept { return batch_->secondHopDelayTime_[index_]; }
+        int64_t totalDelayTime() const noexcept { return batch_->totalDelayTime_[index_]; }
+        int64_t thirdHopSentTime() const noexcept { return batch_->thirdHopSentTime_[index_]; }
+
+    private:
+        const FinalCalcTrackDataBatch* batch_;
+        std::size_t index_;
+    };
+
+    /// Forward iterator yielding row proxies by value
+    template <typename BatchPointer, typename RowProxy>
+    class RowIterator final {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = RowProxy;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = RowProxy;
+
+        RowIterator(BatchPointer batch, std::size_t index) noexcept : batch_(batch), index_(index) {}
+        RowProxy operator*() const noexcept { return RowProxy(batch_, index_); }
+        RowIterator& operator++() noexcept { ++index_; return *this; }
+        RowIterator operator++(int) noexcept { RowIterator previous = *this; ++index_; return previous; }
+        bool operator==(const RowIterator& other) const noexcept { return index_ == other.index_; }
+        bool operator!=(const RowIterator& other) const noexcept { return index_ != other.index_; }
+
+    private:
+        BatchPointer batch_;
+        std::size_t index_;
+    };
+
+    using iterator = RowIterator<FinalCalcTrackDataBatch*, Row>;
+    using const_iterator = RowIterator<const FinalCalcTrackDataBatch*, ConstRow>;
+
+    /// One allocation holds every column; @throws std::invalid_argument for a zero capacity
+    explicit FinalCalcTrackDataBatch(std::size_t capacity);
+
+    // Columns point into the arena: no copies, moves keep the arena
+    FinalCalcTrackDataBatch(const FinalCalcTrackDataBatch& other) = delete;
+    FinalCalcTrackDataBatch& operator=(const FinalCalcTrackDataBatch& other) = delete;
+    FinalCalcTrackDataBatch(FinalCalcTrackDataBatch&& other) noexcept = default;
+    FinalCalcTrackDataBatch& operator=(FinalCalcTrackDataBatch&& other) noexcept = default;
+    ~FinalCalcTrackDataBatch() = default;
+
+    std::size_t size() const noexcept { return size_; }
+    std::size_t capacity() const noexcept { return capacity_; }
+    bool empty() const noexcept { return size_ == 0U; }
+    bool full() const noexcept { return size_ == capacity_; }
+    void clear() noexcept { size_ = 0U; }
+
+    /// Adds up to count rows with unspecified values, for kernels that fill columns; returns rows added
+    std::size_t extend(std::size_t count) noexcept;
+
+    // Columns: capacity() values each, the first size() in use
+    int32_t* trackIdColumn() noexcept { return trackId_; }
+    const int32_t* trackIdColumn() const noexcept { return trackId_; }
+    double* xVelocityECEFColumn() noexcept { return xVelocityECEF_; }
+    const double* xVelocityECEFColumn() const noexcept { return xVelocityECEF_; }
+    double* yVelocityECEFColumn() noexcept { return yVelocityECEF_; }
+    const double* yVelocityECEFColumn() const noexcept { return yVelocityECEF_; }
+    double* zVelocityECEFColumn() noexcept { return zVelocityECEF_; }
+    const double* zVelocityECEFColumn() const noexcept { return zVelocityECEF_; }
+    double* xPositionECEFColumn() noexcept { return xPositionECEF_; }
+    const double* xPositionECEFColumn() const noexcept { return xPositionECEF_; }
+    double* yPositionECEFColumn() noexcept { return yPositionECEF_; }
+    const double* yPositionECEFColumn() const noexcept { return yPositionECEF_; }
+    double* zPositionECEFColumn() noexcept { return zPositionECEF_; }
+    const double* zPositionECEFColumn() const noexcept { return zPositionECEF_; }
+    int64_t* originalUpdateTimeColumn() noexcept { return originalUpdateTime_; }
+    const int64_t* originalUpdateTimeColumn() const noexcept { return originalUpdateTime_; }
+    int64_t* updateTimeColumn() noexcept { return updateTime_; }
+    const int64_t* updateTimeColumn() const noexcept { return updateTime_; }
+    int64_t* firstHopSentTimeColumn() noexcept { return firstHopSentTime_; }
+    const int64_t* firstHopSentTimeColumn() const noexcept { return firstHopSentTime_; }
+    int64_t* firstHopDelayTimeColumn() noexcept { return firstHopDelayTime_; }
+    const int64_t* firstHopDelayTimeColumn() const noexcept { return firstHopDelayTime_; }
+    int64_t* secondHopSentTimeColumn() noexcept { return secondHopSentTime_; }
+    const int64_t* secondHopSentTimeColumn() const noexcept { return secondHopSentTime_; }
+    int64_t* secondHopDelayTimeColumn() noexcept { return secondHopDelayTime_; }
+    const int64_t* secondHopDelayTimeColumn() const noexcept { return secondHopDelayTime_; }
+    int64_t* totalDelayTimeColumn() noexcept { return totalDelayTime_; }
+    const int64_t* totalDelayTimeColumn() const noexcept { return totalDelayTime_; }
+    int64_t* thirdHopSentTimeColumn() noexcept { return thirdHopSentTime_; }
+    const int64_t* thirdHopSentTimeColumn() const noexcept { return thirdHopSentTime_; }
+
+    // Rows
+    Row operator[](std::size_t index) noexcept { return Row(this, index); }
+    ConstRow operator[](std::size_t index) const noexcept { return ConstRow(this, index); }
+    iterator begin() noexcept { return iterator(this, 0U); }
+    iterator end() noexcept { return iterator(this, size_); }
+    const_iterator begin() const noexcept { return const_iterator(this, 0U); }
+    const_iterator end() const noexcept { return const_iterator(this, size_); }
+
+    /// Appends one record; false if the batch is full
+    bool push(const FinalCalcTrackData& record) noexcept;
+
+    /// Builds the record of one row with FinalCalcTrackData::fromFields (one range check)
+    FinalCalcTrackData::FieldError record(std::size_t index, FinalCalcTrackData& out) const noexcept;
+
+    // Bulk wire codec, one column at a time
+    /// Appends up to count packed records from wire; returns records decoded (stops when full)
+    std::size_t decode(const uint8_t* wire, std::size_t count) noexcept;
+    /// Writes rows [first, first + count) packed into out; returns bytes written, 0 if out is too small
+    std::size_t encode(std::size_t first, std::size_t count, uint8_t* out, std::size_t outCapacity) const noexcept;
+
+private:
+    struct alignas(COLUMN_ALIGNMENT) Line {
+        uint8_t bytes[COLUMN_ALIGNMENT];
+    };
+
+    std::size_t capacity_;
+    std::size_t size_ = 0U;
+    std::unique_ptr<Line[]> arena_;
+
+    // Column pointers into arena_
+    int32_t* trackId_ = nullptr;
+    double* xVelocityECEF_ = nullptr;
+    double* yVelocityECEF_ = nullptr;
+    double* zVelocityECEF_ = nullptr;
+    double* xPositionECEF_ = nullptr;
+    double* yPositionECEF_ = nullptr;
+    double* zPositionECEF_ = nullptr;
+    int64_t* originalUpdateTime_ = nullptr;
+    int64_t* updateTime_ = nullptr;
+    int64_t* firstHopSentTime_ = nullptr;
+    int64_t* firstHopDelayTime_ = nullptr;
+    int64_t* secondHopSentTime_ = nullptr;
+    int64_t* secondHopDelayTime_ = nullptr;
+    int64_t* totalDelayTime_ = nullptr;
+    int64_t* thirdHopSentTime_ = nullptr;
+};
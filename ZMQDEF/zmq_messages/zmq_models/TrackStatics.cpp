@@ -228,26 +228,98 @@ void TrackStatics::setUpdateTime(const int64_t& value) {
     updateTime_ = value;
 }
 
+const char* TrackStatics::fieldErrorName(FieldError error) noexcept {
+    switch (error) {
+        case FieldError::None:
+            return "none";
+        case FieldError::TrackId:
+            return "trackId";
+        case FieldError::FirstHopDelayDataMean:
+            return "firstHopDelayDataMean";
+        case FieldError::FirstHopDelayDataStd:
+            return "firstHopDelayDataStd";
+        case FieldError::FirstHopDelayDataMin:
+            return "firstHopDelayDataMin";
+        case FieldError::FirstHopDelayDataMax:
+            return "firstHopDelayDataMax";
+        case FieldError::SecondHopDelayDataMean:
+            return "secondHopDelayDataMean";
+        case FieldError::SecondHopDelayDataStd:
+            return "secondHopDelayDataStd";
+        case FieldError::SecondHopDelayDataMin:
+            return "secondHopDelayDataMin";
+        case FieldError::SecondHopDelayDataMax:
+            return "secondHopDelayDataMax";
+        case FieldError::TotalHopDelayDataMean:
+            return "totalHopDelayDataMean";
+        case FieldError::TotalHopDelayDataStd:
+            return "totalHopDelayDataStd";
+        case FieldError::TotalHopDelayDataMin:
+            return "totalHopDelayDataMin";
+        case FieldError::TotalHopDelayDataMax:
+            return "totalHopDelayDataMax";
+        case FieldError::UpdateTime:
+            return "updateTime";
+        default:
+            return "unknown";
+    }
+}
+
+TrackStatics::FieldError TrackStatics::fromFields(int32_t trackId, double firstHopDelayDataMean, double firstHopDelayDataStd, double firstHopDelayDataMin, double firstHopDelayDataMax, double secondHopDelayDataMean, double secondHopDelayDataStd, double secondHopDelayDataMin, double secondHopDelayDataMax, double totalHopDelayDataMean, double totalHopDelayDataStd, double totalHopDelayDataMin, double totalHopDelayDataMax, int64_t updateTime) noexcept {
+    trackId_ = trackId;
+    firstHopDelayDataMean_ = firstHopDelayDataMean;
+    firstHopDelayDataStd_ = firstHopDelayDataStd;
+    firstHopDelayDataMin_ = firstHopDelayDataMin;
+    firstHopDelayDataMax_ = firstHopDelayDataMax;
+    secondHopDelayDataMean_ = secondHopDelayDataMean;
+    secondHopDelayDataStd_ = secondHopDelayDataStd;
+    secondHopDelayDataMin_ = secondHopDelayDataMin;
+    secondHopDelayDataMax_ = secondHopDelayDataMax;
+    totalHopDelayDataMean_ = totalHopDelayDataMean;
+    totalHopDelayDataStd_ = totalHopDelayDataStd;
+    totalHopDelayDataMin_ = totalHopDelayDataMin;
+    totalHopDelayDataMax_ = totalHopDelayDataMax;
+    updateTime_ = updateTime;
+    return firstInvalidField();
+}
+
+TrackStatics::FieldError TrackStatics::firstInvalidField() const noexcept {
+    // Bit i set: field i (schema order) is out of range
+    std::uint64_t invalid = 0U;
+
+    // Floating point fields; an all-ones exponent (NaN, Inf) is rejected without std::isnan
+    static constexpr std::size_t REAL_COUNT = 12U;
+    static constexpr double REAL_MIN[REAL_COUNT] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+    static constexpr double REAL_MAX[REAL_COUNT] = {1.0E+6, 1.0E+6, 1.0E+6, 1.0E+6, 1.0E+6, 1.0E+6, 1.0E+6, 1.0E+6, 1.0E+6, 1.0E+6, 1.0E+6, 1.0E+6};
+    static constexpr unsigned REAL_BIT[REAL_COUNT] = {1U, 2U, 3U, 4U, 5U, 6U, 7U, 8U, 9U, 10U, 11U, 12U};
+    const double reals[REAL_COUNT] = {firstHopDelayDataMean_, firstHopDelayDataStd_, firstHopDelayDataMin_, firstHopDelayDataMax_, secondHopDelayDataMean_, secondHopDelayDataStd_, secondHopDelayDataMin_, secondHopDelayDataMax_, totalHopDelayDataMean_, totalHopDelayDataStd_, totalHopDelayDataMin_, totalHopDelayDataMax_};
+    for (std::size_t i = 0U; i < REAL_COUNT; ++i) {
+        std::uint64_t bits = 0U;
+        std::memcpy(&bits, &reals[i], sizeof(bits));
+        const bool outside = ((bits & 0x7FF0000000000000ULL) == 0x7FF0000000000000ULL) |
+                             (reals[i] < REAL_MIN[i]) | (reals[i] > REAL_MAX[i]);
+        invalid |= static_cast<std::uint64_t>(outside) << REAL_BIT[i];
+    }
+
+    // Integer fields, widened to int64_t
+    static constexpr std::size_t INTEGER_COUNT = 2U;
+    static constexpr std::int64_t INTEGER_MIN[INTEGER_COUNT] = {1LL, 0LL};
+    static constexpr std::int64_t INTEGER_MAX[INTEGER_COUNT] = {9999LL, 9223372036854775LL};
+    static constexpr unsigned INTEGER_BIT[INTEGER_COUNT] = {0U, 13U};
+    const std::int64_t integers[INTEGER_COUNT] = {static_cast<std::int64_t>(trackId_), static_cast<std::int64_t>(updateTime_)};
+    for (std::size_t i = 0U; i < INTEGER_COUNT; ++i) {
+        const bool outside = (integers[i] < INTEGER_MIN[i]) | (integers[i] > INTEGER_MAX[i]);
+        invalid |= static_cast<std::uint64_t>(outside) << INTEGER_BIT[i];
+    }
+
+    if (invalid == 0U) {
+        return FieldError::None;
+    }
+    return static_cast<FieldError>(static_cast<std::uint8_t>(__builtin_ctzll(invalid) + 1));
+}
+
 bool TrackStatics::isValid() const noexcept {
-    try {
-        validateTrackId(trackId_);
-        validateFirstHopDelayDataMean(firstHopDelayDataMean_);
-        validateFirstHopDelayDataStd(firstHopDelayDataStd_);
-        validateFirstHopDelayDataMin(firstHopDelayDataMin_);
-        validateFirstHopDelayDataMax(firstHopDelayDataMax_);
-        validateSecondHopDelayDataMean(secondHopDelayDataMean_);
-        validateSecondHopDelayDataStd(secondHopDelayDataStd_);
-        validateSecondHopDelayDataMin(secondHopDelayDataMin_);
-        validateSecondHopDelayDataMax(secondHopDelayDataMax_);
-        validateTotalHopDelayDataMean(totalHopDelayDataMean_);
-        validateTotalHopDelayDataStd(totalHopDelayDataStd_);
-        validateTotalHopDelayDataMin(totalHopDelayDataMin_);
-        validateTotalHopDelayDataMax(totalHopDelayDataMax_);
-        validateUpdateTime(updateTime_);
-        return true;
-    } catch (const std::exception&) {
-        return false;
-    }
+    return firstInvalidField() == FieldError::None;
 }
 
 // MISRA C++ 2023 compliant Binary Serialization Implementation
@@ -342,6 +414,74 @@ std::vector<uint8_t> TrackStatics::serialize() const {
     return buffer;
 }
 
+// Serialization into caller memory (pooled send buffers) - MISRA compliant
+std::size_t TrackStatics::serializeTo(uint8_t* out, std::size_t capacity) const noexcept {
+    const std::size_t size = getSerializedSize();
+    if (out == nullptr || capacity < size) {
+        return 0U;
+    }
+
+    std::size_t offset = 0U;
+
+    // Serialize trackId_
+    std::memcpy(&out[offset], &trackId_, sizeof(trackId_));
+    offset += sizeof(trackId_);
+
+    // Serialize firstHopDelayDataMean_
+    std::memcpy(&out[offset], &firstHopDelayDataMean_, sizeof(firstHopDelayDataMean_));
+    offset += sizeof(firstHopDelayDataMean_);
+
+    // Serialize firstHopDelayDataStd_
+    std::memcpy(&out[offset], &firstHopDelayDataStd_, sizeof(firstHopDelayDataStd_));
+    offset += sizeof(firstHopDelayDataStd_);
+
+    // Serialize firstHopDelayDataMin_
+    std::memcpy(&out[offset], &firstHopDelayDataMin_, sizeof(firstHopDelayDataMin_));
+    offset += sizeof(firstHopDelayDataMin_);
+
+    // Serialize firstHopDelayDataMax_
+    std::memcpy(&out[offset], &firstHopDelayDataMax_, sizeof(firstHopDelayDataMax_));
+    offset += sizeof(firstHopDelayDataMax_);
+
+    // Serialize secondHopDelayDataMean_
+    std::memcpy(&out[offset], &secondHopDelayDataMean_, sizeof(secondHopDelayDataMean_));
+    offset += sizeof(secondHopDelayDataMean_);
+
+    // Serialize secondHopDelayDataStd_
+    std::memcpy(&out[offset], &secondHopDelayDataStd_, sizeof(secondHopDelayDataStd_));
+    offset += sizeof(secondHopDelayDataStd_);
+
+    // Serialize secondHopDelayDataMin_
+    std::memcpy(&out[offset], &secondHopDelayDataMin_, sizeof(secondHopDelayDataMin_));
+    offset += sizeof(secondHopDelayDataMin_);
+
+    // Serialize secondHopDelayDataMax_
+    std::memcpy(&out[offset], &secondHopDelayDataMax_, sizeof(secondHopDelayDataMax_));
+    offset += sizeof(secondHopDelayDataMax_);
+
+    // Serialize totalHopDelayDataMean_
+    std::memcpy(&out[offset], &totalHopDelayDataMean_, sizeof(totalHopDelayDataMean_));
+    offset += sizeof(totalHopDelayDataMean_);
+
+    // Serialize totalHopDelayDataStd_
+    std::memcpy(&out[offset], &totalHopDelayDataStd_, sizeof(totalHopDelayDataStd_));
+    offset += sizeof(totalHopDelayDataStd_);
+
+    // Serialize totalHopDelayDataMin_
+    std::memcpy(&out[offset], &totalHopDelayDataMin_, sizeof(totalHopDelayDataMin_));
+    offset += sizeof(totalHopDelayDataMin_);
+
+    // Serialize totalHopDelayDataMax_
+    std::memcpy(&out[offset], &totalHopDelayDataMax_, sizeof(totalHopDelayDataMax_));
+    offset += sizeof(totalHopDelayDataMax_);
+
+    // Serialize updateTime_
+    std::memcpy(&out[offset], &updateTime_, sizeof(updateTime_));
+    offset += sizeof(updateTime_);
+
+    return offset;
+}
+
 bool TrackStatics::deserialize(const std::vector<uint8_t>& data) noexcept {
     if (data.size() < getSerializedSize()) {
         return false;
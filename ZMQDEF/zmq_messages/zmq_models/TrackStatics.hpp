@@ -19,6 +19,7 @@ public:
     // Network configuration constants
     static constexpr const char* MULTICAST_ADDRESS = "239.1.1.5";
     static constexpr int PORT = 9599;
+    static constexpr const char* SOCKET_PROFILE = "throughput";
     
     // ZeroMQ RADIO socket configuration (outgoing)
     static constexpr const char* ZMQ_SOCKET_TYPE = "RADIO";
@@ -85,11 +86,39 @@ public:
     int64_t getUpdateTime() const noexcept;
     void setUpdateTime(const int64_t& value);
 
+    // Validation result: the first out-of-range field, in schema order
+    enum class FieldError : std::uint8_t {
+        None = 0U,
+        TrackId,
+        FirstHopDelayDataMean,
+        FirstHopDelayDataStd,
+        FirstHopDelayDataMin,
+        FirstHopDelayDataMax,
+        SecondHopDelayDataMean,
+        SecondHopDelayDataStd,
+        SecondHopDelayDataMin,
+        SecondHopDelayDataMax,
+        TotalHopDelayDataMean,
+        TotalHopDelayDataStd,
+        TotalHopDelayDataMin,
+        TotalHopDelayDataMax,
+        UpdateTime,
+    };
+    [[nodiscard]] static const char* fieldErrorName(FieldError error) noexcept;
+
+    // Exception-free construction - MISRA compliant
+    /// Sets every field, then checks the whole record once; on an error the record holds the rejected values
+    [[nodiscard]] FieldError fromFields(int32_t trackId, double firstHopDelayDataMean, double firstHopDelayDataStd, double firstHopDelayDataMin, double firstHopDelayDataMax, double secondHopDelayDataMean, double secondHopDelayDataStd, double secondHopDelayDataMin, double secondHopDelayDataMax, double totalHopDelayDataMean, double totalHopDelayDataStd, double totalHopDelayDataMin, double totalHopDelayDataMax, int64_t updateTime) noexcept;
+    /// One pass over every field without exceptions; FieldError::None if the record is valid
+    [[nodiscard]] FieldError firstInvalidField() const noexcept;
+
     // Validation - MISRA compliant
     [[nodiscard]] bool isValid() const noexcept;
 
     // Binary Serialization - MISRA compliant
     [[nodiscard]] std::vector<uint8_t> serialize() const;
+    /// Writes the same bytes as serialize() into out; returns 0 if capacity is too small
+    std::size_t serializeTo(uint8_t* out, std::size_t capacity) const noexcept;
     bool deserialize(const std::vector<uint8_t>& data) noexcept;
     [[nodiscard]] std::size_t getSerializedSize() const noexcept;
 
@@ -0,0 +1,200 @@
+#include "TrackStaticsBatch.hpp"
+
+#include <cstring>
+#include <stdexcept>
+
+namespace {
+
+// Offset of each field in a packed record, in schema order
+constexpr std::size_t WIRE_OFFSET[14U] = {0U, 4U, 12U, 20U, 28U, 36U, 44U, 52U, 60U, 68U, 76U, 84U, 92U, 100U};
+
+// Bytes of one column of capacity values, rounded up to whole aligned lines
+std::size_t columnLines(std::size_t capacity, std::size_t valueSize) noexcept {
+    const std::size_t bytes = capacity * valueSize;
+    return (bytes + TrackStaticsBatch::COLUMN_ALIGNMENT - 1U) / TrackStaticsBatch::COLUMN_ALIGNMENT;
+}
+
+} // namespace
+
+TrackStaticsBatch::TrackStaticsBatch(std::size_t capacity)
+    : capacity_(capacity) {
+    if (capacity == 0U) {
+        throw std::invalid_argument("TrackStaticsBatch capacity must be positive");
+    }
+    std::size_t lines = 0U;
+    lines += columnLines(capacity, sizeof(int32_t));
+    lines += columnLines(capacity, sizeof(double));
+    lines += columnLines(capacity, sizeof(double));
+    lines += columnLines(capacity, sizeof(double));
+    lines += columnLines(capacity, sizeof(double));
+    lines += columnLines(capacity, sizeof(double));
+    lines += columnLines(capacity, sizeof(double));
+    lines += columnLines(capacity, sizeof(double));
+    lines += columnLines(capacity, sizeof(double));
+    lines += columnLines(capacity, sizeof(double));
+    lines += columnLines(capacity, sizeof(double));
+    lines += columnLines(capacity, sizeof(double));
+    lines += columnLines(capacity, sizeof(double));
+    lines += columnLines(capacity, sizeof(int64_t));
+    arena_.reset(new Line[lines]);
+
+    std::size_t line = 0U;
+    trackId_ = reinterpret_cast<int32_t*>(&arena_[line]);
+    line += columnLines(capacity, sizeof(int32_t));
+    firstHopDelayDataMean_ = reinterpret_cast<double*>(&arena_[line]);
+    line += columnLines(capacity, sizeof(double));
+    firstHopDelayDataStd_ = reinterpret_cast<double*>(&arena_[line]);
+    line += columnLines(capacity, sizeof(double));
+    firstHopDelayDataMin_ = reinterpret_cast<double*>(&arena_[line]);
+    line += columnLines(capacity, sizeof(double));
+    firstHopDelayDataMax_ = reinterpret_cast<double*>(&arena_[line]);
+    line += columnLines(capacity, sizeof(double));
+    secondHopDelayDataMean_ = reinterpret_cast<double*>(&arena_[line]);
+    line += columnLines(capacity, sizeof(double));
+    secondHopDelayDataStd_ = reinterpret_cast<double*>(&arena_[line]);
+    line += columnLines(capacity, sizeof(double));
+    secondHopDelayDataMin_ = reinterpret_cast<double*>(&arena_[line]);
+    line += columnLines(capacity, sizeof(double));
+    secondHopDelayDataMax_ = reinterpret_cast<double*>(&arena_[line]);
+    line += columnLines(capacity, sizeof(double));
+    totalHopDelayDataMean_ = reinterpret_cast<double*>(&arena_[line]);
+    line += columnLines(capacity, sizeof(double));
+    totalHopDelayDataStd_ = reinterpret_cast<double*>(&arena_[line]);
+    line += columnLines(capacity, sizeof(double));
+    totalHopDelayDataMin_ = reinterpret_cast<double*>(&arena_[line]);
+    line += columnLines(capacity, sizeof(double));
+    totalHopDelayDataMax_ = reinterpret_cast<double*>(&arena_[line]);
+    line += columnLines(capacity, sizeof(double));
+    updateTime_ = reinterpret_cast<int64_t*>(&arena_[line]);
+}
+
+std::size_t TrackStaticsBatch::extend(std::size_t count) noexcept {
+    const std::size_t room = capacity_ - size_;
+    const std::size_t added = count < room ? count : room;
+    size_ += added;
+    return added;
+}
+
+bool TrackStaticsBatch::push(const TrackStatics& record) noexcept {
+    if (size_ == capacity_) {
+        return false;
+    }
+    trackId_[size_] = record.getTrackId();
+    firstHopDelayDataMean_[size_] = record.getFirstHopDelayDataMean();
+    firstHopDelayDataStd_[size_] = record.getFirstHopDelayDataStd();
+    firstHopDelayDataMin_[size_] = record.getFirstHopDelayDataMin();
+    firstHopDelayDataMax_[size_] = record.getFirstHopDelayDataMax();
+    secondHopDelayDataMean_[size_] = record.getSecondHopDelayDataMean();
+    secondHopDelayDataStd_[size_] = record.getSecondHopDelayDataStd();
+    secondHopDelayDataMin_[size_] = record.getSecondHopDelayDataMin();
+    secondHopDelayDataMax_[size_] = record.getSecondHopDelayDataMax();
+    totalHopDelayDataMean_[size_] = record.getTotalHopDelayDataMean();
+    totalHopDelayDataStd_[size_] = record.getTotalHopDelayDataStd();
+    totalHopDelayDataMin_[size_] = record.getTotalHopDelayDataMin();
+    totalHopDelayDataMax_[size_] = record.getTotalHopDelayDataMax();
+    updateTime_[size_] = record.getUpdateTime();
+    ++size_;
+    return true;
+}
+
+TrackStatics::FieldError TrackStaticsBatch::record(std::size_t index, TrackStatics& out) const noexcept {
+    return out.fromFields(trackId_[index], firstHopDelayDataMean_[index], firstHopDelayDataStd_[index], firstHopDelayDataMin_[index], firstHopDelayDataMax_[index], secondHopDelayDataMean_[index], secondHopDelayDataStd_[index], secondHopDelayDataMin_[index], secondHopDelayDataMax_[index], totalHopDelayDataMean_[index], totalHopDelayDataStd_[index], totalHopDelayDataMin_[index], totalHopDelayDataMax_[index], updateTime_[index]);
+}
+
+std::size_t TrackStaticsBatch::decode(const uint8_t* wire, std::size_t count) noexcept {
+    const std::size_t room = capacity_ - size_;
+    const std::size_t rows = count < room ? count : room;
+    for (std::size_t row = 0U; row < rows; ++row) {
+        std::memcpy(&trackId_[size_ + row], &wire[row * WIRE_SIZE + WIRE_OFFSET[0U]], sizeof(int32_t));
+    }
+    for (std::size_t row = 0U; row < rows; ++row) {
+        std::memcpy(&firstHopDelayDataMean_[size_ + row], &wire[row * WIRE_SIZE + WIRE_OFFSET[1U]], sizeof(double));
+    }
+    for (std::size_t row = 0U; row < rows; ++row) {
+        std::memcpy(&firstHopDelayDataStd_[size_ + row], &wire[row * WIRE_SIZE + WIRE_OFFSET[2U]], sizeof(double));
+    }
+    for (std::size_t row = 0U; row < rows; ++row) {
+        std::memcpy(&firstHopDelayDataMin_[size_ + row], &wire[row * WIRE_SIZE + WIRE_OFFSET[3U]], sizeof(double));
+    }
+    for (std::size_t row = 0U; row < rows; ++row) {
+        std::memcpy(&firstHopDelayDataMax_[size_ + row], &wire[row * WIRE_SIZE + WIRE_OFFSET[4U]], sizeof(double));
+    }
+    for (std::size_t row = 0U; row < rows; ++row) {
+        std::memcpy(&secondHopDelayDataMean_[size_ + row], &wire[row * WIRE_SIZE + WIRE_OFFSET[5U]], sizeof(double));
+    }
+    for (std::size_t row = 0U; row < rows; ++row) {
+        std::memcpy(&secondHopDelayDataStd_[size_ + row], &wire[row * WIRE_SIZE + WIRE_OFFSET[6U]], sizeof(double));
+    }
+    for (std::size_t row = 0U; row < rows; ++row) {
+        std::memcpy(&secondHopDelayDataMin_[size_ + row], &wire[row * WIRE_SIZE + WIRE_OFFSET[7U]], sizeof(double));
+    }
+    for (std::size_t row = 0U; row < rows; ++row) {
+        std::memcpy(&secondHopDelayDataMax_[size_ + row], &wire[row * WIRE_SIZE + WIRE_OFFSET[8U]], sizeof(double));
+    }
+    for (std::size_t row = 0U; row < rows; ++row) {
+        std::memcpy(&totalHopDelayDataMean_[size_ + row], &wire[row * WIRE_SIZE + WIRE_OFFSET[9U]], sizeof(double));
+    }
+    for (std::size_t row = 0U; row < rows; ++row) {
+        std::memcpy(&totalHopDelayDataStd_[size_ + row], &wire[row * WIRE_SIZE + WIRE_OFFSET[10U]], sizeof(double));
+    }
+    for (std::size_t row = 0U; row < rows; ++row) {
+        std::memcpy(&totalHopDelayDataMin_[size_ + row], &wire[row * WIRE_SIZE + WIRE_OFFSET[11U]], sizeof(double));
+    }
+    for (std::size_t row = 0U; row < rows; ++row) {
+        std::memcpy(&totalHopDelayDataMax_[size_ + row], &wire[row * WIRE_SIZE + WIRE_OFFSET[12U]], sizeof(double));
+    }
+    for (std::size_t row = 0U; row < rows; ++row) {
+        std::memcpy(&updateTime_[size_ + row], &wire[row * WIRE_SIZE + WIRE_OFFSET[13U]], sizeof(int64_t));
+    }
+    size_ += rows;
+    return rows;
+}
+
+std::size_t TrackStaticsBatch::encode(std::size_t first, std::size_t count, uint8_t* out, std::size_t outCapacity) const noexcept {
+    if (first > size_ || count > size_ - first || out == nullptr || outCapacity / WIRE_SIZE < count) {
+        return 0U;
+    }
+    for (std::size_t row = 0U; row < count; ++row) {
+        std::memcpy(&out[row * WIRE_SIZE + WIRE_OFFSET[0U]], &trackId_[first + row], sizeof(int32_t));
+    }
+    for (std::size_t row = 0U; row < count; ++row) {
+        std::memcpy(&out[row * WIRE_SIZE + WIRE_OFFSET[1U]], &firstHopDelayDataMean_[first + row], sizeof(double));
+    }
+    for (std::size_t row = 0U; row < count; ++row) {
+        std::memcpy(&out[row * WIRE_SIZE + WIRE_OFFSET[2U]], &firstHopDelayDataStd_[first + row], sizeof(double));
+    }
+    for (std::size_t row = 0U; row < count; ++row) {
+        std::memcpy(&out[row * WIRE_SIZE + WIRE_OFFSET[3U]], &firstHopDelayDataMin_[first + row], sizeof(double));
+    }
+    for (std::size_t row = 0U; row < count; ++row) {
+        std::memcpy(&out[row * WIRE_SIZE + WIRE_OFFSET[4U]], &firstHopDelayDataMax_[first + row], sizeof(double));
+    }
+    for (std::size_t row = 0U; row < count; ++row) {
+        std::memcpy(&out[row * WIRE_SIZE + WIRE_OFFSET[5U]], &secondHopDelayDataMean_[first + row], sizeof(double));
+    }
+    for (std::size_t row = 0U; row < count; ++row) {
+        std::memcpy(&out[row * WIRE_SIZE + WIRE_OFFSET[6U]], &secondHopDelayDataStd_[first + row], sizeof(double));
+    }
+    for (std::size_t row = 0U; row < count; ++row) {
+        std::memcpy(&out[row * WIRE_SIZE + WIRE_OFFSET[7U]], &secondHopDelayDataMin_[first + row], sizeof(double));
+    }
+    for (std::size_t row = 0U; row < count; ++row) {
+        std::memcpy(&out[row * WIRE_SIZE + WIRE_OFFSET[8U]], &secondHopDelayDataMax_[first + row], sizeof(double));
+    }
+    for (std::size_t row = 0U; row < count; ++row) {
+        std::memcpy(&out[row * WIRE_SIZE + WIRE_OFFSET[9U]], &totalHopDelayDataMean_[first + row], sizeof(double));
+    }
+    for (std::size_t row = 0U; row < count; ++row) {
+        std::memcpy(&out[row * WIRE_SIZE + WIRE_OFFSET[10U]], &totalHopDelayDataStd_[first + row], sizeof(double));
+    }
+    for (std::size_t row = 0U; row < count; ++row) {
+        std::memcpy(&out[row * WIRE_SIZE + WIRE_OFFSET[11U]], &totalHopDelayDataMin_[first + row], sizeof(double));
+    }
+    for (std::size_t row = 0U; row < count; ++row) {
+        std::memcpy(&out[row * WIRE_SIZE + WIRE_OFFSET[12U]], &totalHopDelayDataMax_[first + row], sizeof(double));
+    }
+    for (std::size_t row = 0U; row < count; ++row) {
+        std::memcpy(&out[row * WIRE_SIZE + WIRE_OFFSET[13U]], &updateTime_[first + row], sizeof(int64_t));
+    }
+    return count * WIRE_SIZE;
+}
@@ -0,0 +1,191 @@
+#pragma once
+
+// MISRA C++ 2023 compliant includes
+#include "TrackStatics.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+
+/**
+ * @brief Column-per-field (SoA) batch of TrackStatics records
+ * Auto-generated from TrackStatics.json
+ * Every field is one TrackStaticsBatch::COLUMN_ALIGNMENT-byte aligned array of capacity() values,
+ * so batch kernels loop over a column instead of calling getters per record.
+ * decode()/encode() read and write the packed record layout of TrackStatics::serialize().
+ */
+class TrackStaticsBatch final {
+public:
+    static constexpr std::size_t COLUMN_ALIGNMENT = 64U;
+    /// Bytes of one packed wire record
+    static constexpr std::size_t WIRE_SIZE = 108U;
+
+    /// Row proxy: the batch and an index; accessors are references into the columns
+    class Row final {
+    public:
+        Row(TrackStaticsBatch* batch, std::size_t index) noexcept : batch_(batch), index_(index) {}
+        std::size_t index() const noexcept { return index_; }
+        int32_t& trackId() const noexcept { return batch_->trackId_[index_]; }
+        double& firstHopDelayDataMean() const noexcept { return batch_->firstHopDelayDataMean_[index_]; }
+        double& firstHopDelayDataStd() const noexcept { return batch_->firstHopDelayDataStd_[index_]; }
+        double& firstHopDelayDataMin() const noexcept { return batch_->firstHopDelayDataMin_[index_]; }
+        double& firstHopDelayDataMax() const noexcept { return batch_->firstHopDelayDataMax_[index_]; }
+        double& secondHopDelayDataMean() const noexcept { return batch_->secondHopDelayDataMean_[index_]; }
+        double& secondHopDelayDataStd() const noexcept { return batch_->secondHopDelayDataStd_[index_]; }
+        double& secondHopDelayDataMin() const noexcept { return batch_->secondHopDelayDataMin_[index_]; }
+        double& secondHopDelayDataMax() const noexcept { return batch_->secondHopDelayDataMax_[index_]; }
+        double& totalHopDelayDataMean() const noexcept { return batch_->totalHopDelayDataMean_[index_]; }
+        double& totalHopDelayDataStd() const noexcept { return batch_->totalHopDelayDataStd_[index_]; }
+        double& totalHopDelayDataMin() const noexcept { return batch_->totalHopDelayDataMin_[index_]; }
+        double& totalHopDelayDataMax() const noexcept { return batch_->totalHopDelayDataMax_[index_]; }
+        int64_t& updateTime() const noexcept { return batch_->updateTime_[index_]; }
+
+    private:
+        TrackStaticsBatch* batch_;
+        std::size_t index_;
+    };
+
+    /// Read-only row proxy
+    class ConstRow final {
+    public:
+        ConstRow(const TrackStaticsBatch* batch, std::size_t index) noexcept : batch_(batch), index_(index) {}
+        std::size_t index() const noexcept { return index_; }
+        int32_t trackId() const noexcept { return batch_->trackId_[index_]; }
+        double firstHopDelayDataMean() const noexcept { return batch_->firstHopDelayDataMean_[index_]; }
+        double firstHopDelayDataStd() const noexcept { return batch_->firstHopDelayDataStd_[index_]; }
+        double firstHopDelayDataMin() const noexcept { return batch_->firstHopDelayDataMin_[index_]; }
+        double firstHopDelayDataMax() const noexcept { return batch_->firstHopDelayDataMax_[index_]; }
+        double secondHopDelayDataMean() const noexcept { return batch_->secondHopDelayDataMean_[index_]; }
+        double secondHopDelayDataStd() const noexcept { return batch_->secondHopDelayDataStd_[index_]; }
+        double secondHopDelayDataMin() const noexcept { return batch_->secondHopDelayDataMin_[index_]; }
+        double secondHopDelayDataMax() const noexcept { return batch_->secondHopDelayDataMax_[index_]; }
+        double totalHopDelayDataMean() const noexcept { return batch_->totalHopDelayDataMean_[index_]; }
+        double totalHopDelayDataStd() const noexcept { return batch_->totalHopDelayDataStd_[index_]; }
+        double totalHopDelayDataMin() const noexcept { return batch_->totalHopDelayDataMin_[index_]; }
+        double totalHopDelayDataMax() const noexcept { return batch_->totalHopDelayDataMax_[index_]; }
+        int64_t updateTime() const noexcept { return batch_->updateTime_[index_]; }
+
+    private:
+        const TrackStaticsBatch* batch_;
+        std::size_t index_;
+    };
+
+    /// Forward iterator yielding row proxies by value
+    template <typename BatchPointer, typename RowProxy>
+    class RowIterator final {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = RowProxy;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = RowProxy;
+
+        RowIterator(BatchPointer batch, std::size_t index) noexcept : batch_(batch), index_(index) {}
+        RowProxy operator*() const noexcept { return RowProxy(batch_, index_); }
+        RowIterator& operator++() noexcept { ++index_; return *this; }
+        RowIterator operator++(int) noexcept { RowIterator previous = *this; ++index_; return previous; }
+        bool operator==(const RowIterator& other) const noexcept { return index_ == other.index_; }
+        bool operator!=(const RowIterator& other) const noexcept { return index_ != other.index_; }
+
+    private:
+        BatchPointer batch_;
+        std::size_t index_;
+    };
+
+    using iterator = RowIterator<TrackStaticsBatch*, Row>;
+    using const_iterator = RowIterator<const TrackStaticsBatch*, ConstRow>;
+
+    /// One allocation holds every column; @throws std::invalid_argument for a zero capacity
+    explicit TrackStaticsBatch(std::size_t capacity);
+
+    // Columns point into the arena: no copies, moves keep the arena
+    TrackStaticsBatch(const TrackStaticsBatch& other) = delete;
+    TrackStaticsBatch& operator=(const TrackStaticsBatch& other) = delete;
+    TrackStaticsBatch(TrackStaticsBatch&& other) noexcept = default;
+    TrackStaticsBatch& operator=(TrackStaticsBatch&& other) noexcept = default;
+    ~TrackStaticsBatch() = default;
+
+    std::size_t size() const noexcept { return size_; }
+    std::size_t capacity() const noexcept { return capacity_; }
+    bool empty() const noexcept { return size_ == 0U; }
+    bool full() const noexcept { return size_ == capacity_; }
+    void clear() noexcept { size_ = 0U; }
+
+    /// Adds up to count rows with unspecified values, for kernels that fill columns; returns rows added
+    std::size_t extend(std::size_t count) noexcept;
+
+    // Columns: capacity() values each, the first size() in use
+    int32_t* trackIdColumn() noexcept { return trackId_; }
+    const int32_t* trackIdColumn() const noexcept { return trackId_; }
+    double* firstHopDelayDataMeanColumn() noexcept { return firstHopDelayDataMean_; }
+    const double* firstHopDelayDataMeanColumn() const noexcept { return firstHopDelayDataMean_; }
+    double* firstHopDelayDataStdColumn() noexcept { return firstHopDelayDataStd_; }
+    const double* firstHopDelayDataStdColumn() const noexcept { return firstHopDelayDataStd_; }
+    double* firstHopDelayDataMinColumn() noexcept { return firstHopDelayDataMin_; }
+    const double* firstHopDelayDataMinColumn() const noexcept { return firstHopDelayDataMin_; }
+    double* firstHopDelayDataMaxColumn() noexcept { return firstHopDelayDataMax_; }
+    const double* firstHopDelayDataMaxColumn() const noexcept { return firstHopDelayDataMax_; }
+    double* secondHopDelayDataMeanColumn() noexcept { return secondHopDelayDataMean_; }
+    const double* secondHopDelayDataMeanColumn() const noexcept { return secondHopDelayDataMean_; }
+    double* secondHopDelayDataStdColumn() noexcept { return secondHopDelayDataStd_; }
+    const double* secondHopDelayDataStdColumn() const noexcept { return secondHopDelayDataStd_; }
+    double* secondHopDelayDataMinColumn() noexcept { return secondHopDelayDataMin_; }
+    const double* secondHopDelayDataMinColumn() const noexcept { return secondHopDelayDataMin_; }
+    double* secondHopDelayDataMaxColumn() noexcept { return secondHopDelayDataMax_; }
+    const double* secondHopDelayDataMaxColumn() const noexcept { return secondHopDelayDataMax_; }
+    double* totalHopDelayDataMeanColumn() noexcept { return totalHopDelayDataMean_; }
+    const double* totalHopDelayDataMeanColumn() const noexcept { return totalHopDelayDataMean_; }
+    double* totalHopDelayDataStdColumn() noexcept { return totalHopDelayDataStd_; }
+    const double* totalHopDelayDataStdColumn() const noexcept { return totalHopDelayDataStd_; }
+    double* totalHopDelayDataMinColumn() noexcept { return totalHopDelayDataMin_; }
+    const double* totalHopDelayDataMinColumn() const noexcept { return totalHopDelayDataMin_; }
+    double* totalHopDelayDataMaxColumn() noexcept { return totalHopDelayDataMax_; }
+    const double* totalHopDelayDataMaxColumn() const noexcept { return totalHopDelayDataMax_; }
+    int64_t* updateTimeColumn() noexcept { return updateTime_; }
+    const int64_t* updateTimeColumn() const noexcept { return updateTime_; }
+
+    // Rows
+    Row operator[](std::size_t index) noexcept { return Row(this, index); }
+    ConstRow operator[](std::size_t index) const noexcept { return ConstRow(this, index); }
+    iterator begin() noexcept { return iterator(this, 0U); }
+    iterator end() noexcept { return iterator(this, size_); }
+    const_iterator begin() const noexcept { return const_iterator(this, 0U); }
+    const_iterator end() const noexcept { return const_iterator(this, size_); }
+
+    /// Appends one record; false if the batch is full
+    bool push(const TrackStatics& record) noexcept;
+
+    /// Builds the record of one row with TrackStatics::fromFields (one range check)
+    TrackStatics::FieldError record(std::size_t index, TrackStatics& out) const noexcept;
+
+    // Bulk wire codec, one column at a time
+    /// Appends up to count packed records from wire; returns records decoded (stops when full)
+    std::size_t decode(const uint8_t* wire, std::size_t count) noexcept;
+    /// Writes rows [first, first + count) packed into out; returns bytes written, 0 if out is too small
+    std::size_t encode(std::size_t first, std::size_t count, uint8_t* out, std::size_t outCapacity) const noexcept;
+
+private:
+    struct alignas(COLUMN_ALIGNMENT) Line {
+        uint8_t bytes[COLUMN_ALIGNMENT];
+    };
+
+    std::size_t capacity_;
+    std::size_t size_ = 0U;
+    std::unique_ptr<Line[]> arena_;
+
+    // Column pointers into arena_
+    int32_t* trackId_ = nullptr;
+    double* firstHopDelayDataMean_ = nullptr;
+    double* firstHopDelayDataStd_ = nullptr;
+    double* firstHopDelayDataMin_ = nullptr;
+    double* firstHopDelayDataMax_ = nullptr;
+    double* secondHopDelayDataMean_ = nullptr;
+    double* secondHopDelayDataStd_ = nullptr;
+    double* secondHopDelayDataMin_ = nullptr;
+    double* secondHopDelayDataMax_ = nullptr;
+    double* totalHopDelayDataMean_ = nullptr;
+    double* totalHopDelayDataStd_ = nullptr;
+    double* totalHopDelayDataMin_ = nullptr;
+    double* totalHopDelayDataMax_ = nullptr;
+    int64_t* updateTime_ = nullptr;
+};
@@ -1,5 +1,12 @@
 #include "ZeroMQExtrapTrackDataAdapter.hpp"
 #include "../../utilities/JsonConfigParser.hpp"
+#include "common/PooledMessage.h"
+#include "common/FlightRecorder.h"
+#include "common/TscClock.h"
+#include "common/ScopeTimer.h"
+#include "common/Probes.h"
+#include "common/ZmqSocketProfile.h"
+#include "common/ZmqGroups.h"
 #include <iostream>
 #include <sstream>
 
@@ -15,15 +22,41 @@ ZeroMQExtrapTrackDataAdapter::ZeroMQExtrapTrackDataAdapter()
 }
 
 void ZeroMQExtrapTrackDataAdapter::sendExtrapTrackData(const std::vector<domain::model::ExtrapTrackData>& data) {
+    common::capture::FlightRecorder& flightRecorder = common::capture::FlightRecorder::process();
     for (const auto& item : data) {
-        // Modelin kendi binary serialization'ını kullan
-        std::vector<uint8_t> binaryData = item.serialize();
-        zmq::message_t message(binaryData.begin(), binaryData.end());
+        // Uçuş kaydı: A hexagon'da mesaj hesaplanmış olarak buraya gelir
+        common::capture::FlightEntry flight;
+        flight.trackId = item.getTrackId();
+        flight.sequence = flightRecorder.nextSequence();
+        flight.computeNs = common::timing::TscClock::nowNanos();
+        HEXAGON_PROBE_COMPUTED(flight.trackId, flight.sequence, flight.computeNs);
         
-        // RADIO socket için group belirleme
-        message.set_group(group_name_.c_str());
+        // Havuzdan alınan bloğa doğrudan serialize et (vector ve kopya yok)
+        common::pool::PooledBuffer buffer = common::pool::MessageBufferPool::local().acquire(item.getSerializedSize());
+        std::size_t payloadSize = 0U;
+        {
+            HEXAGON_SCOPE_TIMER("serialize");
+            payloadSize = item.serializeTo(buffer.data(), buffer.capacity());
+        }
+        zmq::message_t message = common::pool::toMessage(buffer, payloadSize);
+        
+        // RADIO socket için group belirleme (bölümlüyse iz/bölge grup id'si)
+        if (groupScheme_.isPartitioned()) {
+            common::groups::setGroupId(message, groupScheme_.groupIdFor(item.getTrackId(), item.getXPositionECEF(),
+                                                                        item.getYPositionECEF(), item.getZPositionECEF()));
+        } else {
+            message.set_group(group_name_.c_str());
+        }
         
-        socket.send(message, zmq::send_flags::none);
+        {
+            HEXAGON_SCOPE_TIMER("send");
+            socket.send(message, zmq::send_flags::none);
+        }
+        flight.sendNs = common::timing::TscClock::nowNanos();
+        flightRecorder.record(flight);
+        sentCount_.add();
+        sendNs_.record(static_cast<std::uint64_t>(flight.sendNs - flight.computeNs));
+        HEXAGON_PROBE_SENT(flight.trackId, flight.sequence, flight.sendNs, flight.sendNs - flight.computeNs);
     }
 }
 
@@ -51,9 +84,21 @@ void ZeroMQExtrapTrackDataAdapter::loadConfiguration() {
             endpoint = "udp://239.255.0.1:7779";
         }
         
+        // Grup bölümleme (group_partitioning yoksa tek string grup)
+        groupScheme_ = common::groups::TrackGroupScheme::fromMetadata(group_name_, config);
+        
+        // Kernel socket ayarları (socket_profile ve socket_* anahtarları)
+        const common::net::UdpSocketProfile socketProfile = common::net::UdpSocketProfile::fromMetadata(config);
+        
         // Mevcut socket'i kapat ve yeni socket oluştur
         socket.close();
         socket = zmq::socket_t(context, socketType);
+        if (groupScheme_.isPartitioned()) {
+            common::groups::enableNumericGroups(socket);
+        }
+        // connect'ten önce ayarlanmalı; libzmq UDP socket'i connect'te açar
+        common::net::applySocketProfile(socket, socketProfile);
+        std::cout << "Socket profili: " << socketProfile.toString() << std::endl;
         
     } catch (const std::exception& e) {
         std::cerr << "Konfigürasyon yükleme hatası: " << e.what() << std::endl;
@@ -63,6 +108,7 @@ void ZeroMQExtrapTrackDataAdapter::loadConfiguration() {
         protocol = "udp";
         socketType = ZMQ_RADIO;
         endpoint = "udp://239.255.0.1:7779";
+        groupScheme_ = common::groups::TrackGroupScheme(group_name_);
         socket.close();
         socket = zmq::socket_t(context, socketType);
     }
@@ -11,6 +11,8 @@
 #include <vector>
 #include "../../domain/model/ExtrapTrackData.hpp"
 #include "../../domain/ports/outgoing/TrackDataOutgoingPort.hpp"
+#include "common/TrackGroups.h"
+#include "common/MetricsSegment.h"
 namespace domain {
 namespace adapters {
 namespace outgoing {
@@ -25,7 +27,11 @@ private:
     std::string protocol;
     std::string endpoint;
     std::string group_name_;  // ZeroMQ grup adı (UDP RADIO için)
+    common::groups::TrackGroupScheme groupScheme_{group_name_};  // İz/bölge bazlı grup bölümleme
     int socketType;
+    // hexstat sayaçları; yalnızca gönderen thread yazar
+    common::metrics::Counter sentCount_{common::metrics::MetricsSegment::process().counter("radio.sent")};
+    common::metrics::Histogram sendNs_{common::metrics::MetricsSegment::process().histogram("radio.send_ns")};
     
     void loadConfiguration();
 };
@@ -1,6 +1,8 @@
 #include "domain/logic/TrackDataExtrapolator.hpp"
 #include "adapters/outgoing/ZeroMQExtrapTrackDataAdapter.hpp"
 #include "domain/model/TrackData.hpp"
+#include "common/ClockSync.h"
+#include "common/FlightRecorder.h"
 #include <iostream>
 #include <thread>
 #include <chrono>
@@ -28,6 +30,9 @@ void generateTestData() {
     domain::adapters::outgoing::ZeroMQExtrapTrackDataAdapter outgoingAdapter;
     domain::logic::TrackDataExtrapolator extrapolator(&outgoingAdapter);
     
+    // 200Hz tick thread'i: her 5ms'de tablodaki güncel anchor'lardan üretir
+    extrapolator.start();
+    
     int messageCount = 0;
     
     while (true) {
@@ -49,7 +54,7 @@ void generateTestData() {
                 std::chrono::system_clock::now().time_since_epoch()).count();
             rawTrackData.setOriginalUpdateTime(nowMilliseconds);
             
-            // Domain logic'e gönder (8Hz → 200Hz extrapolation)
+            // Domain logic'e gönder: anchor hemen değişir, sonraki tick yeni veriden üretir
             extrapolator.processAndForwardTrackData(rawTrackData);
             
             messageCount++;
@@ -69,6 +74,16 @@ void generateTestData() {
 int main() {
     try {
         std::cout << "A_hexagon 8Hz→200Hz extrapolation system başlatılıyor..." << std::endl;
+
+        // B/C hexagon'ları saat farkını buradan ölçer (config/clock_sync.conf, listen_port)
+        const common::timing::ClockSync& clockSync = common::timing::ClockSync::process();
+        if (clockSync.listenPort() != 0U) {
+            std::cout << "Saat senkronizasyonu UDP " << clockSync.listenPort() << " portunda sunuluyor" << std::endl;
+        }
+
+        // Son mesajların aşama zamanları; kill -USR1 <pid> döküm alır (HEXAGON_FLIGHT_*).
+        // İlk mesajdan önce kurulur ki sinyal işleyicisi baştan yerinde olsun
+        common::capture::FlightRecorder::process();
         
         // Test verisi gönderimini başlat (sonsuz döngü)
         generateTestData();
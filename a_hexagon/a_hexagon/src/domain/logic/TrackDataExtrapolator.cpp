@@ -1,52 +1,146 @@
 #include "domain/logic/TrackDataExtrapolator.hpp"
+#include "common/TscClock.h"
+#include "common/ScopeTimer.h"
+#include "common/Probes.h"
 #include <chrono>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <string>
 #include <thread>
 namespace domain {
 namespace logic {
 using std::vector;
 using namespace domain::model;
-TrackDataExtrapolator::TrackDataExtrapolator(domain::ports::outgoing::ExtrapTrackDataOutgoingPort* outgoingPort) 
-    : outgoingPort_(outgoingPort) {
-}
-void TrackDataExtrapolator::extrapolateTo200Hz(const TrackData& trackData) {
-    int numSamples = 25;
-    double dt = 0.005; // 5ms intervals for 200Hz
-    
-    for (int i = 0; i < numSamples; ++i) {
-        ExtrapTrackData extrap;
-        double t = i * dt;
-        
-        // Track data kopyala
-        extrap.setTrackId(trackData.getTrackId());
-        extrap.setXVelocityECEF(trackData.getXVelocityECEF());
-        extrap.setYVelocityECEF(trackData.getYVelocityECEF());
-        extrap.setZVelocityECEF(trackData.getZVelocityECEF());
-        
-        // Position'ı velocity ile extrapole et
-        extrap.setXPositionECEF(trackData.getXPositionECEF() + trackData.getXVelocityECEF() * t);
-        extrap.setYPositionECEF(trackData.getYPositionECEF() + trackData.getYVelocityECEF() * t);
-        extrap.setZPositionECEF(trackData.getZPositionECEF() + trackData.getZVelocityECEF() * t);
-        
-        // Timestamp'leri ayarla
-        extrap.setUpdateTime(trackData.getOriginalUpdateTime() * 1000 + static_cast<long>(t * 1000000)); // ms to μs + offset
-        extrap.setOriginalUpdateTime(trackData.getOriginalUpdateTime()); // milisaniye olarak kalsın
-        
-        auto now = std::chrono::high_resolution_clock::now();
-        auto micros = std::chrono::duration_cast<std::chrono::microseconds>(now.time_since_epoch()).count();
-        extrap.setFirstHopSentTime(micros); // mikrosaniye cinsinden
-        
-        // Her veriyi hemen gönder (tek tek)
-        if (outgoingPort_) {
-            outgoingPort_->sendExtrapTrackData(extrap); // Artık tek veri gönderiyoruz
-        }
-        
-        // 200Hz için 5ms bekle (gerçek zamanlı extrapolation)
-        std::this_thread::sleep_for(std::chrono::microseconds(250));
+namespace {
+// Anchor'ı örnek üretmeden doğrular: pencerenin ilk örneği ve son örneğin zamanı
+// ExtrapTrackData şemasına (firstInvalidField) uymuyorsa tabloya girmemeli
+void validateAnchor(const TrackData& anchor) {
+    // UpdateTime = ms * 1000 + ofset; int64'e sığmayan zaman zaten şema dışıdır, çarpım taşmasın
+    const int64_t window = static_cast<int64_t>(TrackDataExtrapolator::SAMPLES_PER_ANCHOR - 1U) *
+                           TrackDataExtrapolator::TICK_PERIOD_US;
+    const int64_t originalMs = anchor.getOriginalUpdateTime();
+    const bool timeFits = (originalMs >= std::numeric_limits<int64_t>::min() / 1000) &&
+                          (originalMs <= (std::numeric_limits<int64_t>::max() - window) / 1000);
+
+    ExtrapTrackData probe;
+    ExtrapTrackData::FieldError error = ExtrapTrackData::FieldError::OriginalUpdateTime;
+    if (timeFits) {
+        error = TrackDataExtrapolator::extrapolateSample(anchor, 0U, probe);
+    }
+    if (error == ExtrapTrackData::FieldError::None) {
+        // Son örnek: yalnızca UpdateTime farklı, konum taşması tick'te iz bazında ele alınır
+        error = probe.fromFields(probe.getTrackId(),
+                                 probe.getXVelocityECEF(), probe.getYVelocityECEF(), probe.getZVelocityECEF(),
+                                 probe.getXPositionECEF(), probe.getYPositionECEF(), probe.getZPositionECEF(),
+                                 originalMs, originalMs * 1000 + window, probe.getFirstHopSentTime());
+    }
+    if (error != ExtrapTrackData::FieldError::None) {
+        throw std::out_of_range(std::string(ExtrapTrackData::fieldErrorName(error)) + " value is out of valid range");
     }
 }
+} // namespace
+TrackDataExtrapolator::TrackDataExtrapolator(domain::ports::outgoing::ExtrapTrackDataOutgoingPort* outgoingPort)
+    : outgoingPort_(outgoingPort), running_(false) {
+}
+TrackDataExtrapolator::~TrackDataExtrapolator() {
+    stop();
+}
+ExtrapTrackData::FieldError TrackDataExtrapolator::extrapolateSample(const TrackData& anchor, std::size_t sampleIndex, ExtrapTrackData& out) {
+    HEXAGON_SCOPE_TIMER("extrapolate");
+    const int64_t offsetMicros = static_cast<int64_t>(sampleIndex) * TICK_PERIOD_US;
+    const double t = static_cast<double>(offsetMicros) / 1000000.0;
+
+    // Hız ve zaman anchor'dan kopyalanır, konum hız ile extrapole edilir;
+    // UpdateTime ms -> μs + ofset, OriginalUpdateTime milisaniye kalır.
+    // FirstHopSentTime kalibre TSC saatinden: epoch mikrosaniye, system_clock ile aynı eksen
+    return out.fromFields(anchor.getTrackId(),
+                          anchor.getXVelocityECEF(), anchor.getYVelocityECEF(), anchor.getZVelocityECEF(),
+                          anchor.getXPositionECEF() + anchor.getXVelocityECEF() * t,
+                          anchor.getYPositionECEF() + anchor.getYVelocityECEF() * t,
+                          anchor.getZPositionECEF() + anchor.getZVelocityECEF() * t,
+                          anchor.getOriginalUpdateTime(),
+                          anchor.getOriginalUpdateTime() * 1000 + offsetMicros,
+                          common::timing::TscClock::nowMicros());
+}
 void TrackDataExtrapolator::processAndForwardTrackData(const TrackData& trackData) {
-    // 8Hz TrackData'yı alıp 200Hz ExtrapTrackData olarak gönder
-    extrapolateTo200Hz(trackData);
+    // A hexagon ölçümü ağdan değil çağırandan alır: sıra numarası yok, decode ile aynı an
+    HEXAGON_PROBE_DECODED(trackData.getTrackId(), 0, common::timing::TscClock::nowNanos());
+    // Geçersiz ölçüm tabloya girmeden çağırana hata fırlatsın (tick thread'i değil)
+    validateAnchor(trackData);
+
+    // Yeni ölçüm gelir gelmez anchor'u değiştir; bir sonraki tick yeni anchor'dan üretir
+    std::lock_guard<std::mutex> lock(tableMutex_);
+    TrackAnchor& anchor = trackTable_[trackData.getTrackId()];
+    anchor.data = trackData;
+    anchor.nextSample = 0U;
+}
+std::size_t TrackDataExtrapolator::emitTick() {
+    tickBuffer_.clear();
+    std::size_t failed = 0U;
+    const char* lastError = "";
+    ExtrapTrackData sample;
+    {
+        std::lock_guard<std::mutex> lock(tableMutex_);
+        for (auto it = trackTable_.begin(); it != trackTable_.end();) {
+            TrackAnchor& anchor = it->second;
+            bool keep = false;
+            const ExtrapTrackData::FieldError error = extrapolateSample(anchor.data, anchor.nextSample, sample);
+            if (error == ExtrapTrackData::FieldError::None) {
+                tickBuffer_.push_back(sample);
+                ++anchor.nextSample;
+                // 125ms penceresi bitti ve yeni ölçüm gelmedi: izi tablodan çıkar
+                keep = anchor.nextSample < SAMPLES_PER_ANCHOR;
+            } else {
+                // Konum pencere içinde aralık dışına taştı: yalnızca bu iz düşer, tick diğerleriyle sürer
+                ++failed;
+                lastError = ExtrapTrackData::fieldErrorName(error);
+            }
+            it = keep ? std::next(it) : trackTable_.erase(it);
+        }
+    }
+    if (failed != 0U) {
+        std::cerr << "Extrapolation hatası, " << failed << " iz bırakıldı, aralık dışı alan: " << lastError << std::endl;
+    }
+
+    // Gönderim kilit dışında yapılır, ingest yolu beklemez
+    if (outgoingPort_) {
+        for (const auto& extrap : tickBuffer_) {
+            outgoingPort_->sendExtrapTrackData(extrap);
+        }
+    }
+    return tickBuffer_.size();
+}
+bool TrackDataExtrapolator::start() {
+    if (running_.exchange(true)) {
+        return false; // Zaten çalışıyor
+    }
+    tickThread_ = std::thread([this]() { tickWorker(); });
+    return true;
+}
+void TrackDataExtrapolator::stop() {
+    running_.store(false);
+    if (tickThread_.joinable()) {
+        tickThread_.join();
+    }
+}
+std::size_t TrackDataExtrapolator::getActiveTrackCount() const {
+    std::lock_guard<std::mutex> lock(tableMutex_);
+    return trackTable_.size();
+}
+void TrackDataExtrapolator::tickWorker() {
+    // 200Hz: mutlak deadline ile uyu, gönderim süresi periyoda eklenmesin
+    auto nextTick = std::chrono::steady_clock::now();
+    while (running_.load()) {
+        try {
+            emitTick();
+        } catch (const std::exception& e) {
+            std::cerr << "Extrapolation tick hatası: " << e.what() << std::endl;
+        }
+        nextTick += std::chrono::microseconds(TICK_PERIOD_US);
+        std::this_thread::sleep_until(nextTick);
+    }
+}
 }
 }
-}
\ No newline at end of file
@@ -5,62 +5,127 @@
  * @date 2025
  */
 
-#ifndef TRACK_DATA_EXTRAPOLATOR_H 
-#define TRACK_DATA_EXTRAPOLATOR_H 
+#ifndef TRACK_DATA_EXTRAPOLATOR_H
+#define TRACK_DATA_EXTRAPOLATOR_H
 
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
 #include <vector>
-#include "domain/model/TrackData.hpp"          
-#include "domain/model/ExtrapTrackData.hpp"    
-#include "domain/ports/outgoing/TrackDataOutgoingPort.hpp" 
+#include "domain/model/TrackData.hpp"
+#include "domain/model/ExtrapTrackData.hpp"
+#include "domain/ports/outgoing/TrackDataOutgoingPort.hpp"
 
 namespace domain {
 namespace logic {
 
-using domain::model::TrackData;     
+using domain::model::TrackData;
 using domain::model::ExtrapTrackData;
-using std::vector; 
+using std::vector;
 
 /**
  * @brief Main business logic class for track data extrapolation
- * 
+ *
  * This class implements the core extrapolation algorithm that converts
  * incoming track data from 5Hz frequency to 200Hz frequency using
  * constant velocity model. It follows the Hexagonal Architecture pattern
  * by implementing the TrackDataIncomingPort interface.
+ *
+ * Extrapolation is incremental: every incoming TrackData replaces the
+ * anchor of its track in the track table, and each 5ms tick emits one
+ * sample per track from the current anchor. A fresh measurement is
+ * therefore visible downstream on the very next tick instead of after
+ * the previous 125ms window has been played out.
  */
 class TrackDataExtrapolator {
-private:
-    /** @brief Pointer to outgoing port for sending extrapolated data */
-    domain::ports::outgoing::ExtrapTrackDataOutgoingPort* outgoingPort_;
+public:
+    /** @brief Tick period for 200Hz output (microseconds) */
+    static constexpr int64_t TICK_PERIOD_US = 5000;
+
+    /** @brief Maximum number of samples emitted from one anchor (125ms window) */
+    static constexpr std::size_t SAMPLES_PER_ANCHOR = 25U;
 
-public: 
     /**
      * @brief Constructor for TrackDataExtrapolator
      * @param outgoingPort Pointer to the outgoing port implementation
      */
     TrackDataExtrapolator(domain::ports::outgoing::ExtrapTrackDataOutgoingPort* outgoingPort);
-    
+
+    /** @brief Destructor - stops the tick thread if it is running */
+    ~TrackDataExtrapolator();
+
+    TrackDataExtrapolator(const TrackDataExtrapolator&) = delete;
+    TrackDataExtrapolator& operator=(const TrackDataExtrapolator&) = delete;
+
     /**
-     * @brief Processes incoming track data and forwards extrapolated results
-     * 
-     * This method receives track data at 5Hz, extrapolates it to 200Hz
-     * for a 125ms window (25 data points), and forwards the results
-     * through the configured outgoing port.
-     * 
+     * @brief Re-anchors the track on the incoming measurement
+     *
+     * Atomically replaces the anchor for trackData's trackId in the track
+     * table. Nothing is sent here; the next tick emits sample 0 of the new
+     * anchor.
+     *
      * @param trackData Input track data containing position, velocity, and timing
      */
     void processAndForwardTrackData(const domain::model::TrackData& trackData);
-    
+
+    /**
+     * @brief Emits one 200Hz sample for every live track
+     *
+     * Each anchor is coasted with the constant velocity model for at most
+     * SAMPLES_PER_ANCHOR ticks; tracks without a newer update after that
+     * are dropped from the table.
+     *
+     * @return Number of samples forwarded to the outgoing port
+     */
+    std::size_t emitTick();
+
     /**
-     * @brief Method to extrapolate track data to 200Hz frequency and send immediately
-     * 
-     * Generates and sends 25 extrapolated data points covering 125ms window
-     * using constant velocity model. Each point is sent immediately (real-time).
-     * 
-     * @param trackData Input track data to extrapolate
+     * @brief Starts the 200Hz tick thread (drift-free, absolute deadlines)
+     * @return false if the thread is already running
      */
-    void extrapolateTo200Hz(const TrackData& trackData);
+    bool start();
+
+    /** @brief Stops the tick thread and waits for it to exit */
+    void stop();
+
+    /** @brief Number of tracks currently in the track table */
+    std::size_t getActiveTrackCount() const;
+
+    /**
+     * @brief Builds the extrapolated sample at the given tick index of an anchor
+     * @param anchor Anchor measurement
+     * @param sampleIndex Tick index since the anchor was installed (0 = anchor itself)
+     * @param out Receives the extrapolated sample (built with fromFields, no throwing setters)
+     * @return First out-of-range field, or FieldError::None if out is valid
+     */
+    static ExtrapTrackData::FieldError extrapolateSample(const TrackData& anchor, std::size_t sampleIndex, ExtrapTrackData& out);
+
+private:
+    /** @brief Track table entry: latest measurement and next sample index */
+    struct TrackAnchor {
+        TrackData data;
+        std::size_t nextSample;
+    };
+
+    /** @brief Tick thread body */
+    void tickWorker();
+
+    /** @brief Pointer to outgoing port for sending extrapolated data */
+    domain::ports::outgoing::ExtrapTrackDataOutgoingPort* outgoingPort_;
+
+    /** @brief trackId -> current anchor */
+    std::unordered_map<int, TrackAnchor> trackTable_;
+    mutable std::mutex tableMutex_;
+
+    /** @brief Scratch buffer reused by emitTick to keep the lock hold short */
+    vector<ExtrapTrackData> tickBuffer_;
+
+    std::thread tickThread_;
+    std::atomic<bool> running_;
 };
 }
 }
-#endif
\ No newline at end of file
+#endif
@@ -17,6 +17,24 @@ std::map<std::string, std::string> JsonConfigParser::parseServiceMetadata(const
         config["multicast_address"] = extractJsonValue(metadata, "multicast_address");
         config["port"] = extractJsonValue(metadata, "port");
         
+        // Opsiyonel grup bölümleme anahtarları (yalnızca tanımlıysa eklenir)
+        for (const char* key : {"group_partitioning", "group_track_range_size", "group_cell_size_deg"}) {
+            std::string value = extractJsonValue(metadata, key);
+            if (!value.empty()) {
+                config[key] = value;
+            }
+        }
+        
+        // Opsiyonel UDP socket profili ve tekil ayarları (common/UdpSocketProfile.h)
+        for (const char* key : {"socket_profile", "socket_busy_poll_us", "socket_prefer_busy_poll",
+                                "socket_sndbuf", "socket_rcvbuf", "socket_priority", "socket_tos",
+                                "socket_multicast_loop", "socket_incoming_cpu", "socket_direct"}) {
+            std::string value = extractJsonValue(metadata, key);
+            if (!value.empty()) {
+                config[key] = value;
+            }
+        }
+        
         return config;
         
     } catch (const std::exception& e) {
@@ -3,6 +3,7 @@
 #include <memory>
 #include <thread>
 #include <chrono>
+#include <stdexcept>
 #include "domain/model/TrackData.hpp"
 #include "domain/model/ExtrapTrackData.hpp"
 #include "domain/logic/TrackDataExtrapolator.hpp"
@@ -17,9 +18,13 @@ using namespace domain::logic;
 // Mock outgoing adapter for testing
 class MockOutgoingAdapter : public domain::ports::outgoing::ExtrapTrackDataOutgoingPort {
 public:
-    std::vector<std::vector<ExtrapTrackData>> sentData;
+    std::vector<ExtrapTrackData> sentData;
     
     void sendExtrapTrackData(const std::vector<ExtrapTrackData>& data) override {
+        sentData.insert(sentData.end(), data.begin(), data.end());
+    }
+    
+    void sendExtrapTrackData(const ExtrapTrackData& data) override {
         sentData.push_back(data);
     }
     
@@ -28,27 +33,35 @@ public:
     }
 };
 
+static TrackData makeTrack(int id, double x, double y, double z, double vx, double vy, double vz, long time) {
+    TrackData track;
+    track.setTrackId(id);
+    track.setXPositionECEF(x);
+    track.setYPositionECEF(y);
+    track.setZPositionECEF(z);
+    track.setXVelocityECEF(vx);
+    track.setYVelocityECEF(vy);
+    track.setZVelocityECEF(vz);
+    track.setOriginalUpdateTime(time);
+    return track;
+}
+
+static void runTicks(TrackDataExtrapolator& extrapolator, int count) {
+    for (int i = 0; i < count; ++i) {
+        extrapolator.emitTick();
+    }
+}
+
 // ============= processAndForwardTrackData Tests =============
 
 bool Test_processAndForwardTrackData_ConstantVelocity() {
     auto mockAdapter = std::make_shared<MockOutgoingAdapter>();
     TrackDataExtrapolator extrapolator(mockAdapter.get());
     
-    TrackData track;
-    track.setTrackId(42);
-    track.setXPositionECEF(100.0);
-    track.setYPositionECEF(200.0);
-    track.setZPositionECEF(300.0);
-    track.setXVelocityECEF(10.0);
-    track.setYVelocityECEF(20.0);
-    track.setZVelocityECEF(30.0);
-    track.setOriginalUpdateTime(1000);
-    
-    extrapolator.processAndForwardTrackData(track);
-    
-    ASSERT_EQ(mockAdapter->sentData.size(), 1);
-    auto result = mockAdapter->sentData[0];
+    extrapolator.processAndForwardTrackData(makeTrack(42, 100.0, 200.0, 300.0, 10.0, 20.0, 30.0, 1000));
+    runTicks(extrapolator, 25);
     
+    auto result = mockAdapter->sentData;
     ASSERT_EQ(result.size(), 25);
     EXPECT_DOUBLE_EQ(result[0].getXPositionECEF(), 100.0);
     EXPECT_DOUBLE_EQ(result[0].getYPositionECEF(), 200.0);
@@ -62,27 +75,28 @@ bool Test_processAndForwardTrackData_ConstantVelocity() {
     return true;
 }
 
-bool Test_processAndForwardTrackData_ZeroVelocity() {
+bool Test_processAndForwardTrackData_NoSendBeforeTick() {
     auto mockAdapter = std::make_shared<MockOutgoingAdapter>();
     TrackDataExtrapolator extrapolator(mockAdapter.get());
     
-    TrackData track;
-    track.setTrackId(1);
-    track.setXPositionECEF(50.0);
-    track.setYPositionECEF(-50.0);
-    track.setZPositionECEF(0.0);
-    track.setXVelocityECEF(0.0);
-    track.setYVelocityECEF(0.0);
-    track.setZVelocityECEF(0.0);
-    track.setOriginalUpdateTime(500);
+    extrapolator.processAndForwardTrackData(makeTrack(5, 1.0, 2.0, 3.0, 0.0, 0.0, 0.0, 100));
     
-    extrapolator.processAndForwardTrackData(track);
+    // Anchor güncellenir ama gönderim tick'e kadar beklemez/yapılmaz
+    ASSERT_EQ(mockAdapter->sentData.size(), 0);
+    ASSERT_EQ(extrapolator.getActiveTrackCount(), 1);
     
-    ASSERT_EQ(mockAdapter->sentData.size(), 1);
-    auto result = mockAdapter->sentData[0];
+    return true;
+}
+
+bool Test_processAndForwardTrackData_ZeroVelocity() {
+    auto mockAdapter = std::make_shared<MockOutgoingAdapter>();
+    TrackDataExtrapolator extrapolator(mockAdapter.get());
     
-    ASSERT_EQ(result.size(), 25);
-    for (const auto& extrap : result) {
+    extrapolator.processAndForwardTrackData(makeTrack(1, 50.0, -50.0, 0.0, 0.0, 0.0, 0.0, 500));
+    runTicks(extrapolator, 25);
+    
+    ASSERT_EQ(mockAdapter->sentData.size(), 25);
+    for (const auto& extrap : mockAdapter->sentData) {
         EXPECT_DOUBLE_EQ(extrap.getXPositionECEF(), 50.0);
         EXPECT_DOUBLE_EQ(extrap.getYPositionECEF(), -50.0);
         EXPECT_DOUBLE_EQ(extrap.getZPositionECEF(), 0.0);
@@ -98,21 +112,10 @@ bool Test_processAndForwardTrackData_NegativeVelocity() {
     auto mockAdapter = std::make_shared<MockOutgoingAdapter>();
     TrackDataExtrapolator extrapolator(mockAdapter.get());
     
-    TrackData track;
-    track.setTrackId(99);
-    track.setXPositionECEF(1000.0);
-    track.setYPositionECEF(2000.0);
-    track.setZPositionECEF(3000.0);
-    track.setXVelocityECEF(-5.0);
-    track.setYVelocityECEF(-10.0);
-    track.setZVelocityECEF(-15.0);
-    track.setOriginalUpdateTime(1500);
-    
-    extrapolator.processAndForwardTrackData(track);
-    
-    ASSERT_EQ(mockAdapter->sentData.size(), 1);
-    auto result = mockAdapter->sentData[0];
+    extrapolator.processAndForwardTrackData(makeTrack(99, 1000.0, 2000.0, 3000.0, -5.0, -10.0, -15.0, 1500));
+    runTicks(extrapolator, 25);
     
+    auto result = mockAdapter->sentData;
     ASSERT_EQ(result.size(), 25);
     double t = 0.005 * 10; // 10th step
     EXPECT_NEAR(result[10].getXPositionECEF(), 1000.0 + (-5.0) * t, 1e-9);
@@ -126,22 +129,11 @@ bool Test_processAndForwardTrackData_LargeValues() {
     auto mockAdapter = std::make_shared<MockOutgoingAdapter>();
     TrackDataExtrapolator extrapolator(mockAdapter.get());
     
-    TrackData track;
-    track.setTrackId(12345);
-    track.setXPositionECEF(1e6);
-    track.setYPositionECEF(2e6);
-    track.setZPositionECEF(3e6);
-    track.setXVelocityECEF(1000.0);
-    track.setYVelocityECEF(2000.0);
-    track.setZVelocityECEF(3000.0);
-    track.setOriginalUpdateTime(9999999);
-    
-    extrapolator.processAndForwardTrackData(track);
+    extrapolator.processAndForwardTrackData(makeTrack(12345, 1e6, 2e6, 3e6, 1000.0, 2000.0, 3000.0, 9999999));
+    runTicks(extrapolator, 1);
     
-    ASSERT_EQ(mockAdapter->sentData.size(), 1);
-    auto result = mockAdapter->sentData[0];
-    
-    ASSERT_EQ(result.size(), 25);
+    auto result = mockAdapter->sentData;
+    ASSERT_EQ(result.size(), 1);
     ASSERT_EQ(result[0].getTrackId(), 12345);
     EXPECT_DOUBLE_EQ(result[0].getXPositionECEF(), 1e6);
     EXPECT_DOUBLE_EQ(result[0].getYPositionECEF(), 2e6);
@@ -154,24 +146,13 @@ bool Test_processAndForwardTrackData_TimeProgression() {
     auto mockAdapter = std::make_shared<MockOutgoingAdapter>();
     TrackDataExtrapolator extrapolator(mockAdapter.get());
     
-    TrackData track;
-    track.setTrackId(7);
-    track.setXPositionECEF(0.0);
-    track.setYPositionECEF(0.0);
-    track.setZPositionECEF(0.0);
-    track.setXVelocityECEF(1.0);
-    track.setYVelocityECEF(1.0);
-    track.setZVelocityECEF(1.0);
-    track.setOriginalUpdateTime(2000);
-    
-    extrapolator.processAndForwardTrackData(track);
-    
-    ASSERT_EQ(mockAdapter->sentData.size(), 1);
-    auto result = mockAdapter->sentData[0];
+    extrapolator.processAndForwardTrackData(makeTrack(7, 0.0, 0.0, 0.0, 1.0, 1.0, 1.0, 2000));
+    runTicks(extrapolator, 25);
     
+    auto result = mockAdapter->sentData;
     ASSERT_EQ(result.size(), 25);
     for (int i = 0; i < 25; ++i) {
-        long expectedTime = 2000 + static_cast<long>(i * 0.005 * 1000000000); // nanoseconds
+        long expectedTime = 2000L * 1000L + i * 5000L; // ms to μs + 5ms tick offset
         ASSERT_EQ(result[i].getUpdateTime(), expectedTime);
         ASSERT_EQ(result[i].getOriginalUpdateTime(), 2000);
     }
@@ -179,94 +160,162 @@ bool Test_processAndForwardTrackData_TimeProgression() {
     return true;
 }
 
-// ============= extrapolate Tests =============
+// ============= re-anchoring Tests =============
 
-bool Test_extrapolate_BasicFunctionality() {
+bool Test_reanchor_NextTickUsesFreshMeasurement() {
     auto mockAdapter = std::make_shared<MockOutgoingAdapter>();
     TrackDataExtrapolator extrapolator(mockAdapter.get());
     
-    TrackData input;
-    input.setTrackId(10);
-    input.setXPositionECEF(0.0);
-    input.setYPositionECEF(0.0);
-    input.setZPositionECEF(0.0);
-    input.setXVelocityECEF(100.0);
-    input.setYVelocityECEF(200.0);
-    input.setZVelocityECEF(300.0);
-    input.setOriginalUpdateTime(1000);
+    extrapolator.processAndForwardTrackData(makeTrack(8, 0.0, 0.0, 0.0, 100.0, 0.0, 0.0, 1000));
+    runTicks(extrapolator, 10);
+    ASSERT_EQ(mockAdapter->sentData.size(), 10);
     
-    auto result = extrapolator.extrapolateTo200Hz(input);
+    // Pencere ortasında yeni ölçüm: bir sonraki tick doğrudan yeni anchor'dan üretmeli
+    extrapolator.processAndForwardTrackData(makeTrack(8, 500.0, 600.0, 700.0, -1.0, -2.0, -3.0, 1125));
+    mockAdapter->clear();
+    runTicks(extrapolator, 1);
     
-    ASSERT_EQ(result.size(), 25);
-    ASSERT_EQ(result[0].getTrackId(), 10);
-    EXPECT_DOUBLE_EQ(result[0].getXVelocityECEF(), 100.0);
-    EXPECT_DOUBLE_EQ(result[0].getYVelocityECEF(), 200.0);
-    EXPECT_DOUBLE_EQ(result[0].getZVelocityECEF(), 300.0);
+    ASSERT_EQ(mockAdapter->sentData.size(), 1);
+    EXPECT_DOUBLE_EQ(mockAdapter->sentData[0].getXPositionECEF(), 500.0);
+    EXPECT_DOUBLE_EQ(mockAdapter->sentData[0].getYPositionECEF(), 600.0);
+    EXPECT_DOUBLE_EQ(mockAdapter->sentData[0].getZPositionECEF(), 700.0);
+    ASSERT_EQ(mockAdapter->sentData[0].getOriginalUpdateTime(), 1125);
+    ASSERT_EQ(mockAdapter->sentData[0].getUpdateTime(), 1125L * 1000L);
+    
+    // Yeni anchor tam bir pencere boyunca coast eder
+    runTicks(extrapolator, 30);
+    ASSERT_EQ(mockAdapter->sentData.size(), 25);
     
     return true;
 }
 
-bool Test_extrapolate_PositionCalculation() {
+bool Test_reanchor_WindowExpiry() {
     auto mockAdapter = std::make_shared<MockOutgoingAdapter>();
     TrackDataExtrapolator extrapolator(mockAdapter.get());
     
-    TrackData input;
-    input.setTrackId(20);
-    input.setXPositionECEF(10.0);
-    input.setYPositionECEF(20.0);
-    input.setZPositionECEF(30.0);
-    input.setXVelocityECEF(2.0);
-    input.setYVelocityECEF(4.0);
-    input.setZVelocityECEF(6.0);
-    input.setOriginalUpdateTime(500);
+    extrapolator.processAndForwardTrackData(makeTrack(9, 0.0, 0.0, 0.0, 1.0, 1.0, 1.0, 100));
+    runTicks(extrapolator, 25);
+    ASSERT_EQ(extrapolator.getActiveTrackCount(), 0);
     
-    auto result = extrapolator.extrapolateTo200Hz(input);
+    // Yeni ölçüm gelmezse 125ms sonrası için veri üretilmez
+    ASSERT_EQ(extrapolator.emitTick(), 0);
+    ASSERT_EQ(mockAdapter->sentData.size(), 25);
     
-    ASSERT_EQ(result.size(), 25);
+    return true;
+}
+
+bool Test_reanchor_MultipleTracksPerTick() {
+    auto mockAdapter = std::make_shared<MockOutgoingAdapter>();
+    TrackDataExtrapolator extrapolator(mockAdapter.get());
     
-    // Check 5th element (i=4)
-    double t = 0.005 * 4;
-    EXPECT_NEAR(result[4].getXPositionECEF(), 10.0 + 2.0 * t, 1e-9);
-    EXPECT_NEAR(result[4].getYPositionECEF(), 20.0 + 4.0 * t, 1e-9);
-    EXPECT_NEAR(result[4].getZPositionECEF(), 30.0 + 6.0 * t, 1e-9);
+    extrapolator.processAndForwardTrackData(makeTrack(11, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 100));
+    extrapolator.processAndForwardTrackData(makeTrack(12, 1.0, 1.0, 1.0, 0.0, 0.0, 0.0, 100));
+    ASSERT_EQ(extrapolator.getActiveTrackCount(), 2);
+    
+    ASSERT_EQ(extrapolator.emitTick(), 2);
+    ASSERT_EQ(mockAdapter->sentData.size(), 2);
     
     return true;
 }
 
-bool Test_extrapolate_FirstHopSentTime() {
+bool Test_reanchor_InvalidMeasurementRejected() {
+    auto mockAdapter = std::make_shared<MockOutgoingAdapter>();
+    TrackDataExtrapolator extrapolator(mockAdapter.get());
+    
+    // Şema dışı ölçüm çağırana hata fırlatır ve tabloya girmez
+    bool thrown = false;
+    try {
+        extrapolator.processAndForwardTrackData(makeTrack(13, std::nan(""), 0.0, 0.0, 0.0, 0.0, 0.0, 100));
+    } catch (const std::out_of_range&) {
+        thrown = true;
+    }
+    ASSERT_EQ(thrown, true);
+    ASSERT_EQ(extrapolator.getActiveTrackCount(), 0);
+    
+    return true;
+}
+
+bool Test_reanchor_WindowEndTimeRejected() {
     auto mockAdapter = std::make_shared<MockOutgoingAdapter>();
     TrackDataExtrapolator extrapolator(mockAdapter.get());
     
-    TrackData input;
-    input.setTrackId(30);
-    input.setXPositionECEF(0.0);
-    input.setYPositionECEF(0.0);
-    input.setZPositionECEF(0.0);
-    input.setXVelocityECEF(0.0);
-    input.setYVelocityECEF(0.0);
-    input.setZVelocityECEF(0.0);
-    input.setOriginalUpdateTime(1234567890);
+    // İlk örneğin UpdateTime'ı şemada, pencerenin son örneğininki (+120ms) şema dışı
+    bool thrown = false;
+    try {
+        extrapolator.processAndForwardTrackData(makeTrack(16, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 9223372036854775L / 1000));
+    } catch (const std::out_of_range&) {
+        thrown = true;
+    }
+    ASSERT_EQ(thrown, true);
+    ASSERT_EQ(extrapolator.getActiveTrackCount(), 0);
+    
+    return true;
+}
+
+bool Test_reanchor_FailingAnchorDoesNotStallOthers() {
+    auto mockAdapter = std::make_shared<MockOutgoingAdapter>();
+    TrackDataExtrapolator extrapolator(mockAdapter.get());
+    
+    // İlk örnek sınırda, ikinci örnek X konum aralığının dışına taşar
+    extrapolator.processAndForwardTrackData(makeTrack(14, 9.9e10 - 1.0, 0.0, 0.0, 1.0e6, 0.0, 0.0, 100));
+    extrapolator.processAndForwardTrackData(makeTrack(15, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 100));
+    ASSERT_EQ(extrapolator.emitTick(), 2);
+    
+    // Taşan iz düşer, diğeri aynı tick'te ve sonrakilerde üretilmeye devam eder
+    ASSERT_EQ(extrapolator.emitTick(), 1);
+    ASSERT_EQ(extrapolator.getActiveTrackCount(), 1);
+    runTicks(extrapolator, 23);
+    ASSERT_EQ(mockAdapter->sentData.size(), 26);
+    ASSERT_EQ(mockAdapter->sentData.back().getTrackId(), 15);
+    
+    return true;
+}
+
+// ============= extrapolate Tests =============
+
+bool Test_extrapolate_BasicFunctionality() {
+    ExtrapTrackData result;
+    ASSERT_EQ(TrackDataExtrapolator::extrapolateSample(
+        makeTrack(10, 0.0, 0.0, 0.0, 100.0, 200.0, 300.0, 1000), 0, result) == ExtrapTrackData::FieldError::None, true);
+    
+    ASSERT_EQ(result.getTrackId(), 10);
+    EXPECT_DOUBLE_EQ(result.getXVelocityECEF(), 100.0);
+    EXPECT_DOUBLE_EQ(result.getYVelocityECEF(), 200.0);
+    EXPECT_DOUBLE_EQ(result.getZVelocityECEF(), 300.0);
+    
+    return true;
+}
+
+bool Test_extrapolate_PositionCalculation() {
+    ExtrapTrackData result;
+    ASSERT_EQ(TrackDataExtrapolator::extrapolateSample(
+        makeTrack(20, 10.0, 20.0, 30.0, 2.0, 4.0, 6.0, 500), 4, result) == ExtrapTrackData::FieldError::None, true);
+    
+    // Check 5th element (i=4)
+    double t = 0.005 * 4;
+    EXPECT_NEAR(result.getXPositionECEF(), 10.0 + 2.0 * t, 1e-9);
+    EXPECT_NEAR(result.getYPositionECEF(), 20.0 + 4.0 * t, 1e-9);
+    EXPECT_NEAR(result.getZPositionECEF(), 30.0 + 6.0 * t, 1e-9);
+    
+    return true;
+}
+
+bool Test_extrapolate_FirstHopSentTime() {
+    TrackData input = makeTrack(30, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 1234567890);
     
     // İlk çağrı
-    auto result1 = extrapolator.extrapolateTo200Hz(input);
+    ExtrapTrackData result1;
+    TrackDataExtrapolator::extrapolateSample(input, 0, result1);
     
     // Kısa bir bekleme
     std::this_thread::sleep_for(std::chrono::milliseconds(10));
     
     // İkinci çağrı
-    auto result2 = extrapolator.extrapolateTo200Hz(input);
-    
-    ASSERT_EQ(result1.size(), 25);
-    ASSERT_EQ(result2.size(), 25);
-    
-    // İki farklı çağrının firstHopSentTime'ları farklı olmalı
-    long firstTime1 = result1[0].getFirstHopSentTime();
-    long firstTime2 = result2[0].getFirstHopSentTime();
+    ExtrapTrackData result2;
+    TrackDataExtrapolator::extrapolateSample(input, 0, result2);
     
     // firstHopSentTime'lar farklı olmalı (ikinci çağrı daha sonra yapıldığı için)
-    ASSERT_EQ(firstTime1 < firstTime2, true);
-    
-    
+    ASSERT_EQ(result1.getFirstHopSentTime() < result2.getFirstHopSentTime(), true);
     
     return true;
 }
@@ -275,22 +324,13 @@ bool Test_extrapolate_VelocityPreservation() {
     auto mockAdapter = std::make_shared<MockOutgoingAdapter>();
     TrackDataExtrapolator extrapolator(mockAdapter.get());
     
-    TrackData input;
-    input.setTrackId(40);
-    input.setXPositionECEF(100.0);
-    input.setYPositionECEF(200.0);
-    input.setZPositionECEF(300.0);
-    input.setXVelocityECEF(50.0);
-    input.setYVelocityECEF(-25.0);
-    input.setZVelocityECEF(75.0);
-    input.setOriginalUpdateTime(9876);
-    
-    auto result = extrapolator.extrapolateTo200Hz(input);
+    extrapolator.processAndForwardTrackData(makeTrack(40, 100.0, 200.0, 300.0, 50.0, -25.0, 75.0, 9876));
+    runTicks(extrapolator, 25);
     
-    ASSERT_EQ(result.size(), 25);
+    ASSERT_EQ(mockAdapter->sentData.size(), 25);
     
     // Velocity should remain constant in all extrapolated points
-    for (const auto& extrap : result) {
+    for (const auto& extrap : mockAdapter->sentData) {
         EXPECT_DOUBLE_EQ(extrap.getXVelocityECEF(), 50.0);
         EXPECT_DOUBLE_EQ(extrap.getYVelocityECEF(), -25.0);
         EXPECT_DOUBLE_EQ(extrap.getZVelocityECEF(), 75.0);
@@ -303,22 +343,13 @@ bool Test_extrapolate_TrackIdPreservation() {
     auto mockAdapter = std::make_shared<MockOutgoingAdapter>();
     TrackDataExtrapolator extrapolator(mockAdapter.get());
     
-    TrackData input;
-    input.setTrackId(999888777);
-    input.setXPositionECEF(0.0);
-    input.setYPositionECEF(0.0);
-    input.setZPositionECEF(0.0);
-    input.setXVelocityECEF(0.0);
-    input.setYVelocityECEF(0.0);
-    input.setZVelocityECEF(0.0);
-    input.setOriginalUpdateTime(1111);
-    
-    auto result = extrapolator.extrapolateTo200Hz(input);
+    extrapolator.processAndForwardTrackData(makeTrack(999888777, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 1111));
+    runTicks(extrapolator, 25);
     
-    ASSERT_EQ(result.size(), 25);
+    ASSERT_EQ(mockAdapter->sentData.size(), 25);
     
     // Track ID should be preserved in all extrapolated points
-    for (const auto& extrap : result) {
+    for (const auto& extrap : mockAdapter->sentData) {
         ASSERT_EQ(extrap.getTrackId(), 999888777);
         ASSERT_EQ(extrap.getOriginalUpdateTime(), 1111);
     }
@@ -326,6 +357,24 @@ bool Test_extrapolate_TrackIdPreservation() {
     return true;
 }
 
+// ============= tick thread Tests =============
+
+bool Test_tickThread_EmitsAt200Hz() {
+    auto mockAdapter = std::make_shared<MockOutgoingAdapter>();
+    TrackDataExtrapolator extrapolator(mockAdapter.get());
+    
+    extrapolator.processAndForwardTrackData(makeTrack(50, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 100));
+    ASSERT_EQ(extrapolator.start(), true);
+    ASSERT_EQ(extrapolator.start(), false);
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    extrapolator.stop();
+    
+    // 125ms pencere 200ms içinde tamamen oynatılmış olmalı
+    ASSERT_EQ(mockAdapter->sentData.size(), 25);
+    
+    return true;
+}
+
 int main() {
     int passed = 0, failed = 0;
     
@@ -337,6 +386,13 @@ int main() {
         ++failed; 
     }
     
+    if (Test_processAndForwardTrackData_NoSendBeforeTick()) { 
+        std::cout << "Test_processAndForwardTrackData_NoSendBeforeTick PASSED\n"; 
+        ++passed; 
+    } else { 
+        ++failed; 
+    }
+    
     if (Test_processAndForwardTrackData_ZeroVelocity()) { 
         std::cout << "Test_processAndForwardTrackData_ZeroVelocity PASSED\n"; 
         ++passed; 
@@ -365,6 +421,51 @@ int main() {
         ++failed; 
     }
     
+    
+    // re-anchoring Tests
+    if (Test_reanchor_NextTickUsesFreshMeasurement()) { 
+        std::cout << "Test_reanchor_NextTickUsesFreshMeasurement PASSED\n"; 
+        ++passed; 
+    } else { 
+        ++failed; 
+    }
+    
+    if (Test_reanchor_WindowExpiry()) { 
+        std::cout << "Test_reanchor_WindowExpiry PASSED\n"; 
+        ++passed; 
+    } else { 
+        ++failed; 
+    }
+    
+    if (Test_reanchor_MultipleTracksPerTick()) { 
+        std::cout << "Test_reanchor_MultipleTracksPerTick PASSED\n"; 
+        ++passed; 
+    } else { 
+        ++failed; 
+    }
+    
+    if (Test_reanchor_InvalidMeasurementRejected()) { 
+        std::cout << "Test_reanchor_InvalidMeasurementRejected PASSED\n"; 
+        ++passed; 
+    } else { 
+        ++failed; 
+    }
+    
+    if (Test_reanchor_WindowEndTimeRejected()) { 
+        std::cout << "Test_reanchor_WindowEndTimeRejected PASSED\n"; 
+        ++passed; 
+    } else { 
+        ++failed; 
+    }
+    
+    if (Test_reanchor_FailingAnchorDoesNotStallOthers()) { 
+        std::cout << "Test_reanchor_FailingAnchorDoesNotStallOthers PASSED\n"; 
+        ++passed; 
+    } else { 
+        ++failed; 
+    }
+    
+    
     // extrapolate Tests
     if (Test_extrapolate_BasicFunctionality()) { 
         std::cout << "Test_extrapolate_BasicFunctionality PASSED\n"; 
@@ -401,6 +502,15 @@ int main() {
         ++failed; 
     }
     
+    
+    // tick thread Tests
+    if (Test_tickThread_EmitsAt200Hz()) { 
+        std::cout << "Test_tickThread_EmitsAt200Hz PASSED\n"; 
+        ++passed; 
+    } else { 
+        ++failed; 
+    }
+    
     std::cout << "\n" << passed << " tests passed, " << failed << " tests failed.\n";
     return failed == 0 ? 0 : 1;
-}
\ No newline at end of file
+}
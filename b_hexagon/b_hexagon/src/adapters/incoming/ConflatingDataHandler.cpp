@@ -0,0 +1,70 @@
+/**
+ * @file ConflatingDataHandler.cpp
+ * @brief Latest-value-wins handoff between the DISH receive loop and track processing
+ */
+
+#include "adapters/incoming/ConflatingDataHandler.hpp"  // Own header
+#include "common/Logger.hpp"                            // Logging
+#include "common/ThreadTopology.h"                      // compute_stage placement
+#include "common/TscClock.h"                            // Service time
+#include <exception>                                    // std::exception
+
+ConflatingDataHandler::ConflatingDataHandler(IDataHandler* downstream, std::chrono::milliseconds statsInterval,
+                                             common::flow::StageMetrics* metrics)
+    : downstream_(downstream),
+      statsInterval_(statsInterval),
+      metrics_(metrics),
+      worker_(&ConflatingDataHandler::processLoop, this) {
+}
+
+ConflatingDataHandler::~ConflatingDataHandler() {
+    queue_.close();
+    worker_.join();
+}
+
+void ConflatingDataHandler::onDataReceived(const ExtrapTrackData& data) {
+    queue_.push(data.getTrackId(), Pending{data, common::capture::currentFlight()});
+}
+
+void ConflatingDataHandler::processLoop() {
+    common::topology::ThreadTopology& topology = common::topology::ThreadTopology::process();
+    if (topology.hasRole("compute_stage")) {
+        Logger::info("Compute stage placement: ",
+                     common::topology::ThreadTopology::toString(topology.applyToCurrentThread("compute_stage")));
+    }
+    Pending pending;
+    std::uint64_t lastSuperseded = 0U;
+    auto nextStats = std::chrono::steady_clock::now() + statsInterval_;
+    for (;;) {
+        const bool got = queue_.popFor(pending, statsInterval_);
+        if (got && downstream_ != nullptr) {
+            const std::int64_t started = common::timing::TscClock::nowNanos();
+            common::capture::currentFlight() = pending.flight;
+            try {
+                downstream_->onDataReceived(pending.data);
+            } catch (const std::exception& e) {
+                Logger::error("Track ", pending.data.getTrackId(), " processing error: ", e.what());
+            }
+            if (metrics_ != nullptr) {
+                metrics_->record(common::timing::TscClock::nowNanos() - started, queue_.stats().depth);
+            }
+        }
+        if (std::chrono::steady_clock::now() >= nextStats) {
+            logStats(lastSuperseded);
+            nextStats = std::chrono::steady_clock::now() + statsInterval_;
+        }
+        if (!got && queue_.closed()) {
+            return;   // Closed and drained
+        }
+    }
+}
+
+void ConflatingDataHandler::logStats(std::uint64_t& lastSuperseded) {
+    const common::flow::ConflationStats stats = queue_.stats();
+    if (stats.superseded != lastSuperseded) {
+        Logger::warn("Processing behind: ", stats.superseded - lastSuperseded, " samples superseded in the last ",
+                     statsInterval_.count(), " ms (total ", stats.superseded, " of ", stats.pushed,
+                     ", pending ", stats.depth, "/", stats.keys, " tracks, max ", stats.maxDepth, ")");
+        lastSuperseded = stats.superseded;
+    }
+}
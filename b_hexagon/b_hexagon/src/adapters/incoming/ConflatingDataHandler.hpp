@@ -0,0 +1,65 @@
+/**
+ * @file ConflatingDataHandler.hpp
+ * @brief Latest-value-wins handoff between the DISH receive loop and track processing
+ */
+
+#pragma once
+
+#include "domain/ports/incoming/IDataHandler.hpp"      // Inbound port interface
+#include "domain/model/ExtrapTrackData.hpp"            // Domain data model
+#include "common/ConflatingQueue.h"                    // Per-track pending slot
+#include "common/StagePipeline.h"                      // Stage metrics
+#include "common/FlightRecorder.h"                     // Stage stamps travel with the sample
+#include <chrono>                                      // Stats interval
+#include <thread>                                      // Processing thread
+
+/**
+ * @class ConflatingDataHandler
+ * @brief IDataHandler decorator that keeps one pending sample per trackId
+ *
+ * The receive loop calls onDataReceived(), which only stores the sample in
+ * the track's slot and returns, so the DISH socket is always drained at
+ * line rate. A processing thread hands the slots to the downstream
+ * handler in the order the tracks became pending. When processing falls
+ * behind, newer samples replace older ones in place (counted as
+ * superseded): the backlog is at most one sample per track and every
+ * track's next result is computed from its freshest position.
+ */
+class ConflatingDataHandler final : public IDataHandler {
+public:
+    /**
+     * @param downstream Handler run on the processing thread; must outlive this object
+     * @param statsInterval How often superseded counts are logged while samples are being dropped
+     * @param metrics Service time and pending depth of the processing thread; optional, must outlive this object
+     */
+    explicit ConflatingDataHandler(IDataHandler* downstream,
+                                   std::chrono::milliseconds statsInterval = std::chrono::seconds(5),
+                                   common::flow::StageMetrics* metrics = nullptr);
+
+    // Processes what is still pending, then stops the processing thread
+    ~ConflatingDataHandler() override;
+
+    // Disable copy and move operations (owns a running thread)
+    ConflatingDataHandler(const ConflatingDataHandler& other) = delete;
+    ConflatingDataHandler& operator=(const ConflatingDataHandler& other) = delete;
+
+    // Called on the receive thread; never blocks on processing
+    void onDataReceived(const ExtrapTrackData& data) override;
+
+    common::flow::ConflationStats stats() const { return queue_.stats(); }
+
+private:
+    struct Pending {
+        ExtrapTrackData data{};
+        common::capture::FlightEntry flight;
+    };
+
+    void processLoop();
+    void logStats(std::uint64_t& lastSuperseded);
+
+    IDataHandler* const downstream_;
+    const std::chrono::milliseconds statsInterval_;
+    common::flow::StageMetrics* const metrics_;
+    common::flow::ConflatingQueue<Pending> queue_;
+    std::thread worker_;
+};
@@ -0,0 +1,30 @@
+/**
+ * @file StagedDataHandler.cpp
+ * @brief Hands received samples to the compute stage through a lock-free ring
+ */
+
+#include "adapters/incoming/StagedDataHandler.hpp"  // Own header
+#include "common/Logger.hpp"                        // Logging
+#include <exception>                                // std::exception
+
+StagedDataHandler::StagedDataHandler(IDataHandler* downstream, std::size_t capacity,
+                                     common::flow::StageMetrics& metrics)
+    : downstream_(downstream),
+      worker_("compute_stage", capacity, metrics, [this](Item& item) { process(item); }) {
+}
+
+void StagedDataHandler::onDataReceived(const ExtrapTrackData& data) {
+    worker_.push(Item{data, common::capture::currentFlight()});
+}
+
+void StagedDataHandler::process(Item& item) {
+    if (downstream_ == nullptr) {
+        return;
+    }
+    common::capture::currentFlight() = item.flight;
+    try {
+        downstream_->onDataReceived(item.data);
+    } catch (const std::exception& e) {
+        Logger::error("Track ", item.data.getTrackId(), " processing error: ", e.what());
+    }
+}
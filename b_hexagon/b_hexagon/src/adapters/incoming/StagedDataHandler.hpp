@@ -0,0 +1,44 @@
+/**
+ * @file StagedDataHandler.hpp
+ * @brief Hands received samples to the compute stage through a lock-free ring
+ */
+
+#pragma once
+
+#include "domain/ports/incoming/IDataHandler.hpp"      // Inbound port interface
+#include "domain/model/ExtrapTrackData.hpp"            // Domain data model
+#include "common/StagePipeline.h"                      // Ring, stage thread and metrics
+#include "common/FlightRecorder.h"                     // Stage stamps travel with the sample
+#include <cstddef>                                     // std::size_t
+
+/**
+ * @class StagedDataHandler
+ * @brief IDataHandler decorator running the downstream handler on its own compute thread
+ *
+ * Every sample is kept, in order. A full ring makes the receive thread
+ * wait (counted as full waits), so use ConflatingDataHandler instead when
+ * only the newest sample per track matters.
+ */
+class StagedDataHandler final : public IDataHandler {
+public:
+    /**
+     * @param downstream Handler run on the compute thread; must outlive this object
+     * @param capacity Ring size, rounded up to a power of two
+     * @param metrics Compute stage metrics; must outlive this object
+     */
+    StagedDataHandler(IDataHandler* downstream, std::size_t capacity, common::flow::StageMetrics& metrics);
+
+    // Called on the receive thread
+    void onDataReceived(const ExtrapTrackData& data) override;
+
+private:
+    struct Item {
+        ExtrapTrackData data{};
+        common::capture::FlightEntry flight;
+    };
+
+    void process(Item& item);
+
+    IDataHandler* const downstream_;
+    common::flow::StageWorker<Item> worker_;  // Last: its thread uses the members above
+};
@@ -7,9 +7,16 @@
 
 #include "adapters/incoming/ZeroMQDataHandler.hpp"  // Own header
 #include "common/Logger.hpp"                        // Logging
+#include "common/TscClock.h"                       // Capture timestamps, service time
+#include "common/FlightRecorder.h"                 // Per-message stage stamps
+#include "common/ScopeTimer.h"                     // Cycle timers (HEXAGON_SCOPE_TIMERS)
+#include "common/Probes.h"                         // USDT probes
+#include "common/ZmqSocketProfile.h"               // Schema socket_profile
+#include "common/ZmqGroups.h"                      // Numeric partition groups
 #include <stdexcept>      // Exception types
 #include <cstring>        // Memory operations
 #include <sstream>        // String stream for endpoint formatting
+#include <vector>         // Group id lists
 
 // Using declarations for convenience
 using domain::model::ExtrapTrackData;
@@ -24,10 +31,22 @@ using domain::model::ExtrapTrackData;
 
 // Default constructor - uses configuration from ExtrapTrackData domain model
 ZeroMQDataHandler::ZeroMQDataHandler(IDataHandler* dataReceiver)
+    : ZeroMQDataHandler(dataReceiver,
+                        common::groups::schemeOf<ExtrapTrackData>("ExtrapTrackData"),  // Group name matches message type
+                        ExtrapTrackData::GROUP_SELECTION) {
+}
+
+// Constructor with explicit group scheme and selection
+ZeroMQDataHandler::ZeroMQDataHandler(IDataHandler* dataReceiver,
+                                     const common::groups::TrackGroupScheme& groupScheme,
+                                     const std::string& selection)
     : context_(1),
       socket_(context_, ZMQ_DISH),
-      group_("ExtrapTrackData"),  // Group name matches message type
-      dataReceiver_(dataReceiver) {
+      group_(groupScheme.getBaseGroup()),
+      dataReceiver_(dataReceiver),
+      capture_(common::capture::CaptureWriter::fromEnvironment("b_hexagon_dish")),
+      receivedCount_(common::metrics::MetricsSegment::process().counter("dish.received")),
+      errorCount_(common::metrics::MetricsSegment::process().counter("dish.errors")) {
     
     try {
         // Build endpoint from ExtrapTrackData configuration constants
@@ -37,9 +56,23 @@ ZeroMQDataHandler::ZeroMQDataHandler(IDataHandler* dataReceiver)
             << ExtrapTrackData::ZMQ_PORT;
         std::string endpoint = oss.str();
         
-        // Bind and join group using C++ API
-        socket_.bind(endpoint);
-        socket_.join(group_.c_str());
+        // Kernel socket knobs from the schema's socket_profile, before bind
+        const common::net::UdpSocketProfile profile =
+            common::net::UdpSocketProfile::preset(ExtrapTrackData::SOCKET_PROFILE);
+        common::net::applySocketProfile(socket_, profile);
+        Logger::info("ZeroMQDataHandler socket profile: ", profile.toString());
+        
+        // Bind and join group(s) using C++ API
+        if (groupScheme.isPartitioned()) {
+            const std::vector<std::uint32_t> groupIds = groupScheme.groupIdsForSelection(selection);
+            common::groups::enableNumericGroups(socket_);
+            socket_.bind(endpoint);
+            common::groups::joinGroupIds(socket_, groupIds);
+            Logger::info("ZeroMQDataHandler joined ", groupIds.size(), " partition groups for selection: ", selection);
+        } else {
+            socket_.bind(endpoint);
+            socket_.join(group_.c_str());
+        }
         
         Logger::info("ZeroMQDataHandler configured from ExtrapTrackData constants -> " + endpoint);
         
@@ -62,18 +95,22 @@ void ZeroMQDataHandler::startReceiving() {
                 continue; // No message received
             }
             
+            const std::int64_t receivedNs = common::timing::TscClock::nowNanos();
+            common::capture::FlightEntry& flight = common::capture::currentFlight();
+            flight = common::capture::FlightEntry();
+            flight.receiveNs = receivedNs;
+            flight.sequence = common::capture::FlightRecorder::process().nextSequence();
+            HEXAGON_PROBE_RECEIVED(flight.sequence, receivedNs, message.size());
+            receivedCount_.add();
             Logger::debug("Received ZMQ message, size: ", message.size(), " bytes");
             
-            // Get group identifier from received message
-            const char* msg_group = message.group();
-            
-            // Verify message group matches our subscribed group
-            if (msg_group == nullptr || group_ != std::string(msg_group)) {
-                Logger::warn("Message received for wrong group: ", (msg_group ? msg_group : "null"));
-                continue;  // Skip messages not for our group
+            // Record the raw frame before decoding so replays see exactly what arrived
+            if (capture_) {
+                capture_->append(common::timing::TscClock::nowNanos(), message.group(), message.data(), message.size());
             }
             
-            Logger::info("Processing message from group: ", msg_group);
+            // DISH socket only delivers joined groups; no need to re-compare the group string
+            Logger::debug("Processing message from group: ", message.group());
             
             // Extract binary payload
             const uint8_t* binaryData = static_cast<const uint8_t*>(message.data());
@@ -81,16 +118,27 @@ void ZeroMQDataHandler::startReceiving() {
             
             // Deserialize binary data to domain object
             ExtrapTrackData data = deserializeBinary(binaryData, dataSize);
+            flight.trackId = data.getTrackId();
+            flight.decodeNs = common::timing::TscClock::nowNanos();
+            HEXAGON_PROBE_DECODED(flight.trackId, flight.sequence, flight.decodeNs);
             
             // Notify domain layer
             if (dataReceiver_ != nullptr) {
                 dataReceiver_->onDataReceived(data);
             }
             
+            // Everything downstream of recv that ran on this thread
+            if (stageMetrics_ != nullptr) {
+                stageMetrics_->record(common::timing::TscClock::nowNanos() - receivedNs, 0U);
+            }
+            
         } catch (const zmq::error_t& e) {
             throw std::runtime_error("ZeroMQ receive failed: " + std::string(e.what()));
         } catch (const std::exception& ex) {
             // Log error but continue processing (don't terminate reception loop)
+            errorCount_.add();
+            HEXAGON_PROBE_DROPPED(common::capture::currentFlight().trackId, common::capture::currentFlight().sequence,
+                                  common::timing::TscClock::nowNanos(), common::probes::PROBE_DROP_DECODE);
             Logger::error("Message processing error: ", ex.what());
         }
     }
@@ -98,6 +146,7 @@ void ZeroMQDataHandler::startReceiving() {
 
 // Deserialize binary data to ExtrapTrackData object
 ExtrapTrackData ZeroMQDataHandler::deserializeBinary(const uint8_t* data, std::size_t size) {
+    HEXAGON_SCOPE_TIMER("deserialize");
     // Güncellenmiş modelin binary deserialization özelliğini kullan
     ExtrapTrackData extrapData; // default constructed
     std::vector<uint8_t> binary_data(data, data + size);
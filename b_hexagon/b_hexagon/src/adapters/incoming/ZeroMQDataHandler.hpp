@@ -7,6 +7,10 @@
 
 #include "domain/ports/incoming/IDataHandler.hpp"      // Inbound port interface
 #include "domain/model/ExtrapTrackData.hpp"                   // Domain data model
+#include "common/TrackGroups.h"                          // Per-track / per-region group scheme
+#include "common/CaptureFile.h"                          // Optional capture tap
+#include "common/StagePipeline.h"                        // Receive stage metrics
+#include "common/MetricsSegment.h"                       // hexstat counters
 #include <zmq.hpp>                                       // ZeroMQ C++ bindings
 #include <string>                                        // String utilities
 #include <memory>                                        // Smart pointers
@@ -26,12 +30,21 @@ using domain::model::ExtrapTrackData;
  * - Deserializes binary messages to ExtrapTrackData objects
  * 
  * Uses configuration constants from ExtrapTrackData domain model.
+ * With a partitioned TrackGroupScheme the socket joins only the numeric
+ * groups of the selected track ranges or region, so libzmq discards
+ * other tracks before they are deserialized.
  */
 class ZeroMQDataHandler final {
 public:
-    // Default constructor - uses configuration from ExtrapTrackData domain model
+    // Default constructor - uses configuration from ExtrapTrackData domain model,
+    // including its group_partitioning and group_selection
     explicit ZeroMQDataHandler(IDataHandler* dataReceiver = nullptr);
 
+    // Join only the groups of selection (see TrackGroupScheme::groupIdsForSelection)
+    ZeroMQDataHandler(IDataHandler* dataReceiver,
+                      const common::groups::TrackGroupScheme& groupScheme,
+                      const std::string& selection);
+
     // Destructor - RAII cleanup
     ~ZeroMQDataHandler() noexcept = default;
 
@@ -46,6 +59,9 @@ public:
     // Start continuous message reception loop
     void startReceiving();
 
+    // Record per-message service time (deserialize + handoff) into metrics; must outlive the loop
+    void setStageMetrics(common::flow::StageMetrics* metrics) noexcept { stageMetrics_ = metrics; }
+
 private:
     // Deserialize binary data to ExtrapTrackData object
     static ExtrapTrackData deserializeBinary(const uint8_t* data, std::size_t size);
@@ -54,4 +70,8 @@ private:
     zmq::socket_t socket_;             // DISH socket for UDP multicast
     const std::string group_;          // Group identifier for filtering
     IDataHandler* const dataReceiver_; // Domain notification interface
+    std::unique_ptr<common::capture::CaptureWriter> capture_; // Set when HEXAGON_CAPTURE_DIR is
+    common::flow::StageMetrics* stageMetrics_ = nullptr; // Receive stage metrics, optional
+    common::metrics::Counter receivedCount_;   // Written by the receive loop only
+    common::metrics::Counter errorCount_;
 };
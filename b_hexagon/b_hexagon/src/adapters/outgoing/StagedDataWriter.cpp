@@ -0,0 +1,28 @@
+/**
+ * @file StagedDataWriter.cpp
+ * @brief Moves serialization and the RADIO send onto a dedicated send stage
+ */
+
+#include "adapters/outgoing/StagedDataWriter.hpp"  // Own header
+#include "common/Logger.hpp"                       // Logging
+#include <exception>                               // std::exception
+#include <utility>                                 // std::move
+
+StagedDataWriter::StagedDataWriter(std::unique_ptr<IDataWriter> downstream, std::size_t capacity,
+                                   common::flow::StageMetrics& metrics)
+    : downstream_(std::move(downstream)),
+      worker_("send_stage", capacity, metrics, [this](Item& item) { send(item); }) {
+}
+
+void StagedDataWriter::sendData(const DelayCalcTrackData& data) {
+    worker_.push(Item{data, common::capture::currentFlight()});
+}
+
+void StagedDataWriter::send(Item& item) {
+    common::capture::currentFlight() = item.flight;
+    try {
+        downstream_->sendData(item.data);
+    } catch (const std::exception& e) {
+        Logger::error("Send failed for track ", item.data.getTrackId(), ": ", e.what());
+    }
+}
@@ -0,0 +1,45 @@
+/**
+ * @file StagedDataWriter.hpp
+ * @brief Moves serialization and the RADIO send onto a dedicated send stage
+ */
+
+#pragma once
+
+#include "domain/ports/outgoing/IDataWriter.hpp"       // Outbound port interface
+#include "domain/model/DelayCalcTrackData.hpp"         // Domain data model
+#include "common/StagePipeline.h"                      // Ring, stage thread and metrics
+#include "common/FlightRecorder.h"                     // Stage stamps travel with the result
+#include <cstddef>                                     // std::size_t
+#include <memory>                                      // Smart pointers
+
+/**
+ * @class StagedDataWriter
+ * @brief IDataWriter decorator running the wrapped writer on its own send thread
+ *
+ * sendData() only copies the result into the ring, so a slow or blocking
+ * send no longer holds up the compute stage. Results keep their order.
+ */
+class StagedDataWriter final : public IDataWriter {
+public:
+    /**
+     * @param downstream Writer run on the send thread
+     * @param capacity Ring size, rounded up to a power of two
+     * @param metrics Send stage metrics; must outlive this object
+     */
+    StagedDataWriter(std::unique_ptr<IDataWriter> downstream, std::size_t capacity,
+                     common::flow::StageMetrics& metrics);
+
+    // Called on the compute thread
+    void sendData(const DelayCalcTrackData& data) override;
+
+private:
+    struct Item {
+        DelayCalcTrackData data{};
+        common::capture::FlightEntry flight;
+    };
+
+    void send(Item& item);
+
+    std::unique_ptr<IDataWriter> downstream_;
+    common::flow::StageWorker<Item> worker_;  // Last: joined before downstream_ is destroyed
+};
@@ -7,6 +7,13 @@
 
 #include "adapters/outgoing/ZeroMQDataWriter.hpp"  // Own header
 #include "common/Logger.hpp"                       // Logging utility
+#include "common/PooledMessage.h"                  // Pooled zero-copy payloads
+#include "common/FlightRecorder.h"                 // Per-message stage stamps
+#include "common/TscClock.h"                       // Send stamp
+#include "common/ScopeTimer.h"                     // Cycle timers (HEXAGON_SCOPE_TIMERS)
+#include "common/Probes.h"                         // USDT probes
+#include "common/ZmqSocketProfile.h"               // Schema socket_profile
+#include "common/ZmqGroups.h"                      // Numeric partition groups
 #include <sstream>        // String stream for endpoint formatting
 #include <cstring>        // Memory operations
 #include <stdexcept>      // Exception types
@@ -17,11 +24,25 @@ using domain::model::DelayCalcTrackData;
 
 // Default constructor - uses configuration from DelayCalcTrackData domain model
 ZeroMQDataWriter::ZeroMQDataWriter()
+    : ZeroMQDataWriter(common::groups::schemeOf<DelayCalcTrackData>("DelayCalcTrackData")) {  // Group name matches message type
+}
+
+// Constructor with explicit group scheme
+ZeroMQDataWriter::ZeroMQDataWriter(const common::groups::TrackGroupScheme& groupScheme)
     : context_(1),
       socket_(context_, ZMQ_RADIO),
-      group_("DelayCalcTrackData") {  // Group name matches message type
+      group_(groupScheme.getBaseGroup()),
+      groupScheme_(groupScheme),
+      sentCount_(common::metrics::MetricsSegment::process().counter("radio.sent")),
+      errorCount_(common::metrics::MetricsSegment::process().counter("radio.errors")),
+      latencyNs_(common::metrics::MetricsSegment::process().histogram("track.latency_ns")) {
     
     try {
+        // Partitioned schemes publish numeric group ids
+        if (groupScheme_.isPartitioned()) {
+            common::groups::enableNumericGroups(socket_);
+        }
+        
         // Build endpoint from DelayCalcTrackData configuration constants
         std::ostringstream oss;
         oss << DelayCalcTrackData::ZMQ_PROTOCOL << "://"
@@ -32,6 +53,12 @@ ZeroMQDataWriter::ZeroMQDataWriter()
         Logger::info("Initializing ZeroMQDataWriter from DelayCalcTrackData constants");
         Logger::info("Endpoint: ", endpoint, ", Group: ", group_);
         
+        // Kernel socket knobs from the schema's socket_profile, before connect
+        const common::net::UdpSocketProfile profile =
+            common::net::UdpSocketProfile::preset(DelayCalcTrackData::SOCKET_PROFILE);
+        common::net::applySocketProfile(socket_, profile);
+        Logger::info("Socket profile: ", profile.toString());
+        
         // Connect to the endpoint (RADIO typically connects)
         Logger::debug("Connecting RADIO socket to endpoint: ", endpoint);
         socket_.connect(endpoint);
@@ -48,48 +75,72 @@ void ZeroMQDataWriter::sendData(const DelayCalcTrackData& data) {
     
     Logger::debug("Sending DelayCalcTrackData for track ID: ", data.getTrackId());
     
-    // Validate input data
-    if (!data.isValid()) {
-        Logger::error("Attempted to send invalid DelayCalcTrackData for track ID: ", data.getTrackId());
-        throw std::invalid_argument("ZeroMQDataWriter::send: Invalid DelayCalcTrackData");
-    }
+    // No second range check: records are built by DelayCalcTrackData::fromFields, which checked them once
     
     try {
-        // Güncellenmiş modelin binary serialization özelliğini kullan
-        std::vector<uint8_t> binaryData = data.serialize();
+        // Serialize straight into a pooled block; libzmq returns it on release
+        common::pool::PooledBuffer buffer = common::pool::MessageBufferPool::local().acquire(data.getSerializedSize());
+        std::size_t payloadSize = 0U;
+        {
+            HEXAGON_SCOPE_TIMER("serialize");
+            payloadSize = data.serializeTo(buffer.data(), buffer.capacity());
+        }
         
-        Logger::debug("Generated binary payload for track ", data.getTrackId(), " - Size: ", binaryData.size(), " bytes");
+        Logger::debug("Generated binary payload for track ", data.getTrackId(), " - Size: ", payloadSize, " bytes");
         
-        if (binaryData.empty()) {
+        if (payloadSize == 0U) {
             Logger::error("Empty binary payload generated for track ID: ", data.getTrackId());
             throw std::runtime_error("ZeroMQDataWriter::sendData: Empty binary payload generated");
         }
         
-        // Create C++ API message with binary payload
-        zmq::message_t processed_msg(binaryData.begin(), binaryData.end());
+        // Create C++ API message around the pooled payload (no copy)
+        zmq::message_t processed_msg = common::pool::toMessage(buffer, payloadSize);
         
         // Set group identifier for DISH filtering
-        Logger::debug("Setting message group to: ", group_);
-        processed_msg.set_group(group_.c_str());
+        if (groupScheme_.isPartitioned()) {
+            common::groups::setGroupId(processed_msg, groupScheme_.groupIdFor(data.getTrackId(), data.getXPositionECEF(),
+                                                                              data.getYPositionECEF(), data.getZPositionECEF()));
+        } else {
+            Logger::debug("Setting message group to: ", group_);
+            processed_msg.set_group(group_.c_str());
+        }
         
         // Send via RADIO socket
         Logger::debug("Transmitting message via RADIO socket...");
-        auto send_result = socket_.send(processed_msg, zmq::send_flags::none);
+        zmq::send_result_t send_result;
+        {
+            HEXAGON_SCOPE_TIMER("send");
+            send_result = socket_.send(processed_msg, zmq::send_flags::none);
+        }
         
-        if (!send_result || *send_result != binaryData.size()) {
-            Logger::error("ZeroMQ RADIO transmission failed or partial send - expected: ", binaryData.size(), 
+        if (!send_result || *send_result != payloadSize) {
+            Logger::error("ZeroMQ RADIO transmission failed or partial send - expected: ", payloadSize, 
                          ", sent: ", (send_result ? *send_result : 0));
             throw std::runtime_error("ZeroMQ RADIO transmission failed or partial send");
         }
         
         Logger::info("Successfully transmitted track ", data.getTrackId(), " (", *send_result, " bytes) to group: ", group_);
         
+        // Last stage: close this message's flight entry
+        common::capture::FlightEntry& flight = common::capture::currentFlight();
+        flight.sendNs = common::timing::TscClock::nowNanos();
+        common::capture::FlightRecorder::process().record(flight);
+        sentCount_.add();
+        latencyNs_.record(static_cast<std::uint64_t>(flight.sendNs - flight.receiveNs));
+        HEXAGON_PROBE_SENT(flight.trackId, flight.sequence, flight.sendNs, flight.sendNs - flight.receiveNs);
+        
     } catch (const zmq::error_t& e) {
         Logger::error("ZeroMQ error during transmission for track ", data.getTrackId(), ": ", e.what());
+        errorCount_.add();
+        HEXAGON_PROBE_DROPPED(data.getTrackId(), common::capture::currentFlight().sequence,
+                              common::timing::TscClock::nowNanos(), common::probes::PROBE_DROP_SEND);
         throw std::runtime_error("ZeroMQDataWriter::send: ZeroMQ RADIO transmission error - " + 
             std::string(e.what()));
     } catch (const std::exception& e) {
         Logger::error("Critical sendData failure for track ", data.getTrackId(), ": ", e.what());
+        errorCount_.add();
+        HEXAGON_PROBE_DROPPED(data.getTrackId(), common::capture::currentFlight().sequence,
+                              common::timing::TscClock::nowNanos(), common::probes::PROBE_DROP_SEND);
         throw std::runtime_error("ZeroMQDataWriter::send: DelayCalcTrackData transmission failed - " + 
             std::string(e.what()));
     }
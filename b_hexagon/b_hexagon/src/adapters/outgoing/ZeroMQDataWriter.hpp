@@ -8,6 +8,8 @@
 #define ZMQ_BUILD_DRAFT_API  // Enable RADIO/DISH socket types
 #include "domain/ports/outgoing/IDataWriter.hpp"        // Outbound port interface
 #include "domain/model/DelayCalcTrackData.hpp"    // Domain data model
+#include "common/TrackGroups.h"                    // Per-track / per-region group scheme
+#include "common/MetricsSegment.h"                 // hexstat counters
 #include <zmq.hpp>                                       // ZeroMQ C++ bindings
 #include <string>                                        // String utilities
 
@@ -25,12 +27,18 @@ using domain::model::DelayCalcTrackData;
  * - DISH receivers filter by group using zmq_join()
  * 
  * Uses configuration constants from DelayCalcTrackData domain model.
+ * With a partitioned TrackGroupScheme each track is published on its own
+ * numeric group (track range or geo cell) instead of "DelayCalcTrackData".
  */
 class ZeroMQDataWriter final : public IDataWriter {
 public:
-    // Default constructor - uses configuration from DelayCalcTrackData domain model
+    // Default constructor - uses configuration from DelayCalcTrackData domain model,
+    // including its group_partitioning
     explicit ZeroMQDataWriter();
 
+    // Publish on the groups of the given scheme (must match the DISH side)
+    explicit ZeroMQDataWriter(const common::groups::TrackGroupScheme& groupScheme);
+
     // Destructor - RAII cleanup
     ~ZeroMQDataWriter() noexcept = default;
 
@@ -49,4 +57,8 @@ private:
     zmq::context_t context_;      // ZeroMQ context
     zmq::socket_t socket_;        // RADIO socket for UDP multicast
     const std::string group_;     // Group identifier for DISH filtering
+    const common::groups::TrackGroupScheme groupScheme_;  // Group per track when partitioned
+    common::metrics::Counter sentCount_;          // Written by the sending thread only
+    common::metrics::Counter errorCount_;
+    common::metrics::Histogram latencyNs_;        // Receive to send, from the flight entry
 };
@@ -0,0 +1,171 @@
+/**
+ * @file TrackPipeline.cpp
+ * @brief Splits receive, compute and send into pipeline stages on their own threads
+ */
+
+#include "application/TrackPipeline.hpp"            // Own header
+#include "adapters/incoming/ConflatingDataHandler.hpp"  // Latest-value handoff
+#include "adapters/incoming/StagedDataHandler.hpp"  // Ring handoff
+#include "adapters/outgoing/StagedDataWriter.hpp"   // Send stage
+#include "common/KeyValueFile.h"                    // config/pipeline.conf
+#include "common/Logger.hpp"                        // Logging
+#include "common/ThreadTopology.h"                  // receive_stage placement
+#include <chrono>                                   // Report interval
+#include <cstdlib>                                  // getenv, strtol
+#include <sstream>                                  // Stage list
+#include <stdexcept>                                // Exception types
+#include <utility>                                  // std::move
+
+namespace {
+
+constexpr const char* DEFAULT_PIPELINE_PATH = "config/pipeline.conf";
+
+long parseNumber(const std::string& key, const std::string& value, long minimum, long maximum) {
+    char* end = nullptr;
+    const long parsed = std::strtol(value.c_str(), &end, 10);
+    if (value.empty() || end == nullptr || *end != '\0' || parsed < minimum || parsed > maximum) {
+        throw std::invalid_argument("Pipeline: " + key + " must be in [" + std::to_string(minimum) + ", " +
+                                    std::to_string(maximum) + "]: " + value);
+    }
+    return parsed;
+}
+
+bool parseFlag(const std::string& key, const std::string& value) {
+    if (value == "true" || value == "1" || value == "on") {
+        return true;
+    }
+    if (value == "false" || value == "0" || value == "off") {
+        return false;
+    }
+    throw std::invalid_argument("Pipeline: " + key + " must be true or false: " + value);
+}
+
+} // namespace
+
+PipelineOptions PipelineOptions::fromConfig(const std::map<std::string, std::string>& config) {
+    PipelineOptions options;
+    for (const auto& entry : config) {
+        if (entry.first == "stages") {
+            options.stages = static_cast<int>(parseNumber(entry.first, entry.second, 1, 3));
+        } else if (entry.first == "ring_capacity") {
+            options.ringCapacity = static_cast<std::size_t>(parseNumber(entry.first, entry.second, 1, 1L << 20));
+        } else if (entry.first == "conflate") {
+            options.conflate = parseFlag(entry.first, entry.second);
+        } else if (entry.first == "stats_interval_ms") {
+            options.statsIntervalMs = static_cast<int>(parseNumber(entry.first, entry.second, 0, 3600000));
+        } else {
+            throw std::invalid_argument("Pipeline: unknown key " + entry.first);
+        }
+    }
+    return options;
+}
+
+PipelineOptions PipelineOptions::fromFile(const std::string& path) {
+    return fromConfig(common::config::readKeyValueFile(path, "Pipeline"));
+}
+
+PipelineOptions PipelineOptions::process() {
+    const char* env = std::getenv("HEXAGON_PIPELINE");
+    const std::string path = (env != nullptr && env[0] != '\0') ? env : DEFAULT_PIPELINE_PATH;
+    try {
+        return fromFile(path);
+    } catch (const std::exception& e) {
+        Logger::warn(path, " ignored: ", e.what());
+        return PipelineOptions();
+    }
+}
+
+TrackPipeline::TrackPipeline(const PipelineOptions& options) : options_(options) {
+    const std::size_t capacity = options_.ringCapacity;
+    switch (options_.stages) {
+        case 1:
+            metrics_.push_back(std::make_unique<common::flow::StageMetrics>("receive+compute+send"));
+            break;
+        case 2:
+            metrics_.push_back(std::make_unique<common::flow::StageMetrics>("receive"));
+            metrics_.push_back(std::make_unique<common::flow::StageMetrics>(
+                "compute+send", options_.conflate ? 0U : capacity));
+            break;
+        default:
+            metrics_.push_back(std::make_unique<common::flow::StageMetrics>("receive"));
+            metrics_.push_back(std::make_unique<common::flow::StageMetrics>(
+                "compute", options_.conflate ? 0U : capacity));
+            metrics_.push_back(std::make_unique<common::flow::StageMetrics>("send", capacity));
+            break;
+    }
+}
+
+TrackPipeline::~TrackPipeline() {
+    {
+        std::lock_guard<std::mutex> lock(reportMutex_);
+        stopping_ = true;
+    }
+    reportWake_.notify_all();
+    if (reporter_.joinable()) {
+        reporter_.join();
+    }
+}
+
+std::unique_ptr<IDataWriter> TrackPipeline::wrapWriter(std::unique_ptr<IDataWriter> writer) {
+    if (options_.stages < 3) {
+        return writer;
+    }
+    return std::make_unique<StagedDataWriter>(std::move(writer), options_.ringCapacity, *metrics_[2]);
+}
+
+std::unique_ptr<IDataHandler> TrackPipeline::wrapHandler(IDataHandler* compute) {
+    if (options_.stages < 2) {
+        return nullptr;
+    }
+    if (options_.conflate) {
+        const std::chrono::milliseconds statsInterval(options_.statsIntervalMs > 0 ? options_.statsIntervalMs : 5000);
+        return std::make_unique<ConflatingDataHandler>(compute, statsInterval, metrics_[1].get());
+    }
+    return std::make_unique<StagedDataHandler>(compute, options_.ringCapacity, *metrics_[1]);
+}
+
+void TrackPipeline::pinReceiveThread() {
+    common::topology::ThreadTopology& topology = common::topology::ThreadTopology::process();
+    if (topology.hasRole("receive_stage")) {
+        Logger::info("Receive stage placement: ",
+                     common::topology::ThreadTopology::toString(topology.applyToCurrentThread("receive_stage")));
+    }
+}
+
+void TrackPipeline::startReporting() {
+    if (options_.statsIntervalMs > 0 && !reporter_.joinable()) {
+        reporter_ = std::thread(&TrackPipeline::reportLoop, this);
+    }
+}
+
+std::string TrackPipeline::describe() const {
+    std::ostringstream out;
+    out << options_.stages << " stage(s): ";
+    for (std::size_t stage = 0U; stage < metrics_.size(); ++stage) {
+        out << (stage > 0U ? " | " : "") << metrics_[stage]->name();
+    }
+    if (options_.stages >= 2) {
+        out << (options_.conflate ? " (receive->compute conflated per track)" : " (lock-free rings)");
+    }
+    return out.str();
+}
+
+void TrackPipeline::reportLoop() {
+    const std::chrono::milliseconds interval(options_.statsIntervalMs);
+    std::vector<common::flow::StageSnapshot> before;
+    for (const auto& metrics : metrics_) {
+        before.push_back(metrics->take());
+    }
+    std::unique_lock<std::mutex> lock(reportMutex_);
+    while (!reportWake_.wait_for(lock, interval, [this] { return stopping_; })) {
+        std::vector<common::flow::StageSnapshot> now;
+        for (const auto& metrics : metrics_) {
+            now.push_back(metrics->take());
+        }
+        if (now.front().items != before.front().items) {
+            Logger::info("Pipeline stages over the last ", interval.count(), " ms:\n",
+                         common::flow::formatStages(before, now, static_cast<double>(interval.count()) / 1000.0));
+        }
+        before = std::move(now);
+    }
+}
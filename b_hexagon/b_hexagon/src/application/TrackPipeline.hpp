@@ -0,0 +1,92 @@
+/**
+ * @file TrackPipeline.hpp
+ * @brief Splits receive, compute and send into pipeline stages on their own threads
+ */
+
+#pragma once
+
+#include "domain/ports/incoming/IDataHandler.hpp"      // Inbound port interface
+#include "domain/ports/outgoing/IDataWriter.hpp"       // Outbound port interface
+#include "common/StagePipeline.h"                      // Stage metrics
+#include <atomic>                                      // Reporter stop flag
+#include <condition_variable>                          // Reporter wakeup
+#include <cstddef>                                     // std::size_t
+#include <map>                                         // Configuration entries
+#include <memory>                                      // Smart pointers
+#include <mutex>                                       // Reporter wakeup
+#include <string>                                      // Paths
+#include <thread>                                      // Reporter thread
+#include <vector>                                      // Stage list
+
+/**
+ * @brief Pipeline shape, from config/pipeline.conf
+ *
+ * stages = 1  receive, compute and send inline on the receive thread (lowest latency)
+ * stages = 2  receive | compute + send
+ * stages = 3  receive | compute | send
+ */
+struct PipelineOptions {
+    int stages = 3;
+    std::size_t ringCapacity = 1024U;   // Per stage ring, rounded up to a power of two
+    bool conflate = true;               // receive -> compute keeps only the newest sample per track
+    int statsIntervalMs = 5000;         // Stage report period; 0 disables it
+
+    /// @throws std::invalid_argument on unknown keys or out-of-range values
+    static PipelineOptions fromConfig(const std::map<std::string, std::string>& config);
+
+    /// Reads "key = value" lines; a missing file yields the defaults
+    static PipelineOptions fromFile(const std::string& path);
+
+    /// $HEXAGON_PIPELINE, else config/pipeline.conf; defaults (logged) if the file is invalid
+    static PipelineOptions process();
+};
+
+/**
+ * @class TrackPipeline
+ * @brief Wraps the ports in stage decorators and reports per-stage metrics
+ *
+ * Wiring order in the composition root:
+ *   writer  = pipeline.wrapWriter(std::move(writer));   // send stage (stages = 3)
+ *   handoff = pipeline.wrapHandler(useCase);            // compute stage (stages >= 2)
+ *   dishHandler(handoff ? handoff.get() : useCase);     // handoff declared after useCase
+ *   dishHandler.setStageMetrics(&pipeline.receiveMetrics());
+ *   pipeline.startReporting();
+ */
+class TrackPipeline final {
+public:
+    explicit TrackPipeline(const PipelineOptions& options);
+
+    // Stops the reporter; the stage decorators belong to the caller
+    ~TrackPipeline();
+
+    TrackPipeline(const TrackPipeline&) = delete;
+    TrackPipeline& operator=(const TrackPipeline&) = delete;
+
+    /// Puts writer on its own send thread when the pipeline has three stages
+    std::unique_ptr<IDataWriter> wrapWriter(std::unique_ptr<IDataWriter> writer);
+
+    /// Runs compute on its own thread from two stages up; nullptr means call compute inline
+    std::unique_ptr<IDataHandler> wrapHandler(IDataHandler* compute);
+
+    common::flow::StageMetrics& receiveMetrics() noexcept { return *metrics_.front(); }
+
+    /// Applies the receive_stage placement to the calling thread, if configured
+    void pinReceiveThread();
+
+    /// Logs every stage once per statsIntervalMs
+    void startReporting();
+
+    /// One line per stage: "receive", "compute", "send" (merged names for fewer stages)
+    std::string describe() const;
+
+private:
+    void reportLoop();
+
+    const PipelineOptions options_;
+    std::vector<std::unique_ptr<common::flow::StageMetrics>> metrics_;  // receive, [compute], [send]
+
+    std::mutex reportMutex_;
+    std::condition_variable reportWake_;
+    bool stopping_ = false;
+    std::thread reporter_;
+};
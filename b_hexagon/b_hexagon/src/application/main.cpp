@@ -8,7 +8,12 @@
 #include "domain/ports/outgoing/IDataWriter.hpp"
 #include "adapters/incoming/ZeroMQDataHandler.hpp"
 #include "adapters/outgoing/ZeroMQDataWriter.hpp"
+#include "application/TrackPipeline.hpp"
 #include "common/Logger.hpp"
+#include "common/ClockSync.h"
+#include "common/FlightRecorder.h"
+#include "common/TscClock.h"
+#include "common/Probes.h"
 #include <memory>
 #include <iostream>
 #include <thread>
@@ -43,20 +48,37 @@ public:
         Logger::info("Update Time: ", data.getUpdateTime());
         Logger::info("=====================================");
         
-        if (!data.isValid()) {
-            Logger::warn("Invalid track data received: ID=", data.getTrackId());
+        // The one range check of the incoming record; no exceptions on the processing path
+        const ExtrapTrackData::FieldError inputError = data.firstInvalidField();
+        if (inputError != ExtrapTrackData::FieldError::None) {
+            Logger::warn("Invalid track data received: ID=", data.getTrackId(),
+                         " field=", ExtrapTrackData::fieldErrorName(inputError));
+            HEXAGON_PROBE_DROPPED(data.getTrackId(), common::capture::currentFlight().sequence,
+                                  common::timing::TscClock::nowNanos(), common::probes::PROBE_DROP_INVALID);
             return;
         }
         
         try {
             // Process the track data through domain logic
-            DelayCalcTrackData processedData = calculator_->calculateDelay(data);
+            DelayCalcTrackData processedData;
+            const DelayCalcTrackData::FieldError outputError = calculator_->calculateDelay(data, processedData);
+            if (outputError != DelayCalcTrackData::FieldError::None) {
+                Logger::warn("Delay result out of range for track ", data.getTrackId(),
+                             ": field=", DelayCalcTrackData::fieldErrorName(outputError));
+                HEXAGON_PROBE_DROPPED(data.getTrackId(), common::capture::currentFlight().sequence,
+                                      common::timing::TscClock::nowNanos(), common::probes::PROBE_DROP_RANGE);
+                return;
+            }
             
             Logger::info("Processed track ", data.getTrackId(), 
                         " -> Delay: ", processedData.getFirstHopDelayTime(), "μs, ",
                         "SecondHop: ", processedData.getSecondHopSentTime(), "μs");
             
-            // Send processed data via outgoing adapter
+            common::capture::FlightEntry& flight = common::capture::currentFlight();
+            flight.computeNs = common::timing::TscClock::nowNanos();
+            HEXAGON_PROBE_COMPUTED(flight.trackId, flight.sequence, flight.computeNs);
+            
+            // Send processed data via outgoing adapter (already validated by fromFields)
             dataSender_->sendData(processedData);
             
             Logger::debug("Successfully sent processed track data for ID=", data.getTrackId());
@@ -81,11 +103,19 @@ int main() {
         
         // Create domain services
         Logger::debug("Creating CalculatorService...");
-        auto calculatorService = std::make_unique<CalculatorService>();
+        // Serves our clock to hexagon_c and polls a_hexagon's (config/clock_sync.conf)
+        const common::timing::ClockSync& clockSync = common::timing::ClockSync::process();
+        auto calculatorService = std::make_unique<CalculatorService>(clockSync.peer("a_hexagon"));
+        // Last messages' stage timestamps; kill -USR1 <pid> dumps them (HEXAGON_FLIGHT_*).
+        // Built here so the signal handler is in place before the first message arrives
+        common::capture::FlightRecorder::process();
+        
+        // Receive, compute and send stages (config/pipeline.conf)
+        TrackPipeline pipeline(PipelineOptions::process());
         
-        // Create outgoing adapter (RADIO socket)
+        // Create outgoing adapter (RADIO socket), on the send stage when there are three stages
         Logger::debug("Creating ZeroMQDataWriter (RADIO socket)...");
-        auto dataSender = std::make_unique<ZeroMQDataWriter>();
+        auto dataSender = pipeline.wrapWriter(std::make_unique<ZeroMQDataWriter>());
         
         // Create use case with dependencies
         Logger::debug("Creating ProcessTrackUseCase with dependencies...");
@@ -94,20 +124,29 @@ int main() {
             std::move(dataSender)
         );
         
-        // Create incoming adapter (DISH socket) and wire to use case
+        // Compute stage thread (stages >= 2); destroyed before the use case it calls
+        std::unique_ptr<IDataHandler> handoff = pipeline.wrapHandler(useCase.get());
+        
+        // Create incoming adapter (DISH socket) and wire to the compute stage
         Logger::info("Creating ZeroMQDataHandler (DISH socket)...");
-        ZeroMQDataHandler dataHandler(useCase.get());
+        ZeroMQDataHandler dataHandler(handoff ? handoff.get() : useCase.get());
+        dataHandler.setStageMetrics(&pipeline.receiveMetrics());
         
         Logger::info("=== System Configuration ===");
         Logger::info("Architecture: Hexagonal (Ports & Adapters)");
         Logger::info("Messaging: ZeroMQ RADIO/DISH UDP multicast");
         Logger::info("Endpoint: udp://239.255.0.1:7779");
         Logger::info("Group: TRACK_DATA_UDP");
+        Logger::info("Pipeline: ", pipeline.describe());
+        Logger::info("Clock sync: ", clockSync.peer("a_hexagon") != nullptr ? "polling a_hexagon" : "off (delays assume synchronized clocks)",
+                     clockSync.listenPort() != 0U ? ", serving on udp port " + std::to_string(clockSync.listenPort()) : std::string());
         Logger::info("Status: Ready to receive track data");
         Logger::info("===============================");
         
         // Start receiving messages (blocks indefinitely)
         Logger::info("Starting message reception loop...");
+        pipeline.pinReceiveThread();
+        pipeline.startReporting();
         dataHandler.startReceiving();
         
     } catch (const std::exception& ex) {
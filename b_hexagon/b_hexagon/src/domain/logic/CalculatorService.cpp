@@ -5,8 +5,24 @@
 
 #include "domain/logic/CalculatorService.hpp"
 #include "common/Logger.hpp"
+#include "common/TscClock.h"
+#include "common/ScopeTimer.h"
+#include <stdexcept>
+#include <string>
 
 DelayCalcTrackData CalculatorService::calculateDelay(const ExtrapTrackData& trackData) const {
+    DelayCalcTrackData result;
+    const DelayCalcTrackData::FieldError error = calculateDelay(trackData, result);
+    if (error != DelayCalcTrackData::FieldError::None) {
+        throw std::out_of_range(std::string("DelayCalcTrackData field out of range: ") +
+                                DelayCalcTrackData::fieldErrorName(error));
+    }
+    return result;
+}
+
+DelayCalcTrackData::FieldError CalculatorService::calculateDelay(const ExtrapTrackData& trackData,
+                                                                 DelayCalcTrackData& result) const {
+    HEXAGON_SCOPE_TIMER("calculate_delay");
     Logger::debug("Processing track ", trackData.getTrackId(), " - calculating delay metrics");
     
     // Get current processing time for second hop
@@ -17,44 +33,37 @@ DelayCalcTrackData CalculatorService::calculateDelay(const ExtrapTrackData& trac
         Logger::warn("Invalid firstHopSentTime for track ", trackData.getTrackId(), ": ", trackData.getFirstHopSentTime());
     }
     
-    // Create result with calculated values
-    DelayCalcTrackData result;
-    
-    // Copy all original track data
-    result.setTrackId(trackData.getTrackId());
-    result.setXVelocityECEF(trackData.getXVelocityECEF());
-    result.setYVelocityECEF(trackData.getYVelocityECEF());
-    result.setZVelocityECEF(trackData.getZVelocityECEF());
-    result.setXPositionECEF(trackData.getXPositionECEF());
-    result.setYPositionECEF(trackData.getYPositionECEF());
-    result.setZPositionECEF(trackData.getZPositionECEF());
-    result.setUpdateTime(trackData.getUpdateTime());
-    result.setOriginalUpdateTime(trackData.getOriginalUpdateTime());
-    result.setFirstHopSentTime(trackData.getFirstHopSentTime());
-    
-    // Calculate first hop delay (current time - first hop sent time)
-    result.setFirstHopDelayTime(calculateTimeDelta(trackData.getFirstHopSentTime(), currentTime));
+    // Calculate first hop delay (current time on a_hexagon's clock - first hop sent time)
+    common::timing::ClockOffset offset;
+    long receiveTimeOnSender = currentTime;
+    if (upstreamClock_ != nullptr) {
+        offset = upstreamClock_->estimate();
+        if (offset.valid) {
+            receiveTimeOnSender = currentTime + static_cast<long>(offset.offsetAt(currentTime * 1000L) / 1000);
+        }
+    }
     
-    // Set second hop sent time as current time
-    result.setSecondHopSentTime(currentTime);
+    // Copy the original track data and add the delays; one range check for the whole record
+    const DelayCalcTrackData::FieldError error = result.fromFields(
+        trackData.getTrackId(),
+        trackData.getXVelocityECEF(), trackData.getYVelocityECEF(), trackData.getZVelocityECEF(),
+        trackData.getXPositionECEF(), trackData.getYPositionECEF(), trackData.getZPositionECEF(),
+        trackData.getOriginalUpdateTime(), trackData.getUpdateTime(), trackData.getFirstHopSentTime(),
+        calculateTimeDelta(trackData.getFirstHopSentTime(), receiveTimeOnSender),
+        currentTime);  // Second hop sent time
     
     Logger::info("Track ", trackData.getTrackId(), " delay calculation complete - first hop delay: ", 
-                 result.getFirstHopDelayTime(), " μs, second hop time: ", result.getSecondHopSentTime());
+                 result.getFirstHopDelayTime(), " μs (clock offset ", common::timing::toString(offset),
+                 "), second hop time: ", result.getSecondHopSentTime());
     Logger::info("CURRENT TIME <>>>>>>>  ",currentTime);
     Logger::info("getFirstHopSentTime TIME <>>>>>>>  ",trackData.getFirstHopSentTime());
     
-    return result;
+    return error;
 }
 
 long CalculatorService::getCurrentTimeMicroseconds() const noexcept {
-    try {
-        auto now = std::chrono::system_clock::now();
-        auto duration = now.time_since_epoch();
-        // Microsecond precision kullan (nanosecond yerine)
-        return std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
-    } catch (...) {
-        return 0L;  // Fallback value if time acquisition fails
-    }
+    // Calibrated TSC read; same epoch as system_clock, microsecond precision
+    return static_cast<long>(common::timing::TscClock::nowMicros());
 }
 
 long CalculatorService::calculateTimeDelta(long originalTime, long currentTime) const noexcept {
@@ -7,6 +7,7 @@
 
 #include "domain/model/ExtrapTrackData.hpp"
 #include "domain/model/DelayCalcTrackData.hpp"
+#include "common/ClockSync.h"
 #include <chrono>
 
 // Using declarations for convenience
@@ -24,6 +25,16 @@ public:
      */
     CalculatorService() = default;
 
+    /**
+     * @brief Constructor with the upstream clock estimate
+     * @param upstreamClock a_hexagon's clock relative to ours; nullptr treats the clocks as equal
+     *
+     * firstHopSentTime is stamped on a_hexagon's clock, so the receive time
+     * is moved onto that clock before subtracting.
+     */
+    explicit CalculatorService(const common::timing::ClockOffsetEstimator* upstreamClock) noexcept
+        : upstreamClock_(upstreamClock) {}
+
     /**
      * @brief Destructor
      */
@@ -41,9 +52,18 @@ public:
      * @brief Calculate delay between original update time and current time
      * @param trackData Input track data with timing information
      * @return DelayCalcTrackData with computed delay value
+     * @throws std::out_of_range if a computed field is out of range
      */
     DelayCalcTrackData calculateDelay(const ExtrapTrackData& trackData) const;
 
+    /**
+     * @brief Exception-free variant for the processing path
+     * @param trackData Input track data with timing information
+     * @param result Receives the computed record, range-checked once by DelayCalcTrackData::fromFields
+     * @return FieldError::None, or the first field of result that is out of range
+     */
+    DelayCalcTrackData::FieldError calculateDelay(const ExtrapTrackData& trackData, DelayCalcTrackData& result) const;
+
 private:
     /**
      * @brief Get current time in microseconds since epoch
@@ -58,4 +78,6 @@ private:
      * @return Calculated delay in microseconds
      */
     long calculateTimeDelta(long originalTime, long currentTime) const noexcept;
+
+    const common::timing::ClockOffsetEstimator* upstreamClock_ = nullptr;
 };
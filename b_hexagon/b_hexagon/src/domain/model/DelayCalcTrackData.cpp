@@ -199,26 +199,94 @@ void DelayCalcTrackData::setSecondHopSentTime(const int64_t& value) {
     secondHopSentTime_ = value;
 }
 
-bool DelayCalcTrackData::isValid() const noexcept {
-    try {
-        validateTrackId(trackId_);
-        validateXVelocityECEF(xVelocityECEF_);
-        validateYVelocityECEF(yVelocityECEF_);
-        validateZVelocityECEF(zVelocityECEF_);
-        validateXPositionECEF(xPositionECEF_);
-        validateYPositionECEF(yPositionECEF_);
-        validateZPositionECEF(zPositionECEF_);
-        validateOriginalUpdateTime(originalUpdateTime_);
-        validateUpdateTime(updateTime_);
-        validateFirstHopSentTime(firstHopSentTime_);
-        validateFirstHopDelayTime(firstHopDelayTime_);
-        validateSecondHopSentTime(secondHopSentTime_);
-        return true;
-    } catch (const std::exception&) {
-        return false;
+const char* DelayCalcTrackData::fieldErrorName(FieldError error) noexcept {
+    switch (error) {
+        case FieldError::None:
+            return "none";
+        case FieldError::TrackId:
+            return "trackId";
+        case FieldError::XVelocityECEF:
+            return "xVelocityECEF";
+        case FieldError::YVelocityECEF:
+            return "yVelocityECEF";
+        case FieldError::ZVelocityECEF:
+            return "zVelocityECEF";
+        case FieldError::XPositionECEF:
+            return "xPositionECEF";
+        case FieldError::YPositionECEF:
+            return "yPositionECEF";
+        case FieldError::ZPositionECEF:
+            return "zPositionECEF";
+        case FieldError::OriginalUpdateTime:
+            return "originalUpdateTime";
+        case FieldError::UpdateTime:
+            return "updateTime";
+        case FieldError::FirstHopSentTime:
+            return "firstHopSentTime";
+        case FieldError::FirstHopDelayTime:
+            return "firstHopDelayTime";
+        case FieldError::SecondHopSentTime:
+            return "secondHopSentTime";
+        default:
+            return "unknown";
     }
 }
 
+DelayCalcTrackData::FieldError DelayCalcTrackData::fromFields(int32_t trackId, double xVelocityECEF, double yVelocityECEF, double zVelocityECEF, double xPositionECEF, double yPositionECEF, double zPositionECEF, int64_t originalUpdateTime, int64_t updateTime, int64_t firstHopSentTime, int64_t firstHopDelayTime, int64_t secondHopSentTime) noexcept {
+    trackId_ = trackId;
+    xVelocityECEF_ = xVelocityECEF;
+    yVelocityECEF_ = yVelocityECEF;
+    zVelocityECEF_ = zVelocityECEF;
+    xPositionECEF_ = xPositionECEF;
+    yPositionECEF_ = yPositionECEF;
+    zPositionECEF_ = zPositionECEF;
+    originalUpdateTime_ = originalUpdateTime;
+    updateTime_ = updateTime;
+    firstHopSentTime_ = firstHopSentTime;
+    firstHopDelayTime_ = firstHopDelayTime;
+    secondHopSentTime_ = secondHopSentTime;
+    return firstInvalidField();
+}
+
+DelayCalcTrackData::FieldError DelayCalcTrackData::firstInvalidField() const noexcept {
+    // Bit i set: field i (schema order) is out of range
+    std::uint64_t invalid = 0U;
+
+    // Floating point fields; an all-ones exponent (NaN, Inf) is rejected without std::isnan
+    static constexpr std::size_t REAL_COUNT = 6U;
+    static constexpr double REAL_MIN[REAL_COUNT] = {-1.0E+6, -1.0E+6, -1.0E+6, -9.9E+10, -9.9E+10, -9.9E+10};
+    static constexpr double REAL_MAX[REAL_COUNT] = {1.0E+6, 1.0E+6, 1.0E+6, 9.9E+10, 9.9E+10, 9.9E+10};
+    static constexpr unsigned REAL_BIT[REAL_COUNT] = {1U, 2U, 3U, 4U, 5U, 6U};
+    const double reals[REAL_COUNT] = {xVelocityECEF_, yVelocityECEF_, zVelocityECEF_, xPositionECEF_, yPositionECEF_, zPositionECEF_};
+    for (std::size_t i = 0U; i < REAL_COUNT; ++i) {
+        std::uint64_t bits = 0U;
+        std::memcpy(&bits, &reals[i], sizeof(bits));
+        const bool outside = ((bits & 0x7FF0000000000000ULL) == 0x7FF0000000000000ULL) |
+                             (reals[i] < REAL_MIN[i]) | (reals[i] > REAL_MAX[i]);
+        invalid |= static_cast<std::uint64_t>(outside) << REAL_BIT[i];
+    }
+
+    // Integer fields, widened to int64_t
+    static constexpr std::size_t INTEGER_COUNT = 6U;
+    static constexpr std::int64_t INTEGER_MIN[INTEGER_COUNT] = {1LL, 0LL, 0LL, 0LL, 0LL, 0LL};
+    static constexpr std::int64_t INTEGER_MAX[INTEGER_COUNT] = {9999LL, 9223372036854775LL, 9223372036854775LL, 9223372036854775LL, 9223372036854775LL, 9223372036854775LL};
+    static constexpr unsigned INTEGER_BIT[INTEGER_COUNT] = {0U, 7U, 8U, 9U, 10U, 11U};
+    const std::int64_t integers[INTEGER_COUNT] = {static_cast<std::int64_t>(trackId_), static_cast<std::int64_t>(originalUpdateTime_), static_cast<std::int64_t>(updateTime_), static_cast<std::int64_t>(firstHopSentTime_), static_cast<std::int64_t>(firstHopDelayTime_), static_cast<std::int64_t>(secondHopSentTime_)};
+    for (std::size_t i = 0U; i < INTEGER_COUNT; ++i) {
+        const bool outside = (integers[i] < INTEGER_MIN[i]) | (integers[i] > INTEGER_MAX[i]);
+        invalid |= static_cast<std::uint64_t>(outside) << INTEGER_BIT[i];
+    }
+
+    if (invalid == 0U) {
+        return FieldError::None;
+    }
+    return static_cast<FieldError>(static_cast<std::uint8_t>(__builtin_ctzll(invalid) + 1));
+}
+
+bool DelayCalcTrackData::isValid() const noexcept {
+    return firstInvalidField() == FieldError::None;
+}
+
 // MISRA C++ 2023 compliant Binary Serialization Implementation
 std::vector<uint8_t> DelayCalcTrackData::serialize() const {
     std::vector<uint8_t> buffer;
@@ -299,6 +367,66 @@ std::vector<uint8_t> DelayCalcTrackData::serialize() const {
     return buffer;
 }
 
+// Serialization into caller memory (pooled send buffers) - MISRA compliant
+std::size_t DelayCalcTrackData::serializeTo(uint8_t* out, std::size_t capacity) const noexcept {
+    const std::size_t size = getSerializedSize();
+    if (out == nullptr || capacity < size) {
+        return 0U;
+    }
+    
+    std::size_t offset = 0U;
+    
+    // Serialize trackId_
+    std::memcpy(&out[offset], &trackId_, sizeof(trackId_));
+    offset += sizeof(trackId_);
+    
+    // Serialize xVelocityECEF_
+    std::memcpy(&out[offset], &xVelocityECEF_, sizeof(xVelocityECEF_));
+    offset += sizeof(xVelocityECEF_);
+    
+    // Serialize yVelocityECEF_
+    std::memcpy(&out[offset], &yVelocityECEF_, sizeof(yVelocityECEF_));
+    offset += sizeof(yVelocityECEF_);
+    
+    // Serialize zVelocityECEF_
+    std::memcpy(&out[offset], &zVelocityECEF_, sizeof(zVelocityECEF_));
+    offset += sizeof(zVelocityECEF_);
+    
+    // Serialize xPositionECEF_
+    std::memcpy(&out[offset], &xPositionECEF_, sizeof(xPositionECEF_));
+    offset += sizeof(xPositionECEF_);
+    
+    // Serialize yPositionECEF_
+    std::memcpy(&out[offset], &yPositionECEF_, sizeof(yPositionECEF_));
+    offset += sizeof(yPositionECEF_);
+    
+    // Serialize zPositionECEF_
+    std::memcpy(&out[offset], &zPositionECEF_, sizeof(zPositionECEF_));
+    offset += sizeof(zPositionECEF_);
+    
+    // Serialize originalUpdateTime_
+    std::memcpy(&out[offset], &originalUpdateTime_, sizeof(originalUpdateTime_));
+    offset += sizeof(originalUpdateTime_);
+    
+    // Serialize updateTime_
+    std::memcpy(&out[offset], &updateTime_, sizeof(updateTime_));
+    offset += sizeof(updateTime_);
+    
+    // Serialize firstHopSentTime_
+    std::memcpy(&out[offset], &firstHopSentTime_, sizeof(firstHopSentTime_));
+    offset += sizeof(firstHopSentTime_);
+    
+    // Serialize firstHopDelayTime_
+    std::memcpy(&out[offset], &firstHopDelayTime_, sizeof(firstHopDelayTime_));
+    offset += sizeof(firstHopDelayTime_);
+    
+    // Serialize secondHopSentTime_
+    std::memcpy(&out[offset], &secondHopSentTime_, sizeof(secondHopSentTime_));
+    offset += sizeof(secondHopSentTime_);
+    
+    return offset;
+}
+
 bool DelayCalcTrackData::deserialize(const std::vector<uint8_t>& data) noexcept {
     if (data.size() < getSerializedSize()) {
         return false;
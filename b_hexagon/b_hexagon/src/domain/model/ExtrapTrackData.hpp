@@ -22,6 +22,11 @@ public:
     // Network configuration constants
     static constexpr const char* MULTICAST_ADDRESS = "239.1.1.5";
     static constexpr int PORT = 9596;
+    static constexpr const char* SOCKET_PROFILE = "latency";
+    static constexpr const char* GROUP_PARTITIONING = "none";
+    static constexpr int GROUP_TRACK_RANGE_SIZE = 100;
+    static constexpr double GROUP_CELL_SIZE_DEG = 1.0;
+    static constexpr const char* GROUP_SELECTION = "";
     static constexpr const char* ZMQ_PROTOCOL = "udp";
     static constexpr const char* ZMQ_MULTICAST_ADDRESS = "239.1.1.5";
     static constexpr int ZMQ_PORT = 9596;
@@ -79,6 +84,28 @@ public:
     int64_t getFirstHopSentTime() const noexcept;
     void setFirstHopSentTime(const int64_t& value);
 
+    // Validation result: the first out-of-range field, in schema order
+    enum class FieldError : std::uint8_t {
+        None = 0U,
+        TrackId,
+        XVelocityECEF,
+        YVelocityECEF,
+        ZVelocityECEF,
+        XPositionECEF,
+        YPositionECEF,
+        ZPositionECEF,
+        OriginalUpdateTime,
+        UpdateTime,
+        FirstHopSentTime,
+    };
+    [[nodiscard]] static const char* fieldErrorName(FieldError error) noexcept;
+
+    // Exception-free construction - MISRA compliant
+    /// Sets every field, then checks the whole record once; on an error the record holds the rejected values
+    [[nodiscard]] FieldError fromFields(int32_t trackId, double xVelocityECEF, double yVelocityECEF, double zVelocityECEF, double xPositionECEF, double yPositionECEF, double zPositionECEF, int64_t originalUpdateTime, int64_t updateTime, int64_t firstHopSentTime) noexcept;
+    /// One pass over every field without exceptions; FieldError::None if the record is valid
+    [[nodiscard]] FieldError firstInvalidField() const noexcept;
+
     // Validation - MISRA compliant
     [[nodiscard]] bool isValid() const noexcept;
 
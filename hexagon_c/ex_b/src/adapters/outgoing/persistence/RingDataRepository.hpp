@@ -0,0 +1,178 @@
+#pragma once
+
+#include "../../../domain/ports/outgoing/DataRepository.hpp"
+#include "../../../domain/model/DelayCalcTrackData.hpp"
+#include "common/CompressedHistory.h"
+#include "common/TrackHistoryStore.h"
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace hat_b::adapters::outgoing::persistence {
+
+/**
+ * Track başına sabit kapasiteli halka tutan DataRepository
+ *
+ * Her track'in son samples_per_track örneği SoA kolonlarda saklanır
+ * (common/TrackHistoryStore.h). Anahtar zaman update_time'dır (ms); zaman
+ * aralığı sorguları 1 sn'lik kovalardan oluşan zaman indeksiyle yalnızca
+ * ilgili track'leri tarar. Okumalar kilit almaz, bu yüzden istatistik ve
+ * sorgular üretim döngüsündeki kayıtları hiç bekletmez.
+ *
+ * cleanupOldData zamanlayıcı çarkıyla (timing wheel) çalışır: yalnızca en
+ * eski örneğinin süresi dolmuş track'lere dokunur ve işi EXPIRY_SLICE
+ * track'lik dilimlere böler; dilimler arasında kilit bırakıldığı için
+ * kayıtlar temizlik bitene kadar beklemez.
+ *
+ * Halkanın yanında her örnek sıkıştırılmış arşive de yazılır
+ * (common/CompressedHistory.h): zaman damgaları delta-of-delta, double
+ * kolonlar XOR ile kodlanır. 5 ms ızgarada halka birkaç saniyeyi tutarken
+ * arşiv saklama süresinin tamamını ham boyutun küçük bir kısmında tutar;
+ * halkanın en eski örneğinden geriye giden aralık sorguları arşivden
+ * çözülür. Arşiv de cleanupOldData ile aynı cutoff'la blok blok temizlenir.
+ */
+class RingDataRepository : public hat_b::domain::ports::outgoing::DataRepository {
+public:
+    static constexpr std::size_t DOUBLE_COLUMNS = 6U;   // ECEF hız + konum
+    static constexpr std::size_t INT_COLUMNS = 4U;      // update_time dışındaki zaman alanları
+    static constexpr std::size_t EXPIRY_SLICE = 32U;    // Kilit başına en fazla temizlenecek track
+
+    /**
+     * @param max_tracks Aynı anda tutulacak en fazla track sayısı
+     * @param samples_per_track Track başına geçmiş uzunluğu (2'nin kuvvetine yuvarlanır)
+     * @param bucket_ms Zaman indeksi kova genişliği (ms)
+     * @param buckets İndekste tutulan kova sayısı
+     * @param archive_block_samples Arşivde bir sıkıştırılmış bloktaki örnek sayısı
+     */
+    explicit RingDataRepository(std::size_t max_tracks = 1024,
+                                std::size_t samples_per_track = 256,
+                                int64_t bucket_ms = 1000,
+                                std::size_t buckets = 300,
+                                std::size_t archive_block_samples = 1024)
+        : store_(makeOptions(max_tracks, samples_per_track, bucket_ms, buckets)),
+          archive_(makeArchiveOptions(archive_block_samples)) {}
+
+    bool saveDelayCalcTrackData(const hat::domain::model::DelayCalcTrackData& data) override {
+        const double doubles[DOUBLE_COLUMNS] = {
+            data.getXVelocityECEF(), data.getYVelocityECEF(), data.getZVelocityECEF(),
+            data.getXPositionECEF(), data.getYPositionECEF(), data.getZPositionECEF()};
+        const int64_t ints[INT_COLUMNS] = {
+            data.getOriginalUpdateTime(), data.getFirstHopSentTime(),
+            data.getFirstHopDelayTime(), data.getSecondHopSentTime()};
+        archive_.append(data.getTrackId(), data.getUpdateTime(), doubles, ints);
+        return store_.append(data.getTrackId(), data.getUpdateTime(), doubles, ints);
+    }
+
+    // ID track ID'dir; track'in en son örneği döner
+    std::optional<hat::domain::model::DelayCalcTrackData> findById(int id) override {
+        common::store::HistoryRows rows = store_.makeRows();
+        if (!store_.readLatest(id, rows)) {
+            return std::nullopt;
+        }
+        return toModel(rows, 0);
+    }
+
+    // Track'in halkadaki tüm geçmişi, eskiden yeniye
+    std::vector<hat::domain::model::DelayCalcTrackData> findByTrackId(int track_id) override {
+        common::store::HistoryRows rows = store_.makeRows();
+        store_.readTrack(track_id, rows);
+        return toModels(rows);
+    }
+
+    bool updateDelayCalcTrackData(const hat::domain::model::DelayCalcTrackData& data) override {
+        return saveDelayCalcTrackData(data);
+    }
+
+    std::vector<hat::domain::model::DelayCalcTrackData> findByTimeRange(
+        int64_t start_time, int64_t end_time) override {
+        common::store::HistoryRows rows = store_.makeRows();
+        const common::store::HistoryStats stats = store_.stats();
+        if (stats.records > 0 && start_time >= stats.oldestTime) {
+            store_.readRange(start_time, end_time, rows);
+        } else {
+            // Halkadan taşmış örnekler yalnızca arşivde
+            archive_.readRange(start_time, end_time, rows);
+        }
+        return toModels(rows);
+    }
+
+    std::vector<int> getActiveTrackIds() override {
+        return store_.activeTracks();
+    }
+
+    size_t cleanupOldData(int64_t cutoff_time) override {
+        size_t removed = 0;
+        for (;;) {
+            const common::store::ExpiryProgress progress = store_.expireBefore(cutoff_time, EXPIRY_SLICE);
+            removed += progress.removed;
+            if (progress.done) {
+                archive_.evictBefore(cutoff_time);
+                return removed;
+            }
+        }
+    }
+
+    RepositoryStats getRepositoryStats() override {
+        const common::store::HistoryStats stats = store_.stats();
+        RepositoryStats result;
+        result.total_records = stats.records;
+        result.active_tracks = stats.activeTracks;
+        result.oldest_record_time = stats.oldestTime;
+        result.newest_record_time = stats.newestTime;
+        return result;
+    }
+
+    // Halka taşmaları, reddedilen track'ler ve okuma tekrarları için ayrıntılı sayaçlar
+    common::store::HistoryStats getHistoryStats() const {
+        return store_.stats();
+    }
+
+    // Arşivin sıkıştırılmış ve ham boyutu
+    common::store::CompressedStats getArchiveStats() const {
+        return archive_.stats();
+    }
+
+private:
+    static common::store::HistoryOptions makeOptions(std::size_t max_tracks, std::size_t samples_per_track,
+                                                     int64_t bucket_ms, std::size_t buckets) {
+        common::store::HistoryOptions options;
+        options.maxTracks = max_tracks;
+        options.samplesPerTrack = samples_per_track;
+        options.doubleColumns = DOUBLE_COLUMNS;
+        options.intColumns = INT_COLUMNS;
+        options.bucketWidth = bucket_ms;
+        options.buckets = buckets;
+        return options;
+    }
+
+    static common::store::CompressedOptions makeArchiveOptions(std::size_t archive_block_samples) {
+        common::store::CompressedOptions options;
+        options.doubleColumns = DOUBLE_COLUMNS;
+        options.intColumns = INT_COLUMNS;
+        options.samplesPerBlock = archive_block_samples;
+        return options;
+    }
+
+    static hat::domain::model::DelayCalcTrackData toModel(const common::store::HistoryRows& rows, std::size_t row) {
+        const double* d = rows.doublesAt(row);
+        const int64_t* t = rows.intsAt(row);
+        return hat::domain::model::DelayCalcTrackData(
+            rows.trackIds[row], d[0], d[1], d[2], d[3], d[4], d[5],
+            rows.times[row], t[0], t[1], t[2], t[3]);
+    }
+
+    static std::vector<hat::domain::model::DelayCalcTrackData> toModels(const common::store::HistoryRows& rows) {
+        std::vector<hat::domain::model::DelayCalcTrackData> result;
+        result.reserve(rows.size());
+        for (std::size_t row = 0; row < rows.size(); ++row) {
+            result.push_back(toModel(rows, row));
+        }
+        return result;
+    }
+
+    common::store::TrackHistoryStore store_;
+    common::store::CompressedHistory archive_;
+};
+
+} // namespace hat_b::adapters::outgoing::persistence
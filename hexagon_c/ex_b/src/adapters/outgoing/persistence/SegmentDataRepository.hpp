@@ -0,0 +1,172 @@
+#pragma once
+
+#include "RingDataRepository.hpp"
+#include "common/SegmentStore.h"
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace hat_b::adapters::outgoing::persistence {
+
+/**
+ * Track geçmişini yeniden başlatmalar arasında koruyan DataRepository
+ *
+ * Her kayıt sabit boyutlu bir PersistedTrackRecord olarak mmap'lenmiş,
+ * önceden ayrılmış segment dosyalarına eklenir (common/SegmentStore.h).
+ * Diske yazma (msync) arka plan thread'inde yapılır; kayıt yolu yalnızca
+ * bellek kopyalar. Sorgular sıcak veri için RingDataRepository'den,
+ * halkadan daha eski zaman aralıkları için segmentlerden cevaplanır.
+ * Açılışta segmentler O(segment) sürede kurtarılır ve son kayıtlar
+ * halkaya geri yüklenir.
+ */
+class SegmentDataRepository : public hat_b::domain::ports::outgoing::DataRepository {
+public:
+    // Diskteki kayıt düzeni - alan sırası değişirse segment formatı da değişir
+    struct PersistedTrackRecord {
+        int32_t track_id;
+        int32_t reserved;
+        double velocity_ecef[3];
+        double position_ecef[3];
+        int64_t update_time;
+        int64_t original_update_time;
+        int64_t first_hop_sent_time;
+        int64_t first_hop_delay_time;
+        int64_t second_hop_sent_time;
+    };
+    static_assert(sizeof(PersistedTrackRecord) == 96, "persisted track record layout");
+
+    /**
+     * @param directory Segment dosyalarının dizini
+     * @param max_segments Diskte tutulacak en fazla segment (0: hepsi)
+     * @param warm_records Açılışta halkaya geri yüklenecek son kayıt sayısı
+     */
+    explicit SegmentDataRepository(const std::string& directory,
+                                   std::size_t max_segments = 0,
+                                   std::size_t warm_records = 65536)
+        : segments_(makeOptions(directory, max_segments)) {
+        segments_.readLatest(warm_records, [this](int64_t, const uint8_t* raw) {
+            ring_.saveDelayCalcTrackData(fromRecord(raw));
+        });
+    }
+
+    bool saveDelayCalcTrackData(const hat::domain::model::DelayCalcTrackData& data) override {
+        const PersistedTrackRecord record = toRecord(data);
+        const bool persisted = segments_.append(data.getUpdateTime(), &record);
+        return ring_.saveDelayCalcTrackData(data) && persisted;
+    }
+
+    std::optional<hat::domain::model::DelayCalcTrackData> findById(int id) override {
+        return ring_.findById(id);
+    }
+
+    std::vector<hat::domain::model::DelayCalcTrackData> findByTrackId(int track_id) override {
+        return ring_.findByTrackId(track_id);
+    }
+
+    bool updateDelayCalcTrackData(const hat::domain::model::DelayCalcTrackData& data) override {
+        return saveDelayCalcTrackData(data);
+    }
+
+    // Halkanın kapsadığı aralık halkadan, daha eskisi segmentlerin zaman indeksinden okunur
+    std::vector<hat::domain::model::DelayCalcTrackData> findByTimeRange(
+        int64_t start_time, int64_t end_time) override {
+        const RepositoryStats ring_stats = ring_.getRepositoryStats();
+        if (ring_stats.total_records > 0 && start_time >= ring_stats.oldest_record_time) {
+            return ring_.findByTimeRange(start_time, end_time);
+        }
+        std::vector<hat::domain::model::DelayCalcTrackData> result;
+        segments_.readRange(start_time, end_time, [&result](int64_t, const uint8_t* raw) {
+            result.push_back(fromRecord(raw));
+        });
+        return result;
+    }
+
+    std::vector<int> getActiveTrackIds() override {
+        return ring_.getActiveTrackIds();
+    }
+
+    // Bellekteki geçmişi temizler; diskteki saklama süresi max_segments ile sınırlanır
+    size_t cleanupOldData(int64_t cutoff_time) override {
+        return ring_.cleanupOldData(cutoff_time);
+    }
+
+    RepositoryStats getRepositoryStats() override {
+        return ring_.getRepositoryStats();
+    }
+
+    common::store::SegmentStats getSegmentStats() const {
+        return segments_.stats();
+    }
+
+    /**
+     * $HEXAGON_HISTORY_DIR tanımlıysa kalıcı repository, değilse nullptr
+     * ($HEXAGON_HISTORY_MAX_SEGMENTS diskteki segment sayısını sınırlar)
+     */
+    static std::shared_ptr<SegmentDataRepository> fromEnvironment() {
+        const char* directory = std::getenv("HEXAGON_HISTORY_DIR");
+        if (directory == nullptr || directory[0] == '\0') {
+            return nullptr;
+        }
+        const char* max_segments = std::getenv("HEXAGON_HISTORY_MAX_SEGMENTS");
+        try {
+            auto repository = std::make_shared<SegmentDataRepository>(
+                directory, max_segments != nullptr ? std::strtoull(max_segments, nullptr, 10) : 0);
+            const common::store::SegmentStats stats = repository->getSegmentStats();
+            std::cout << "[History] " << directory << ": " << stats.segments << " segments, "
+                      << stats.recovered << " records recovered" << std::endl;
+            return repository;
+        } catch (const std::exception& e) {
+            std::cerr << "[History] disabled: " << e.what() << std::endl;
+            return nullptr;
+        }
+    }
+
+private:
+    static common::store::SegmentOptions makeOptions(const std::string& directory, std::size_t max_segments) {
+        common::store::SegmentOptions options;
+        options.directory = directory;
+        options.prefix = "hat_b_history";
+        options.recordBytes = sizeof(PersistedTrackRecord);
+        options.maxSegments = max_segments;
+        return options;
+    }
+
+    static PersistedTrackRecord toRecord(const hat::domain::model::DelayCalcTrackData& data) {
+        PersistedTrackRecord record{};
+        record.track_id = data.getTrackId();
+        record.velocity_ecef[0] = data.getXVelocityECEF();
+        record.velocity_ecef[1] = data.getYVelocityECEF();
+        record.velocity_ecef[2] = data.getZVelocityECEF();
+        record.position_ecef[0] = data.getXPositionECEF();
+        record.position_ecef[1] = data.getYPositionECEF();
+        record.position_ecef[2] = data.getZPositionECEF();
+        record.update_time = data.getUpdateTime();
+        record.original_update_time = data.getOriginalUpdateTime();
+        record.first_hop_sent_time = data.getFirstHopSentTime();
+        record.first_hop_delay_time = data.getFirstHopDelayTime();
+        record.second_hop_sent_time = data.getSecondHopSentTime();
+        return record;
+    }
+
+    static hat::domain::model::DelayCalcTrackData fromRecord(const uint8_t* raw) {
+        PersistedTrackRecord record;
+        std::memcpy(&record, raw, sizeof(record));
+        return hat::domain::model::DelayCalcTrackData(
+            record.track_id,
+            record.velocity_ecef[0], record.velocity_ecef[1], record.velocity_ecef[2],
+            record.position_ecef[0], record.position_ecef[1], record.position_ecef[2],
+            record.update_time, record.original_update_time,
+            record.first_hop_sent_time, record.first_hop_delay_time, record.second_hop_sent_time);
+    }
+
+    // Bildirim sırası önemli: halka, segmentlerden geri yüklenmeden önce kurulmalı
+    RingDataRepository ring_;
+    common::store::SegmentStore segments_;
+};
+
+} // namespace hat_b::adapters::outgoing::persistence
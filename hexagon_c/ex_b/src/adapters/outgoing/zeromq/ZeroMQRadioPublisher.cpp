@@ -2,6 +2,10 @@
 #define ZMQ_BUILD_DRAFT_API
 
 #include "ZeroMQRadioPublisher.hpp"
+#include "common/PooledMessage.h"
+#include "common/ZmqTopology.h"
+#include <cstdlib>
+#include <cstring>
 #include <iostream>
 
 namespace hat_b::adapters::outgoing::zeromq {
@@ -15,7 +19,9 @@ ZeroMQRadioPublisher::ZeroMQRadioPublisher(
     , zmq_context_(1)  // 1 I/O thread
     , radio_socket_(nullptr)
     , total_published_(0)
-    , failed_publications_(0) {
+    , failed_publications_(0)
+    , sent_count_(common::metrics::MetricsSegment::process().counter("radio.published"))
+    , queue_latency_ns_(common::metrics::MetricsSegment::process().histogram("radio.queue_latency_ns")) {
     
     initializeRadioSocket();
 }
@@ -27,6 +33,12 @@ ZeroMQRadioPublisher::~ZeroMQRadioPublisher() {
 
 void ZeroMQRadioPublisher::initializeRadioSocket() {
     try {
+        // libzmq I/O thread yerleşimi ilk socket'ten önce ayarlanmalı
+        const common::topology::AppliedPlacement io_placement = common::topology::applyIoThreadPlacement(
+            zmq_context_, common::topology::ThreadTopology::process(), "zmq_io");
+        std::cout << "[RadioPublisher] I/O thread placement: "
+                  << common::topology::ThreadTopology::toString(io_placement) << std::endl;
+
         // RADIO socket oluştur (C++ wrapper ile) - Draft API gerekli
         radio_socket_ = std::make_unique<zmq::socket_t>(zmq_context_, zmq::socket_type::radio);
 
@@ -59,19 +71,12 @@ bool ZeroMQRadioPublisher::start() {
 
     // Publisher worker thread'ini başlat
     publisher_thread_ = std::thread([this]() {
-        // Real-time thread priority ayarla
-        #ifdef __linux__
-        struct sched_param param;
-        param.sched_priority = 94; // High priority
-        pthread_setschedparam(pthread_self(), SCHED_FIFO, &param);
-        
-        // CPU affinity - dedicated core
-        cpu_set_t cpuset;
-        CPU_ZERO(&cpuset);
-        CPU_SET(0, &cpuset); // Core 0'a bind et
-        pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuset);
-        #endif
-        
+        // CPU, real-time öncelik ve NUMA yerleşimi config/thread_topology.conf'tan gelir
+        const common::topology::AppliedPlacement placement =
+            common::topology::ThreadTopology::process().applyToCurrentThread("radio_publisher");
+        std::cout << "[RadioPublisher] Thread placement: "
+                  << common::topology::ThreadTopology::toString(placement) << std::endl;
+
         publisherWorker();
     });
 
@@ -132,7 +137,7 @@ ZeroMQRadioPublisher::PublisherStats ZeroMQRadioPublisher::getPublisherStats() c
     PublisherStats stats;
     stats.total_published = total_published_.load();
     stats.failed_publications = failed_publications_.load();
-    stats.average_latency_ms = 0.0; // Basit implementasyon
+    stats.average_latency_ms = queue_latency_ns_.mean() / 1e6;
     return stats;
 }
 
@@ -141,9 +146,11 @@ void ZeroMQRadioPublisher::publisherWorker() {
         try {
             std::string message;
             if (dequeueMessage(message)) {
-                // C++ wrapper ile mesaj gönder
-                zmq::message_t zmq_message(message.begin(), message.end());
-                
+                // Payload'ı havuz bloğuna kopyala, libzmq işi bitince bloğu geri verir
+                common::pool::PooledBuffer buffer = common::pool::MessageBufferPool::local().acquire(message.size());
+                std::memcpy(buffer.data(), message.data(), message.size());
+                zmq::message_t zmq_message = common::pool::toMessage(buffer, message.size());
+
                 // Grup set et (RADIO için set_group kullanılır)
                 zmq_message.set_group(group_name_.c_str());
                 
@@ -152,6 +159,17 @@ void ZeroMQRadioPublisher::publisherWorker() {
                 
                 if (send_result && *send_result == message.size()) {
                     total_published_.fetch_add(1);
+                    sent_count_.add();
+                    // Payload sonundaki "|<ns>" publish zamanıdır (steady_clock)
+                    const std::size_t separator = message.rfind('|');
+                    if (separator != std::string::npos) {
+                        const long long enqueued_ns = std::strtoll(message.c_str() + separator + 1, nullptr, 10);
+                        const long long now_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                            std::chrono::steady_clock::now().time_since_epoch()).count();
+                        if (now_ns >= enqueued_ns) {
+                            queue_latency_ns_.record(static_cast<std::uint64_t>(now_ns - enqueued_ns));
+                        }
+                    }
                 } else {
                     failed_publications_.fetch_add(1);
                 }
@@ -5,6 +5,7 @@
 
 #include "../../../domain/ports/outgoing/DataPublisher.hpp"
 #include "../../../domain/model/DelayCalcTrackData.hpp"
+#include "common/MetricsSegment.h"
 #include <zmq.hpp>
 #include <zmq_addon.hpp>
 #include <thread>
@@ -44,6 +45,10 @@ private:
     // İstatistikler
     std::atomic<size_t> total_published_;
     std::atomic<size_t> failed_publications_;
+    
+    // hexstat metrikleri; yalnızca publisher thread'i yazar
+    common::metrics::Counter sent_count_;
+    common::metrics::Histogram queue_latency_ns_;  // publish çağrısından socket send'e
 
 public:
     /**
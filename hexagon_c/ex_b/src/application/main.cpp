@@ -4,18 +4,15 @@
 #include <chrono>
 #include <csignal>
 #include <atomic>
-#include <map>
-#include <set>
-#include <mutex>
 #include <random>
-#include <limits>
-#include <optional>
 
 // Domain katmanı
 #include "../domain/logic/DataProcessor.hpp"
 
 // Adapter katmanı
 #include "../adapters/outgoing/zeromq/ZeroMQRadioPublisher.hpp"
+#include "../adapters/outgoing/persistence/RingDataRepository.hpp"
+#include "../adapters/outgoing/persistence/SegmentDataRepository.hpp"
 
 using namespace hat;
 
@@ -28,109 +25,6 @@ void signalHandler(int signum) {
     running.store(false);
 }
 
-/**
- * Basit in-memory repository implementasyonu
- * hexagon_b için veri saklama
- */
-class InMemoryDataRepository : public hat_b::domain::ports::outgoing::DataRepository {
-private:
-    std::map<int, hat::domain::model::DelayCalcTrackData> data_storage_;
-    mutable std::mutex data_mutex_;
-
-public:
-    bool saveDelayCalcTrackData(const hat::domain::model::DelayCalcTrackData& data) override {
-        std::lock_guard<std::mutex> lock(data_mutex_);
-        data_storage_[data.getTrackId()] = data;
-        return true;
-    }
-
-    std::optional<hat::domain::model::DelayCalcTrackData> findById(int id) override {
-        std::lock_guard<std::mutex> lock(data_mutex_);
-        auto it = data_storage_.find(id);
-        if (it != data_storage_.end()) {
-            return it->second;
-        }
-        return std::nullopt;
-    }
-
-    std::vector<hat::domain::model::DelayCalcTrackData> findByTrackId(int track_id) override {
-        std::lock_guard<std::mutex> lock(data_mutex_);
-        std::vector<hat::domain::model::DelayCalcTrackData> result;
-        for (const auto& pair : data_storage_) {
-            if (pair.second.getTrackId() == track_id) {
-                result.push_back(pair.second);
-            }
-        }
-        return result;
-    }
-
-    bool updateDelayCalcTrackData(const hat::domain::model::DelayCalcTrackData& data) override {
-        return saveDelayCalcTrackData(data);
-    }
-
-    std::vector<hat::domain::model::DelayCalcTrackData> findByTimeRange(
-        int64_t start_time, int64_t end_time) override {
-        std::lock_guard<std::mutex> lock(data_mutex_);
-        std::vector<hat::domain::model::DelayCalcTrackData> result;
-        for (const auto& pair : data_storage_) {
-            auto update_time = pair.second.getUpdateTime();
-            if (update_time >= start_time && update_time <= end_time) {
-                result.push_back(pair.second);
-            }
-        }
-        return result;
-    }
-
-    std::vector<int> getActiveTrackIds() override {
-        std::lock_guard<std::mutex> lock(data_mutex_);
-        std::vector<int> result;
-        std::set<int> track_ids;
-        for (const auto& pair : data_storage_) {
-            track_ids.insert(pair.second.getTrackId());
-        }
-        for (int id : track_ids) {
-            result.push_back(id);
-        }
-        return result;
-    }
-
-    size_t cleanupOldData(int64_t cutoff_time) override {
-        std::lock_guard<std::mutex> lock(data_mutex_);
-        size_t removed = 0;
-        for (auto it = data_storage_.begin(); it != data_storage_.end();) {
-            if (it->second.getUpdateTime() < cutoff_time) {
-                it = data_storage_.erase(it);
-                removed++;
-            } else {
-                ++it;
-            }
-        }
-        return removed;
-    }
-
-    RepositoryStats getRepositoryStats() override {
-        std::lock_guard<std::mutex> lock(data_mutex_);
-        RepositoryStats stats;
-        stats.total_records = data_storage_.size();
-        
-        std::set<int> track_ids;
-        int64_t min_time = std::numeric_limits<int64_t>::max();
-        int64_t max_time = 0;
-        
-        for (const auto& pair : data_storage_) {
-            track_ids.insert(pair.second.getTrackId());
-            min_time = std::min(min_time, pair.second.getUpdateTime());
-            max_time = std::max(max_time, pair.second.getUpdateTime());
-        }
-        
-        stats.active_tracks = track_ids.size();
-        stats.oldest_record_time = min_time == std::numeric_limits<int64_t>::max() ? 0 : min_time;
-        stats.newest_record_time = max_time;
-        
-        return stats;
-    }
-};
-
 /**
  * Test veri üretici - gerçek uygulamada sensörlerden gelecek
  */
@@ -176,6 +70,7 @@ int main(int argc, char* argv[]) {
         // Konfigürasyon
         std::string output_endpoint = "tcp://*:7777";  // cpp_hat port 7777'den dinliyor
         int generation_interval_ms = 1000;  // Her 1 saniyede veri üret
+        int64_t history_retention_ms = 600000;  // Repository'de 10 dakikalık geçmiş tutulur
         
         if (argc > 1) {
             for (int i = 1; i < argc; ++i) {
@@ -198,8 +93,13 @@ int main(int argc, char* argv[]) {
 
         // Hexagonal Architecture bileşenlerini oluştur
 
-        // 1. Repository (Secondary Port)
-        auto repository = std::make_shared<InMemoryDataRepository>();
+        // 1. Repository (Secondary Port) - track başına halka, kilitsiz okuma
+        //    HEXAGON_HISTORY_DIR tanımlıysa geçmiş ayrıca diske yazılır ve yeniden başlatmada kurtarılır
+        std::shared_ptr<hat_b::domain::ports::outgoing::DataRepository> repository =
+            hat_b::adapters::outgoing::persistence::SegmentDataRepository::fromEnvironment();
+        if (!repository) {
+            repository = std::make_shared<hat_b::adapters::outgoing::persistence::RingDataRepository>();
+        }
 
         // 2. RADIO Publisher (Secondary Port) - hexagon_c'ye UDP multicast ile gönderir
         auto publisher = std::make_shared<hat_b::adapters::outgoing::zeromq::ZeroMQRadioPublisher>(
@@ -253,6 +153,11 @@ int main(int argc, char* argv[]) {
                          << " m/s - 🕒 Sent Time: " << current_time << " ms" << std::endl;
             }
 
+            // Süresi dolan geçmişi temizle - yalnızca süresi dolan track'ler dilim dilim işlenir
+            const int64_t now_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+                common::timing::TscClock::now().time_since_epoch()).count();
+            repository->cleanupOldData(now_ms - history_retention_ms);
+
             // Her 10 saniyede bir istatistikleri göster
             auto now = std::chrono::steady_clock::now();
             if (std::chrono::duration_cast<std::chrono::seconds>(now - last_stats_time).count() >= 10) {
@@ -4,6 +4,7 @@
 #include "../ports/outgoing/DataPublisher.hpp"
 #include "../ports/outgoing/DataRepository.hpp"
 #include "../model/DelayCalcTrackData.hpp"
+#include "common/TscClock.h"
 #include <memory>
 #include <chrono>
 #include <vector>
@@ -98,7 +99,7 @@ public:
         try {
             // KRITIK: Gerçek gönderim zamanını al (hexagon_b'de)
             auto send_time = std::chrono::duration_cast<std::chrono::milliseconds>(
-                std::chrono::system_clock::now().time_since_epoch()).count();
+                common::timing::TscClock::now().time_since_epoch()).count();
 
             // DelayCalcTrackData oluştur - GERÇEK GECİKME ÖLÇÜMÜ İÇİN
             hat::domain::model::DelayCalcTrackData data(
@@ -204,7 +205,7 @@ private:
         const TrackInfo& info) {
         try {
             auto current_time = std::chrono::duration_cast<std::chrono::milliseconds>(
-                std::chrono::system_clock::now().time_since_epoch()).count();
+                common::timing::TscClock::now().time_since_epoch()).count();
 
             return hat::domain::model::DelayCalcTrackData(
                 info.track_id,
@@ -1,7 +1,10 @@
 // DRAFT API'leri etkinleştirmek için
-#define ZMQ_BUILD_DRAFT_API
+#define ZMQ_BUILD_DRAFT_API 1
 
 #include "ZeroMQDishTrackDataSubscriber.hpp"
+#include "common/ZmqTopology.h"
+#include "common/ZmqSocketProfile.h"
+#include "common/TscClock.h"
 #include <iostream>
 #include <zmq.hpp> // C++ wrapper için
 
@@ -9,11 +12,13 @@ namespace hat::adapters::incoming::zeromq {
 
 // Default constructor with standard configuration
 ZeroMQDishTrackDataSubscriber::ZeroMQDishTrackDataSubscriber(
-    std::shared_ptr<domain::ports::incoming::TrackDataSubmission> track_data_submission)
+    std::shared_ptr<IDataReceiver> track_data_submission)
     : track_data_submission_(track_data_submission)
     , running_(false)
     , multicast_endpoint_("udp://239.1.1.5:9595")  // Port 9595 for DelayCalcTrackData from B_hexagon (updated to match DelayCalcTrackData constants)
     , group_name_("DelayCalcTrackData")             // Group name matches message type
+    , group_scheme_(common::groups::schemeOf<DelayCalcTrackData>(group_name_))  // Şema metadata'sındaki group_partitioning
+    , group_selection_(DelayCalcTrackData::GROUP_SELECTION)
     , zmq_context_(1)  // 1 I/O thread
     , dish_socket_(nullptr) {
     
@@ -22,13 +27,32 @@ ZeroMQDishTrackDataSubscriber::ZeroMQDishTrackDataSubscriber(
 
 // Custom configuration constructor
 ZeroMQDishTrackDataSubscriber::ZeroMQDishTrackDataSubscriber(
-    std::shared_ptr<domain::ports::incoming::TrackDataSubmission> track_data_submission,
+    std::shared_ptr<IDataReceiver> track_data_submission,
     const std::string& multicast_endpoint,
     const std::string& group_name)
     : track_data_submission_(track_data_submission)
     , running_(false)
     , multicast_endpoint_(multicast_endpoint)
     , group_name_(group_name)
+    , group_scheme_(group_name_)
+    , zmq_context_(1)  // 1 I/O thread
+    , dish_socket_(nullptr) {
+    
+    initializeDishSocket();
+}
+
+// Partitioned group constructor
+ZeroMQDishTrackDataSubscriber::ZeroMQDishTrackDataSubscriber(
+    std::shared_ptr<IDataReceiver> track_data_submission,
+    const std::string& multicast_endpoint,
+    const common::groups::TrackGroupScheme& group_scheme,
+    const std::string& selection)
+    : track_data_submission_(track_data_submission)
+    , running_(false)
+    , multicast_endpoint_(multicast_endpoint)
+    , group_name_(group_scheme.getBaseGroup())
+    , group_scheme_(group_scheme)
+    , group_selection_(selection)
     , zmq_context_(1)  // 1 I/O thread
     , dish_socket_(nullptr) {
     
@@ -46,6 +70,14 @@ void ZeroMQDishTrackDataSubscriber::initializeDishSocket() {
         std::cout << "   📡 Endpoint: " << multicast_endpoint_ << std::endl;
         std::cout << "   👥 Group: " << group_name_ << std::endl;
         
+        // libzmq I/O thread yerleşimi ilk socket'ten önce ayarlanmalı
+        const common::topology::AppliedPlacement io_placement = common::topology::applyIoThreadPlacement(
+            zmq_context_, common::topology::ThreadTopology::process(), "zmq_io");
+        std::cout << "   🧵 I/O threads: " << common::topology::ThreadTopology::toString(io_placement) << std::endl;
+
+        // Gelen frame'leri replay için kaydet (HEXAGON_CAPTURE_DIR)
+        capture_ = common::capture::CaptureWriter::fromEnvironment("hexagon_c_dish");
+
         // DISH socket oluştur (C++ wrapper ile) - Draft API gerekli
         dish_socket_ = std::make_unique<zmq::socket_t>(zmq_context_, zmq::socket_type::dish);
 
@@ -55,11 +87,31 @@ void ZeroMQDishTrackDataSubscriber::initializeDishSocket() {
         dish_socket_->set(zmq::sockopt::linger, 0);       // No linger on close
         dish_socket_->set(zmq::sockopt::immediate, 1);    // Process messages immediately
         
+        // Bölümlü şemada numeric grup id'leri kullanılır (join'lerden önce ayarlanmalı)
+        if (group_scheme_.isPartitioned()) {
+            dish_socket_->set(zmq::sockopt::group_numeric, 1);
+        }
+        
+        // Kernel socket ayarları şemadaki socket_profile'dan (bind'dan önce ayarlanmalı)
+        const common::net::UdpSocketProfile socket_profile =
+            common::net::UdpSocketProfile::preset(DelayCalcTrackData::SOCKET_PROFILE);
+        common::net::applySocketProfile(*dish_socket_, socket_profile);
+        std::cout << "   ⚡ Socket profile: " << socket_profile.toString() << std::endl;
+        
         // UDP multicast için DISH socket bind yapar
         dish_socket_->bind(multicast_endpoint_);
         
-        // Gruba join ol (DISH için)
-        dish_socket_->join(group_name_.c_str());
+        // Gruba join ol (DISH için) - bölümlüyse yalnızca seçilen gruplara
+        if (group_scheme_.isPartitioned()) {
+            const std::vector<std::uint32_t> group_ids = group_scheme_.groupIdsForSelection(group_selection_);
+            for (const std::uint32_t group_id : group_ids) {
+                dish_socket_->join_id(group_id);
+            }
+            std::cout << "   👥 Partition groups: " << group_ids.size()
+                      << " (selection: " << group_selection_ << ")" << std::endl;
+        } else {
+            dish_socket_->join(group_name_.c_str());
+        }
 
     } catch (const zmq::error_t& e) {
         std::cerr << "[DishSubscriber] ZMQ Initialize hatası: " << e.what() << std::endl;
@@ -79,19 +131,12 @@ bool ZeroMQDishTrackDataSubscriber::start() {
 
     // Subscriber worker thread'ini başlat
     subscriber_thread_ = std::thread([this]() {
-        // Real-time thread priority ayarla
-        #ifdef __linux__
-        struct sched_param param;
-        param.sched_priority = 95; // Max priority
-        pthread_setschedparam(pthread_self(), SCHED_FIFO, &param);
-        
-        // CPU affinity - dedicated core
-        cpu_set_t cpuset;
-        CPU_ZERO(&cpuset);
-        CPU_SET(1, &cpuset); // Core 1'e bind et
-        pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuset);
-        #endif
-        
+        // CPU, real-time öncelik ve NUMA yerleşimi config/thread_topology.conf'tan gelir
+        const common::topology::AppliedPlacement placement =
+            common::topology::ThreadTopology::process().applyToCurrentThread("dish_receiver");
+        std::cout << "[DishSubscriber] Thread placement: "
+                  << common::topology::ThreadTopology::toString(placement) << std::endl;
+
         subscriberWorker();
     });
 
@@ -123,6 +168,12 @@ void ZeroMQDishTrackDataSubscriber::subscriberWorker() {
                 continue;
             }
 
+            // Ham frame'i decode etmeden kaydet
+            if (capture_) {
+                capture_->append(common::timing::TscClock::nowNanos(), received_msg.group(),
+                                 received_msg.data(), received_msg.size());
+            }
+
             // Mesajı string'e çevir (C++ wrapper)
             std::string received_payload = received_msg.to_string();
 
@@ -134,7 +185,7 @@ void ZeroMQDishTrackDataSubscriber::subscriberWorker() {
 
             if (track_data.has_value() && track_data_submission_) {
                 // Domain katmanına gönder
-                track_data_submission_->submitDelayCalcTrackData(track_data.value());
+                track_data_submission_->onDataReceived(track_data.value());
                 
                 // Doğru toplam gecikme hesapla: şu anki zaman - ilk gönderim zamanı
                 auto receive_time_us = std::chrono::duration_cast<std::chrono::microseconds>(
@@ -220,4 +271,6 @@ ZeroMQDishTrackDataSubscriber::deserializeDelayCalcTrackData(
         std::cerr << "[DishSubscriber] Data size: " << original_data.size() << " bytes" << std::endl;
         return std::nullopt;
     }
+}
+
 } // namespace hat::adapters::incoming::zeromq
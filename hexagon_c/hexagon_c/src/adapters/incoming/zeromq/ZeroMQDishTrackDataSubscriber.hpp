@@ -1,10 +1,12 @@
 #pragma once
 
 // DRAFT API'leri etkinleştirmek için (ZMQ_DISH için gerekli)
-#define ZMQ_BUILD_DRAFT_API
+#define ZMQ_BUILD_DRAFT_API 1
 
 #include "../../../domain/ports/incoming/TrackDataSubmission.hpp"
 #include "../../../domain/model/DelayCalcTrackData.hpp"
+#include "common/TrackGroups.h"
+#include "common/CaptureFile.h"
 #include <zmq.hpp>
 #include <zmq_addon.hpp>
 #include <thread>
@@ -28,7 +30,7 @@ namespace hat::adapters::incoming::zeromq {
  */
 class ZeroMQDishTrackDataSubscriber {
 private:
-    std::shared_ptr<domain::ports::incoming::TrackDataSubmission> track_data_submission_;
+    std::shared_ptr<IDataReceiver> track_data_submission_;
     
     // ZeroMQ C++ context ve socket
     zmq::context_t zmq_context_;
@@ -41,6 +43,9 @@ private:
     // Konfigürasyon
     std::string multicast_endpoint_;  // UDP multicast adresi (örn: udp://239.1.1.1:9001)
     std::string group_name_;          // Dinlenecek grup adı (örn: "SOURCE_DATA")
+    common::groups::TrackGroupScheme group_scheme_;  // İz/bölge bazlı grup bölümleme
+    std::string group_selection_;     // Bölümlü şemada join edilecek izler/bölge (örn: "100-299,512")
+    std::unique_ptr<common::capture::CaptureWriter> capture_;  // HEXAGON_CAPTURE_DIR verilmişse kayıt
     
     // Gecikme hesaplama için
     struct LatencyMeasurement {
@@ -59,7 +64,7 @@ public:
      * @param track_data_submission Domain katmanına veri göndermek için port
      */
     ZeroMQDishTrackDataSubscriber(
-        std::shared_ptr<domain::ports::incoming::TrackDataSubmission> track_data_submission);
+        std::shared_ptr<IDataReceiver> track_data_submission);
 
     /**
      * Constructor with custom configuration
@@ -68,10 +73,24 @@ public:
      * @param group_name Dinlenecek multicast grup adı (örn: "SOURCE_DATA")
      */
     ZeroMQDishTrackDataSubscriber(
-        std::shared_ptr<domain::ports::incoming::TrackDataSubmission> track_data_submission,
+        std::shared_ptr<IDataReceiver> track_data_submission,
         const std::string& multicast_endpoint,
         const std::string& group_name);
 
+    /**
+     * Constructor with partitioned groups - yalnızca seçilen iz aralıkları
+     * veya bölgenin numeric gruplarına join olur
+     * @param track_data_submission Domain katmanına veri göndermek için port
+     * @param multicast_endpoint UDP multicast endpoint
+     * @param group_scheme Yayıncı ile aynı konfigürasyondan kurulmuş grup şeması
+     * @param selection TrackRange için "100-299,512", GeoCell için "minLat,maxLat,minLon,maxLon"
+     */
+    ZeroMQDishTrackDataSubscriber(
+        std::shared_ptr<IDataReceiver> track_data_submission,
+        const std::string& multicast_endpoint,
+        const common::groups::TrackGroupScheme& group_scheme,
+        const std::string& selection);
+
     ~ZeroMQDishTrackDataSubscriber();
 
     /**
@@ -0,0 +1,129 @@
+#include "ColumnarTrackExporter.hpp"
+#include "common/TscClock.h"
+#include <cstdlib>
+#include <iostream>
+
+namespace hat::adapters::outgoing::columnar {
+
+namespace {
+
+using common::store::ColumnCell;
+using common::store::ColumnType;
+
+constexpr std::size_t FINAL_COLUMNS = 15;
+constexpr std::size_t STATICS_COLUMNS = 14;
+
+ColumnCell intCell(int64_t value) {
+    ColumnCell cell;
+    cell.asInt = value;
+    return cell;
+}
+
+ColumnCell doubleCell(double value) {
+    ColumnCell cell;
+    cell.asDouble = value;
+    return cell;
+}
+
+// Aynı dizine yazan ardışık çalıştırmalar birbirinin dosyasını ezmesin
+std::string filePath(const std::string& directory, const char* name) {
+    return directory + "/" + name + "." + std::to_string(common::timing::TscClock::nowMicros()) + ".hxcol";
+}
+
+} // namespace
+
+ColumnarTrackExporter::ColumnarTrackExporter(const std::string& directory, std::size_t rows_per_chunk)
+    : finalCalc_(filePath(directory, "final_calc_track_data"), finalCalcSchema(), rows_per_chunk),
+      trackStatics_(filePath(directory, "track_statics"), trackStaticsSchema(), rows_per_chunk) {}
+
+common::store::ColumnSchema ColumnarTrackExporter::finalCalcSchema() {
+    return {
+        {"trackId", ColumnType::Int64},
+        {"xVelocityECEF", ColumnType::Double},
+        {"yVelocityECEF", ColumnType::Double},
+        {"zVelocityECEF", ColumnType::Double},
+        {"xPositionECEF", ColumnType::Double},
+        {"yPositionECEF", ColumnType::Double},
+        {"zPositionECEF", ColumnType::Double},
+        {"originalUpdateTime", ColumnType::Int64},
+        {"updateTime", ColumnType::Int64},
+        {"firstHopSentTime", ColumnType::Int64},
+        {"firstHopDelayTime", ColumnType::Int64},
+        {"secondHopSentTime", ColumnType::Int64},
+        {"secondHopDelayTime", ColumnType::Int64},
+        {"totalDelayTime", ColumnType::Int64},
+        {"thirdHopSentTime", ColumnType::Int64},
+    };
+}
+
+common::store::ColumnSchema ColumnarTrackExporter::trackStaticsSchema() {
+    return {
+        {"trackId", ColumnType::Int64},
+        {"firstHopDelayDataMean", ColumnType::Double},
+        {"firstHopDelayDataStd", ColumnType::Double},
+        {"firstHopDelayDataMin", ColumnType::Double},
+        {"firstHopDelayDataMax", ColumnType::Double},
+        {"secondHopDelayDataMean", ColumnType::Double},
+        {"secondHopDelayDataStd", ColumnType::Double},
+        {"secondHopDelayDataMin", ColumnType::Double},
+        {"secondHopDelayDataMax", ColumnType::Double},
+        {"totalHopDelayDataMean", ColumnType::Double},
+        {"totalHopDelayDataStd", ColumnType::Double},
+        {"totalHopDelayDataMin", ColumnType::Double},
+        {"totalHopDelayDataMax", ColumnType::Double},
+        {"updateTime", ColumnType::Int64},
+    };
+}
+
+void ColumnarTrackExporter::exportFinal(const domain::model::FinalCalcTrackData& data) noexcept {
+    const ColumnCell row[FINAL_COLUMNS] = {
+        intCell(data.getTrackId()),
+        doubleCell(data.getXVelocityECEF()), doubleCell(data.getYVelocityECEF()), doubleCell(data.getZVelocityECEF()),
+        doubleCell(data.getXPositionECEF()), doubleCell(data.getYPositionECEF()), doubleCell(data.getZPositionECEF()),
+        intCell(data.getOriginalUpdateTime()), intCell(data.getUpdateTime()),
+        intCell(data.getFirstHopSentTime()), intCell(data.getFirstHopDelayTime()),
+        intCell(data.getSecondHopSentTime()), intCell(data.getSecondHopDelayTime()),
+        intCell(data.getTotalDelayTime()), intCell(data.getThirdHopSentTime())};
+    finalCalc_.append(row);
+}
+
+void ColumnarTrackExporter::exportStatics(const domain::model::TrackStatics& statics) noexcept {
+    const ColumnCell row[STATICS_COLUMNS] = {
+        intCell(statics.getTrackId()),
+        doubleCell(statics.getFirstHopDelayDataMean()), doubleCell(statics.getFirstHopDelayDataStd()),
+        doubleCell(statics.getFirstHopDelayDataMin()), doubleCell(statics.getFirstHopDelayDataMax()),
+        doubleCell(statics.getSecondHopDelayDataMean()), doubleCell(statics.getSecondHopDelayDataStd()),
+        doubleCell(statics.getSecondHopDelayDataMin()), doubleCell(statics.getSecondHopDelayDataMax()),
+        doubleCell(statics.getTotalHopDelayDataMean()), doubleCell(statics.getTotalHopDelayDataStd()),
+        doubleCell(statics.getTotalHopDelayDataMin()), doubleCell(statics.getTotalHopDelayDataMax()),
+        intCell(statics.getUpdateTime())};
+    trackStatics_.append(row);
+}
+
+void ColumnarTrackExporter::flush() noexcept {
+    finalCalc_.flush();
+    trackStatics_.flush();
+}
+
+std::unique_ptr<ColumnarTrackExporter> ColumnarTrackExporter::fromEnvironment() {
+    const char* directory = std::getenv("HEXAGON_EXPORT_DIR");
+    if (directory == nullptr || directory[0] == '\0') {
+        return nullptr;
+    }
+    std::size_t rows_per_chunk = 65536;
+    if (const char* rows = std::getenv("HEXAGON_EXPORT_CHUNK_ROWS")) {
+        const unsigned long long parsed = std::strtoull(rows, nullptr, 10);
+        rows_per_chunk = parsed > 0 ? static_cast<std::size_t>(parsed) : rows_per_chunk;
+    }
+    try {
+        std::unique_ptr<ColumnarTrackExporter> exporter(new ColumnarTrackExporter(directory, rows_per_chunk));
+        std::cout << "[Export] FinalCalcTrackData/TrackStatics -> " << directory
+                  << " (" << rows_per_chunk << " rows per chunk)" << std::endl;
+        return exporter;
+    } catch (const std::exception& e) {
+        std::cerr << "[Export] disabled: " << e.what() << std::endl;
+        return nullptr;
+    }
+}
+
+} // namespace hat::adapters::outgoing::columnar
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "domain/model/FinalCalcTrackData.hpp"
+#include "domain/model/TrackStatics.hpp"
+#include "common/ColumnarFile.h"
+#include <cstddef>
+#include <memory>
+#include <string>
+
+namespace hat::adapters::outgoing::columnar {
+
+/**
+ * FinalCalcTrackData ve TrackStatics kayıtlarını kolonlu dosyalara yazan çıkış adaptörü
+ *
+ * Her model kendi dosyasına gider (common/ColumnarFile.h):
+ *   <dizin>/final_calc_track_data.<µs>.hxcol
+ *   <dizin>/track_statics.<µs>.hxcol
+ * Kolon adları modelin alan adlarıdır; dosya şemayı kendi taşır, analiz
+ * tarafı bu sınıfa bağımlı değildir. export*() yalnızca satırı chunk
+ * tamponuna kopyalar; diske yazma exporter'ın kendi thread'inde yapılır,
+ * alım döngüsü hiçbir zaman I/O beklemez.
+ */
+class ColumnarTrackExporter {
+public:
+    /**
+     * @param directory Dosyaların yazılacağı dizin
+     * @param rows_per_chunk Chunk başına satır sayısı
+     * @throws std::runtime_error dosyalar oluşturulamazsa
+     */
+    explicit ColumnarTrackExporter(const std::string& directory, std::size_t rows_per_chunk = 65536);
+
+    void exportFinal(const domain::model::FinalCalcTrackData& data) noexcept;
+    void exportStatics(const domain::model::TrackStatics& statics) noexcept;
+
+    // Yarım chunk'ları yazma thread'ine devreder
+    void flush() noexcept;
+
+    common::store::ExportStats finalStats() const noexcept { return finalCalc_.stats(); }
+    common::store::ExportStats staticsStats() const noexcept { return trackStatics_.stats(); }
+
+    static common::store::ColumnSchema finalCalcSchema();
+    static common::store::ColumnSchema trackStaticsSchema();
+
+    /**
+     * $HEXAGON_EXPORT_DIR tanımlıysa o dizine yazan bir exporter döner;
+     * tanımlı değilse ya da dizine yazılamıyorsa nullptr (loglanır).
+     * $HEXAGON_EXPORT_CHUNK_ROWS chunk boyutunu değiştirir.
+     */
+    static std::unique_ptr<ColumnarTrackExporter> fromEnvironment();
+
+private:
+    common::store::ColumnarExporter finalCalc_;
+    common::store::ColumnarExporter trackStatics_;
+};
+
+} // namespace hat::adapters::outgoing::columnar
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <iostream>
 #include <chrono>
 #include <csignal>
@@ -7,10 +8,22 @@
 
 #include "../domain/model/DelayCalcTrackData.hpp"
 #include "../domain/model/FinalCalcTrackData.hpp"
+#include "../domain/logic/TrackStaticsCalculator.hpp"
+#include "../adapters/outgoing/columnar/ColumnarTrackExporter.hpp"
+#include "common/TscClock.h"
+#include "common/ClockSync.h"
+#include "common/CaptureFile.h"
+#include "common/FlightRecorder.h"
+#include "common/MetricsSegment.h"
+#include "common/ScopeTimer.h"
+#include "common/TrackGroups.h"
+#include "common/Probes.h"
 
 // Enable ZeroMQ DRAFT API for RADIO/DISH - must be defined before zmq.hpp
 #define ZMQ_BUILD_DRAFT_API 1
 #include "zmq.hpp"
+#include "common/ZmqSocketProfile.h"
+#include "common/ZmqTopology.h"
 
 // Using declarations for convenience
 using domain::model::DelayCalcTrackData;
@@ -26,37 +39,85 @@ void signalHandler(int signum) {
 class ZeroMQDishTrackDataSubscriber {
 private:
     zmq::context_t context_;
+    common::topology::AppliedPlacement ioPlacement_;  // Before socket_: libzmq starts its I/O threads with the first socket
     zmq::socket_t socket_;
+    std::unique_ptr<common::capture::CaptureWriter> capture_;  // Set when HEXAGON_CAPTURE_DIR is
     
 public:
     explicit ZeroMQDishTrackDataSubscriber(const std::string& endpoint) 
-        : context_(1), socket_(context_, ZMQ_DISH) {
+        : context_(1),
+          ioPlacement_(common::topology::applyIoThreadPlacement(
+              context_, common::topology::ThreadTopology::process(), "zmq_io")),
+          socket_(context_, ZMQ_DISH),
+          capture_(common::capture::CaptureWriter::fromEnvironment("hexagon_c_dish")) {
+        // Group partitioning from the schema's group_partitioning; numeric ids must be set before join
+        const common::groups::TrackGroupScheme scheme =
+            common::groups::schemeOf<DelayCalcTrackData>("DelayCalcTrackData");
+        if (scheme.isPartitioned()) {
+            socket_.set(zmq::sockopt::group_numeric, 1);
+        }
+        // Kernel socket knobs from the schema's socket_profile, before bind
+        common::net::applySocketProfile(
+            socket_, common::net::UdpSocketProfile::preset(DelayCalcTrackData::SOCKET_PROFILE));
         socket_.bind(endpoint);  // DISH socket should bind, not connect
-        socket_.join("DelayCalcTrackData");
-        std::cout << "Bound to " << endpoint << " and joined group 'DelayCalcTrackData'" << std::endl;
+        if (scheme.isPartitioned()) {
+            const std::vector<std::uint32_t> group_ids = scheme.groupIdsForSelection(DelayCalcTrackData::GROUP_SELECTION);
+            for (const std::uint32_t group_id : group_ids) {
+                socket_.join_id(group_id);
+            }
+            std::cout << "Bound to " << endpoint << " and joined " << group_ids.size()
+                      << " partition groups (selection: " << DelayCalcTrackData::GROUP_SELECTION << ")" << std::endl;
+        } else {
+            socket_.join("DelayCalcTrackData");
+            std::cout << "Bound to " << endpoint << " and joined group 'DelayCalcTrackData'" << std::endl;
+        }
     }
     
+    const common::topology::AppliedPlacement& ioPlacement() const { return ioPlacement_; }
+
     bool receiveDelayCalcTrackData(DelayCalcTrackData& trackData) {
         zmq::message_t message;
         auto result = socket_.recv(message, zmq::recv_flags::dontwait);
         
         if (result.has_value() && message.size() > 0) {
+            // Start this message's flight entry
+            common::capture::FlightEntry& flight = common::capture::currentFlight();
+            flight = common::capture::FlightEntry();
+            flight.receiveNs = common::timing::TscClock::nowNanos();
+            flight.sequence = common::capture::FlightRecorder::process().nextSequence();
+            HEXAGON_PROBE_RECEIVED(flight.sequence, flight.receiveNs, message.size());
+            // Record the raw frame for capture_replay before decoding
+            if (capture_) {
+                capture_->append(common::timing::TscClock::nowNanos(), message.group(), message.data(), message.size());
+            }
             try {
                 const uint8_t* data = static_cast<const uint8_t*>(message.data());
                 size_t dataSize = message.size();
                 
                 std::vector<uint8_t> dataVector(data, data + dataSize);
                 
-                if (trackData.deserialize(dataVector)) {
+                bool decoded = false;
+                {
+                    HEXAGON_SCOPE_TIMER("deserialize");
+                    decoded = trackData.deserialize(dataVector);
+                }
+                if (decoded) {
+                    flight.trackId = trackData.getTrackId();
+                    flight.decodeNs = common::timing::TscClock::nowNanos();
+                    HEXAGON_PROBE_DECODED(flight.trackId, flight.sequence, flight.decodeNs);
                     std::cout << "Successfully received and deserialized DelayCalcTrackData" << std::endl;
                     std::cout << "Track ID: " << trackData.getTrackId() 
                               << ", Update Time: " << trackData.getUpdateTime() << std::endl;
                     return true;
                 } else {
                     std::cerr << "Failed to deserialize DelayCalcTrackData" << std::endl;
+                    HEXAGON_PROBE_DROPPED(0, flight.sequence, common::timing::TscClock::nowNanos(),
+                                          common::probes::PROBE_DROP_DECODE);
                 }
             } catch (const std::exception& e) {
                 std::cerr << "Exception during deserialization: " << e.what() << std::endl;
+                HEXAGON_PROBE_DROPPED(0, flight.sequence, common::timing::TscClock::nowNanos(),
+                                      common::probes::PROBE_DROP_DECODE);
             }
         }
         
@@ -78,7 +139,33 @@ int main(int argc, char* argv[]) {
         signal(SIGINT, signalHandler);
         signal(SIGTERM, signalHandler);
 
+        // Offsets to A/B hexagon clocks (config/clock_sync.conf: peer.a_hexagon, peer.b_hexagon)
+        const common::timing::ClockSync& clockSync = common::timing::ClockSync::process();
+        const common::timing::ClockOffsetEstimator* aClock = clockSync.peer("a_hexagon");
+        const common::timing::ClockOffsetEstimator* bClock = clockSync.peer("b_hexagon");
+
+        // Columnar export for offline analysis (HEXAGON_EXPORT_DIR); written off this thread
+        std::unique_ptr<hat::adapters::outgoing::columnar::ColumnarTrackExporter> exporter =
+            hat::adapters::outgoing::columnar::ColumnarTrackExporter::fromEnvironment();
+        // Last messages' stage timestamps; kill -USR1 <pid> dumps them (HEXAGON_FLIGHT_*)
+        common::capture::FlightRecorder& flightRecorder = common::capture::FlightRecorder::process();
+        // Live counters for hexstat (/dev/shm/hexagon.<name>.<pid>); all written by this thread
+        common::metrics::MetricsSegment& metrics = common::metrics::MetricsSegment::process();
+        common::metrics::Counter receivedCount = metrics.counter("dish.received");
+        common::metrics::Histogram processNs = metrics.histogram("process_ns");
+        common::metrics::Histogram secondHopUs = metrics.histogram("second_hop_delay_us");
+        common::metrics::Histogram totalDelayUs = metrics.histogram("total_delay_us");
+        TrackStaticsCalculator statics;
+        constexpr long long STATICS_INTERVAL_US = 1000000;
+        long long nextStaticsUs = common::timing::TscClock::nowMicros() + STATICS_INTERVAL_US;
+
         ZeroMQDishTrackDataSubscriber subscriber("udp://239.1.1.5:9595");
+        std::cout << "I/O threads: " << common::topology::ThreadTopology::toString(subscriber.ioPlacement()) << std::endl;
+        // This thread runs the receive loop: CPU, real-time priority and NUMA from config/thread_topology.conf
+        std::cout << "Thread placement: "
+                  << common::topology::ThreadTopology::toString(
+                         common::topology::ThreadTopology::process().applyToCurrentThread("dish_receiver"))
+                  << std::endl;
         DelayCalcTrackData delayCalcData;
         
         std::cout << "🚀 Starting DelayCalcTrackData reception from B_hexagon..." << std::endl;
@@ -90,36 +177,74 @@ int main(int argc, char* argv[]) {
             if (subscriber.receiveDelayCalcTrackData(delayCalcData)) {
                 // Process received DelayCalcTrackData
                 FinalCalcTrackData finalData;
+                {
+                    HEXAGON_SCOPE_TIMER("final_calc");
                 
-                // Copy basic track data
-                finalData.setTrackId(delayCalcData.getTrackId());
-                finalData.setXPositionECEF(delayCalcData.getXPositionECEF());
-                finalData.setYPositionECEF(delayCalcData.getYPositionECEF());
-                finalData.setZPositionECEF(delayCalcData.getZPositionECEF());
-                finalData.setXVelocityECEF(delayCalcData.getXVelocityECEF());
-                finalData.setYVelocityECEF(delayCalcData.getYVelocityECEF());
-                finalData.setZVelocityECEF(delayCalcData.getZVelocityECEF());
+                    // Copy basic track data
+                    finalData.setTrackId(delayCalcData.getTrackId());
+                    finalData.setXPositionECEF(delayCalcData.getXPositionECEF());
+                    finalData.setYPositionECEF(delayCalcData.getYPositionECEF());
+                    finalData.setZPositionECEF(delayCalcData.getZPositionECEF());
+                    finalData.setXVelocityECEF(delayCalcData.getXVelocityECEF());
+                    finalData.setYVelocityECEF(delayCalcData.getYVelocityECEF());
+                    finalData.setZVelocityECEF(delayCalcData.getZVelocityECEF());
                 
-                // Set timing information
-                auto currentTime = std::chrono::duration_cast<std::chrono::microseconds>(
-                    std::chrono::high_resolution_clock::now().time_since_epoch()).count();
+                    // Set timing information
+                    auto currentTime = common::timing::TscClock::nowMicros();
                 
-                finalData.setThirdHopSentTime(currentTime);
-                finalData.setSecondHopSentTime(delayCalcData.getSecondHopSentTime());
-                finalData.setFirstHopDelayTime(delayCalcData.getFirstHopDelayTime());
-                finalData.setSecondHopDelayTime(currentTime - delayCalcData.getSecondHopSentTime());
-                finalData.setTotalDelayTime(currentTime - (delayCalcData.getOriginalUpdateTime() * 1000));
+                    finalData.setThirdHopSentTime(currentTime);
+                    finalData.setSecondHopSentTime(delayCalcData.getSecondHopSentTime());
+                    finalData.setFirstHopDelayTime(delayCalcData.getFirstHopDelayTime());
+                    // Move local time onto the sender's clock; unchanged while unsynchronized
+                    const long long currentOnB = bClock ? bClock->toPeerMicros(currentTime) : currentTime;
+                    const long long currentOnA = aClock ? aClock->toPeerMicros(currentTime) : currentTime;
+                    finalData.setSecondHopDelayTime(currentOnB - delayCalcData.getSecondHopSentTime());
+                    finalData.setTotalDelayTime(currentOnA - (delayCalcData.getOriginalUpdateTime() * 1000));
+                }
+                common::capture::FlightEntry& flight = common::capture::currentFlight();
+                flight.computeNs = common::timing::TscClock::nowNanos();
+                HEXAGON_PROBE_COMPUTED(flight.trackId, flight.sequence, flight.computeNs);
                 
                 std::cout << "Created FinalCalcTrackData for Track ID: " << finalData.getTrackId() << std::endl
                           << " FirstHopDelayTime: " << finalData.getFirstHopDelayTime() << " microseconds" << std::endl
                           << " SecondHopDelayTime: " << finalData.getSecondHopDelayTime() << " microseconds" << std::endl
                           << " Total ZeroMQ Delay: " << finalData.getFirstHopDelayTime() + finalData.getSecondHopDelayTime() << " microseconds" << std::endl
                           << " Total Delay: " << finalData.getTotalDelayTime() << " microseconds" << std::endl;
+                if (aClock != nullptr || bClock != nullptr) {
+                    std::cout << " Clock offsets: A " << (aClock ? common::timing::toString(aClock->estimate()) : "-")
+                              << ", B " << (bClock ? common::timing::toString(bClock->estimate()) : "-") << std::endl;
+                }
+
+                if (exporter) {
+                    HEXAGON_SCOPE_TIMER("export");
+                    exporter->exportFinal(finalData);
+                    statics.add(finalData);
+                }
+                flight.sendNs = common::timing::TscClock::nowNanos();
+                HEXAGON_PROBE_SENT(flight.trackId, flight.sequence, flight.sendNs, flight.sendNs - flight.receiveNs);
+                flightRecorder.record(flight);
+                receivedCount.add();
+                processNs.record(static_cast<std::uint64_t>(flight.sendNs - flight.receiveNs));
+                secondHopUs.record(static_cast<std::uint64_t>(std::max<std::int64_t>(finalData.getSecondHopDelayTime(), 0)));
+                totalDelayUs.record(static_cast<std::uint64_t>(std::max<std::int64_t>(finalData.getTotalDelayTime(), 0)));
+            }
+
+            if (exporter && common::timing::TscClock::nowMicros() >= nextStaticsUs) {
+                const long long nowUs = common::timing::TscClock::nowMicros();
+                for (const domain::model::TrackStatics& trackStatics : statics.drain(nowUs)) {
+                    exporter->exportStatics(trackStatics);
+                }
+                nextStaticsUs = nowUs + STATICS_INTERVAL_US;
             }
             
             std::this_thread::sleep_for(std::chrono::microseconds(10));
         }
 
+        if (exporter) {
+            const common::store::ExportStats exported = exporter->finalStats();
+            std::cout << "[Export] " << exported.rows << " FinalCalcTrackData rows, "
+                      << exported.droppedRows << " dropped" << std::endl;
+        }
         std::cout << "✅ C_hexagon shutdown complete." << std::endl;
         return 0;
 
@@ -1,9 +1,25 @@
 #include "TrackDataProcessor.hpp"
+#include "common/TscClock.h"
 #include <iostream>
 #include <chrono>
 
-FinalCalculatorService::FinalCalculatorService(std::unique_ptr<IDataSender> dataSender)
-    : dataSender_(std::move(dataSender)) {
+namespace {
+
+/// Peer clock minus local clock in µs at localMicros; 0 while unsynchronized
+long long offsetMicros(const common::timing::ClockOffsetEstimator* clock, long long localMicros) {
+    if (clock == nullptr) {
+        return 0;
+    }
+    const common::timing::ClockOffset offset = clock->estimate();
+    return offset.valid ? offset.offsetAt(localMicros * 1000) / 1000 : 0;
+}
+
+} // namespace
+
+FinalCalculatorService::FinalCalculatorService(std::unique_ptr<IDataSender> dataSender,
+                                               const common::timing::ClockOffsetEstimator* aHexagonClock,
+                                               const common::timing::ClockOffsetEstimator* bHexagonClock)
+    : dataSender_(std::move(dataSender)), aHexagonClock_(aHexagonClock), bHexagonClock_(bHexagonClock) {
 }
 
 void FinalCalculatorService::onDataReceived(const domain::model::DelayCalcTrackData& data) {
@@ -22,17 +38,22 @@ void FinalCalculatorService::onDataReceived(const domain::model::DelayCalcTrackD
         }
 
         // Log processing results
-        auto now = std::chrono::duration_cast<std::chrono::microseconds>(
-            std::chrono::system_clock::now().time_since_epoch()
-        ).count();
+        auto now = common::timing::TscClock::nowMicros();
         
-        long long totalDelay = now - data.getFirstHopSentTime();
-        long long bToCDelay = now - data.getSecondHopSentTime();
+        // Each delay is taken on the sender's clock
+        long long totalDelay = now + offsetMicros(aHexagonClock_, now) - data.getFirstHopSentTime();
+        long long bToCDelay = now + offsetMicros(bHexagonClock_, now) - data.getSecondHopSentTime();
         
         std::cout << "📊 Track[" << data.getTrackId() 
                   << "] Total:" << totalDelay << "μs"
                   << " B→C:" << bToCDelay << "μs"
-                  << " Final:" << finalData.getTotalDelayTime() << "μs" << std::endl;
+                  << " Final:" << finalData.getTotalDelayTime() << "μs";
+        if (aHexagonClock_ != nullptr || bHexagonClock_ != nullptr) {
+            std::cout << " (clock A " << (aHexagonClock_ ? common::timing::toString(aHexagonClock_->estimate()) : "-")
+                      << ", B " << (bHexagonClock_ ? common::timing::toString(bHexagonClock_->estimate()) : "-")
+                      << ")";
+        }
+        std::cout << std::endl;
 
     } catch (const std::exception& e) {
         std::cout << "Error processing DelayCalcTrackData: " << e.what() << std::endl;
@@ -59,15 +80,17 @@ domain::model::FinalCalcTrackData FinalCalculatorService::calculateFinalDelay(
     finalData.setFirstHopSentTime(static_cast<uint32_t>(input.getFirstHopSentTime()));
     finalData.setFirstHopDelayTime(static_cast<uint32_t>(input.getFirstHopDelayTime()));
     finalData.setSecondHopSentTime(static_cast<uint32_t>(input.getSecondHopSentTime()));
-    finalData.setSecondHopDelayTime(static_cast<uint32_t>(input.getSecondHopSentTime() - input.getFirstHopSentTime()));
+    // secondHopSentTime is on B's clock, firstHopSentTime on A's: move via the local clock onto A's
+    const long long secondHopLocal = input.getSecondHopSentTime() - offsetMicros(bHexagonClock_, input.getSecondHopSentTime());
+    const long long secondHopOnA = secondHopLocal + offsetMicros(aHexagonClock_, secondHopLocal);
+    finalData.setSecondHopDelayTime(static_cast<uint32_t>(secondHopOnA - input.getFirstHopSentTime()));
 
     // Calculate final hop timing
-    auto currentTime = std::chrono::duration_cast<std::chrono::microseconds>(
-        std::chrono::system_clock::now().time_since_epoch()
-    ).count();
+    auto currentTime = common::timing::TscClock::nowMicros();
     
     uint32_t thirdHopSentTime = static_cast<uint32_t>(currentTime);
-    uint32_t totalDelayTime = thirdHopSentTime - static_cast<uint32_t>(input.getFirstHopSentTime());
+    const long long currentOnA = currentTime + offsetMicros(aHexagonClock_, currentTime);
+    uint32_t totalDelayTime = static_cast<uint32_t>(currentOnA) - static_cast<uint32_t>(input.getFirstHopSentTime());
 
     finalData.setThirdHopSentTime(thirdHopSentTime);
     finalData.setTotalDelayTime(totalDelayTime);
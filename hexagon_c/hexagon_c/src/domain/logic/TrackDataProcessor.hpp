@@ -4,6 +4,7 @@
 #include "../ports/outgoing/TrackDataPublisher.hpp"
 #include "../model/DelayCalcTrackData.hpp"
 #include "../model/FinalCalcTrackData.hpp"
+#include "common/ClockSync.h"
 #include <memory>
 
 /**
@@ -16,9 +17,17 @@
 class FinalCalculatorService : public IDataReceiver {
 private:
     std::unique_ptr<IDataSender> dataSender_;
+    const common::timing::ClockOffsetEstimator* aHexagonClock_;
+    const common::timing::ClockOffsetEstimator* bHexagonClock_;
 
 public:
-    explicit FinalCalculatorService(std::unique_ptr<IDataSender> dataSender);
+    /**
+     * @param aHexagonClock A_hexagon's clock (firstHopSentTime); nullptr treats the clocks as equal
+     * @param bHexagonClock B_hexagon's clock (secondHopSentTime); nullptr treats the clocks as equal
+     */
+    explicit FinalCalculatorService(std::unique_ptr<IDataSender> dataSender,
+                                    const common::timing::ClockOffsetEstimator* aHexagonClock = nullptr,
+                                    const common::timing::ClockOffsetEstimator* bHexagonClock = nullptr);
 
     // IDataReceiver interface implementation
     void onDataReceived(const domain::model::DelayCalcTrackData& data) override;
@@ -0,0 +1,60 @@
+#include "TrackStaticsCalculator.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+constexpr double SCHEMA_MIN = 0.0;
+constexpr double SCHEMA_MAX = 1.0e6;
+
+double clampToSchema(double value) {
+    return std::isfinite(value) ? std::min(std::max(value, SCHEMA_MIN), SCHEMA_MAX) : SCHEMA_MAX;
+}
+
+} // namespace
+
+void TrackStaticsCalculator::Moments::add(double value) {
+    ++count;
+    const double delta = value - mean;
+    mean += delta / static_cast<double>(count);
+    m2 += delta * (value - mean);
+    min = count == 1 ? value : std::min(min, value);
+    max = count == 1 ? value : std::max(max, value);
+}
+
+double TrackStaticsCalculator::Moments::stddev() const {
+    return count > 1 ? std::sqrt(m2 / static_cast<double>(count - 1)) : 0.0;
+}
+
+void TrackStaticsCalculator::add(const domain::model::FinalCalcTrackData& data) {
+    TrackMoments& track = tracks_[data.getTrackId()];
+    track.firstHop.add(static_cast<double>(data.getFirstHopDelayTime()));
+    track.secondHop.add(static_cast<double>(data.getSecondHopDelayTime()));
+    track.total.add(static_cast<double>(data.getTotalDelayTime()));
+}
+
+std::vector<domain::model::TrackStatics> TrackStaticsCalculator::drain(int64_t updateTime) {
+    std::vector<domain::model::TrackStatics> result;
+    result.reserve(tracks_.size());
+    for (const auto& entry : tracks_) {
+        const TrackMoments& track = entry.second;
+        domain::model::TrackStatics statics;
+        statics.setTrackId(entry.first);
+        statics.setFirstHopDelayDataMean(clampToSchema(track.firstHop.mean));
+        statics.setFirstHopDelayDataStd(clampToSchema(track.firstHop.stddev()));
+        statics.setFirstHopDelayDataMin(clampToSchema(track.firstHop.min));
+        statics.setFirstHopDelayDataMax(clampToSchema(track.firstHop.max));
+        statics.setSecondHopDelayDataMean(clampToSchema(track.secondHop.mean));
+        statics.setSecondHopDelayDataStd(clampToSchema(track.secondHop.stddev()));
+        statics.setSecondHopDelayDataMin(clampToSchema(track.secondHop.min));
+        statics.setSecondHopDelayDataMax(clampToSchema(track.secondHop.max));
+        statics.setTotalHopDelayDataMean(clampToSchema(track.total.mean));
+        statics.setTotalHopDelayDataStd(clampToSchema(track.total.stddev()));
+        statics.setTotalHopDelayDataMin(clampToSchema(track.total.min));
+        statics.setTotalHopDelayDataMax(clampToSchema(track.total.max));
+        statics.setUpdateTime(updateTime);
+        result.push_back(statics);
+    }
+    tracks_.clear();
+    return result;
+}
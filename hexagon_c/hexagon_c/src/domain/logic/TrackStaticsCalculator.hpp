@@ -0,0 +1,47 @@
+#pragma once
+
+#include "../model/FinalCalcTrackData.hpp"
+#include "../model/TrackStatics.hpp"
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @class TrackStaticsCalculator
+ * @brief Per-track mean, standard deviation, min and max of the hop delays
+ *
+ * Accumulates FinalCalcTrackData delays (Welford, one pass) and turns them
+ * into TrackStatics on drain(). Not thread-safe; owned by the receive loop.
+ */
+class TrackStaticsCalculator {
+public:
+    void add(const domain::model::FinalCalcTrackData& data);
+
+    /**
+     * @brief Statistics of every track updated since the last drain
+     * @param updateTime Stamped into every result (µs)
+     *
+     * Values are clamped into the TrackStatics schema range [0, 1e6] µs.
+     */
+    std::vector<domain::model::TrackStatics> drain(int64_t updateTime);
+
+private:
+    struct Moments {
+        uint64_t count = 0;
+        double mean = 0.0;
+        double m2 = 0.0;
+        double min = 0.0;
+        double max = 0.0;
+
+        void add(double value);
+        double stddev() const;
+    };
+
+    struct TrackMoments {
+        Moments firstHop;
+        Moments secondHop;
+        Moments total;
+    };
+
+    std::unordered_map<int32_t, TrackMoments> tracks_;
+};
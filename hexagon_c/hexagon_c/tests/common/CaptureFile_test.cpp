@@ -0,0 +1,124 @@
+#include <gtest/gtest.h>
+#include "common/CaptureFile.h"
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+// Bu dosyada capture dosya formatını test ediyoruz: kayıtlar segmentler
+// arasında sırayla geri okunmalı, bozuk kuyruk atlanmalı, replay hızı doğru olmalı.
+
+using namespace common::capture;
+
+namespace {
+
+class CaptureFileTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        char pattern[] = "/tmp/hxcap_testXXXXXX";
+        ASSERT_NE(mkdtemp(pattern), nullptr);
+        directory_ = pattern;
+    }
+
+    void TearDown() override {
+        for (const std::string& path : CaptureReader::listSegments(directory_, "dish")) {
+            std::remove(path.c_str());
+        }
+        rmdir(directory_.c_str());
+    }
+
+    std::string directory_;
+};
+
+} // namespace
+
+TEST_F(CaptureFileTest, ReadsBackFramesAcrossSegments) {
+    CaptureOptions options;
+    options.directory = directory_;
+    options.prefix = "dish";
+    options.segmentBytes = 8192U;
+    {
+        CaptureWriter writer(options);
+        for (int i = 0; i < 200; ++i) {
+            const std::vector<std::uint8_t> payload(static_cast<std::size_t>(84 + i % 40),
+                                                    static_cast<std::uint8_t>(i));
+            ASSERT_TRUE(writer.append(1000 + i, i % 2 == 0 ? "DelayCalcTrackData" : "0000002a",
+                                      payload.data(), payload.size()));
+        }
+        EXPECT_EQ(writer.records(), 200U);
+        EXPECT_GT(writer.segments(), 1U);
+    }
+
+    CaptureReader reader(directory_, "dish");
+    CaptureRecord record;
+    int count = 0;
+    while (reader.next(record)) {
+        EXPECT_EQ(record.receiveNs, 1000 + count);
+        EXPECT_EQ(record.group, count % 2 == 0 ? "DelayCalcTrackData" : "0000002a");
+        ASSERT_EQ(record.size, static_cast<std::size_t>(84 + count % 40));
+        EXPECT_EQ(record.data[0], static_cast<std::uint8_t>(count));
+        EXPECT_EQ(record.data[record.size - 1U], static_cast<std::uint8_t>(count));
+        ++count;
+    }
+    EXPECT_EQ(count, 200);
+}
+
+TEST_F(CaptureFileTest, NewRunContinuesAfterExistingSegments) {
+    CaptureOptions options;
+    options.directory = directory_;
+    options.prefix = "dish";
+    const std::uint8_t byte = 7U;
+    {
+        CaptureWriter first(options);
+        first.append(1, "g", &byte, 1U);
+    }
+    {
+        CaptureWriter second(options);
+        second.append(2, "g", &byte, 1U);
+    }
+    EXPECT_EQ(CaptureReader::listSegments(directory_, "dish").size(), 2U);
+
+    CaptureReader reader(directory_, "dish");
+    CaptureRecord record;
+    ASSERT_TRUE(reader.next(record));
+    EXPECT_EQ(record.receiveNs, 1);
+    ASSERT_TRUE(reader.next(record));
+    EXPECT_EQ(record.receiveNs, 2);
+    EXPECT_FALSE(reader.next(record));
+}
+
+TEST_F(CaptureFileTest, DropsOversizeFramesAndOldSegments) {
+    CaptureOptions options;
+    options.directory = directory_;
+    options.prefix = "dish";
+    options.segmentBytes = 8192U;
+    options.maxSegments = 2U;
+    CaptureWriter writer(options);
+
+    const std::vector<std::uint8_t> huge(16384U, 1U);
+    EXPECT_FALSE(writer.append(1, "g", huge.data(), huge.size()));
+    EXPECT_EQ(writer.dropped(), 1U);
+
+    const std::vector<std::uint8_t> frame(1000U, 2U);
+    for (int i = 0; i < 40; ++i) {
+        ASSERT_TRUE(writer.append(i, "g", frame.data(), frame.size()));
+    }
+    EXPECT_LE(CaptureReader::listSegments(directory_, "dish").size(), 2U);
+}
+
+TEST(ReplayPacerTest, ScalesCapturedGaps) {
+    ReplayPacer original(1.0);
+    EXPECT_EQ(original.dueAt(5000, 100), 100);
+    EXPECT_EQ(original.dueAt(7000, 150), 2100);
+
+    ReplayPacer faster(4.0);
+    EXPECT_EQ(faster.dueAt(5000, 100), 100);
+    EXPECT_EQ(faster.dueAt(9000, 100), 1100);
+
+    ReplayPacer asap(0.0);
+    EXPECT_TRUE(asap.asFastAsPossible());
+    EXPECT_EQ(asap.dueAt(9000, 123), 123);
+}
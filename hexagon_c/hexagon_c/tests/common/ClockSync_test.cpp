@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+#include "common/ClockSync.h"
+#include "common/TscClock.h"
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+
+// Bu dosyada hexagon'lar arası saat farkı tahminini test ediyoruz: offset ve
+// drift doğru bulunmalı, yüksek gecikmeli örnekler elenmeli, UDP kanalı çalışmalı.
+
+using namespace common::timing;
+
+namespace {
+
+/// Peer clock = local + offset + drift * local; request/reply legs take up and down ns
+OffsetSample exchange(std::int64_t local, std::int64_t offset, double driftPpm, std::int64_t up, std::int64_t down) {
+    const auto peer = [offset, driftPpm](std::int64_t t) {
+        return t + offset + static_cast<std::int64_t>(driftPpm * 1e-6 * static_cast<double>(t));
+    };
+    OffsetSample sample;
+    sample.t1 = local;
+    sample.t2 = peer(local + up);
+    sample.t3 = sample.t2 + 2000;
+    sample.t4 = local + up + 2000 + down;
+    return sample;
+}
+
+} // namespace
+
+TEST(ClockSyncTest, ComputesNtpOffsetAndDelay) {
+    const OffsetSample sample = exchange(1000000, 5000000, 0.0, 30000, 30000);
+    EXPECT_EQ(sample.offset(), 5000000);
+    EXPECT_EQ(sample.delay(), 60000);
+}
+
+TEST(ClockSyncTest, EstimatorIsInvalidUntilFirstSample) {
+    ClockOffsetEstimator estimator;
+    EXPECT_FALSE(estimator.estimate().valid);
+    EXPECT_EQ(estimator.toPeerMicros(1234), 1234);
+}
+
+TEST(ClockSyncTest, FiltersAsymmetricQueueingDelays) {
+    ClockOffsetEstimator estimator;
+    const std::int64_t base = TscClock::nowNanos() - 64 * 200000000LL;
+    for (int i = 0; i < 64; ++i) {
+        const std::int64_t local = base + i * 200000000LL;
+        // Her dört örnekten biri gidişte 2 ms kuyrukta beklemiş
+        const std::int64_t up = (i % 4 == 0) ? 2030000 : 30000 + (i % 3) * 1000;
+        estimator.addSample(exchange(local, 5000000, 0.0, up, 30000));
+    }
+    const ClockOffset offset = estimator.estimate();
+    ASSERT_TRUE(offset.valid);
+    EXPECT_NEAR(static_cast<double>(offset.offsetNs), 5000000.0, 5000.0);
+    EXPECT_LE(offset.uncertaintyNs, 40000);
+    EXPECT_LT(offset.samples, 64U);
+}
+
+TEST(ClockSyncTest, EstimatesDrift) {
+    // 20 ppm: 16 s boyunca 320 µs kayma
+    ClockOffsetEstimator estimator;
+    const std::int64_t base = TscClock::nowNanos() - 32 * 500000000LL;
+    for (int i = 0; i < 32; ++i) {
+        OffsetSample sample = exchange(i * 500000000LL, -2000000, 20.0, 20000, 20000);
+        sample.t1 += base;
+        sample.t2 += base;
+        sample.t3 += base;
+        sample.t4 += base;
+        estimator.addSample(sample);
+    }
+    const ClockOffset offset = estimator.estimate();
+    ASSERT_TRUE(offset.valid);
+    EXPECT_NEAR(offset.driftPpm, 20.0, 0.5);
+    EXPECT_NEAR(static_cast<double>(offset.offsetNs), -2000000.0 + 20e-6 * 31 * 500000000.0, 2000.0);
+    EXPECT_NEAR(static_cast<double>(offset.offsetAt(offset.referenceNs + 1000000000LL) - offset.offsetNs),
+                20000.0, 1000.0);
+}
+
+TEST(ClockSyncTest, StaleEstimateIsInvalid) {
+    ClockOffsetEstimator estimator;
+    estimator.addSample(exchange(TscClock::nowNanos() - 20000000000LL, 1000, 0.0, 1000, 1000));
+    EXPECT_FALSE(estimator.estimate().valid);
+    estimator.setMaxAge(60000000000LL);
+    EXPECT_TRUE(estimator.estimate().valid);
+}
+
+TEST(ClockSyncTest, RejectsInvalidConfig) {
+    EXPECT_THROW(ClockSync::fromConfig({{"listen", "7790"}}), std::invalid_argument);
+    EXPECT_THROW(ClockSync::fromConfig({{"listen_port", "70000"}}), std::invalid_argument);
+    EXPECT_THROW(ClockSync::fromConfig({{"peer.a_hexagon", "10.0.0.1"}}), std::invalid_argument);
+    EXPECT_EQ(ClockSync::fromFile("does/not/exist.conf")->peer("a_hexagon"), nullptr);
+}
+
+TEST(ClockSyncTest, LoopbackPeerConvergesToZeroOffset) {
+    ClockSyncServer server(0);
+    ASSERT_NE(server.port(), 0U);
+    ClockSyncClient client("127.0.0.1", server.port(), 20);
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+    while (client.estimator().estimate().samples < 4U && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    const ClockOffset offset = client.estimator().estimate();
+    ASSERT_TRUE(offset.valid);
+    // Aynı host: fark belirsizlik sınırı içinde sıfır olmalı
+    EXPECT_LE(std::llabs(offset.offsetNs), offset.uncertaintyNs + 50000);
+    EXPECT_LT(offset.uncertaintyNs, 1000000);
+    EXPECT_GT(server.answered(), 0U);
+}
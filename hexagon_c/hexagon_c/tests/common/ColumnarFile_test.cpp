@@ -0,0 +1,193 @@
+#include <gtest/gtest.h>
+#include "common/ColumnarFile.h"
+#include "adapters/outgoing/columnar/ColumnarTrackExporter.hpp"
+#include "domain/logic/TrackStaticsCalculator.hpp"
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include <dirent.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Bu dosyada kolonlu dışa aktarma dosyasını test ediyoruz: satırlar şemasıyla birlikte geri
+// okunmalı, min/max istatistikleri uymayan chunk'lar atlanmalı, footer'sız dosya kurtarılmalı.
+
+using namespace common::store;
+
+namespace {
+
+class ColumnarFileTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        char pattern[] = "/tmp/hxcol_testXXXXXX";
+        ASSERT_NE(mkdtemp(pattern), nullptr);
+        directory_ = pattern;
+        path_ = directory_ + "/rows.hxcol";
+    }
+
+    void TearDown() override {
+        for (const std::string& path : files()) {
+            std::remove(path.c_str());
+        }
+        rmdir(directory_.c_str());
+    }
+
+    std::vector<std::string> files() const {
+        std::vector<std::string> paths;
+        if (DIR* dir = opendir(directory_.c_str())) {
+            while (const dirent* entry = readdir(dir)) {
+                if (entry->d_name[0] != '.') {
+                    paths.push_back(directory_ + "/" + entry->d_name);
+                }
+            }
+            closedir(dir);
+        }
+        return paths;
+    }
+
+    static ColumnSchema schema() {
+        return {{"time", ColumnType::Int64}, {"delay", ColumnType::Double}};
+    }
+
+    static void row(ColumnCell (&cells)[2], std::int64_t time) {
+        cells[0].asInt = time;
+        cells[1].asDouble = static_cast<double>(time) * 0.5;
+    }
+
+    std::string directory_;
+    std::string path_;
+};
+
+} // namespace
+
+TEST_F(ColumnarFileTest, WritesSchemaAndSkipsChunksByStatistics) {
+    {
+        ColumnarExporter exporter(path_, schema(), 100U, 16U);
+        ColumnCell cells[2];
+        for (std::int64_t time = 0; time < 1050; ++time) {
+            row(cells, time);
+            exporter.append(cells);
+        }
+        exporter.flush();
+        EXPECT_EQ(exporter.stats().droppedRows, 0U);
+    }
+
+    ColumnarReader reader(path_);
+    EXPECT_TRUE(reader.complete());
+    ASSERT_EQ(reader.schema().size(), 2U);
+    EXPECT_EQ(reader.schema()[1].name, "delay");
+    EXPECT_EQ(reader.schema()[1].type, ColumnType::Double);
+    EXPECT_EQ(reader.rows(), 1050U);
+    EXPECT_EQ(reader.chunks(), 11U);
+    EXPECT_EQ(reader.chunk(10).rows(), 50U);
+    EXPECT_EQ(reader.chunk(3).stats(0).min.asInt, 300);
+    EXPECT_EQ(reader.chunk(3).stats(1).max.asDouble, 199.5);
+    EXPECT_THROW(reader.columnIndex("missing"), std::invalid_argument);
+
+    // 250..349 iki chunk'a düşer; diğer dokuzu atlanmalı
+    const std::vector<ColumnRange> ranges = {ColumnRange::ints(reader.columnIndex("time"), 250, 349)};
+    std::size_t matched = 0U;
+    double sum = 0.0;
+    const std::size_t scanned = reader.scan(ranges, [&](const ChunkView& chunk) {
+        for (std::size_t index = 0U; index < chunk.rows(); ++index) {
+            if (chunk.rowMatches(index, ranges)) {
+                ++matched;
+                sum += chunk.column(1)[index].asDouble;
+            }
+        }
+    });
+    EXPECT_EQ(scanned, 2U);
+    EXPECT_EQ(matched, 100U);
+    EXPECT_DOUBLE_EQ(sum, (250.0 + 349.0) * 100.0 / 2.0 * 0.5);
+
+    EXPECT_EQ(reader.scan({ColumnRange::doubles(1, 1000.0, 2000.0)}, [](const ChunkView&) {}), 0U);
+}
+
+TEST_F(ColumnarFileTest, RecoversChunksWithoutFooter) {
+    ColumnBuffer buffer(2U, 10U);
+    ColumnCell cells[2];
+    for (std::int64_t time = 0; time < 10; ++time) {
+        row(cells, time);
+        buffer.append(cells);
+    }
+    {
+        ColumnarWriter writer(path_, schema());
+        ASSERT_TRUE(writer.writeChunk(buffer));
+        ASSERT_TRUE(writer.writeChunk(buffer));
+        ASSERT_TRUE(writer.close());
+    }
+    // Footer'ı ve ikinci chunk'ın sonunu kes: çökme sonrası dosya gibi
+    struct stat info {};
+    ASSERT_EQ(stat(path_.c_str(), &info), 0);
+    ASSERT_EQ(truncate(path_.c_str(), info.st_size - static_cast<off_t>(sizeof(ColumnarFooter) + 2U * 8U + 8U)), 0);
+
+    ColumnarReader reader(path_);
+    EXPECT_FALSE(reader.complete());
+    EXPECT_EQ(reader.chunks(), 1U);
+    EXPECT_EQ(reader.rows(), 10U);
+    EXPECT_EQ(reader.chunk(0).column(0)[9].asInt, 9);
+}
+
+TEST_F(ColumnarFileTest, ExporterDropsInsteadOfBlockingWhenWriterFallsBehind) {
+    ColumnarExporter exporter(path_, schema(), 1U, 1U);
+    ColumnCell cells[2];
+    for (std::int64_t time = 0; time < 10000; ++time) {
+        row(cells, time);
+        exporter.append(cells);
+    }
+    const ExportStats stats = exporter.stats();
+    EXPECT_EQ(stats.rows, 10000U);
+    EXPECT_LE(stats.chunks + stats.droppedRows, 10000U);
+}
+
+TEST_F(ColumnarFileTest, TrackExporterWritesFinalCalcAndStatics) {
+    {
+        hat::adapters::outgoing::columnar::ColumnarTrackExporter exporter(directory_, 64U);
+        TrackStaticsCalculator calculator;
+        domain::model::FinalCalcTrackData data;
+        for (int i = 0; i < 40; ++i) {
+            data.setTrackId(1000 + i % 2);
+            data.setFirstHopDelayTime(100 + i);
+            data.setSecondHopDelayTime(200);
+            data.setTotalDelayTime(300 + i);
+            exporter.exportFinal(data);
+            calculator.add(data);
+        }
+        for (const domain::model::TrackStatics& statics : calculator.drain(5000)) {
+            exporter.exportStatics(statics);
+        }
+        EXPECT_TRUE(calculator.drain(6000).empty());
+    }
+
+    std::string finalPath;
+    std::string staticsPath;
+    for (const std::string& path : files()) {
+        (path.find("final_calc_track_data.") != std::string::npos ? finalPath : staticsPath) = path;
+    }
+    ColumnarReader finalReader(finalPath);
+    EXPECT_EQ(finalReader.rows(), 40U);
+    EXPECT_EQ(finalReader.schema().size(), 15U);
+    const std::vector<ColumnRange> track = {ColumnRange::ints(finalReader.columnIndex("trackId"), 1001, 1001)};
+    std::size_t rows = 0U;
+    finalReader.scan(track, [&](const ChunkView& chunk) {
+        for (std::size_t index = 0U; index < chunk.rows(); ++index) {
+            rows += chunk.rowMatches(index, track) ? 1U : 0U;
+        }
+    });
+    EXPECT_EQ(rows, 20U);
+
+    ColumnarReader staticsReader(staticsPath);
+    ASSERT_EQ(staticsReader.rows(), 2U);
+    const ChunkView chunk = staticsReader.chunk(0);
+    const std::size_t meanColumn = staticsReader.columnIndex("firstHopDelayDataMean");
+    const std::size_t trackColumn = staticsReader.columnIndex("trackId");
+    for (std::size_t index = 0U; index < chunk.rows(); ++index) {
+        // Track 1000 çift i'leri (100, 102, ..., 138), 1001 tek i'leri alır
+        const double expected = chunk.column(trackColumn)[index].asInt == 1000 ? 119.0 : 120.0;
+        EXPECT_DOUBLE_EQ(chunk.column(meanColumn)[index].asDouble, expected);
+    }
+    EXPECT_EQ(chunk.column(staticsReader.columnIndex("updateTime"))[0].asInt, 5000);
+}
@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+#include "common/ConflatingQueue.h"
+#include <chrono>
+#include <thread>
+#include <vector>
+
+// Bu dosyada track bazlı birleştirici kuyruğu test ediyoruz: her track için yalnızca en yeni
+// değer beklemeli, ezilen değerler sayılmalı ve track'ler beklemeye girdikleri sırayla çıkmalı.
+
+using common::flow::ConflatingQueue;
+using common::flow::ConflationStats;
+
+namespace {
+
+struct Sample {
+    int trackId = 0;
+    int sequence = 0;
+};
+
+} // namespace
+
+TEST(ConflatingQueueTest, KeepsLatestValuePerKeyInArrivalOrder) {
+    ConflatingQueue<Sample> queue;
+    queue.push(7, Sample{7, 1});
+    queue.push(3, Sample{3, 1});
+    queue.push(7, Sample{7, 2});
+    queue.push(7, Sample{7, 3});
+
+    Sample sample;
+    ASSERT_TRUE(queue.tryPop(sample));
+    EXPECT_EQ(sample.trackId, 7);
+    EXPECT_EQ(sample.sequence, 3);
+    ASSERT_TRUE(queue.tryPop(sample));
+    EXPECT_EQ(sample.trackId, 3);
+    EXPECT_FALSE(queue.tryPop(sample));
+
+    // Boşalan anahtar yeniden sıranın sonuna girer
+    queue.push(3, Sample{3, 2});
+    queue.push(7, Sample{7, 4});
+    ASSERT_TRUE(queue.tryPop(sample));
+    EXPECT_EQ(sample.trackId, 3);
+
+    const ConflationStats stats = queue.stats();
+    EXPECT_EQ(stats.pushed, 6U);
+    EXPECT_EQ(stats.superseded, 2U);
+    EXPECT_EQ(stats.delivered, 3U);
+    EXPECT_EQ(stats.depth, 1U);
+    EXPECT_EQ(stats.maxDepth, 2U);
+    EXPECT_EQ(stats.keys, 2U);
+}
+
+TEST(ConflatingQueueTest, DepthStaysBoundedUnderOverload) {
+    ConflatingQueue<Sample> queue;
+    constexpr int TRACKS = 50;
+    constexpr int ROUNDS = 2000;
+    std::vector<int> lastSeen(TRACKS, 0);
+    bool ordered = true;
+
+    std::thread consumer([&] {
+        Sample sample;
+        while (queue.pop(sample)) {
+            ordered = ordered && sample.sequence > lastSeen[sample.trackId];
+            lastSeen[sample.trackId] = sample.sequence;
+            std::this_thread::sleep_for(std::chrono::microseconds(20));
+        }
+    });
+    for (int round = 1; round <= ROUNDS; ++round) {
+        for (int track = 0; track < TRACKS; ++track) {
+            queue.push(track, Sample{track, round});
+        }
+    }
+    queue.close();
+    consumer.join();
+
+    const ConflationStats stats = queue.stats();
+    EXPECT_TRUE(ordered);
+    EXPECT_LE(stats.maxDepth, static_cast<std::size_t>(TRACKS));
+    EXPECT_EQ(stats.delivered + stats.superseded, stats.pushed);
+    EXPECT_GT(stats.superseded, 0U);
+    // Kapatıldıktan sonra bekleyenler yine teslim edilir: her track son değerini görür
+    for (int track = 0; track < TRACKS; ++track) {
+        EXPECT_EQ(lastSeen[track], ROUNDS);
+    }
+    EXPECT_FALSE(queue.push(1, Sample{1, ROUNDS + 1}));
+}
+
+TEST(ConflatingQueueTest, PopForTimesOut) {
+    ConflatingQueue<Sample> queue;
+    Sample sample;
+    EXPECT_FALSE(queue.popFor(sample, std::chrono::milliseconds(5)));
+    EXPECT_FALSE(queue.closed());
+}
@@ -0,0 +1,147 @@
+#include <gtest/gtest.h>
+#include "common/FlightRecorder.h"
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <dirent.h>
+#include <unistd.h>
+
+// Bu dosyada uçuş kaydediciyi test ediyoruz: halka son N mesajı sırayla tutmalı,
+// eşik aşımı otomatik döküm üretmeli, döküm dosyası aynen geri okunmalı.
+
+using namespace common::capture;
+
+namespace {
+
+class FlightRecorderTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        char pattern[] = "/tmp/hxflt_testXXXXXX";
+        ASSERT_NE(mkdtemp(pattern), nullptr);
+        directory_ = pattern;
+    }
+
+    void TearDown() override {
+        for (const std::string& path : files()) {
+            std::remove(path.c_str());
+        }
+        rmdir(directory_.c_str());
+    }
+
+    std::vector<std::string> files() const {
+        std::vector<std::string> paths;
+        DIR* dir = opendir(directory_.c_str());
+        if (dir != nullptr) {
+            while (const dirent* item = readdir(dir)) {
+                const std::string name = item->d_name;
+                if (name != "." && name != "..") {
+                    paths.push_back(directory_ + "/" + name);
+                }
+            }
+            closedir(dir);
+        }
+        return paths;
+    }
+
+    static FlightEntry entry(std::int64_t trackId, std::int64_t receiveNs, std::int64_t latencyNs) {
+        FlightEntry flight;
+        flight.trackId = trackId;
+        flight.receiveNs = receiveNs;
+        flight.decodeNs = receiveNs + 100;
+        flight.computeNs = receiveNs + 200;
+        flight.sendNs = receiveNs + latencyNs;
+        return flight;
+    }
+
+    std::string directory_;
+};
+
+} // namespace
+
+TEST_F(FlightRecorderTest, KeepsLastEntriesOldestFirst) {
+    FlightOptions options;
+    options.slots = 6U;
+    options.directory = directory_;
+    FlightRecorder recorder(options);
+    EXPECT_EQ(recorder.options().slots, 8U);
+    EXPECT_EQ(recorder.nextSequence(), 1U);
+
+    for (int i = 0; i < 20; ++i) {
+        recorder.record(entry(i, 1000 * i, 500));
+    }
+    const std::vector<FlightEntry> entries = recorder.snapshot();
+    ASSERT_EQ(entries.size(), 8U);
+    for (std::size_t i = 0U; i < entries.size(); ++i) {
+        EXPECT_EQ(entries[i].ticket, 12U + i);
+        EXPECT_EQ(entries[i].trackId, static_cast<std::int64_t>(12U + i));
+        EXPECT_EQ(entries[i].latencyNs(), 500);
+        EXPECT_EQ(entries[i].flags, 0U);
+    }
+    EXPECT_EQ(recorder.recorded(), 20U);
+    EXPECT_EQ(recorder.dumps(), 0U);
+    EXPECT_THROW(FlightRecorder(FlightOptions{0U}), std::invalid_argument);
+}
+
+TEST_F(FlightRecorderTest, SlowMessageTriggersDump) {
+    FlightOptions options;
+    options.slots = 16U;
+    options.thresholdNs = 1000;
+    options.directory = directory_;
+    FlightRecorder recorder(options);
+
+    recorder.record(entry(1, 5000, 400));
+    recorder.record(entry(2, 6000, 2500));
+    recorder.record(entry(3, 9000, 5000));
+    for (int wait = 0; wait < 200 && recorder.dumps() == 0U; ++wait) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    ASSERT_EQ(recorder.dumps(), 1U);
+
+    const std::vector<std::string> dumps = files();
+    ASSERT_EQ(dumps.size(), 1U);
+    FlightDumpHeader header{};
+    const std::vector<FlightEntry> entries = readFlightDump(dumps[0], header);
+    EXPECT_EQ(header.reason, static_cast<std::uint32_t>(DumpReason::Threshold));
+    EXPECT_EQ(header.thresholdNs, 1000);
+    EXPECT_EQ(header.pid, static_cast<std::uint32_t>(getpid()));
+    ASSERT_EQ(entries.size(), 3U);
+    EXPECT_EQ(entries[0].flags, 0U);
+    EXPECT_EQ(entries[1].flags, FLIGHT_OVER_THRESHOLD);
+    EXPECT_EQ(entries[2].flags, FLIGHT_OVER_THRESHOLD);
+}
+
+TEST_F(FlightRecorderTest, DumpReadsBackAndRejectsOtherFiles) {
+    FlightOptions options;
+    options.slots = 4U;
+    options.directory = directory_;
+    FlightRecorder recorder(options);
+    FlightEntry partial;
+    partial.trackId = 42;
+    partial.sequence = 7U;
+    partial.computeNs = 1234;
+    recorder.record(partial);
+
+    const std::string path = recorder.dump(DumpReason::Request);
+    ASSERT_FALSE(path.empty());
+    FlightDumpHeader header{};
+    const std::vector<FlightEntry> entries = readFlightDump(path, header);
+    ASSERT_EQ(entries.size(), 1U);
+    EXPECT_EQ(entries[0].trackId, 42);
+    EXPECT_EQ(entries[0].sequence, 7U);
+    EXPECT_EQ(entries[0].computeNs, 1234);
+    EXPECT_EQ(entries[0].latencyNs(), 0);
+    EXPECT_EQ(header.reason, static_cast<std::uint32_t>(DumpReason::Request));
+
+    const std::string bogus = directory_ + "/bogus.hxflt";
+    std::FILE* file = std::fopen(bogus.c_str(), "wb");
+    ASSERT_NE(file, nullptr);
+    std::fputs("not a flight dump, just some text padding it out to header size", file);
+    std::fclose(file);
+    EXPECT_THROW(readFlightDump(bogus, header), std::runtime_error);
+    EXPECT_THROW(readFlightDump(directory_ + "/missing.hxflt", header), std::runtime_error);
+}
@@ -0,0 +1,189 @@
+#include <gtest/gtest.h>
+#include "common/GeoTransforms.h"
+#include <cmath>
+#include <random>
+#include <vector>
+
+// Bu dosyada ortak GeoTransforms kütüphanesinin doğruluğunu test ediyoruz.
+// Batch (SIMD) çekirdekler skaler referansla ve bilinen noktalarla karşılaştırılır.
+
+using namespace common::geo;
+
+namespace {
+
+constexpr double kDeg = 3.14159265358979323846 / 180.0;
+constexpr double kAngleTol = 1e-11;   // ~0.06 mm yer yüzeyinde
+constexpr double kMetreTol = 1e-4;    // 0.1 mm
+// Bowring tek adım: 100 km irtifaya kadar ~1e-11 rad model hatası
+constexpr double kBowringTol = 5e-11; // ~0.3 mm
+
+struct Columns {
+    std::vector<double> a, b, c;
+    explicit Columns(std::size_t n) : a(n), b(n), c(n) {}
+};
+
+// Rastgele geodetik noktalar: tüm enlem/boylam aralığı, 0-100 km irtifa
+Columns randomGeodetic(std::size_t n, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<double> lat(-90.0 * kDeg, 90.0 * kDeg);
+    std::uniform_real_distribution<double> lon(-180.0 * kDeg, 180.0 * kDeg);
+    std::uniform_real_distribution<double> alt(-500.0, 100000.0);
+    Columns c(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        c.a[i] = lat(rng);
+        c.b[i] = lon(rng);
+        c.c[i] = alt(rng);
+    }
+    return c;
+}
+
+} // namespace
+
+TEST(GeoTransformsTest, KnownPointsGeodeticToEcef) {
+    double x, y, z;
+    geodeticToEcef(0.0, 0.0, 0.0, x, y, z);
+    EXPECT_NEAR(x, WGS84_A, kMetreTol);
+    EXPECT_NEAR(y, 0.0, kMetreTol);
+    EXPECT_NEAR(z, 0.0, kMetreTol);
+
+    geodeticToEcef(90.0 * kDeg, 0.0, 0.0, x, y, z);
+    EXPECT_NEAR(x, 0.0, kMetreTol);
+    EXPECT_NEAR(z, WGS84_B, kMetreTol);
+
+    geodeticToEcef(0.0, 90.0 * kDeg, 1000.0, x, y, z);
+    EXPECT_NEAR(y, WGS84_A + 1000.0, kMetreTol);
+}
+
+TEST(GeoTransformsTest, KnownPointsEcefToGeodetic) {
+    double lat, lon, alt;
+    ecefToGeodetic(WGS84_A + 250.0, 0.0, 0.0, lat, lon, alt);
+    EXPECT_NEAR(lat, 0.0, kAngleTol);
+    EXPECT_NEAR(lon, 0.0, kAngleTol);
+    EXPECT_NEAR(alt, 250.0, kMetreTol);
+
+    // Kuzey ve güney kutbu
+    ecefToGeodetic(0.0, 0.0, WGS84_B + 10.0, lat, lon, alt);
+    EXPECT_NEAR(lat, 90.0 * kDeg, kAngleTol);
+    EXPECT_NEAR(alt, 10.0, kMetreTol);
+    ecefToGeodetic(0.0, 0.0, -WGS84_B, lat, lon, alt);
+    EXPECT_NEAR(lat, -90.0 * kDeg, kAngleTol);
+    EXPECT_NEAR(alt, 0.0, kMetreTol);
+}
+
+TEST(GeoTransformsTest, ScalarRoundTrip) {
+    const Columns g = randomGeodetic(1000, 1U);
+    for (std::size_t i = 0; i < g.a.size(); ++i) {
+        double x, y, z, lat, lon, alt;
+        geodeticToEcef(g.a[i], g.b[i], g.c[i], x, y, z);
+        ecefToGeodetic(x, y, z, lat, lon, alt);
+        EXPECT_NEAR(lat, g.a[i], kBowringTol);
+        EXPECT_NEAR(alt, g.c[i], kMetreTol);
+        if (std::fabs(g.a[i]) < 89.9 * kDeg) {
+            EXPECT_NEAR(lon, g.b[i], kAngleTol);
+        }
+    }
+}
+
+TEST(GeoTransformsTest, BatchMatchesScalar) {
+    // 4'ün katı olmayan boyut: vektör döngüsü + skaler kuyruk birlikte test edilir
+    const std::size_t n = 1003;
+    const Columns g = randomGeodetic(n, 2U);
+    Columns ecef(n);
+    Columns back(n);
+
+    geodeticToEcef(g.a.data(), g.b.data(), g.c.data(), ecef.a.data(), ecef.b.data(), ecef.c.data(), n);
+    ecefToGeodetic(ecef.a.data(), ecef.b.data(), ecef.c.data(), back.a.data(), back.b.data(), back.c.data(), n);
+
+    for (std::size_t i = 0; i < n; ++i) {
+        double x, y, z, lat, lon, alt;
+        geodeticToEcef(g.a[i], g.b[i], g.c[i], x, y, z);
+        EXPECT_NEAR(ecef.a[i], x, kMetreTol);
+        EXPECT_NEAR(ecef.b[i], y, kMetreTol);
+        EXPECT_NEAR(ecef.c[i], z, kMetreTol);
+
+        ecefToGeodetic(x, y, z, lat, lon, alt);
+        EXPECT_NEAR(back.a[i], lat, kAngleTol);
+        EXPECT_NEAR(back.b[i], lon, kAngleTol);
+        EXPECT_NEAR(back.c[i], alt, kMetreTol);
+    }
+}
+
+TEST(GeoTransformsTest, BatchHandlesAxesAndOrigin) {
+    // Eksen üzerindeki ve merkezdeki noktalar atan2 kadran düzeltmelerini zorlar
+    const std::vector<double> x = {WGS84_A, -WGS84_A, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0};
+    const std::vector<double> y = {0.0, 0.0, WGS84_A, -WGS84_A, 0.0, 0.0, 0.0, -1.0};
+    const std::vector<double> z = {0.0, 0.0, 0.0, 0.0, WGS84_B, -WGS84_B, 0.0, 0.0};
+    const std::size_t n = x.size();
+    std::vector<double> lat(n), lon(n), alt(n);
+    ecefToGeodetic(x.data(), y.data(), z.data(), lat.data(), lon.data(), alt.data(), n);
+
+    for (std::size_t i = 0; i < n; ++i) {
+        double sLat, sLon, sAlt;
+        ecefToGeodetic(x[i], y[i], z[i], sLat, sLon, sAlt);
+        EXPECT_NEAR(lat[i], sLat, kAngleTol) << "index " << i;
+        EXPECT_NEAR(std::fabs(lon[i]), std::fabs(sLon), kAngleTol) << "index " << i;
+        EXPECT_NEAR(alt[i], sAlt, kMetreTol) << "index " << i;
+    }
+    EXPECT_NEAR(lon[1], 180.0 * kDeg, kAngleTol);
+    EXPECT_NEAR(lon[3], -90.0 * kDeg, kAngleTol);
+}
+
+TEST(GeoTransformsTest, EnuReferencePointIsOrigin) {
+    const EnuFrame frame(39.9 * kDeg, 32.8 * kDeg, 900.0);
+    double e, n, u;
+    frame.ecefToEnu(frame.getRefX(), frame.getRefY(), frame.getRefZ(), e, n, u);
+    EXPECT_NEAR(e, 0.0, kMetreTol);
+    EXPECT_NEAR(n, 0.0, kMetreTol);
+    EXPECT_NEAR(u, 0.0, kMetreTol);
+
+    // Referansın 1 km üstü: yalnızca Up bileşeni
+    double x, y, z;
+    geodeticToEcef(39.9 * kDeg, 32.8 * kDeg, 1900.0, x, y, z);
+    frame.ecefToEnu(x, y, z, e, n, u);
+    EXPECT_NEAR(e, 0.0, kMetreTol);
+    EXPECT_NEAR(n, 0.0, kMetreTol);
+    EXPECT_NEAR(u, 1000.0, kMetreTol);
+}
+
+TEST(GeoTransformsTest, EnuBatchRoundTrip) {
+    const EnuFrame frame(-33.9 * kDeg, 151.2 * kDeg, 50.0);
+    const std::size_t n = 257;
+    const Columns g = randomGeodetic(n, 3U);
+    Columns ecef(n), enu(n), back(n), single(n);
+    geodeticToEcef(g.a.data(), g.b.data(), g.c.data(), ecef.a.data(), ecef.b.data(), ecef.c.data(), n);
+
+    frame.ecefToEnu(ecef.a.data(), ecef.b.data(), ecef.c.data(), enu.a.data(), enu.b.data(), enu.c.data(), n);
+    frame.enuToEcef(enu.a.data(), enu.b.data(), enu.c.data(), back.a.data(), back.b.data(), back.c.data(), n);
+
+    for (std::size_t i = 0; i < n; ++i) {
+        double e, nn, u;
+        frame.ecefToEnu(ecef.a[i], ecef.b[i], ecef.c[i], e, nn, u);
+        EXPECT_NEAR(enu.a[i], e, kMetreTol);
+        EXPECT_NEAR(enu.b[i], nn, kMetreTol);
+        EXPECT_NEAR(enu.c[i], u, kMetreTol);
+        EXPECT_NEAR(back.a[i], ecef.a[i], kMetreTol);
+        EXPECT_NEAR(back.b[i], ecef.b[i], kMetreTol);
+        EXPECT_NEAR(back.c[i], ecef.c[i], kMetreTol);
+    }
+}
+
+TEST(GeoTransformsTest, EnuVectorRotationPreservesNorm) {
+    const EnuFrame frame(10.0 * kDeg, -70.0 * kDeg, 0.0);
+    const std::vector<double> vx = {100.0, -50.0, 0.0, 3.0, 250.0};
+    const std::vector<double> vy = {0.0, 20.0, -300.0, 4.0, 1.0};
+    const std::vector<double> vz = {0.0, 10.0, 5.0, 12.0, -7.0};
+    const std::size_t n = vx.size();
+    std::vector<double> ve(n), vn(n), vu(n), bx(n), by(n), bz(n);
+
+    frame.ecefVectorToEnu(vx.data(), vy.data(), vz.data(), ve.data(), vn.data(), vu.data(), n);
+    frame.enuVectorToEcef(ve.data(), vn.data(), vu.data(), bx.data(), by.data(), bz.data(), n);
+
+    for (std::size_t i = 0; i < n; ++i) {
+        const double inNorm = std::sqrt(vx[i] * vx[i] + vy[i] * vy[i] + vz[i] * vz[i]);
+        const double outNorm = std::sqrt(ve[i] * ve[i] + vn[i] * vn[i] + vu[i] * vu[i]);
+        EXPECT_NEAR(outNorm, inNorm, 1e-9);
+        EXPECT_NEAR(bx[i], vx[i], 1e-9);
+        EXPECT_NEAR(by[i], vy[i], 1e-9);
+        EXPECT_NEAR(bz[i], vz[i], 1e-9);
+    }
+}
@@ -0,0 +1,98 @@
+#include <gtest/gtest.h>
+#include "common/MessageBufferPool.h"
+#include "common/PooledMessage.h"
+#include <cstring>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// Bu dosyada mesaj buffer havuzunu test ediyoruz: aynı thread'de geri verilen
+// blok tekrar kullanılmalı, başka thread'den (libzmq I/O thread) geri verilen
+// blok sahibine dönmeli ve havuz thread'inden uzun yaşayabilmeli.
+
+using namespace common::pool;
+
+TEST(MessageBufferPoolTest, PicksSmallestFittingSizeClass) {
+    MessageBufferPool& pool = MessageBufferPool::local();
+    PooledBuffer small = pool.acquire(84U);
+    PooledBuffer large = pool.acquire(129U);
+    EXPECT_EQ(small.capacity(), 128U);
+    EXPECT_EQ(large.capacity(), 256U);
+    EXPECT_NE(small.data(), nullptr);
+}
+
+TEST(MessageBufferPoolTest, SameThreadReleaseReusesBlock) {
+    MessageBufferPool& pool = MessageBufferPool::local();
+    const std::size_t before = pool.outstanding();
+    std::uint8_t* first = nullptr;
+    {
+        PooledBuffer buffer = pool.acquire(100U);
+        first = buffer.data();
+        EXPECT_EQ(pool.outstanding(), before + 1U);
+    }
+    EXPECT_EQ(pool.outstanding(), before);
+    PooledBuffer again = pool.acquire(100U);
+    EXPECT_EQ(again.data(), first);
+}
+
+TEST(MessageBufferPoolTest, OversizeRequestsUseHeap) {
+    MessageBufferPool& pool = MessageBufferPool::local();
+    const std::uint64_t oversize = pool.getStats().oversize;
+    PooledBuffer buffer = pool.acquire(10000U);
+    EXPECT_GE(buffer.capacity(), 10000U);
+    std::memset(buffer.data(), 0xAB, buffer.capacity());
+    EXPECT_EQ(pool.getStats().oversize, oversize + 1U);
+}
+
+TEST(MessageBufferPoolTest, CrossThreadReleaseReturnsToOwner) {
+    std::thread owner([]() {
+        MessageBufferPool& pool = MessageBufferPool::local();
+        PooledBuffer first = pool.acquire(64U);
+        std::uint8_t* firstData = first.data();
+
+        // Release on another thread, as libzmq's I/O thread would
+        std::thread releaser([buffer = std::move(first)]() mutable {
+            MessageBufferPool::release(buffer.data(), buffer.hint());
+            buffer.detach();
+        });
+        releaser.join();
+
+        // Drain the rest of the first slab, then the returned block comes back
+        std::vector<PooledBuffer> held;
+        for (std::size_t i = 1U; i < MessageBufferPool::BLOCKS_PER_SLAB; ++i) {
+            held.push_back(pool.acquire(64U));
+        }
+        PooledBuffer reclaimed = pool.acquire(64U);
+        EXPECT_EQ(reclaimed.data(), firstData);
+        EXPECT_EQ(pool.getStats().slabs, 1U);
+        EXPECT_EQ(pool.getStats().reclaimed, 1U);
+    });
+    owner.join();
+}
+
+TEST(MessageBufferPoolTest, BlocksOutliveOwningThread) {
+    PooledBuffer survivor;
+    std::thread owner([&survivor]() {
+        survivor = MessageBufferPool::local().acquire(200U);
+        std::memset(survivor.data(), 0x5A, survivor.capacity());
+    });
+    owner.join();
+    ASSERT_NE(survivor.data(), nullptr);
+    EXPECT_EQ(survivor.data()[0], 0x5A);
+    // Dropping survivor frees the orphaned pool
+}
+
+TEST(MessageBufferPoolTest, MessageReturnsBlockWhenClosed) {
+    MessageBufferPool& pool = MessageBufferPool::local();
+    const std::size_t before = pool.outstanding();
+    {
+        PooledBuffer buffer = pool.acquire(96U);
+        std::memset(buffer.data(), 7, 96U);
+        zmq::message_t message = toMessage(buffer, 96U);
+        EXPECT_EQ(buffer.data(), nullptr);
+        EXPECT_EQ(message.size(), 96U);
+        EXPECT_EQ(static_cast<const std::uint8_t*>(message.data())[95], 7U);
+        EXPECT_EQ(pool.outstanding(), before + 1U);
+    }
+    EXPECT_EQ(pool.outstanding(), before);
+}
@@ -0,0 +1,93 @@
+#include <gtest/gtest.h>
+#include "common/MetricsSegment.h"
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+// Bu dosyada paylaşımlı bellek metrik segmentini test ediyoruz: yazılan sayaç, gösterge ve
+// histogramlar ayrı bir okuyucudan aynen görülmeli, yüzdelikler kova hassasiyetinde olmalı.
+
+using namespace common::metrics;
+
+TEST(MetricsSegmentTest, HistogramBucketsCoverValuesInOrder) {
+    EXPECT_EQ(histogramBucket(0U), 0U);
+    EXPECT_EQ(histogramBucket(7U), 7U);
+    std::size_t previous = 0U;
+    for (std::uint64_t value = 1U; value < (1ULL << 41); value = value * 3U / 2U + 1U) {
+        const std::size_t bucket = histogramBucket(value);
+        EXPECT_GE(bucket, previous);
+        EXPECT_LE(histogramBucketLow(bucket), value);
+        EXPECT_GT(histogramBucketLow(bucket + 1U), value);
+        previous = bucket;
+    }
+    EXPECT_EQ(histogramBucket(~0ULL), HISTOGRAM_BUCKETS - 1U);
+
+    std::vector<std::uint64_t> buckets(HISTOGRAM_BUCKETS, 0U);
+    for (std::uint64_t value = 1000U; value < 2000U; ++value) {
+        ++buckets[histogramBucket(value)];
+    }
+    EXPECT_NEAR(histogramPercentile(buckets, 0.5), 1500.0, 1500.0 * 0.125);
+    EXPECT_NEAR(histogramPercentile(buckets, 0.99), 1990.0, 1990.0 * 0.125);
+    EXPECT_EQ(histogramPercentile(std::vector<std::uint64_t>(HISTOGRAM_BUCKETS, 0U), 0.5), 0.0);
+}
+
+TEST(MetricsSegmentTest, ReaderSeesWriterMetrics) {
+    const std::string service = "metrics_test";
+    MetricsSegment segment(service, 4U);
+    EXPECT_EQ(segment.path(), MetricsSegment::pathFor(service, static_cast<std::uint32_t>(getpid())));
+
+    Counter received = segment.counter("dish.received");
+    Gauge depth = segment.gauge("queue.depth");
+    Histogram latency = segment.histogram("track.latency_ns");
+    received.add();
+    received.add(4U);
+    depth.set(-3);
+    for (std::uint64_t value = 1U; value <= 100U; ++value) {
+        latency.record(value * 1000U);
+    }
+    EXPECT_EQ(segment.counter("dish.received").value(), 5U);
+    EXPECT_DOUBLE_EQ(latency.mean(), 50500.0);
+
+    const std::vector<std::string> listed = MetricsReader::listSegments(service);
+    ASSERT_EQ(listed.size(), 1U);
+    MetricsReader reader(listed[0]);
+    EXPECT_TRUE(reader.alive());
+    const MetricsSnapshot snapshot = reader.read();
+    EXPECT_EQ(snapshot.service, service);
+    EXPECT_EQ(snapshot.pid, static_cast<std::uint32_t>(getpid()));
+    ASSERT_EQ(snapshot.metrics.size(), 3U);
+    EXPECT_EQ(snapshot.metrics[0].name, "dish.received");
+    EXPECT_EQ(snapshot.metrics[0].value, 5U);
+    EXPECT_EQ(static_cast<std::int64_t>(snapshot.metrics[1].value), -3);
+    const MetricSample& histogram = snapshot.metrics[2];
+    EXPECT_EQ(histogram.kind, MetricKind::Histogram);
+    EXPECT_EQ(histogram.value, 100U);
+    EXPECT_EQ(histogram.max, 100000U);
+    EXPECT_NEAR(histogramPercentile(histogram.buckets, 0.9), 90000.0, 90000.0 * 0.125);
+}
+
+TEST(MetricsSegmentTest, RejectsBadNamesFullSegmentsAndForeignFiles) {
+    MetricsSegment segment("metrics_test_private", 1U, MetricsSegment::Backing::Private);
+    EXPECT_TRUE(segment.path().empty());
+    segment.counter("one");
+    EXPECT_THROW(segment.gauge("one"), std::invalid_argument);
+    EXPECT_THROW(segment.counter(""), std::invalid_argument);
+    EXPECT_THROW(segment.counter(std::string(METRIC_NAME_BYTES, 'x')), std::invalid_argument);
+    EXPECT_THROW(segment.counter("two"), std::runtime_error);
+    EXPECT_THROW(MetricsSegment("metrics_test_private", 0U, MetricsSegment::Backing::Private), std::invalid_argument);
+
+    // Default handles are no-ops
+    Counter unregistered;
+    unregistered.add();
+    EXPECT_EQ(unregistered.value(), 0U);
+
+    const std::string foreign = "/tmp/hexagon.metrics_test_foreign";
+    std::ofstream(foreign) << std::string(256U, 'x');
+    EXPECT_THROW(MetricsReader reader(foreign), std::runtime_error);
+    std::remove(foreign.c_str());
+    EXPECT_THROW(MetricsReader reader("/dev/shm/hexagon.missing.0"), std::runtime_error);
+}
@@ -0,0 +1,68 @@
+#include <gtest/gtest.h>
+#undef HEXAGON_SCOPE_TIMERS
+#define HEXAGON_SCOPE_TIMERS 1
+#include "common/ScopeTimer.h"
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+// Bu dosyada kapsam zamanlayıcılarını test ediyoruz: her thread kendi histogramına yazmalı,
+// sayaçlar artan olmalı ve sonuçlar metrik segmentinden cycles.<kapsam>.<thread> olarak okunmalı.
+
+using namespace common::timing;
+using common::metrics::MetricSample;
+using common::metrics::MetricsReader;
+using common::metrics::MetricsSegment;
+
+namespace {
+
+void timedWork(int iterations) {
+    for (int i = 0; i < iterations; ++i) {
+        HEXAGON_SCOPE_TIMER("scope_test");
+        volatile std::uint64_t sink = 0U;
+        for (int j = 0; j < 100; ++j) {
+            sink = sink + static_cast<std::uint64_t>(j);
+        }
+    }
+}
+
+std::vector<MetricSample> scopeMetrics() {
+    MetricsReader reader(MetricsSegment::process().path());
+    std::vector<MetricSample> found;
+    for (const MetricSample& sample : reader.read().metrics) {
+        if (sample.name.compare(0U, 17U, "cycles.scope_test") == 0) {
+            found.push_back(sample);
+        }
+    }
+    return found;
+}
+
+} // namespace
+
+TEST(ScopeTimerTest, CountersAreOrdered) {
+    const std::uint64_t first = cyclesBegin();
+    const std::uint64_t second = cyclesEnd();
+    EXPECT_LE(first, second);
+}
+
+TEST(ScopeTimerTest, EachThreadRecordsIntoItsOwnHistogram) {
+    if (MetricsSegment::process().path().empty()) {
+        GTEST_SKIP() << "no /dev/shm in this environment";
+    }
+    timedWork(200);
+    std::thread other([] { timedWork(50); });
+    other.join();
+
+    const std::vector<MetricSample> metrics = scopeMetrics();
+    ASSERT_EQ(metrics.size(), 2U);
+    EXPECT_EQ(metrics[0].value + metrics[1].value, 250U);
+    EXPECT_TRUE((metrics[0].value == 200U && metrics[1].value == 50U) ||
+                (metrics[0].value == 50U && metrics[1].value == 200U));
+    for (const MetricSample& sample : metrics) {
+        EXPECT_GT(sample.max, 0U);
+        EXPECT_GE(sample.sum, sample.max);
+    }
+}
@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+#include "common/SpscRing.h"
+#include "common/StagePipeline.h"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+// Bu dosyada boru hattı aşamalarını test ediyoruz: halka sırayı korumalı, dolu/boş durumları
+// bildirmeli, aşama iş parçacığı her öğeyi sırayla işleyip servis süresi ve doluluğu saymalı.
+
+using namespace common::flow;
+
+TEST(SpscRingTest, KeepsOrderAndReportsFullAndEmpty) {
+    SpscRing<int> ring(3U);
+    EXPECT_EQ(ring.capacity(), 4U);
+
+    int value = 0;
+    EXPECT_FALSE(ring.tryPop(value));
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_TRUE(ring.tryPush(i));
+    }
+    EXPECT_FALSE(ring.tryPush(99));
+    EXPECT_EQ(ring.size(), 4U);
+
+    for (int i = 0; i < 4; ++i) {
+        ASSERT_TRUE(ring.tryPop(value));
+        EXPECT_EQ(value, i);
+    }
+    EXPECT_FALSE(ring.tryPop(value));
+    EXPECT_EQ(ring.size(), 0U);
+}
+
+TEST(SpscRingTest, CrossThreadSequenceSurvivesWrapAround) {
+    SpscRing<std::uint64_t> ring(16U);
+    constexpr std::uint64_t COUNT = 50000U;
+    std::thread producer([&ring] {
+        for (std::uint64_t i = 0U; i < COUNT; ++i) {
+            while (!ring.tryPush(i)) {
+                std::this_thread::yield();
+            }
+        }
+    });
+    std::uint64_t expected = 0U;
+    std::uint64_t value = 0U;
+    while (expected < COUNT) {
+        if (ring.tryPop(value)) {
+            ASSERT_EQ(value, expected);
+            ++expected;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+}
+
+TEST(StageWorkerTest, ProcessesInOrderAndRecordsMetrics) {
+    StageMetrics metrics("compute", 8U);
+    std::vector<int> seen;
+    {
+        StageWorker<int> worker("compute_stage", 8U, metrics, [&seen](int& item) {
+            seen.push_back(item);
+            std::this_thread::sleep_for(std::chrono::microseconds(20));
+        });
+        EXPECT_EQ(worker.capacity(), 8U);
+        for (int i = 0; i < 100; ++i) {
+            worker.push(i);
+        }
+    }   // Destructor serves what is still queued
+
+    ASSERT_EQ(seen.size(), 100U);
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_EQ(seen[static_cast<std::size_t>(i)], i);
+    }
+    const StageSnapshot snapshot = metrics.take();
+    EXPECT_EQ(snapshot.name, "compute");
+    EXPECT_EQ(snapshot.items, 100U);
+    EXPECT_GE(snapshot.serviceNs, 100U * 20000U);
+    EXPECT_GE(snapshot.maxServiceNs, 20000U);
+    EXPECT_LE(snapshot.maxDepth, 8U);
+    EXPECT_GT(snapshot.fullWaits, 0U);   // 100 pushes into 8 slots, 20 µs each
+
+    // take() restarts the maxima, not the totals
+    const StageSnapshot next = metrics.take();
+    EXPECT_EQ(next.items, 100U);
+    EXPECT_EQ(next.maxServiceNs, 0U);
+    EXPECT_FALSE(formatStages({snapshot}, {next}, 1.0).empty());
+}
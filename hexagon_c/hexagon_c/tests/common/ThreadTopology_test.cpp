@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+#include "common/ThreadTopology.h"
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+// Bu dosyada thread yerleşim konfigürasyonunu test ediyoruz: konfigürasyon
+// doğru okunmalı, hatalı değerler reddedilmeli, uygulanan yerleşim raporlanmalı.
+
+using namespace common::topology;
+
+TEST(ThreadTopologyTest, ParsesCpuLists) {
+    EXPECT_EQ(ThreadTopology::parseCpuList("3"), (std::vector<int>{3}));
+    EXPECT_EQ(ThreadTopology::parseCpuList("1-3, 5,2"), (std::vector<int>{1, 2, 3, 5}));
+    EXPECT_THROW(ThreadTopology::parseCpuList("3-1"), std::invalid_argument);
+    EXPECT_THROW(ThreadTopology::parseCpuList("a"), std::invalid_argument);
+}
+
+TEST(ThreadTopologyTest, ReadsRolesFromConfig) {
+    const ThreadTopology topology = ThreadTopology::fromConfig({
+        {"dish_receiver.cpus", "2-3"},
+        {"dish_receiver.policy", "fifo"},
+        {"dish_receiver.priority", "95"},
+        {"zmq_io.cpus", "4"},
+        {"zmq_io.threads", "2"},
+    });
+    ASSERT_TRUE(topology.hasRole("dish_receiver"));
+    const RolePlacement dish = topology.placementFor("dish_receiver");
+    EXPECT_EQ(dish.cpus, (std::vector<int>{2, 3}));
+    EXPECT_EQ(dish.policy, SchedPolicy::Fifo);
+    EXPECT_EQ(dish.priority, 95);
+    EXPECT_EQ(topology.placementFor("zmq_io").ioThreads, 2);
+    EXPECT_FALSE(topology.placementFor("radio_publisher").configured);
+}
+
+TEST(ThreadTopologyTest, RejectsInvalidConfig) {
+    EXPECT_THROW(ThreadTopology::fromConfig({{"dish_receiver.policy", "deadline"}}), std::invalid_argument);
+    EXPECT_THROW(ThreadTopology::fromConfig({{"dish_receiver.policy", "fifo"}}), std::invalid_argument);
+    EXPECT_THROW(ThreadTopology::fromConfig({{"dish_receiver.affinity", "1"}}), std::invalid_argument);
+    EXPECT_THROW(ThreadTopology::fromConfig({{"cpus", "1"}}), std::invalid_argument);
+    EXPECT_THROW(ThreadTopology::fromConfig({{"dish_receiver.cpus", "node"}}), std::invalid_argument);
+}
+
+TEST(ThreadTopologyTest, ReadsFileAndToleratesMissingFile) {
+    const std::string path = "thread_topology_test.conf";
+    {
+        std::ofstream file(path);
+        file << "# comment\n\nradio_publisher.cpus = 0   # trailing comment\nradio_publisher.policy = other\n";
+    }
+    const ThreadTopology topology = ThreadTopology::fromFile(path);
+    std::remove(path.c_str());
+    EXPECT_EQ(topology.placementFor("radio_publisher").cpus, (std::vector<int>{0}));
+
+    EXPECT_FALSE(ThreadTopology::fromFile("does/not/exist.conf").hasRole("radio_publisher"));
+}
+
+TEST(ThreadTopologyTest, WarnsWhenRealTimeRolesShareCpu) {
+    const ThreadTopology topology = ThreadTopology::fromConfig({
+        {"dish_receiver.cpus", "0"},
+        {"dish_receiver.policy", "fifo"},
+        {"dish_receiver.priority", "95"},
+        {"radio_publisher.cpus", "0"},
+    });
+    bool shared = false;
+    for (const std::string& warning : topology.validate()) {
+        shared = shared || warning.find("shared by real-time roles") != std::string::npos;
+    }
+    EXPECT_TRUE(shared);
+}
+
+#ifdef __linux__
+TEST(ThreadTopologyTest, AppliesAndReportsAffinity) {
+    // Pin to a CPU the test process is already allowed to use
+    cpu_set_t allowed;
+    CPU_ZERO(&allowed);
+    ASSERT_EQ(pthread_getaffinity_np(pthread_self(), sizeof(allowed), &allowed), 0);
+    int cpu = 0;
+    while (!CPU_ISSET(static_cast<std::size_t>(cpu), &allowed)) {
+        ++cpu;
+    }
+
+    ThreadTopology topology = ThreadTopology::fromConfig({{"worker.cpus", std::to_string(cpu)}});
+    AppliedPlacement applied;
+    std::thread worker([&topology, &applied]() {
+        applied = topology.applyToCurrentThread("worker");
+    });
+    worker.join();
+
+    EXPECT_TRUE(applied.affinityApplied);
+    EXPECT_TRUE(applied.schedApplied);
+    EXPECT_EQ(applied.effectiveCpus, (std::vector<int>{cpu}));
+    EXPECT_NE(topology.report().find("worker: cpus=" + std::to_string(cpu)), std::string::npos);
+}
+
+TEST(ThreadTopologyTest, UnconfiguredRoleIsLeftAlone) {
+    ThreadTopology topology;
+    const AppliedPlacement probe = topology.probe("dish_receiver");
+    EXPECT_FALSE(probe.affinityApplied);
+    EXPECT_FALSE(probe.schedApplied);
+    EXPECT_EQ(probe.error, "not configured");
+    EXPECT_TRUE(topology.report().empty());
+}
+#endif
@@ -0,0 +1,143 @@
+#include <gtest/gtest.h>
+#include "common/TimeSeriesCodec.h"
+#include "common/CompressedHistory.h"
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+// Bu dosyada zaman serisi kodlayıcısını test ediyoruz: satırlar bit bit aynı geri
+// çözülmeli, 5 ms ızgarada yumuşak değişen track verisi ham boyutun küçük bir kısmına sığmalı.
+
+using namespace common::store;
+
+namespace {
+
+struct Row {
+    std::int64_t time;
+    double doubles[2];
+    std::int64_t ints[1];
+};
+
+std::vector<Row> smoothTrack(std::size_t count) {
+    std::vector<Row> rows;
+    for (std::size_t i = 0U; i < count; ++i) {
+        const double t = static_cast<double>(i) * 0.005;
+        rows.push_back(Row{1700000000000 + static_cast<std::int64_t>(i) * 5,
+                           {4000000.0 + 250.0 * t, 120.5},
+                           {1700000000000 + static_cast<std::int64_t>(i) * 5 - 3}});
+    }
+    return rows;
+}
+
+SeriesBlock encode(const std::vector<Row>& rows) {
+    SeriesEncoder encoder(2U, 1U);
+    for (const Row& row : rows) {
+        encoder.append(row.time, row.doubles, row.ints);
+    }
+    return encoder.finish();
+}
+
+void expectRoundTrip(const std::vector<Row>& rows) {
+    const SeriesBlock block = encode(rows);
+    ASSERT_EQ(block.rows, rows.size());
+    SeriesDecoder decoder(block);
+    Row decoded{};
+    for (const Row& row : rows) {
+        ASSERT_TRUE(decoder.next(decoded.time, decoded.doubles, decoded.ints));
+        EXPECT_EQ(decoded.time, row.time);
+        EXPECT_EQ(std::memcmp(decoded.doubles, row.doubles, sizeof(row.doubles)), 0);
+        EXPECT_EQ(decoded.ints[0], row.ints[0]);
+    }
+    EXPECT_FALSE(decoder.next(decoded.time, decoded.doubles, decoded.ints));
+}
+
+} // namespace
+
+TEST(TimeSeriesCodecTest, SmoothGridSeriesRoundTripsCompactly) {
+    const std::vector<Row> rows = smoothTrack(1000U);
+    expectRoundTrip(rows);
+
+    const SeriesBlock block = encode(rows);
+    EXPECT_EQ(block.minTime, rows.front().time);
+    EXPECT_EQ(block.maxTime, rows.back().time);
+    // Ham: 1000 * 32 bayt; zaman ve int kolonu satır başına 1 bit, sabit double 1 bit
+    EXPECT_LT(block.bytes() * 4U, rows.size() * sizeof(Row));
+}
+
+TEST(TimeSeriesCodecTest, EdgeValuesRoundTrip) {
+    const double inf = std::numeric_limits<double>::infinity();
+    const std::int64_t big = std::numeric_limits<std::int64_t>::max();
+    const std::int64_t small = std::numeric_limits<std::int64_t>::min();
+    std::vector<Row> rows = {
+        {0, {0.0, -0.0}, {0}},
+        {small, {std::nan(""), inf}, {big}},
+        {big, {-inf, std::numeric_limits<double>::denorm_min()}, {small}},
+        {5, {1.0, -1.0}, {-70}},
+        {10, {1.0, 1e300}, {300}},
+        {2000, {1.5, 1e-300}, {-3000}},
+        {2001, {1.25, 2.0}, {-3001}},
+    };
+    expectRoundTrip(rows);
+    expectRoundTrip({rows.front()});
+}
+
+TEST(TimeSeriesCodecTest, EncoderRestartsAfterFinish) {
+    SeriesEncoder encoder(2U, 1U);
+    const std::vector<Row> rows = smoothTrack(10U);
+    for (const Row& row : rows) {
+        encoder.append(row.time, row.doubles, row.ints);
+    }
+    encoder.finish();
+    EXPECT_EQ(encoder.rows(), 0U);
+    encoder.append(rows[3].time, rows[3].doubles, rows[3].ints);
+    const SeriesBlock block = encoder.finish();
+    SeriesDecoder decoder(block);
+    Row decoded{};
+    ASSERT_TRUE(decoder.next(decoded.time, decoded.doubles, decoded.ints));
+    EXPECT_EQ(decoded.time, rows[3].time);
+    EXPECT_EQ(decoded.doubles[0], rows[3].doubles[0]);
+}
+
+TEST(CompressedHistoryTest, RangesSealedAndOpenBlocksAndEvicts) {
+    CompressedOptions options;
+    options.doubleColumns = 2U;
+    options.intColumns = 1U;
+    options.samplesPerBlock = 100U;
+    CompressedHistory history(options);
+
+    const std::vector<Row> rows = smoothTrack(250U);
+    for (int trackId : {7, 3}) {
+        for (const Row& row : rows) {
+            history.append(trackId, row.time, row.doubles, row.ints);
+        }
+    }
+    CompressedStats stats = history.stats();
+    EXPECT_EQ(stats.tracks, 2U);
+    EXPECT_EQ(stats.blocks, 6U);
+    EXPECT_EQ(stats.samples, 500U);
+    EXPECT_LT(stats.compressedBytes * 4U, stats.rawBytes);
+
+    // Kapalı bloğun sonu ile açık bloğun başını kapsayan aralık
+    HistoryRows out;
+    out.doubleColumns = 2U;
+    out.intColumns = 1U;
+    EXPECT_EQ(history.readRange(rows[195].time, rows[205].time, out), 22U);
+    EXPECT_EQ(out.trackIds.front(), 3);
+    EXPECT_EQ(out.trackIds.back(), 7);
+    EXPECT_EQ(out.times.front(), rows[195].time);
+    EXPECT_EQ(out.doublesAt(0)[0], rows[195].doubles[0]);
+    EXPECT_EQ(out.intsAt(10)[0], rows[205].ints[0]);
+
+    out.clear();
+    EXPECT_EQ(history.readTrack(7, rows[249].time, rows[249].time, out), 1U);
+    EXPECT_EQ(history.readTrack(8, 0, rows[249].time, out), 0U);
+
+    // Yalnızca en yeni örneği cutoff'tan eski olan bloklar düşer
+    EXPECT_EQ(history.evictBefore(rows[150].time), 200U);
+    EXPECT_EQ(history.oldestTime(), rows[100].time);
+    stats = history.stats();
+    EXPECT_EQ(stats.samples, 300U);
+    EXPECT_EQ(stats.evicted, 200U);
+}
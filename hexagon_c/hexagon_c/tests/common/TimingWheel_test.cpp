@@ -0,0 +1,98 @@
+#include <gtest/gtest.h>
+#include "common/TimingWheel.h"
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+// Bu dosyada hiyerarşik zamanlayıcı çarkını test ediyoruz: süreler seviyeler
+// arasında doğru inmeli, erteleme/iptal çalışmalı, bütçe işi dilimlere bölmeli.
+
+using common::timing::TimingWheel;
+
+TEST(TimingWheelTest, ExpiresOnlyPastDeadlines) {
+    TimingWheel wheel(8U);
+    wheel.schedule(0U, 1000);
+    wheel.schedule(1U, 1005);
+    wheel.schedule(2U, 1300);       // Bir üst seviyede
+    wheel.schedule(3U, 1000 + 70000); // İki üst seviyede
+
+    std::vector<std::uint32_t> expired;
+    EXPECT_TRUE(wheel.advance(1005, 100U, expired));
+    EXPECT_EQ(expired, (std::vector<std::uint32_t>{0U}));
+
+    expired.clear();
+    EXPECT_TRUE(wheel.advance(1301, 100U, expired));
+    std::sort(expired.begin(), expired.end());
+    EXPECT_EQ(expired, (std::vector<std::uint32_t>{1U, 2U}));
+    EXPECT_FALSE(wheel.pending(2U));
+    EXPECT_TRUE(wheel.pending(3U));
+
+    expired.clear();
+    EXPECT_TRUE(wheel.advance(71000, 100U, expired));
+    EXPECT_TRUE(expired.empty());
+    EXPECT_TRUE(wheel.advance(71001, 100U, expired));
+    EXPECT_EQ(expired, (std::vector<std::uint32_t>{3U}));
+    EXPECT_EQ(wheel.size(), 0U);
+}
+
+TEST(TimingWheelTest, RescheduleAndCancel) {
+    TimingWheel wheel(4U);
+    wheel.schedule(0U, 100);
+    wheel.schedule(1U, 100);
+    wheel.schedule(0U, 500);
+    wheel.cancel(1U);
+    EXPECT_EQ(wheel.size(), 1U);
+    EXPECT_EQ(wheel.deadline(0U), 500);
+
+    std::vector<std::uint32_t> expired;
+    wheel.advance(400, 10U, expired);
+    EXPECT_TRUE(expired.empty());
+    wheel.advance(501, 10U, expired);
+    EXPECT_EQ(expired, (std::vector<std::uint32_t>{0U}));
+    EXPECT_THROW(TimingWheel(0U), std::invalid_argument);
+}
+
+TEST(TimingWheelTest, BudgetSlicesTheWork) {
+    TimingWheel wheel(100U);
+    for (std::uint32_t id = 0U; id < 100U; ++id) {
+        wheel.schedule(id, 10 + id % 3);
+    }
+    std::vector<std::uint32_t> expired;
+    int slices = 0;
+    while (!wheel.advance(20, 16U, expired)) {
+        ++slices;
+    }
+    EXPECT_EQ(slices, 6);
+    EXPECT_EQ(expired.size(), 100U);
+    EXPECT_EQ(wheel.size(), 0U);
+}
+
+TEST(TimingWheelTest, MatchesSortedDeadlinesOverLongSpans) {
+    // Rastgele süreler: her tur yalnızca süresi dolanlar çıkmalı
+    constexpr std::uint32_t COUNT = 2000U;
+    TimingWheel wheel(COUNT, 1);
+    std::mt19937_64 random(42);
+    std::uniform_int_distribution<std::int64_t> offset(0, 50000000);
+    const std::int64_t start = 1700000000000LL;
+    std::vector<std::int64_t> deadlines(COUNT);
+    for (std::uint32_t id = 0U; id < COUNT; ++id) {
+        deadlines[id] = start + offset(random);
+        wheel.schedule(id, deadlines[id]);
+    }
+    std::vector<std::uint32_t> expired;
+    for (std::int64_t now = start; now <= start + 50000001; now += 1234567) {
+        expired.clear();
+        ASSERT_TRUE(wheel.advance(now, COUNT, expired));
+        for (const std::uint32_t id : expired) {
+            ASSERT_LT(deadlines[id], now);
+            deadlines[id] = -1;
+        }
+        for (std::uint32_t id = 0U; id < COUNT; ++id) {
+            if (deadlines[id] >= 0) {
+                ASSERT_GE(deadlines[id], now);
+            }
+        }
+    }
+}
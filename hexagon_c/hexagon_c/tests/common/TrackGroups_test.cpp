@@ -0,0 +1,128 @@
+#include <gtest/gtest.h>
+#include "common/TrackGroups.h"
+#include "common/GeoTransforms.h"
+#include <algorithm>
+#include <map>
+#include <stdexcept>
+#include <string>
+
+// Bu dosyada ortak grup şemasını test ediyoruz: RADIO tarafının bir izi hangi
+// gruba yazdığı ile DISH tarafının seçimden ürettiği grup listesi tutarlı olmalı.
+
+using namespace common::groups;
+
+namespace {
+
+constexpr double kDeg = 3.14159265358979323846 / 180.0;
+
+bool contains(const std::vector<std::uint32_t>& ids, std::uint32_t id) {
+    return std::find(ids.begin(), ids.end(), id) != ids.end();
+}
+
+void ecefOf(double latDeg, double lonDeg, double& x, double& y, double& z) {
+    common::geo::geodeticToEcef(latDeg * kDeg, lonDeg * kDeg, 1000.0, x, y, z);
+}
+
+// Model üreticisinin x-service-metadata'dan ürettiği GROUP_* sabitleri
+struct PartitionedModel {
+    static constexpr const char* GROUP_PARTITIONING = "track_range";
+    static constexpr int GROUP_TRACK_RANGE_SIZE = 100;
+    static constexpr double GROUP_CELL_SIZE_DEG = 1.0;
+};
+
+} // namespace
+
+TEST(TrackGroupsTest, MetadataDefaultsToUnpartitioned) {
+    const TrackGroupScheme scheme = TrackGroupScheme::fromMetadata("ExtrapTrackData", {});
+    EXPECT_FALSE(scheme.isPartitioned());
+    EXPECT_EQ(scheme.getBaseGroup(), "ExtrapTrackData");
+
+    const std::map<std::string, std::string> none = {{"group_partitioning", "none"}};
+    EXPECT_FALSE(TrackGroupScheme::fromMetadata("ExtrapTrackData", none).isPartitioned());
+    EXPECT_THROW(scheme.groupIdsForSelection("1-10"), std::invalid_argument);
+}
+
+TEST(TrackGroupsTest, MetadataRejectsBadConfiguration) {
+    EXPECT_THROW(TrackGroupScheme::fromMetadata("X", {{"group_partitioning", "by_color"}}), std::invalid_argument);
+    EXPECT_THROW(TrackGroupScheme::fromMetadata("X", {{"group_partitioning", "track_range"}}), std::invalid_argument);
+    EXPECT_THROW(TrackGroupScheme::fromMetadata("X", {{"group_partitioning", "track_range"},
+                                                      {"group_track_range_size", "0"}}), std::invalid_argument);
+    EXPECT_THROW(TrackGroupScheme::fromMetadata("X", {{"group_partitioning", "geo_cell"},
+                                                      {"group_cell_size_deg", "abc"}}), std::invalid_argument);
+    EXPECT_THROW(TrackGroupScheme::byGeoCell("X", 0.01), std::invalid_argument);
+}
+
+TEST(TrackGroupsTest, GeneratedModelConstantsMatchMetadata) {
+    const TrackGroupScheme generated = schemeOf<PartitionedModel>("DelayCalcTrackData");
+    const TrackGroupScheme parsed = TrackGroupScheme::fromMetadata(
+        "DelayCalcTrackData", {{"group_partitioning", "track_range"}, {"group_track_range_size", "100"}});
+    ASSERT_TRUE(generated.isPartitioned());
+    EXPECT_EQ(generated.groupIdsForSelection("100-299"), parsed.groupIdsForSelection("100-299"));
+    EXPECT_EQ(generated.groupIdFor(250, 0.0, 0.0, 0.0), parsed.groupIdFor(250, 0.0, 0.0, 0.0));
+
+    EXPECT_FALSE(TrackGroupScheme::fromSettings("X", "none", 0, 0.0).isPartitioned());
+    EXPECT_THROW(TrackGroupScheme::fromSettings("X", "by_color", 100, 1.0), std::invalid_argument);
+    EXPECT_THROW(TrackGroupScheme::fromSettings("X", "track_range", 0, 1.0), std::invalid_argument);
+}
+
+TEST(TrackGroupsTest, TrackRangePartitions) {
+    const TrackGroupScheme scheme = TrackGroupScheme::fromMetadata(
+        "ExtrapTrackData", {{"group_partitioning", "track_range"}, {"group_track_range_size", "100"}});
+    ASSERT_EQ(scheme.getPartitioning(), Partitioning::TrackRange);
+
+    EXPECT_EQ(scheme.groupIdFor(0, 0, 0, 0), scheme.groupIdFor(99, 0, 0, 0));
+    EXPECT_NE(scheme.groupIdFor(99, 0, 0, 0), scheme.groupIdFor(100, 0, 0, 0));
+    EXPECT_NE(scheme.groupIdFor(-1, 0, 0, 0), scheme.groupIdFor(0, 0, 0, 0));
+    EXPECT_EQ(scheme.groupIdFor(1234, 0, 0, 0) >> TrackGroupScheme::PARTITION_BITS, scheme.topicTag());
+
+    const std::vector<std::uint32_t> ids = scheme.groupIdsForSelection("100-299, 512, 250");
+    ASSERT_EQ(ids.size(), 3U);
+    EXPECT_TRUE(contains(ids, scheme.groupIdFor(100, 0, 0, 0)));
+    EXPECT_TRUE(contains(ids, scheme.groupIdFor(299, 0, 0, 0)));
+    EXPECT_TRUE(contains(ids, scheme.groupIdFor(599, 0, 0, 0)));
+    EXPECT_FALSE(contains(ids, scheme.groupIdFor(99, 0, 0, 0)));
+    EXPECT_FALSE(contains(ids, scheme.groupIdFor(300, 0, 0, 0)));
+
+    EXPECT_THROW(scheme.groupIdsForSelection("10-5"), std::invalid_argument);
+    EXPECT_THROW(scheme.groupIdsForSelection("a-b"), std::invalid_argument);
+    EXPECT_THROW(scheme.groupIdsForSelection(""), std::invalid_argument);
+}
+
+TEST(TrackGroupsTest, GeoCellPartitions) {
+    const TrackGroupScheme scheme = TrackGroupScheme::byGeoCell("DelayCalcTrackData", 1.0);
+    double x, y, z;
+
+    ecefOf(39.5, 32.5, x, y, z);
+    const std::uint32_t ankara = scheme.groupIdFor(1, x, y, z);
+    ecefOf(39.6, 32.9, x, y, z);
+    EXPECT_EQ(scheme.groupIdFor(2, x, y, z), ankara);
+    ecefOf(41.0, 29.0, x, y, z);
+    const std::uint32_t istanbul = scheme.groupIdFor(3, x, y, z);
+    EXPECT_NE(istanbul, ankara);
+
+    // Türkiye kutusu: iki şehrin hücresi de seçilmeli
+    const std::vector<std::uint32_t> ids = scheme.groupIdsForSelection("36,42,26,45");
+    EXPECT_EQ(ids.size(), 7U * 20U);
+    EXPECT_TRUE(contains(ids, ankara));
+    EXPECT_TRUE(contains(ids, istanbul));
+
+    ecefOf(-33.9, 151.2, x, y, z);
+    EXPECT_FALSE(contains(ids, scheme.groupIdFor(4, x, y, z)));
+
+    // Kutuplar ve antimeridyen sınır hücrelerine sıkıştırılır
+    ecefOf(90.0, 180.0, x, y, z);
+    const std::vector<std::uint32_t> corner = scheme.groupIdsForRegion(89.5, 90.0, 179.5, 180.0);
+    EXPECT_TRUE(contains(corner, scheme.groupIdFor(5, x, y, z)));
+
+    EXPECT_THROW(scheme.groupIdsForSelection("36,42,26"), std::invalid_argument);
+    EXPECT_THROW(scheme.groupIdsForRegion(42.0, 36.0, 26.0, 45.0), std::invalid_argument);
+}
+
+TEST(TrackGroupsTest, MessageTypesUseDistinctTopicTags) {
+    const TrackGroupScheme extrap("ExtrapTrackData");
+    const TrackGroupScheme delay("DelayCalcTrackData");
+    const TrackGroupScheme finalCalc("FinalCalcTrackData");
+    EXPECT_NE(extrap.topicTag(), delay.topicTag());
+    EXPECT_NE(delay.topicTag(), finalCalc.topicTag());
+    EXPECT_NE(extrap.topicTag(), finalCalc.topicTag());
+}
@@ -0,0 +1,236 @@
+#include <gtest/gtest.h>
+#include "common/TrackHistoryStore.h"
+#include <atomic>
+#include <cstdint>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+// Bu dosyada track geçmiş deposunu test ediyoruz: halka taşınca en eski örnek
+// düşmeli, zaman aralığı sorguları doğru olmalı, okuyucular yarım satır görmemeli.
+
+using namespace common::store;
+
+namespace {
+
+HistoryOptions smallOptions() {
+    HistoryOptions options;
+    options.maxTracks = 8U;
+    options.samplesPerTrack = 4U;
+    options.doubleColumns = 2U;
+    options.intColumns = 1U;
+    options.bucketWidth = 10;
+    options.buckets = 4U;
+    return options;
+}
+
+bool append(TrackHistoryStore& store, int trackId, std::int64_t time) {
+    const double doubles[2] = {static_cast<double>(time), static_cast<double>(trackId)};
+    const std::int64_t ints[1] = {time * 2};
+    return store.append(trackId, time, doubles, ints);
+}
+
+} // namespace
+
+TEST(TrackHistoryStoreTest, ReadsTrackHistoryOldestFirst) {
+    TrackHistoryStore store(smallOptions());
+    ASSERT_TRUE(append(store, 7, 100));
+    ASSERT_TRUE(append(store, 7, 101));
+    ASSERT_TRUE(append(store, 9, 102));
+
+    HistoryRows rows = store.makeRows();
+    ASSERT_EQ(store.readTrack(7, rows), 2U);
+    EXPECT_EQ(rows.times[0], 100);
+    EXPECT_EQ(rows.times[1], 101);
+    EXPECT_EQ(rows.trackIds[1], 7);
+    EXPECT_DOUBLE_EQ(rows.doublesAt(1)[0], 101.0);
+    EXPECT_DOUBLE_EQ(rows.doublesAt(1)[1], 7.0);
+    EXPECT_EQ(rows.intsAt(1)[0], 202);
+
+    rows.clear();
+    ASSERT_TRUE(store.readLatest(7, rows));
+    ASSERT_EQ(rows.size(), 1U);
+    EXPECT_EQ(rows.times[0], 101);
+    EXPECT_FALSE(store.readLatest(8, rows));
+    EXPECT_EQ(store.activeTracks(), (std::vector<int>{7, 9}));
+}
+
+TEST(TrackHistoryStoreTest, FullRingDropsOldestSample) {
+    TrackHistoryStore store(smallOptions());
+    for (std::int64_t time = 1; time <= 6; ++time) {
+        ASSERT_TRUE(append(store, 1, time));
+    }
+    HistoryRows rows = store.makeRows();
+    ASSERT_EQ(store.readTrack(1, rows), 4U);
+    EXPECT_EQ(rows.times.front(), 3);
+    EXPECT_EQ(rows.times.back(), 6);
+
+    const HistoryStats stats = store.stats();
+    EXPECT_EQ(stats.records, 4U);
+    EXPECT_EQ(stats.activeTracks, 1U);
+    EXPECT_EQ(stats.overwritten, 2U);
+    EXPECT_EQ(stats.oldestTime, 3);
+    EXPECT_EQ(stats.newestTime, 6);
+}
+
+TEST(TrackHistoryStoreTest, RangeQueriesInsideAndBeyondIndexWindow) {
+    TrackHistoryStore store(smallOptions());
+    // Kova genişliği 10, pencere 4 kova: 50..89 indeksli, 5 ve 15 pencere dışında
+    append(store, 1, 5);
+    append(store, 2, 15);
+    append(store, 1, 55);
+    append(store, 3, 62);
+    append(store, 2, 71);
+    append(store, 4, 89);
+
+    HistoryRows rows = store.makeRows();
+    ASSERT_EQ(store.readRange(60, 75, rows), 2U);
+    EXPECT_EQ(rows.trackIds[0], 2);
+    EXPECT_EQ(rows.trackIds[1], 3);
+
+    rows.clear();
+    ASSERT_EQ(store.readRange(0, 20, rows), 2U);
+    EXPECT_EQ(rows.times[0], 5);
+    EXPECT_EQ(rows.times[1], 15);
+
+    rows.clear();
+    EXPECT_EQ(store.readRange(0, 1000, rows), 6U);
+    rows.clear();
+    EXPECT_EQ(store.readRange(90, 1000, rows), 0U);
+    EXPECT_EQ(store.readRange(80, 70, rows), 0U);
+}
+
+TEST(TrackHistoryStoreTest, EvictionUpdatesStats) {
+    TrackHistoryStore store(smallOptions());
+    append(store, 1, 10);
+    append(store, 1, 20);
+    append(store, 2, 15);
+    append(store, 3, 30);
+
+    EXPECT_EQ(store.evictBefore(20), 2U);
+    HistoryStats stats = store.stats();
+    EXPECT_EQ(stats.records, 2U);
+    EXPECT_EQ(stats.activeTracks, 2U);
+    EXPECT_EQ(stats.oldestTime, 20);
+    EXPECT_EQ(stats.evicted, 2U);
+    EXPECT_EQ(store.activeTracks(), (std::vector<int>{1, 3}));
+
+    EXPECT_EQ(store.evictTrackBefore(3, 31), 1U);
+    EXPECT_EQ(store.stats().oldestTime, 20);
+    EXPECT_EQ(store.evictBefore(100), 1U);
+    stats = store.stats();
+    EXPECT_EQ(stats.records, 0U);
+    EXPECT_EQ(stats.activeTracks, 0U);
+    EXPECT_EQ(stats.oldestTime, 0);
+}
+
+TEST(TrackHistoryStoreTest, ExpiryVisitsOnlyDueTracksInSlices) {
+    TrackHistoryStore store(smallOptions());
+    for (int track = 0; track < 6; ++track) {
+        append(store, track, 100 + track);
+        append(store, track, 200 + track);
+    }
+    append(store, 7, 1000);
+
+    // Dilim başına en fazla 2 track: 6 track için 3 dilim
+    ExpiryProgress progress;
+    std::size_t removed = 0U;
+    int slices = 0;
+    do {
+        progress = store.expireBefore(150, 2U);
+        removed += progress.removed;
+        ++slices;
+    } while (!progress.done);
+    EXPECT_EQ(removed, 6U);
+    EXPECT_GE(slices, 3);
+    EXPECT_EQ(store.stats().records, 7U);
+    EXPECT_EQ(store.stats().oldestTime, 200);
+
+    // Track'ler yeni en eski örneklerine göre yeniden zamanlanmış olmalı
+    progress = store.expireBefore(204, 100U);
+    EXPECT_TRUE(progress.done);
+    EXPECT_EQ(progress.removed, 4U);
+    EXPECT_EQ(store.activeTracks(), (std::vector<int>{4, 5, 7}));
+    EXPECT_EQ(store.expireBefore(2000, 100U).removed, 3U);
+    EXPECT_EQ(store.stats().activeTracks, 0U);
+}
+
+TEST(TrackHistoryStoreTest, OldestTimeNeedsNoScanAfterExpiryOrOverwrite) {
+    TrackHistoryStore store(smallOptions());
+    for (std::int64_t time = 1; time <= 6; ++time) {
+        append(store, 1, time * 10);
+        append(store, 2, time * 10 + 5);
+    }
+    EXPECT_EQ(store.stats().oldestTime, 30);
+
+    // Süre dolumu sadece expireBefore ile ilerliyor; evictBefore hiç çağrılmıyor
+    EXPECT_TRUE(store.expireBefore(40, 100U).done);
+    HistoryStats stats = store.stats();
+    EXPECT_EQ(stats.oldestTime, 40);
+    EXPECT_EQ(stats.records, 6U);
+    append(store, 2, 70);
+    EXPECT_EQ(store.stats().oldestTime, 40);
+    EXPECT_TRUE(store.expireBefore(50, 100U).done);
+    stats = store.stats();
+    EXPECT_EQ(stats.oldestTime, 50);
+    EXPECT_EQ(store.expireBefore(80, 100U).removed, 5U);
+    EXPECT_EQ(store.stats().oldestTime, 0);
+
+    // Sırasız gelen örnekler yalnızca en eskileri düşünce kendi halkasını taratır
+    for (const std::int64_t time : {100, 90, 95, 97, 99}) {
+        append(store, 3, time);
+    }
+    stats = store.stats();
+    EXPECT_EQ(stats.oldestTime, 90);
+    EXPECT_EQ(stats.ringScans, 0U);
+    append(store, 3, 101);
+    stats = store.stats();
+    EXPECT_EQ(stats.oldestTime, 95);
+    EXPECT_EQ(stats.ringScans, 1U);
+}
+
+TEST(TrackHistoryStoreTest, RejectsTracksBeyondCapacity) {
+    HistoryOptions options = smallOptions();
+    options.maxTracks = 2U;
+    TrackHistoryStore store(options);
+    EXPECT_TRUE(append(store, 1, 1));
+    EXPECT_TRUE(append(store, 2, 1));
+    EXPECT_FALSE(append(store, 3, 1));
+    EXPECT_TRUE(append(store, 1, 2));
+    EXPECT_EQ(store.stats().rejected, 1U);
+
+    options.samplesPerTrack = 0U;
+    EXPECT_THROW(TrackHistoryStore invalid(options), std::invalid_argument);
+}
+
+TEST(TrackHistoryStoreTest, ConcurrentReadersNeverSeeTornRows) {
+    HistoryOptions options = smallOptions();
+    options.samplesPerTrack = 16U;
+    TrackHistoryStore store(options);
+    std::atomic<bool> done(false);
+    std::atomic<int> torn(0);
+
+    std::thread reader([&]() {
+        HistoryRows rows = store.makeRows();
+        while (!done.load()) {
+            rows.clear();
+            store.readTrack(5, rows);
+            for (std::size_t row = 0U; row < rows.size(); ++row) {
+                if (rows.doublesAt(row)[0] != static_cast<double>(rows.times[row]) ||
+                    rows.intsAt(row)[0] != rows.times[row] * 2) {
+                    torn.fetch_add(1);
+                }
+                if (row > 0U && rows.times[row] != rows.times[row - 1U] + 1) {
+                    torn.fetch_add(1);
+                }
+            }
+        }
+    });
+    for (std::int64_t time = 0; time < 200000; ++time) {
+        append(store, 5, time);
+    }
+    done.store(true);
+    reader.join();
+    EXPECT_EQ(torn.load(), 0);
+    EXPECT_EQ(store.stats().records, 16U);
+}
@@ -0,0 +1,80 @@
+#include <gtest/gtest.h>
+#include "common/TscClock.h"
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+// Bu dosyada TSC tabanlı saati test ediyoruz: epoch zamanı system_clock ile
+// uyumlu olmalı, geri gitmemeli ve std::chrono saati gibi kullanılabilmeli.
+
+using common::timing::TscClock;
+
+namespace {
+
+std::int64_t systemNanos() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+} // namespace
+
+TEST(TscClockTest, TracksSystemClock) {
+    TscClock::resync();
+    for (int i = 0; i < 10; ++i) {
+        const std::int64_t before = systemNanos();
+        const std::int64_t now = TscClock::nowNanos();
+        const std::int64_t after = systemNanos();
+        // Kalibrasyon hatası ve sanallaştırma için 1 ms pay
+        EXPECT_GE(now, before - 1000000);
+        EXPECT_LE(now, after + 1000000);
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+}
+
+TEST(TscClockTest, DoesNotGoBackwardsAcrossResync) {
+    TscClock::setResyncInterval(std::chrono::milliseconds(1));
+    std::int64_t previous = TscClock::nowNanos();
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(20);
+    while (std::chrono::steady_clock::now() < deadline) {
+        const std::int64_t now = TscClock::nowNanos();
+        ASSERT_GE(now, previous);
+        previous = now;
+    }
+    TscClock::setResyncInterval(std::chrono::milliseconds(1000));
+    TscClock::resync();
+    if (TscClock::usingTsc()) {
+        EXPECT_GT(TscClock::calibration().resyncs, 1U);
+    }
+}
+
+TEST(TscClockTest, ConvertsEarlierCycleReadings) {
+    const std::uint64_t cycles = TscClock::readCycles();
+    const std::int64_t direct = TscClock::nowNanos();
+    const std::int64_t converted = TscClock::toNanos(cycles);
+    EXPECT_LE(converted, direct + 1000000);
+    EXPECT_GE(converted, direct - 1000000);
+}
+
+TEST(TscClockTest, IsDropInChronoClock) {
+    const TscClock::time_point start = TscClock::now();
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    const auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(TscClock::now() - start);
+    EXPECT_GE(elapsed.count(), 4000);
+
+    const std::int64_t micros = TscClock::nowMicros();
+    const std::int64_t systemMicros = systemNanos() / 1000;
+    EXPECT_LT(std::abs(micros - systemMicros), 1000);
+
+    const auto asSystem = TscClock::toSystem(TscClock::now());
+    EXPECT_LT(std::chrono::abs(asSystem - std::chrono::system_clock::now()), std::chrono::milliseconds(1));
+}
+
+TEST(TscClockTest, ReportsCalibration) {
+    const common::timing::TscCalibration info = TscClock::calibration();
+    EXPECT_EQ(info.usingTsc, TscClock::usingTsc());
+    if (info.usingTsc) {
+        EXPECT_GT(info.cyclesPerMicro, 100.0);
+    }
+}
@@ -0,0 +1,86 @@
+#include <gtest/gtest.h>
+#include "common/UdpSocketProfile.h"
+#include <map>
+#include <stdexcept>
+#include <string>
+
+// Bu dosyada şemadaki socket_profile ve socket_* anahtarlarından üretilen
+// UDP socket ayarlarını test ediyoruz: hazır profiller ve tekil değer ezmeleri.
+
+using common::net::UdpSocketProfile;
+
+TEST(UdpSocketProfileTest, MissingProfileKeepsKernelDefaults) {
+    const UdpSocketProfile profile = UdpSocketProfile::fromMetadata({});
+    EXPECT_EQ(profile.name, "default");
+    EXPECT_EQ(profile.busyPollUs, 0);
+    EXPECT_FALSE(profile.preferBusyPoll);
+    EXPECT_EQ(profile.sndbuf, -1);
+    EXPECT_EQ(profile.rcvbuf, -1);
+    EXPECT_EQ(profile.priority, 0);
+    EXPECT_EQ(profile.tos, 0);
+    EXPECT_TRUE(profile.multicastLoop);
+    EXPECT_EQ(profile.incomingCpu, -1);
+    EXPECT_FALSE(profile.direct);
+}
+
+TEST(UdpSocketProfileTest, LatencyBusyPollsAndMarksTraffic) {
+    const UdpSocketProfile profile = UdpSocketProfile::preset("latency");
+    EXPECT_GT(profile.busyPollUs, 0);
+    EXPECT_TRUE(profile.preferBusyPoll);
+    EXPECT_EQ(profile.priority, 6);
+    EXPECT_EQ(profile.tos, 46 << 2);  // DSCP EF
+    EXPECT_TRUE(profile.multicastLoop);
+    EXPECT_TRUE(profile.direct);
+}
+
+TEST(UdpSocketProfileTest, ThroughputUsesLargeBuffersWithoutBusyPoll) {
+    const UdpSocketProfile throughput = UdpSocketProfile::preset("throughput");
+    const UdpSocketProfile latency = UdpSocketProfile::preset("latency");
+    EXPECT_EQ(throughput.busyPollUs, 0);
+    EXPECT_FALSE(throughput.direct);  // I/O thread'ın kuyruğu patlamaları karşılar
+    EXPECT_GT(throughput.rcvbuf, latency.rcvbuf);
+    EXPECT_GT(throughput.sndbuf, latency.sndbuf);
+}
+
+TEST(UdpSocketProfileTest, MetadataOverridesSingleFields) {
+    const std::map<std::string, std::string> metadata = {
+        {"socket_profile", "latency"},
+        {"socket_busy_poll_us", "20"},
+        {"socket_prefer_busy_poll", "false"},
+        {"socket_rcvbuf", "1048576"},
+        {"socket_tos", "0x28"},
+        {"socket_multicast_loop", "0"},
+        {"socket_incoming_cpu", "3"},
+        {"socket_direct", "false"}};
+    const UdpSocketProfile profile = UdpSocketProfile::fromMetadata(metadata);
+    EXPECT_EQ(profile.name, "latency");
+    EXPECT_EQ(profile.busyPollUs, 20);
+    EXPECT_FALSE(profile.preferBusyPoll);
+    EXPECT_EQ(profile.rcvbuf, 1048576);
+    EXPECT_EQ(profile.tos, 0x28);
+    EXPECT_FALSE(profile.multicastLoop);
+    EXPECT_EQ(profile.incomingCpu, 3);
+    EXPECT_FALSE(profile.direct);
+    // Ezilmeyen alanlar profilden gelir
+    EXPECT_EQ(profile.priority, 6);
+}
+
+TEST(UdpSocketProfileTest, RejectsBadConfiguration) {
+    EXPECT_THROW(UdpSocketProfile::preset("fast"), std::invalid_argument);
+    EXPECT_THROW(UdpSocketProfile::fromMetadata({{"socket_profile", "fast"}}), std::invalid_argument);
+    EXPECT_THROW(UdpSocketProfile::fromMetadata({{"socket_busy_poll_us", "50us"}}), std::invalid_argument);
+    EXPECT_THROW(UdpSocketProfile::fromMetadata({{"socket_busy_poll_us", "-1"}}), std::invalid_argument);
+    // 6'nın üstü CAP_NET_ADMIN ister, libzmq başarısızlıkta assert eder
+    EXPECT_THROW(UdpSocketProfile::fromMetadata({{"socket_priority", "7"}}), std::invalid_argument);
+    EXPECT_THROW(UdpSocketProfile::fromMetadata({{"socket_tos", "256"}}), std::invalid_argument);
+    EXPECT_THROW(UdpSocketProfile::fromMetadata({{"socket_prefer_busy_poll", "yes"}}), std::invalid_argument);
+    EXPECT_THROW(UdpSocketProfile::fromMetadata({{"socket_incoming_cpu", "-2"}}), std::invalid_argument);
+    EXPECT_THROW(UdpSocketProfile::fromMetadata({{"socket_direct", "on"}}), std::invalid_argument);
+}
+
+TEST(UdpSocketProfileTest, ToStringNamesProfile) {
+    const std::string text = UdpSocketProfile::preset("latency").toString();
+    EXPECT_NE(text.find("latency"), std::string::npos);
+    EXPECT_NE(text.find("busy_poll=50us preferred"), std::string::npos);
+    EXPECT_NE(text.find(" direct)"), std::string::npos);
+}
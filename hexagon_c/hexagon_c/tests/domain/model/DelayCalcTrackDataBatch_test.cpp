@@ -0,0 +1,101 @@
+#include <gtest/gtest.h>
+#include "domain/model/DelayCalcTrackDataBatch.hpp"
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+// Bu dosyada SoA toplu taşıyıcıyı test ediyoruz: sütunlar hizalı olmalı, paketli wire kayıtları
+// serialize() ile bayt bayt aynı olmalı, satır vekilleri ve fromFields tek kontrolle çalışmalı.
+
+using namespace domain::model;
+
+namespace {
+
+DelayCalcTrackData makeRecord(int32_t trackId) {
+    DelayCalcTrackData record;
+    EXPECT_EQ(record.fromFields(trackId, 1.5 * trackId, -2.0, 3.0, 4.0e6 + trackId, 5.0e6, 6.0e6,
+                                1000 + trackId, 1100 + trackId, 1200 + trackId, 50, 1300 + trackId),
+              DelayCalcTrackData::FieldError::None);
+    return record;
+}
+
+} // namespace
+
+TEST(DelayCalcTrackDataBatchTest, WireCodecMatchesSerialize) {
+    std::vector<uint8_t> wire;
+    DelayCalcTrackDataBatch batch(64U);
+    for (int32_t trackId = 1; trackId <= 40; ++trackId) {
+        const DelayCalcTrackData record = makeRecord(trackId);
+        const std::vector<uint8_t> bytes = record.serialize();
+        ASSERT_EQ(bytes.size(), DelayCalcTrackDataBatch::WIRE_SIZE);
+        wire.insert(wire.end(), bytes.begin(), bytes.end());
+        ASSERT_TRUE(batch.push(record));
+    }
+
+    std::vector<uint8_t> encoded(wire.size());
+    EXPECT_EQ(batch.encode(0U, batch.size(), encoded.data(), encoded.size()), wire.size());
+    EXPECT_EQ(encoded, wire);
+    EXPECT_EQ(batch.encode(0U, batch.size(), encoded.data(), encoded.size() - 1U), 0U);
+    EXPECT_EQ(batch.encode(30U, 11U, encoded.data(), encoded.size()), 0U);
+
+    // Kapasite dolunca çözümleme durmalı
+    DelayCalcTrackDataBatch decoded(32U);
+    EXPECT_EQ(decoded.decode(wire.data(), 40U), 32U);
+    EXPECT_TRUE(decoded.full());
+    for (std::size_t row = 0U; row < decoded.size(); ++row) {
+        EXPECT_EQ(decoded.trackIdColumn()[row], static_cast<int32_t>(row + 1U));
+        EXPECT_EQ(decoded.secondHopSentTimeColumn()[row], static_cast<int64_t>(1301U + row));
+    }
+}
+
+TEST(DelayCalcTrackDataBatchTest, ColumnsAreAlignedAndRowsIterate) {
+    DelayCalcTrackDataBatch batch(5U);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(batch.trackIdColumn()) % DelayCalcTrackDataBatch::COLUMN_ALIGNMENT, 0U);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(batch.xPositionECEFColumn()) % DelayCalcTrackDataBatch::COLUMN_ALIGNMENT, 0U);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(batch.secondHopSentTimeColumn()) % DelayCalcTrackDataBatch::COLUMN_ALIGNMENT, 0U);
+
+    for (int32_t trackId = 1; trackId <= 5; ++trackId) {
+        ASSERT_TRUE(batch.push(makeRecord(trackId)));
+    }
+    EXPECT_FALSE(batch.push(makeRecord(6)));
+
+    // Satır vekilleri sütunlara referans verir
+    for (DelayCalcTrackDataBatch::Row row : batch) {
+        row.firstHopDelayTime() = static_cast<int64_t>(row.index()) * 10;
+    }
+    const DelayCalcTrackDataBatch& view = batch;
+    int64_t delaySum = 0;
+    for (DelayCalcTrackDataBatch::ConstRow row : view) {
+        delaySum += row.firstHopDelayTime();
+    }
+    EXPECT_EQ(delaySum, 100);
+
+    DelayCalcTrackData record;
+    EXPECT_EQ(batch.record(4U, record), DelayCalcTrackData::FieldError::None);
+    EXPECT_EQ(record.getTrackId(), 5);
+    EXPECT_EQ(record.getFirstHopDelayTime(), 40);
+
+    batch[2].xVelocityECEF() = std::numeric_limits<double>::quiet_NaN();
+    EXPECT_EQ(batch.record(2U, record), DelayCalcTrackData::FieldError::XVelocityECEF);
+    EXPECT_FALSE(record.isValid());
+
+    batch.clear();
+    EXPECT_EQ(batch.extend(9U), 5U);
+}
+
+TEST(DelayCalcTrackDataBatchTest, FromFieldsReportsFirstInvalidField) {
+    DelayCalcTrackData record;
+    EXPECT_EQ(record.fromFields(0, 0.0, 0.0, 0.0, 0.0, 0.0, 1.0e12, 0, 0, 0, 0, -1),
+              DelayCalcTrackData::FieldError::TrackId);
+    EXPECT_EQ(record.fromFields(7, 0.0, 0.0, 0.0, 0.0, 0.0, 1.0e12, 0, 0, 0, 0, -1),
+              DelayCalcTrackData::FieldError::ZPositionECEF);
+    EXPECT_EQ(record.fromFields(7, 0.0, 0.0, std::numeric_limits<double>::infinity(), 0.0, 0.0, 0.0, 0, 0, 0, 0, 0),
+              DelayCalcTrackData::FieldError::ZVelocityECEF);
+    EXPECT_EQ(record.fromFields(7, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0, 0, 0, 0, -1),
+              DelayCalcTrackData::FieldError::SecondHopSentTime);
+    EXPECT_STREQ(DelayCalcTrackData::fieldErrorName(DelayCalcTrackData::FieldError::SecondHopSentTime),
+                 "secondHopSentTime");
+    EXPECT_EQ(record.fromFields(7, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0, 0, 0, 0, 0), DelayCalcTrackData::FieldError::None);
+    EXPECT_TRUE(record.isValid());
+}
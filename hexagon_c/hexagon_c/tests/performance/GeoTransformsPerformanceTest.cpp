@@ -0,0 +1,61 @@
+#include <gtest/gtest.h>
+#include "common/GeoTransforms.h"
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <vector>
+
+// Benchmark: 200Hz tick başına 10k iz dönüşümü 5ms bütçesine sığmalı.
+// Her iterasyonda ECEF -> geodetic, geodetic -> ECEF ve ECEF -> ENU (konum + hız) yapılır.
+
+using namespace common::geo;
+
+TEST(GeoTransformsPerformanceTest, TenThousandTracksWithinTickBudget) {
+    constexpr std::size_t kTracks = 10000;
+    constexpr int kIterations = 200;
+    constexpr double kTickBudgetUs = 5000.0;
+
+    std::mt19937 rng(42U);
+    std::uniform_real_distribution<double> lat(-1.5, 1.5);
+    std::uniform_real_distribution<double> lon(-3.1, 3.1);
+    std::uniform_real_distribution<double> alt(0.0, 15000.0);
+    std::uniform_real_distribution<double> vel(-300.0, 300.0);
+
+    std::vector<double> x(kTracks), y(kTracks), z(kTracks);
+    std::vector<double> vx(kTracks), vy(kTracks), vz(kTracks);
+    std::vector<double> la(kTracks), lo(kTracks), al(kTracks);
+    std::vector<double> e(kTracks), n(kTracks), u(kTracks);
+    std::vector<double> ve(kTracks), vn(kTracks), vu(kTracks);
+    for (std::size_t i = 0; i < kTracks; ++i) {
+        la[i] = lat(rng);
+        lo[i] = lon(rng);
+        al[i] = alt(rng);
+        vx[i] = vel(rng);
+        vy[i] = vel(rng);
+        vz[i] = vel(rng);
+    }
+    geodeticToEcef(la.data(), lo.data(), al.data(), x.data(), y.data(), z.data(), kTracks);
+    const EnuFrame frame(0.7, 0.57, 900.0);
+
+    double best = 1e9;
+    double total = 0.0;
+    for (int it = 0; it < kIterations; ++it) {
+        const auto start = std::chrono::steady_clock::now();
+        ecefToGeodetic(x.data(), y.data(), z.data(), la.data(), lo.data(), al.data(), kTracks);
+        geodeticToEcef(la.data(), lo.data(), al.data(), x.data(), y.data(), z.data(), kTracks);
+        frame.ecefToEnu(x.data(), y.data(), z.data(), e.data(), n.data(), u.data(), kTracks);
+        frame.ecefVectorToEnu(vx.data(), vy.data(), vz.data(), ve.data(), vn.data(), vu.data(), kTracks);
+        const auto end = std::chrono::steady_clock::now();
+        const double us = std::chrono::duration<double, std::micro>(end - start).count();
+        best = std::min(best, us);
+        total += us;
+    }
+
+    const double mean = total / kIterations;
+    std::cout << "GeoTransforms (" << (isVectorized() ? "AVX2" : "scalar") << "): "
+              << kTracks << " tracks, best " << best << " us, mean " << mean
+              << " us per tick (budget " << kTickBudgetUs << " us)" << std::endl;
+
+    EXPECT_LT(best, kTickBudgetUs);
+}
@@ -6,6 +6,8 @@
 #include "domain/ports/outgoing/TrackDataPublisher.hpp"
 #include "domain/model/DelayCalcTrackData.hpp"
 #include "domain/model/FinalCalcTrackData.hpp"
+#include "common/ClockSync.h"
+#include "common/TscClock.h"
 
 using namespace testing;
 
@@ -19,6 +21,11 @@ public:
     explicit TestFinalCalculatorService(std::unique_ptr<IDataSender> sender)
         : FinalCalculatorService(std::move(sender)) {}
 
+    TestFinalCalculatorService(std::unique_ptr<IDataSender> sender,
+                               const common::timing::ClockOffsetEstimator* aClock,
+                               const common::timing::ClockOffsetEstimator* bClock)
+        : FinalCalculatorService(std::move(sender), aClock, bClock) {}
+
     domain::model::FinalCalcTrackData testCalculateFinalDelay(
         const domain::model::DelayCalcTrackData& input
     ) {
@@ -56,4 +63,22 @@ TEST_F(FinalCalculatorServiceTest, CalculatesFinalDelayCorrectly) {
     EXPECT_NEAR(result.getXPositionECEF(), 1000.0, 0.001);
     EXPECT_NEAR(result.getYPositionECEF(), 2000.0, 0.001);
     EXPECT_NEAR(result.getZPositionECEF(), 3000.0, 0.001);
-}
\ No newline at end of file
+}
+TEST_F(FinalCalculatorServiceTest, AppliesCrossHostClockOffsets) {
+    // B'nin saati A'dan 3 ms ileride; A→B gecikmesi gerçekte 500 µs
+    const std::int64_t now = common::timing::TscClock::nowNanos();
+    common::timing::ClockOffsetEstimator aClock;
+    common::timing::ClockOffsetEstimator bClock;
+    aClock.addSample({now - 20000, now - 10000, now - 10000, now});
+    bClock.addSample({now - 20000, now - 10000 + 3000000, now - 10000 + 3000000, now});
+
+    TestFinalCalculatorService corrected(std::make_unique<NiceMock<MockDataSender>>(), &aClock, &bClock);
+    domain::model::DelayCalcTrackData inputData;
+    inputData.setTrackId(1001);
+    inputData.setFirstHopSentTime(1000000);
+    inputData.setSecondHopSentTime(1000000 + 500 + 3000);
+
+    auto result = corrected.testCalculateFinalDelay(inputData);
+
+    EXPECT_NEAR(static_cast<double>(result.getSecondHopDelayTime()), 500.0, 1.0);
+}
@@ -0,0 +1,135 @@
+/**
+ * @file capture_replay.cpp
+ * @brief Publishes a DISH capture back through RADIO
+ *
+ * Usage:
+ *   capture_replay <capture_dir> <prefix> <radio_endpoint> [--speed N | --asap] [--group NAME] [--loop]
+ *
+ *   capture_replay /var/tmp/cap b_hexagon_dish udp://239.1.1.5:9595             # original pacing
+ *   capture_replay /var/tmp/cap b_hexagon_dish udp://239.1.1.5:9595 --speed 4   # 4x faster
+ *   capture_replay /var/tmp/cap b_hexagon_dish udp://239.1.1.5:9595 --asap      # no pacing
+ *
+ * Captures are written by the DISH adapters when HEXAGON_CAPTURE_DIR is set
+ * (see common/CaptureFile.h). Each frame keeps its captured group unless
+ * --group overrides it.
+ */
+
+#include "common/CaptureFile.h"
+#include "common/TscClock.h"
+
+// Enable ZeroMQ DRAFT API for RADIO/DISH - must be defined before zmq.hpp
+#define ZMQ_BUILD_DRAFT_API 1
+#include "zmq.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <csignal>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <thread>
+
+namespace {
+
+std::atomic<bool> running(true);
+
+void signalHandler(int) {
+    running.store(false);
+}
+
+/// Sleeps most of the way, then spins the last stretch for sub-100 µs pacing
+void waitUntil(std::int64_t dueNs) {
+    constexpr std::int64_t SPIN_NS = 100000;
+    const std::int64_t remaining = dueNs - common::timing::TscClock::nowNanos();
+    if (remaining > SPIN_NS) {
+        std::this_thread::sleep_for(std::chrono::nanoseconds(remaining - SPIN_NS));
+    }
+    while (common::timing::TscClock::nowNanos() < dueNs && running.load(std::memory_order_relaxed)) {
+    }
+}
+
+int usage() {
+    std::cerr << "usage: capture_replay <capture_dir> <prefix> <radio_endpoint>"
+              << " [--speed N | --asap] [--group NAME] [--loop]" << std::endl;
+    return 2;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    if (argc < 4) {
+        return usage();
+    }
+    const std::string directory = argv[1];
+    const std::string prefix = argv[2];
+    const std::string endpoint = argv[3];
+    double speed = 1.0;
+    std::string groupOverride;
+    bool loop = false;
+    for (int i = 4; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--asap") {
+            speed = 0.0;
+        } else if (arg == "--speed" && i + 1 < argc) {
+            speed = std::strtod(argv[++i], nullptr);
+            if (!(speed > 0.0)) {
+                std::cerr << "--speed must be positive" << std::endl;
+                return 2;
+            }
+        } else if (arg == "--group" && i + 1 < argc) {
+            groupOverride = argv[++i];
+        } else if (arg == "--loop") {
+            loop = true;
+        } else {
+            return usage();
+        }
+    }
+
+    if (common::capture::CaptureReader::listSegments(directory, prefix).empty()) {
+        std::cerr << "No " << prefix << ".*.hxcap segments in " << directory << std::endl;
+        return 1;
+    }
+
+    signal(SIGINT, signalHandler);
+    signal(SIGTERM, signalHandler);
+
+    try {
+        zmq::context_t context(1);
+        zmq::socket_t radio(context, zmq::socket_type::radio);
+        radio.connect(endpoint);
+
+        std::uint64_t sent = 0U;
+        std::uint64_t skipped = 0U;
+        const std::int64_t startNs = common::timing::TscClock::nowNanos();
+        do {
+            common::capture::CaptureReader reader(directory, prefix);
+            common::capture::ReplayPacer pacer(speed);
+            common::capture::CaptureRecord record;
+            while (running.load(std::memory_order_relaxed) && reader.next(record)) {
+                const std::string group = groupOverride.empty() ? std::string(record.group) : groupOverride;
+                if (group.empty()) {
+                    ++skipped;
+                    continue;
+                }
+                if (!pacer.asFastAsPossible()) {
+                    waitUntil(pacer.dueAt(record.receiveNs, common::timing::TscClock::nowNanos()));
+                }
+                zmq::message_t message(record.data, record.size);
+                message.set_group(group.c_str());
+                if (radio.send(message, zmq::send_flags::none)) {
+                    ++sent;
+                }
+            }
+        } while (loop && running.load());
+
+        const double seconds = static_cast<double>(common::timing::TscClock::nowNanos() - startNs) / 1e9;
+        std::cout << "Replayed " << sent << " frames in " << seconds << " s"
+                  << (skipped > 0U ? " (" + std::to_string(skipped) + " without group skipped)" : std::string())
+                  << std::endl;
+    } catch (const zmq::error_t& e) {
+        std::cerr << "ZeroMQ error: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,134 @@
+/**
+ * @file columnar_query.cpp
+ * @brief Filters and summarizes a columnar export file
+ *
+ * Usage:
+ *   columnar_query <file.hxcol> [--where COLUMN MIN MAX]... [--stats COLUMN]...
+ *
+ *   columnar_query final_calc_track_data.1700000000000000.hxcol --schema
+ *   columnar_query final_calc_track_data.1700000000000000.hxcol \
+ *       --where trackId 1000 1010 --where updateTime 1700000000 1700003600 \
+ *       --stats totalDelayTime --stats secondHopDelayTime
+ *
+ * Files are written by hexagon_c when HEXAGON_EXPORT_DIR is set (see
+ * common/ColumnarFile.h). Chunks whose min/max statistics miss a --where
+ * range are skipped without touching their column data.
+ */
+
+#include "common/ColumnarFile.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+
+using common::store::ChunkView;
+using common::store::ColumnarReader;
+using common::store::ColumnRange;
+using common::store::ColumnType;
+
+namespace {
+
+struct Summary {
+    std::size_t column = 0U;
+    std::uint64_t count = 0U;
+    double sum = 0.0;
+    double min = std::numeric_limits<double>::infinity();
+    double max = -std::numeric_limits<double>::infinity();
+};
+
+int usage() {
+    std::cerr << "usage: columnar_query <file.hxcol> [--schema] [--where COLUMN MIN MAX]... [--stats COLUMN]..."
+              << std::endl;
+    return 2;
+}
+
+const char* typeName(ColumnType type) {
+    return type == ColumnType::Int64 ? "int64" : "double";
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        return usage();
+    }
+    try {
+        const auto started = std::chrono::steady_clock::now();
+        ColumnarReader reader(argv[1]);
+        std::vector<ColumnRange> ranges;
+        std::vector<Summary> summaries;
+        bool printSchema = false;
+
+        for (int i = 2; i < argc; ++i) {
+            const std::string option = argv[i];
+            if (option == "--schema") {
+                printSchema = true;
+            } else if (option == "--where" && i + 3 < argc) {
+                const std::size_t column = reader.columnIndex(argv[i + 1]);
+                if (reader.schema()[column].type == ColumnType::Int64) {
+                    ranges.push_back(ColumnRange::ints(column, std::strtoll(argv[i + 2], nullptr, 10),
+                                                       std::strtoll(argv[i + 3], nullptr, 10)));
+                } else {
+                    ranges.push_back(ColumnRange::doubles(column, std::strtod(argv[i + 2], nullptr),
+                                                          std::strtod(argv[i + 3], nullptr)));
+                }
+                i += 3;
+            } else if (option == "--stats" && i + 1 < argc) {
+                Summary summary;
+                summary.column = reader.columnIndex(argv[++i]);
+                summaries.push_back(summary);
+            } else {
+                return usage();
+            }
+        }
+
+        if (printSchema) {
+            for (const common::store::ColumnSpec& spec : reader.schema()) {
+                std::cout << spec.name << " " << typeName(spec.type) << std::endl;
+            }
+        }
+
+        std::uint64_t matched = 0U;
+        const std::size_t scanned = reader.scan(ranges, [&](const ChunkView& chunk) {
+            for (std::size_t row = 0U; row < chunk.rows(); ++row) {
+                if (!chunk.rowMatches(row, ranges)) {
+                    continue;
+                }
+                ++matched;
+                for (Summary& summary : summaries) {
+                    const common::store::ColumnCell cell = chunk.column(summary.column)[row];
+                    const double value = reader.schema()[summary.column].type == ColumnType::Int64
+                                             ? static_cast<double>(cell.asInt)
+                                             : cell.asDouble;
+                    ++summary.count;
+                    summary.sum += value;
+                    summary.min = std::min(summary.min, value);
+                    summary.max = std::max(summary.max, value);
+                }
+            }
+        });
+        const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - started);
+
+        std::cout << reader.rows() << " rows in " << reader.chunks() << " chunks"
+                  << (reader.complete() ? "" : " (no footer, recovered)") << "; scanned " << scanned
+                  << " chunks, " << matched << " rows matched in " << elapsed.count() << " ms" << std::endl;
+        for (const Summary& summary : summaries) {
+            std::cout << reader.schema()[summary.column].name << ": count " << summary.count;
+            if (summary.count > 0U) {
+                std::cout << " mean " << summary.sum / static_cast<double>(summary.count)
+                          << " min " << summary.min << " max " << summary.max;
+            }
+            std::cout << std::endl;
+        }
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "columnar_query: " << e.what() << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,174 @@
+/**
+ * @file hexstat.cpp
+ * @brief Live view of the hexagons' /dev/shm metrics segments
+ *
+ * Usage:
+ *   hexstat [service] [--interval MS] [--once]
+ *
+ *   hexstat                      # every running hexagon, refreshed each second
+ *   hexstat b_hexagon            # only b_hexagon processes
+ *   hexstat --once               # one sample, no screen clearing (scripts)
+ *
+ * Segments are published by each process through common/MetricsSegment.h
+ * ($HEXAGON_METRICS_NAME, default the program name). Counters are shown
+ * with their rate over the last interval; histograms with their rate and
+ * p50/p90/p99/p99.9/max, recent (over the last interval) once a previous
+ * sample exists and cumulative before that.
+ */
+
+#include "common/MetricsSegment.h"
+
+#include <atomic>
+#include <chrono>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using common::metrics::MetricKind;
+using common::metrics::MetricSample;
+using common::metrics::MetricsReader;
+using common::metrics::MetricsSnapshot;
+
+namespace {
+
+std::atomic<bool> running(true);
+
+void signalHandler(int) {
+    running.store(false);
+}
+
+int usage() {
+    std::cerr << "usage: hexstat [service] [--interval MS] [--once]" << std::endl;
+    return 2;
+}
+
+struct Attached {
+    std::unique_ptr<MetricsReader> reader;
+    MetricsSnapshot previous;
+    bool hasPrevious = false;
+};
+
+const MetricSample* findPrevious(const MetricsSnapshot& previous, const std::string& name) {
+    for (const MetricSample& sample : previous.metrics) {
+        if (sample.name == name) {
+            return &sample;
+        }
+    }
+    return nullptr;
+}
+
+std::string formatUptime(std::int64_t ns) {
+    const long long seconds = ns / 1000000000LL;
+    char text[32];
+    std::snprintf(text, sizeof(text), "%02lld:%02lld:%02lld", seconds / 3600, (seconds / 60) % 60, seconds % 60);
+    return text;
+}
+
+void render(const MetricsSnapshot& current, const MetricsSnapshot* previous) {
+    const double seconds = previous ? static_cast<double>(current.takenNs - previous->takenNs) / 1e9 : 0.0;
+    std::printf("%s  pid %u  up %s\n", current.service.c_str(), current.pid,
+                formatUptime(current.takenNs - current.createdNs).c_str());
+    for (const MetricSample& sample : current.metrics) {
+        const MetricSample* before = previous ? findPrevious(*previous, sample.name) : nullptr;
+        const double rate = (before != nullptr && seconds > 0.0)
+                                ? static_cast<double>(sample.value - before->value) / seconds
+                                : 0.0;
+        switch (sample.kind) {
+            case MetricKind::Counter:
+                std::printf("  %-36s %14llu  %12.1f/s\n", sample.name.c_str(),
+                            static_cast<unsigned long long>(sample.value), rate);
+                break;
+            case MetricKind::Gauge:
+                std::printf("  %-36s %14lld\n", sample.name.c_str(), static_cast<long long>(sample.value));
+                break;
+            case MetricKind::Histogram: {
+                // Percentiles of the last interval when there was traffic in it
+                std::vector<std::uint64_t> buckets = sample.buckets;
+                if (before != nullptr && sample.value > before->value) {
+                    for (std::size_t bucket = 0U; bucket < buckets.size(); ++bucket) {
+                        buckets[bucket] -= before->buckets[bucket];
+                    }
+                }
+                const double mean = sample.value ? static_cast<double>(sample.sum) / static_cast<double>(sample.value) : 0.0;
+                std::printf("  %-36s %14llu  %12.1f/s  p50 %.0f  p90 %.0f  p99 %.0f  p99.9 %.0f  max %llu  mean %.0f\n",
+                            sample.name.c_str(), static_cast<unsigned long long>(sample.value), rate,
+                            common::metrics::histogramPercentile(buckets, 0.50),
+                            common::metrics::histogramPercentile(buckets, 0.90),
+                            common::metrics::histogramPercentile(buckets, 0.99),
+                            common::metrics::histogramPercentile(buckets, 0.999),
+                            static_cast<unsigned long long>(sample.max), mean);
+                break;
+            }
+        }
+    }
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    std::string service;
+    long intervalMs = 1000;
+    bool once = false;
+    for (int i = 1; i < argc; ++i) {
+        const std::string option = argv[i];
+        if (option == "--interval" && i + 1 < argc) {
+            intervalMs = std::strtol(argv[++i], nullptr, 10);
+        } else if (option == "--once") {
+            once = true;
+        } else if (!option.empty() && option[0] != '-' && service.empty()) {
+            service = option;
+        } else {
+            return usage();
+        }
+    }
+    if (intervalMs <= 0) {
+        return usage();
+    }
+
+    std::signal(SIGINT, signalHandler);
+    std::signal(SIGTERM, signalHandler);
+
+    std::map<std::string, Attached> attached;
+    while (running.load()) {
+        // Attach to segments that appeared, drop those whose process is gone
+        for (const std::string& path : MetricsReader::listSegments(service)) {
+            if (attached.count(path) == 0U) {
+                try {
+                    attached[path].reader.reset(new MetricsReader(path));
+                } catch (const std::exception& e) {
+                    attached.erase(path);
+                    std::cerr << "hexstat: " << e.what() << std::endl;
+                }
+            }
+        }
+        for (auto it = attached.begin(); it != attached.end();) {
+            it = it->second.reader->alive() ? std::next(it) : attached.erase(it);
+        }
+
+        if (!once) {
+            std::printf("\033[H\033[2J");
+        }
+        if (attached.empty()) {
+            std::printf("no metrics segments%s%s in /dev/shm\n", service.empty() ? "" : " for ", service.c_str());
+        }
+        for (auto& entry : attached) {
+            Attached& segment = entry.second;
+            MetricsSnapshot current = segment.reader->read();
+            render(current, segment.hasPrevious ? &segment.previous : nullptr);
+            segment.previous = std::move(current);
+            segment.hasPrevious = true;
+        }
+        std::fflush(stdout);
+        if (once) {
+            break;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(intervalMs));
+    }
+    return attached.empty() ? 1 : 0;
+}
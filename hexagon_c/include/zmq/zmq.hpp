@@ -670,6 +670,21 @@ class message_t
         if (rc != 0)
             throw error_t();
     }
+
+#ifdef ZMQ_GROUP_NUMERIC
+    void set_group_id(uint32_t group_id)
+    {
+        int rc = zmq_msg_set_group_id(&msg, group_id);
+        if (rc != 0)
+            throw error_t();
+    }
+
+    // false if the group is not a numeric group id
+    bool group_id(uint32_t &group_id) const ZMQ_NOTHROW
+    {
+        return zmq_msg_group_id(const_cast<zmq_msg_t *>(&msg), &group_id) == 0;
+    }
+#endif
 #endif
 
     // interpret message content as a string
@@ -1463,7 +1478,7 @@ ZMQ_DEFINE_INTEGRAL_OPT(ZMQ_BACKLOG, backlog, int);
 ZMQ_DEFINE_ARRAY_OPT_BINARY(ZMQ_BINDTODEVICE, bindtodevice);
 #endif
 #ifdef ZMQ_BUSY_POLL
-ZMQ_DEFINE_INTEGRAL_BOOL_UNIT_OPT(ZMQ_BUSY_POLL, busy_poll, int);
+ZMQ_DEFINE_INTEGRAL_OPT(ZMQ_BUSY_POLL, busy_poll, int);
 #endif
 #ifdef ZMQ_CONFLATE
 ZMQ_DEFINE_INTEGRAL_BOOL_UNIT_OPT(ZMQ_CONFLATE, conflate, int);
@@ -1517,6 +1532,9 @@ ZMQ_DEFINE_INTEGRAL_OPT(ZMQ_GSSAPI_PRINCIPAL_NAMETYPE,
                         gssapi_principal_nametype,
                         int);
 #endif
+#ifdef ZMQ_GROUP_NUMERIC
+ZMQ_DEFINE_INTEGRAL_BOOL_UNIT_OPT(ZMQ_GROUP_NUMERIC, group_numeric, int);
+#endif
 #ifdef ZMQ_HANDSHAKE_IVL
 ZMQ_DEFINE_INTEGRAL_OPT(ZMQ_HANDSHAKE_IVL, handshake_ivl, int);
 #endif
@@ -1535,6 +1553,9 @@ ZMQ_DEFINE_ARRAY_OPT_BINARY(ZMQ_HELLO_MSG, hello_msg);
 #ifdef ZMQ_IMMEDIATE
 ZMQ_DEFINE_INTEGRAL_BOOL_UNIT_OPT(ZMQ_IMMEDIATE, immediate, int);
 #endif
+#ifdef ZMQ_INCOMING_CPU
+ZMQ_DEFINE_INTEGRAL_OPT(ZMQ_INCOMING_CPU, incoming_cpu, int);
+#endif
 #ifdef ZMQ_INVERT_MATCHING
 ZMQ_DEFINE_INTEGRAL_BOOL_UNIT_OPT(ZMQ_INVERT_MATCHING, invert_matching, int);
 #endif
@@ -1577,6 +1598,9 @@ ZMQ_DEFINE_ARRAY_OPT(ZMQ_PLAIN_PASSWORD, plain_password);
 #ifdef ZMQ_PLAIN_USERNAME
 ZMQ_DEFINE_ARRAY_OPT(ZMQ_PLAIN_USERNAME, plain_username);
 #endif
+#ifdef ZMQ_PREFER_BUSY_POLL
+ZMQ_DEFINE_INTEGRAL_BOOL_UNIT_OPT(ZMQ_PREFER_BUSY_POLL, prefer_busy_poll, int);
+#endif
 #ifdef ZMQ_PRIORITY
 ZMQ_DEFINE_INTEGRAL_OPT(ZMQ_PRIORITY, priority, int);
 #endif
@@ -1685,6 +1709,9 @@ ZMQ_DEFINE_INTEGRAL_OPT(ZMQ_TYPE, type, int);
 ZMQ_DEFINE_INTEGRAL_OPT(ZMQ_TYPE, socket_type, socket_type);
 #endif // ZMQ_CPP11
 #endif // ZMQ_TYPE
+#ifdef ZMQ_UDP_DIRECT
+ZMQ_DEFINE_INTEGRAL_BOOL_UNIT_OPT(ZMQ_UDP_DIRECT, udp_direct, int);
+#endif
 #ifdef ZMQ_UNSUBSCRIBE
 ZMQ_DEFINE_ARRAY_OPT(ZMQ_UNSUBSCRIBE, unsubscribe);
 #endif
@@ -2068,6 +2095,22 @@ class socket_base
         if (rc != 0)
             throw error_t();
     }
+
+#ifdef ZMQ_GROUP_NUMERIC
+    void join_id(uint32_t group_id)
+    {
+        int rc = zmq_join_id(_handle, group_id);
+        if (rc != 0)
+            throw error_t();
+    }
+
+    void leave_id(uint32_t group_id)
+    {
+        int rc = zmq_leave_id(_handle, group_id);
+        if (rc != 0)
+            throw error_t();
+    }
+#endif
 #endif
 
     ZMQ_NODISCARD void *handle() ZMQ_NOTHROW { return _handle; }
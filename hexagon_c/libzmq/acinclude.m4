@@ -1103,7 +1103,7 @@ AC_DEFUN([LIBZMQ_CHECK_POLLER], [{
     # Allow user to override poller autodetection
     AC_ARG_WITH([poller],
         [AS_HELP_STRING([--with-poller],
-        [choose I/O thread polling system manually. Valid values are 'kqueue', 'epoll', 'devpoll', 'pollset', 'poll', 'select', 'wepoll', or 'auto'. [default=auto]])])
+        [choose I/O thread polling system manually. Valid values are 'kqueue', 'epoll', 'io_uring', 'devpoll', 'pollset', 'poll', 'select', 'wepoll', or 'auto'. [default=auto]])])
 
     # Allow user to override poller autodetection
     AC_ARG_WITH([api_poller],
@@ -1185,6 +1185,14 @@ AC_DEFUN([LIBZMQ_CHECK_POLLER], [{
                     poller_found=1
                 ])
             ;;
+            io_uring)
+                # io_uring can only be manually selected
+                AC_CHECK_DECL([IORING_RECV_MULTISHOT], [
+                    AC_MSG_NOTICE([Using 'io_uring' I/O thread polling system])
+                    AC_DEFINE(ZMQ_IOTHREAD_POLLER_USE_IO_URING, 1, [Use 'io_uring' I/O thread polling system])
+                    poller_found=1
+                ], [], [[#include <linux/io_uring.h>]])
+            ;;
             wepoll)
                 # wepoll can only be manually selected
                 AC_MSG_NOTICE([Using 'wepoll' I/O thread polling system])
@@ -662,6 +662,13 @@ ZMQ_EXPORT void zmq_threadclose (void *thread_);
 #define ZMQ_NORM_NUM_PARITY 122
 #define ZMQ_NORM_NUM_AUTOPARITY 123
 #define ZMQ_NORM_PUSH 124
+#define ZMQ_GROUP_NUMERIC 125
+#define ZMQ_PREFER_BUSY_POLL 126
+#define ZMQ_INCOMING_CPU 127
+#define ZMQ_UDP_DIRECT 128
+
+/*  DRAFT numeric RADIO/DISH groups: fixed-width lowercase hex on the wire   */
+#define ZMQ_GROUP_ID_LENGTH 8
 
 /*  DRAFT ZMQ_NORM_MODE options                                               */
 #define ZMQ_NORM_FIXED 0
@@ -691,6 +698,8 @@ ZMQ_EXPORT int zmq_ctx_get_ext (void *context_,
 /*  DRAFT Socket methods.                                                     */
 ZMQ_EXPORT int zmq_join (void *s, const char *group);
 ZMQ_EXPORT int zmq_leave (void *s, const char *group);
+ZMQ_EXPORT int zmq_join_id (void *s, uint32_t group_id);
+ZMQ_EXPORT int zmq_leave_id (void *s, uint32_t group_id);
 ZMQ_EXPORT uint32_t zmq_connect_peer (void *s_, const char *addr_);
 
 /*  DRAFT Msg methods.                                                        */
@@ -698,6 +707,8 @@ ZMQ_EXPORT int zmq_msg_set_routing_id (zmq_msg_t *msg, uint32_t routing_id);
 ZMQ_EXPORT uint32_t zmq_msg_routing_id (zmq_msg_t *msg);
 ZMQ_EXPORT int zmq_msg_set_group (zmq_msg_t *msg, const char *group);
 ZMQ_EXPORT const char *zmq_msg_group (zmq_msg_t *msg);
+ZMQ_EXPORT int zmq_msg_set_group_id (zmq_msg_t *msg, uint32_t group_id);
+ZMQ_EXPORT int zmq_msg_group_id (zmq_msg_t *msg, uint32_t *group_id);
 ZMQ_EXPORT int
 zmq_msg_init_buffer (zmq_msg_t *msg_, const void *buf_, size_t size_);
 
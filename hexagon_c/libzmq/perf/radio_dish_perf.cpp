@@ -0,0 +1,281 @@
+/* SPDX-License-Identifier: MPL-2.0 */
+
+#include "../include/zmq.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+#include <pthread.h>
+
+//  RADIO/DISH over UDP in one process: a thread sends message-count
+//  messages, stamped with a sequence number and the send time, and the main
+//  thread receives them. Without a rate the sender runs flat out and the
+//  result is the throughput; with one it is paced and the latency
+//  percentiles show the tail. Build libzmq once per I/O thread poller
+//  (POLLER=epoll, POLLER=io_uring) to compare them, see
+//  radio_dish_pollers.sh. With "direct" both sockets set ZMQ_UDP_DIRECT
+//  and the I/O threads are out of the path.
+
+static const char group[] = "perf";
+
+static const char *endpoint;
+static size_t message_size;
+static int message_count;
+static int message_rate;
+static int direct;
+
+static uint64_t now_ns ()
+{
+    struct timespec ts;
+    clock_gettime (CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000 + (uint64_t) ts.tv_nsec;
+}
+
+static void *sender (void *ctx_)
+{
+    void *s;
+    int rc;
+    int i;
+    int hwm = 0;
+    zmq_msg_t msg;
+    uint64_t stamp[2];
+    uint64_t start;
+
+    s = zmq_socket (ctx_, ZMQ_RADIO);
+    if (!s) {
+        printf ("error in zmq_socket: %s\n", zmq_strerror (errno));
+        exit (1);
+    }
+
+    rc = zmq_setsockopt (s, ZMQ_SNDHWM, &hwm, sizeof (hwm));
+    if (rc == 0)
+        rc = zmq_setsockopt (s, ZMQ_UDP_DIRECT, &direct, sizeof (direct));
+    if (rc != 0) {
+        printf ("error in zmq_setsockopt: %s\n", zmq_strerror (errno));
+        exit (1);
+    }
+
+    rc = zmq_connect (s, endpoint);
+    if (rc != 0) {
+        printf ("error in zmq_connect: %s\n", zmq_strerror (errno));
+        exit (1);
+    }
+
+    //  Let the UDP engines get plugged.
+    zmq_sleep (1);
+
+    start = now_ns ();
+    for (i = 0; i != message_count; i++) {
+        if (message_rate > 0) {
+            const uint64_t due =
+              start + (uint64_t) i * 1000000000 / (uint64_t) message_rate;
+            while (now_ns () < due)
+                ;
+        }
+
+        rc = zmq_msg_init_size (&msg, message_size);
+        if (rc != 0) {
+            printf ("error in zmq_msg_init_size: %s\n", zmq_strerror (errno));
+            exit (1);
+        }
+        stamp[0] = (uint64_t) i;
+        stamp[1] = now_ns ();
+        memset (zmq_msg_data (&msg), 0, message_size);
+        memcpy (zmq_msg_data (&msg), stamp, sizeof (stamp));
+
+        rc = zmq_msg_set_group (&msg, group);
+        if (rc != 0) {
+            printf ("error in zmq_msg_set_group: %s\n", zmq_strerror (errno));
+            exit (1);
+        }
+        rc = zmq_msg_send (&msg, s, 0);
+        if (rc < 0) {
+            printf ("error in zmq_msg_send: %s\n", zmq_strerror (errno));
+            exit (1);
+        }
+    }
+
+    rc = zmq_close (s);
+    if (rc != 0) {
+        printf ("error in zmq_close: %s\n", zmq_strerror (errno));
+        exit (1);
+    }
+
+    return NULL;
+}
+
+static int compare_u64 (const void *a_, const void *b_)
+{
+    const uint64_t a = *(const uint64_t *) a_;
+    const uint64_t b = *(const uint64_t *) b_;
+    return a < b ? -1 : (a > b ? 1 : 0);
+}
+
+static double percentile_us (const uint64_t *sorted_, int count_, double p_)
+{
+    int index = (int) (p_ * (count_ - 1) + 0.5);
+    return (double) sorted_[index] / 1000.0;
+}
+
+int main (int argc, char *argv[])
+{
+    pthread_t send_thread;
+    void *ctx;
+    void *s;
+    int rc;
+    int hwm = 0;
+    int timeout = 1000;
+    int received = 0;
+    zmq_msg_t msg;
+    uint64_t stamp[2];
+    uint64_t first = 0;
+    uint64_t last = 0;
+    uint64_t *latencies;
+    double elapsed;
+    double throughput;
+    double megabits;
+
+    if (argc < 4 || argc > 6 || (argc == 6 && strcmp (argv[5], "direct"))) {
+        printf ("usage: radio_dish_perf <udp-endpoint> <message-size> "
+                "<message-count> [<messages-per-second> [direct]]\n");
+        return 1;
+    }
+    endpoint = argv[1];
+    message_size = atoi (argv[2]);
+    message_count = atoi (argv[3]);
+    message_rate = argc >= 5 ? atoi (argv[4]) : 0;
+    direct = argc == 6 ? 1 : 0;
+    if (message_size < sizeof (stamp) || message_count < 1) {
+        printf ("message size must be at least %d [B]\n", (int) sizeof (stamp));
+        return 1;
+    }
+
+    latencies = (uint64_t *) malloc (message_count * sizeof (uint64_t));
+    if (!latencies) {
+        printf ("error in malloc\n");
+        return -1;
+    }
+
+    ctx = zmq_init (1);
+    if (!ctx) {
+        printf ("error in zmq_init: %s\n", zmq_strerror (errno));
+        return -1;
+    }
+
+    s = zmq_socket (ctx, ZMQ_DISH);
+    if (!s) {
+        printf ("error in zmq_socket: %s\n", zmq_strerror (errno));
+        return -1;
+    }
+
+    rc = zmq_setsockopt (s, ZMQ_RCVHWM, &hwm, sizeof (hwm));
+    if (rc == 0)
+        rc = zmq_setsockopt (s, ZMQ_RCVTIMEO, &timeout, sizeof (timeout));
+    if (rc == 0)
+        rc = zmq_setsockopt (s, ZMQ_UDP_DIRECT, &direct, sizeof (direct));
+    if (rc != 0) {
+        printf ("error in zmq_setsockopt: %s\n", zmq_strerror (errno));
+        return -1;
+    }
+
+    rc = zmq_bind (s, endpoint);
+    if (rc != 0) {
+        printf ("error in zmq_bind: %s\n", zmq_strerror (errno));
+        return -1;
+    }
+
+    rc = zmq_join (s, group);
+    if (rc != 0) {
+        printf ("error in zmq_join: %s\n", zmq_strerror (errno));
+        return -1;
+    }
+
+    rc = pthread_create (&send_thread, NULL, sender, ctx);
+    if (rc != 0) {
+        printf ("error in pthread_create: %s\n", zmq_strerror (rc));
+        return -1;
+    }
+
+    rc = zmq_msg_init (&msg);
+    if (rc != 0) {
+        printf ("error in zmq_msg_init: %s\n", zmq_strerror (errno));
+        return -1;
+    }
+
+    //  UDP may drop: stop at the last message or once nothing arrives for
+    //  a second.
+    while (true) {
+        rc = zmq_msg_recv (&msg, s, 0);
+        if (rc < 0) {
+            if (errno == EAGAIN && received > 0)
+                break;
+            if (errno == EAGAIN)
+                continue;
+            printf ("error in zmq_msg_recv: %s\n", zmq_strerror (errno));
+            return -1;
+        }
+        last = now_ns ();
+        if (zmq_msg_size (&msg) != message_size) {
+            printf ("message of incorrect size received\n");
+            return -1;
+        }
+        memcpy (stamp, zmq_msg_data (&msg), sizeof (stamp));
+        if (received == 0)
+            first = last;
+        latencies[received++] = last - stamp[1];
+        if (stamp[0] == (uint64_t) message_count - 1)
+            break;
+    }
+
+    rc = zmq_msg_close (&msg);
+    if (rc != 0) {
+        printf ("error in zmq_msg_close: %s\n", zmq_strerror (errno));
+        return -1;
+    }
+
+    rc = pthread_join (send_thread, NULL);
+    if (rc != 0) {
+        printf ("error in pthread_join: %s\n", zmq_strerror (rc));
+        return -1;
+    }
+
+    elapsed = (double) (last - first) / 1000000000.0;
+    throughput = received > 1 ? (received - 1) / elapsed : 0;
+    megabits = throughput * message_size * 8 / 1000000;
+    qsort (latencies, received, sizeof (uint64_t), compare_u64);
+
+    printf ("message size: %d [B]\n", (int) message_size);
+    printf ("message count: %d\n", message_count);
+    if (message_rate > 0)
+        printf ("message rate: %d [msg/s]\n", message_rate);
+    if (direct)
+        printf ("udp direct: yes\n");
+    printf ("messages received: %d (%.2f%% lost)\n", received,
+            100.0 * (message_count - received) / message_count);
+    printf ("mean throughput: %d [msg/s]\n", (int) throughput);
+    printf ("mean throughput: %.3f [Mb/s]\n", megabits);
+    printf ("latency p50/p90/p99/p99.9/max: %.1f %.1f %.1f %.1f %.1f [us]\n",
+            percentile_us (latencies, received, 0.5),
+            percentile_us (latencies, received, 0.9),
+            percentile_us (latencies, received, 0.99),
+            percentile_us (latencies, received, 0.999),
+            (double) latencies[received - 1] / 1000.0);
+
+    rc = zmq_close (s);
+    if (rc != 0) {
+        printf ("error in zmq_close: %s\n", zmq_strerror (errno));
+        return -1;
+    }
+
+    rc = zmq_ctx_term (ctx);
+    if (rc != 0) {
+        printf ("error in zmq_ctx_term: %s\n", zmq_strerror (errno));
+        return -1;
+    }
+
+    free (latencies);
+
+    return 0;
+}
@@ -0,0 +1,47 @@
+#!/bin/sh
+
+#
+# Compares the epoll and the io_uring I/O thread poller on RADIO/DISH over
+# UDP: builds libzmq with each of them and runs radio_dish_perf unpaced
+# (throughput) and paced (tail latency), then once more with ZMQ_UDP_DIRECT,
+# where no I/O thread is involved.
+#
+# Usage example:
+#    export RADIO_DISH_ENDPOINT="udp://127.0.0.1:5560"
+#    ./radio_dish_pollers.sh /tmp/zmq-pollers
+#
+
+set -eu
+
+SOURCE_DIR=$(cd "$(dirname "$0")/.." && pwd)
+BUILD_DIR=${1:-${SOURCE_DIR}/build-pollers}
+
+# configurable values (via environment variables):
+RADIO_DISH_ENDPOINT=${RADIO_DISH_ENDPOINT:-udp://127.0.0.1:5560}
+MESSAGE_SIZE=${MESSAGE_SIZE:-64}
+THROUGHPUT_COUNT=${THROUGHPUT_COUNT:-1000000}
+LATENCY_COUNT=${LATENCY_COUNT:-200000}
+LATENCY_RATE=${LATENCY_RATE:-20000}
+
+for poller in epoll io_uring; do
+    cmake -S "$SOURCE_DIR" -B "$BUILD_DIR/$poller" -DPOLLER=$poller \
+        -DENABLE_DRAFTS=ON -DBUILD_TESTS=OFF -DWITH_DOCS=OFF \
+        -DCMAKE_BUILD_TYPE=Release >/dev/null
+    cmake --build "$BUILD_DIR/$poller" --target radio_dish_perf >/dev/null
+done
+
+for poller in epoll io_uring; do
+    echo "== $poller: throughput"
+    "$BUILD_DIR/$poller/bin/radio_dish_perf" "$RADIO_DISH_ENDPOINT" \
+        "$MESSAGE_SIZE" "$THROUGHPUT_COUNT"
+    echo "== $poller: latency at $LATENCY_RATE msg/s"
+    "$BUILD_DIR/$poller/bin/radio_dish_perf" "$RADIO_DISH_ENDPOINT" \
+        "$MESSAGE_SIZE" "$LATENCY_COUNT" "$LATENCY_RATE"
+done
+
+echo "== direct: throughput"
+"$BUILD_DIR/epoll/bin/radio_dish_perf" "$RADIO_DISH_ENDPOINT" \
+    "$MESSAGE_SIZE" "$THROUGHPUT_COUNT" 0 direct
+echo "== direct: latency at $LATENCY_RATE msg/s"
+"$BUILD_DIR/epoll/bin/radio_dish_perf" "$RADIO_DISH_ENDPOINT" \
+    "$MESSAGE_SIZE" "$LATENCY_COUNT" "$LATENCY_RATE" direct
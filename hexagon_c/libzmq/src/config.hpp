@@ -31,6 +31,15 @@ enum
     //  Maximum number of events the I/O thread can process in one go.
     max_io_events = 256,
 
+    //  Submission queue size of the io_uring I/O thread poller. The
+    //  completion queue is four times as large.
+    io_uring_entries = 256,
+
+    //  Receive buffers (a power of 2) and send buffers per UDP engine when
+    //  the io_uring poller does its datagram I/O.
+    io_uring_recv_buffers = 64,
+    io_uring_send_buffers = 64,
+
     //  Maximal batch size of packets forwarded by a ZMQ proxy.
     //  Increasing this value improves throughput at the expense of
     //  latency and fairness.
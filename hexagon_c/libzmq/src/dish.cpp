@@ -6,9 +6,12 @@
 #include "macros.hpp"
 #include "dish.hpp"
 #include "err.hpp"
+#include "udp_direct.hpp"
 
 zmq::dish_t::dish_t (class ctx_t *parent_, uint32_t tid_, int sid_) :
-    socket_base_t (parent_, tid_, sid_, true), _has_message (false)
+    socket_base_t (parent_, tid_, sid_, true),
+    _numeric (false),
+    _has_message (false)
 {
     options.type = ZMQ_DISH;
 
@@ -63,17 +66,67 @@ void zmq::dish_t::xhiccuped (pipe_t *pipe_)
     send_subscriptions (pipe_);
 }
 
-int zmq::dish_t::xjoin (const char *group_)
+int zmq::dish_t::xsetsockopt (int option_,
+                              const void *optval_,
+                              size_t optvallen_)
+{
+    if (option_ != ZMQ_GROUP_NUMERIC || optvallen_ != sizeof (int)
+        || *static_cast<const int *> (optval_) < 0) {
+        errno = EINVAL;
+        return -1;
+    }
+
+    //  The group representation cannot change under existing joins.
+    if (!_subscriptions.empty () || !_group_ids.empty ()) {
+        errno = EINVAL;
+        return -1;
+    }
+
+    _numeric = (*static_cast<const int *> (optval_) != 0);
+    return 0;
+}
+
+bool zmq::dish_t::add_subscription (const char *group_)
+{
+    if (_numeric) {
+        uint32_t id;
+        if (!decode_group_id (group_, &id))
+            return false;
+        bool inserted;
+        _group_ids.insert (id, &inserted);
+        return inserted;
+    }
+    return _subscriptions.insert (std::string (group_)).second;
+}
+
+bool zmq::dish_t::remove_subscription (const char *group_)
+{
+    if (_numeric) {
+        uint32_t id;
+        return decode_group_id (group_, &id) && _group_ids.erase (id);
+    }
+    return _subscriptions.erase (std::string (group_)) != 0;
+}
+
+bool zmq::dish_t::matches (const msg_t *msg_)
 {
-    const std::string group = std::string (group_);
+    if (_numeric) {
+        uint32_t id;
+        return decode_group_id (msg_->group (), &id)
+               && _group_ids.contains (id);
+    }
+    return _subscriptions.count (std::string (msg_->group ())) != 0;
+}
 
-    if (group.length () > ZMQ_GROUP_MAX_LENGTH) {
+int zmq::dish_t::xjoin (const char *group_)
+{
+    if (strnlen (group_, ZMQ_GROUP_MAX_LENGTH + 1) > ZMQ_GROUP_MAX_LENGTH) {
         errno = EINVAL;
         return -1;
     }
 
     //  User cannot join same group twice
-    if (!_subscriptions.insert (group).second) {
+    if (!add_subscription (group_)) {
         errno = EINVAL;
         return -1;
     }
@@ -98,14 +151,12 @@ int zmq::dish_t::xjoin (const char *group_)
 
 int zmq::dish_t::xleave (const char *group_)
 {
-    const std::string group = std::string (group_);
-
-    if (group.length () > ZMQ_GROUP_MAX_LENGTH) {
+    if (strnlen (group_, ZMQ_GROUP_MAX_LENGTH + 1) > ZMQ_GROUP_MAX_LENGTH) {
         errno = EINVAL;
         return -1;
     }
 
-    if (0 == _subscriptions.erase (group)) {
+    if (!remove_subscription (group_)) {
         errno = EINVAL;
         return -1;
     }
@@ -157,6 +208,14 @@ int zmq::dish_t::xrecv (msg_t *msg_)
 
 int zmq::dish_t::xxrecv (msg_t *msg_)
 {
+    //  A direct UDP endpoint is read on this thread; joins filter locally
+    //  as there is no RADIO session to forward them to.
+    if (udp_direct_t *const direct = udp_direct ()) {
+        while (direct->recv (msg_) == 0)
+            if (matches (msg_))
+                return 0;
+    }
+
     do {
         //  Get a message using fair queueing algorithm.
         const int rc = _fq.recv (msg_);
@@ -167,7 +226,7 @@ int zmq::dish_t::xxrecv (msg_t *msg_)
             return -1;
 
         //  Skip non matching messages
-    } while (0 == _subscriptions.count (std::string (msg_->group ())));
+    } while (!matches (msg_));
 
     //  Found a matching message
     return 0;
@@ -207,6 +266,22 @@ void zmq::dish_t::send_subscriptions (pipe_t *pipe_)
         pipe_->write (&msg);
     }
 
+    for (size_t i = 0, n = _group_ids.capacity (); i < n; ++i) {
+        if (!_group_ids.used (i))
+            continue;
+        char group[group_id_length + 1];
+        encode_group_id (_group_ids.id_at (i), group);
+
+        msg_t msg;
+        int rc = msg.init_join ();
+        errno_assert (rc == 0);
+
+        rc = msg.set_group (group, group_id_length);
+        errno_assert (rc == 0);
+
+        pipe_->write (&msg);
+    }
+
     pipe_->flush ();
 }
 
@@ -10,6 +10,7 @@
 #include "dist.hpp"
 #include "fq.hpp"
 #include "msg.hpp"
+#include "group_id.hpp"
 
 namespace zmq
 {
@@ -36,12 +37,22 @@ class dish_t ZMQ_FINAL : public socket_base_t
     void xwrite_activated (zmq::pipe_t *pipe_);
     void xhiccuped (pipe_t *pipe_);
     void xpipe_terminated (zmq::pipe_t *pipe_);
+    int xsetsockopt (int option_, const void *optval_, size_t optvallen_);
     int xjoin (const char *group_);
     int xleave (const char *group_);
 
   private:
     int xxrecv (zmq::msg_t *msg_);
 
+    //  Check whether msg_ belongs to a joined group.
+    bool matches (const zmq::msg_t *msg_);
+
+    //  Record or drop group_ in the active repository. Return false if
+    //  group_ was already joined (resp. not joined) or is not a valid
+    //  group id in numeric mode.
+    bool add_subscription (const char *group_);
+    bool remove_subscription (const char *group_);
+
     //  Send subscriptions to a pipe
     void send_subscriptions (pipe_t *pipe_);
 
@@ -55,6 +66,12 @@ class dish_t ZMQ_FINAL : public socket_base_t
     typedef std::set<std::string> subscriptions_t;
     subscriptions_t _subscriptions;
 
+    //  The repository of numeric group ids, used instead of _subscriptions
+    //  when ZMQ_GROUP_NUMERIC is set.
+    typedef group_id_table_t<bool> group_ids_t;
+    group_ids_t _group_ids;
+    bool _numeric;
+
     //  If true, 'message' contains a matching message to return on the
     //  next recv call.
     bool _has_message;
@@ -0,0 +1,187 @@
+/* SPDX-License-Identifier: MPL-2.0 */
+
+#ifndef __ZMQ_GROUP_ID_HPP_INCLUDED__
+#define __ZMQ_GROUP_ID_HPP_INCLUDED__
+
+#include <stddef.h>
+#include <vector>
+
+#include "macros.hpp"
+#include "stdint.hpp"
+
+namespace zmq
+{
+//  Numeric RADIO/DISH groups travel on the wire as ordinary groups made of
+//  exactly group_id_length lowercase hex digits, so they interoperate with
+//  string-group peers and every transport unchanged. Sockets running with
+//  ZMQ_GROUP_NUMERIC only ever decode the fixed-width form and filter with
+//  a single integer lookup instead of string compares and tree walks.
+static const size_t group_id_length = 8;
+
+//  Write the fixed-width form of id_ into buf_ (group_id_length bytes plus
+//  the terminating zero).
+inline void encode_group_id (uint32_t id_, char *buf_)
+{
+    static const char digits[] = "0123456789abcdef";
+    for (int i = static_cast<int> (group_id_length) - 1; i >= 0; --i) {
+        buf_[i] = digits[id_ & 0xfu];
+        id_ >>= 4;
+    }
+    buf_[group_id_length] = '\0';
+}
+
+//  Parse a zero-terminated group. Returns false unless group_ is exactly
+//  group_id_length lowercase hex digits, so every id has exactly one
+//  spelling and string-group peers agree with numeric ones.
+inline bool decode_group_id (const char *group_, uint32_t *id_)
+{
+    uint32_t id = 0;
+    uint32_t bad = 0;
+    for (size_t i = 0; i < group_id_length; ++i) {
+        const uint32_t c = static_cast<unsigned char> (group_[i]);
+        const uint32_t digit = c - '0';
+        const uint32_t alpha = c - 'a';
+        const bool is_digit = digit < 10;
+        const bool is_alpha = alpha < 6;
+        bad |= static_cast<uint32_t> (!(is_digit || is_alpha));
+        id = (id << 4) | (is_digit ? digit : alpha + 10);
+        //  Stop before reading past a short group's terminator.
+        if (c == 0)
+            return false;
+    }
+    if (bad || group_[group_id_length] != '\0')
+        return false;
+    *id_ = id;
+    return true;
+}
+
+//  Open-addressing hash table keyed by numeric group id. Linear probing
+//  over a power-of-two slot array with backward-shift deletion, so lookups
+//  never have to skip tombstones and the hot path is one multiply, one
+//  shift and (almost always) one compare.
+template <typename T> class group_id_table_t
+{
+  public:
+    group_id_table_t () : _size (0), _mask (0) {}
+
+    size_t size () const { return _size; }
+    bool empty () const { return _size == 0; }
+
+    //  Returns the value stored for id_, or NULL.
+    T *find (uint32_t id_)
+    {
+        if (_size == 0)
+            return NULL;
+        for (size_t i = slot_for (id_);; i = (i + 1) & _mask) {
+            slot_t &slot = _slots[i];
+            if (!slot.used)
+                return NULL;
+            if (slot.id == id_)
+                return &slot.value;
+        }
+    }
+
+    bool contains (uint32_t id_) { return find (id_) != NULL; }
+
+    //  Returns the value for id_, inserting a default-constructed one if
+    //  needed. inserted_ tells which happened.
+    T &insert (uint32_t id_, bool *inserted_)
+    {
+        //  Keep the load factor at or below 1/2.
+        if ((_size + 1) * 2 > _slots.size ())
+            grow ();
+        size_t i = slot_for (id_);
+        for (; _slots[i].used; i = (i + 1) & _mask) {
+            if (_slots[i].id == id_) {
+                *inserted_ = false;
+                return _slots[i].value;
+            }
+        }
+        _slots[i].used = true;
+        _slots[i].id = id_;
+        _slots[i].value = T ();
+        ++_size;
+        *inserted_ = true;
+        return _slots[i].value;
+    }
+
+    //  Returns false if id_ was not present.
+    bool erase (uint32_t id_)
+    {
+        if (_size == 0)
+            return false;
+        size_t i = slot_for (id_);
+        for (;; i = (i + 1) & _mask) {
+            if (!_slots[i].used)
+                return false;
+            if (_slots[i].id == id_)
+                break;
+        }
+
+        //  Backward-shift the rest of the cluster into the hole.
+        size_t hole = i;
+        for (size_t j = (hole + 1) & _mask; _slots[j].used;
+             j = (j + 1) & _mask) {
+            const size_t home = slot_for (_slots[j].id);
+            //  Move j into the hole unless its home lies cyclically in
+            //  (hole, j].
+            const bool stays = hole <= j ? (hole < home && home <= j)
+                                         : (hole < home || home <= j);
+            if (!stays) {
+                _slots[hole] = _slots[j];
+                hole = j;
+            }
+        }
+        _slots[hole].used = false;
+        _slots[hole].value = T ();
+        --_size;
+        return true;
+    }
+
+    //  Iteration over occupied slots: for (i = 0; i < capacity (); ++i)
+    //  if (used (i)) ... id_at (i) / value_at (i).
+    size_t capacity () const { return _slots.size (); }
+    bool used (size_t i_) const { return _slots[i_].used; }
+    uint32_t id_at (size_t i_) const { return _slots[i_].id; }
+    T &value_at (size_t i_) { return _slots[i_].value; }
+
+  private:
+    struct slot_t
+    {
+        slot_t () : used (false), id (0), value () {}
+        bool used;
+        uint32_t id;
+        T value;
+    };
+
+    size_t slot_for (uint32_t id_) const
+    {
+        //  Fibonacci hashing spreads sequential ids (track ids, region
+        //  numbers) across the table.
+        return static_cast<size_t> (
+                 (static_cast<uint64_t> (id_) * 0x9e3779b97f4a7c15ULL) >> 40)
+               & _mask;
+    }
+
+    void grow ()
+    {
+        std::vector<slot_t> old;
+        old.swap (_slots);
+        _slots.resize (old.empty () ? 16 : old.size () * 2);
+        _mask = _slots.size () - 1;
+        _size = 0;
+        bool inserted;
+        for (size_t i = 0; i < old.size (); ++i)
+            if (old[i].used)
+                insert (old[i].id, &inserted) = old[i].value;
+    }
+
+    std::vector<slot_t> _slots;
+    size_t _size;
+    size_t _mask;
+
+    ZMQ_NON_COPYABLE_NOR_MOVABLE (group_id_table_t)
+};
+}
+
+#endif
@@ -0,0 +1,37 @@
+/* SPDX-License-Identifier: MPL-2.0 */
+
+#ifndef __ZMQ_I_DGRAM_EVENTS_HPP_INCLUDED__
+#define __ZMQ_I_DGRAM_EVENTS_HPP_INCLUDED__
+
+#include <stddef.h>
+
+#include "macros.hpp"
+
+struct sockaddr;
+
+namespace zmq
+{
+// Virtual interface to be exposed by objects that hand datagram I/O on
+// their file descriptor to a completion-based poller (io_uring_t).
+struct i_dgram_events
+{
+    virtual ~i_dgram_events () ZMQ_DEFAULT;
+
+    // Called by I/O thread for each received datagram. Returning false
+    // stops receiving until receiving is started again.
+    virtual bool dgram_in (const char *data_,
+                           size_t size_,
+                           const sockaddr *from_,
+                           size_t from_len_) = 0;
+
+    // Called by I/O thread when send buffers are available again after
+    // all of them were in flight.
+    virtual void dgram_out () = 0;
+
+    // Called by I/O thread when a receive (recv_ true) or a send failed
+    // with errno_. A failed receive is not restarted.
+    virtual void dgram_error (bool recv_, int errno_) = 0;
+};
+}
+
+#endif
@@ -0,0 +1,672 @@
+/* SPDX-License-Identifier: MPL-2.0 */
+
+#include "precompiled.hpp"
+#if defined ZMQ_IOTHREAD_POLLER_USE_IO_URING
+#include "io_uring.hpp"
+
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <new>
+
+#include "macros.hpp"
+#include "err.hpp"
+#include "config.hpp"
+#include "i_poll_events.hpp"
+
+//  The low bits of a request's user_data tell what completed; the rest is
+//  the poll_entry_t or send_slot_t it belongs to. Requests with user_data 0
+//  (cancellations, poll updates) are not looked at.
+enum
+{
+    poll_tag = 1,
+    recv_tag = 2,
+    send_tag = 3,
+    tag_mask = 3
+};
+
+//  One send buffer of an attached handle and its sendmsg arguments.
+struct zmq::io_uring_t::send_slot_t
+{
+    poll_entry_t *pe;
+    msghdr msg;
+    iovec iov;
+    sockaddr_storage addr;
+    char *data;
+};
+
+//  Completion-based datagram I/O state of a handle.
+struct zmq::io_uring_t::dgram_t
+{
+    zmq::i_dgram_events *events;
+    size_t max_size;
+
+    //  Provided buffer ring and the buffers it hands to the kernel; ring is
+    //  NULL if the handle does not receive.
+    void *ring;
+    size_t ring_size;
+    char *recv_buffers;
+    size_t recv_buffer_size;
+    unsigned short bgid;
+    unsigned short ring_tail;
+    msghdr recv_msg;
+    //  The receive is wanted, resp. a multishot receive is in flight.
+    bool recv_wanted;
+    bool recv_armed;
+
+    send_slot_t slots[io_uring_send_buffers];
+    char *send_buffers;
+    send_slot_t *free_slots[io_uring_send_buffers];
+    int free_count;
+    //  dgram_send_buffer found no free buffer since the last dgram_out.
+    bool send_blocked;
+};
+
+static uint64_t make_user_data (void *ptr_, int tag_)
+{
+    return static_cast<uint64_t> (reinterpret_cast<uintptr_t> (ptr_)) | tag_;
+}
+
+static uint32_t poll_events (unsigned int mask_)
+{
+    //  The kernel reads poll32_events as two swapped halfwords on big endian.
+#if defined __BYTE_ORDER__ && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    return (mask_ << 16) | (mask_ >> 16);
+#else
+    return mask_;
+#endif
+}
+
+zmq::io_uring_t::io_uring_t (const zmq::thread_ctx_t &ctx_) :
+    worker_poller_base_t (ctx_), _sqe_tail (0), _next_bgid (0)
+{
+    io_uring_params params;
+    memset (&params, 0, sizeof params);
+    params.flags = IORING_SETUP_CQSIZE | IORING_SETUP_COOP_TASKRUN;
+    params.cq_entries = io_uring_entries * 4;
+    _ring_fd = static_cast<int> (
+      syscall (__NR_io_uring_setup, io_uring_entries, &params));
+    if (_ring_fd == -1 && errno == EINVAL) {
+        //  IORING_SETUP_COOP_TASKRUN is Linux 5.19 or newer.
+        memset (&params, 0, sizeof params);
+        params.flags = IORING_SETUP_CQSIZE;
+        params.cq_entries = io_uring_entries * 4;
+        _ring_fd = static_cast<int> (
+          syscall (__NR_io_uring_setup, io_uring_entries, &params));
+    }
+    errno_assert (_ring_fd != -1);
+    //  Timed waits and no lost completions on a full completion queue.
+    zmq_assert (params.features & IORING_FEAT_EXT_ARG);
+    zmq_assert (params.features & IORING_FEAT_NODROP);
+
+    _sq_ring_size = params.sq_off.array + params.sq_entries * sizeof (unsigned);
+    _cq_ring_size =
+      params.cq_off.cqes + params.cq_entries * sizeof (io_uring_cqe);
+    if (params.features & IORING_FEAT_SINGLE_MMAP) {
+        if (_cq_ring_size > _sq_ring_size)
+            _sq_ring_size = _cq_ring_size;
+        _cq_ring_size = _sq_ring_size;
+    }
+    _sq_ring = mmap (NULL, _sq_ring_size, PROT_READ | PROT_WRITE,
+                     MAP_SHARED | MAP_POPULATE, _ring_fd, IORING_OFF_SQ_RING);
+    errno_assert (_sq_ring != MAP_FAILED);
+    if (params.features & IORING_FEAT_SINGLE_MMAP)
+        _cq_ring = _sq_ring;
+    else {
+        _cq_ring =
+          mmap (NULL, _cq_ring_size, PROT_READ | PROT_WRITE,
+                MAP_SHARED | MAP_POPULATE, _ring_fd, IORING_OFF_CQ_RING);
+        errno_assert (_cq_ring != MAP_FAILED);
+    }
+    _sqes_size = params.sq_entries * sizeof (io_uring_sqe);
+    _sqes = static_cast<io_uring_sqe *> (
+      mmap (NULL, _sqes_size, PROT_READ | PROT_WRITE,
+            MAP_SHARED | MAP_POPULATE, _ring_fd, IORING_OFF_SQES));
+    errno_assert (_sqes != MAP_FAILED);
+
+    char *const sq = static_cast<char *> (_sq_ring);
+    char *const cq = static_cast<char *> (_cq_ring);
+    _sq_entries = params.sq_entries;
+    _sq_mask = *reinterpret_cast<unsigned *> (sq + params.sq_off.ring_mask);
+    _sq_head = reinterpret_cast<unsigned *> (sq + params.sq_off.head);
+    _sq_tail = reinterpret_cast<unsigned *> (sq + params.sq_off.tail);
+    _cq_mask = *reinterpret_cast<unsigned *> (cq + params.cq_off.ring_mask);
+    _cq_head = reinterpret_cast<unsigned *> (cq + params.cq_off.head);
+    _cq_tail = reinterpret_cast<unsigned *> (cq + params.cq_off.tail);
+    _cqes = reinterpret_cast<io_uring_cqe *> (cq + params.cq_off.cqes);
+
+    //  Submission queue entry i always goes into array slot i.
+    unsigned *const array =
+      reinterpret_cast<unsigned *> (sq + params.sq_off.array);
+    for (unsigned i = 0; i != _sq_entries; ++i)
+        array[i] = i;
+    _sqe_tail = *_sq_tail;
+}
+
+zmq::io_uring_t::~io_uring_t ()
+{
+    //  Wait till the worker thread exits.
+    stop_worker ();
+
+    for (retired_t::iterator it = _retired.begin (), end = _retired.end ();
+         it != end; ++it) {
+        destroy_entry (*it);
+    }
+    munmap (_sqes, _sqes_size);
+    if (_cq_ring != _sq_ring)
+        munmap (_cq_ring, _cq_ring_size);
+    munmap (_sq_ring, _sq_ring_size);
+    close (_ring_fd);
+}
+
+zmq::io_uring_t::handle_t zmq::io_uring_t::add_fd (fd_t fd_,
+                                                   i_poll_events *events_)
+{
+    check_thread ();
+    poll_entry_t *pe = new (std::nothrow) poll_entry_t;
+    alloc_assert (pe);
+
+    pe->fd = fd_;
+    pe->mask = 0;
+    pe->armed = false;
+    pe->inflight = 0;
+    pe->events = events_;
+    pe->dgram = NULL;
+
+    //  Increase the load metric of the thread.
+    adjust_load (1);
+
+    return pe;
+}
+
+void zmq::io_uring_t::rm_fd (handle_t handle_)
+{
+    check_thread ();
+    poll_entry_t *pe = static_cast<poll_entry_t *> (handle_);
+    pe->fd = retired_fd;
+    pe->mask = 0;
+    if (pe->armed)
+        cancel (make_user_data (pe, poll_tag));
+    if (pe->dgram) {
+        pe->dgram->recv_wanted = false;
+        if (pe->dgram->recv_armed)
+            cancel (make_user_data (pe, recv_tag));
+    }
+    _retired.push_back (pe);
+
+    //  Decrease the load metric of the thread.
+    adjust_load (-1);
+}
+
+void zmq::io_uring_t::set_pollin (handle_t handle_)
+{
+    check_thread ();
+    poll_entry_t *pe = static_cast<poll_entry_t *> (handle_);
+    set_mask (pe, pe->mask | POLLIN);
+}
+
+void zmq::io_uring_t::reset_pollin (handle_t handle_)
+{
+    check_thread ();
+    poll_entry_t *pe = static_cast<poll_entry_t *> (handle_);
+    set_mask (pe, pe->mask & ~static_cast<unsigned int> (POLLIN));
+}
+
+void zmq::io_uring_t::set_pollout (handle_t handle_)
+{
+    check_thread ();
+    poll_entry_t *pe = static_cast<poll_entry_t *> (handle_);
+    set_mask (pe, pe->mask | POLLOUT);
+}
+
+void zmq::io_uring_t::reset_pollout (handle_t handle_)
+{
+    check_thread ();
+    poll_entry_t *pe = static_cast<poll_entry_t *> (handle_);
+    set_mask (pe, pe->mask & ~static_cast<unsigned int> (POLLOUT));
+}
+
+void zmq::io_uring_t::stop ()
+{
+    check_thread ();
+}
+
+int zmq::io_uring_t::max_fds ()
+{
+    return -1;
+}
+
+int zmq::io_uring_t::dgram_attach (handle_t handle_,
+                                   i_dgram_events *events_,
+                                   size_t max_size_,
+                                   bool recv_)
+{
+    check_thread ();
+    poll_entry_t *pe = static_cast<poll_entry_t *> (handle_);
+    zmq_assert (!pe->dgram);
+
+    dgram_t *dgram = new (std::nothrow) dgram_t;
+    alloc_assert (dgram);
+    dgram->events = events_;
+    dgram->max_size = max_size_;
+    dgram->ring = NULL;
+    dgram->ring_size = 0;
+    dgram->recv_buffers = NULL;
+    dgram->recv_buffer_size = 0;
+    dgram->bgid = 0;
+    dgram->ring_tail = 0;
+    memset (&dgram->recv_msg, 0, sizeof dgram->recv_msg);
+    dgram->recv_wanted = false;
+    dgram->recv_armed = false;
+    dgram->send_blocked = false;
+
+    if (recv_) {
+        dgram->ring_size = io_uring_recv_buffers * sizeof (io_uring_buf);
+        dgram->ring = mmap (NULL, dgram->ring_size, PROT_READ | PROT_WRITE,
+                            MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        errno_assert (dgram->ring != MAP_FAILED);
+
+        io_uring_buf_reg reg;
+        memset (&reg, 0, sizeof reg);
+        reg.ring_addr = reinterpret_cast<uintptr_t> (dgram->ring);
+        reg.ring_entries = io_uring_recv_buffers;
+        reg.bgid = _next_bgid;
+        const long rc = syscall (__NR_io_uring_register, _ring_fd,
+                                 IORING_REGISTER_PBUF_RING, &reg, 1);
+        if (rc == -1) {
+            //  Provided buffer rings are Linux 5.19 or newer.
+            munmap (dgram->ring, dgram->ring_size);
+            LIBZMQ_DELETE (dgram);
+            return -1;
+        }
+        dgram->bgid = _next_bgid++;
+
+        //  Each buffer takes the recvmsg header, the source address and
+        //  the payload, in this order.
+        dgram->recv_msg.msg_namelen = sizeof (sockaddr_storage);
+        dgram->recv_buffer_size = sizeof (io_uring_recvmsg_out)
+                                  + sizeof (sockaddr_storage) + max_size_;
+        dgram->recv_buffers = static_cast<char *> (
+          malloc (io_uring_recv_buffers * dgram->recv_buffer_size));
+        alloc_assert (dgram->recv_buffers);
+        for (unsigned int bid = 0; bid != io_uring_recv_buffers; ++bid)
+            recycle_buffer (dgram, bid);
+    }
+
+    dgram->send_buffers =
+      static_cast<char *> (malloc (io_uring_send_buffers * max_size_));
+    alloc_assert (dgram->send_buffers);
+    for (int i = 0; i != io_uring_send_buffers; ++i) {
+        send_slot_t *const slot = &dgram->slots[i];
+        slot->pe = pe;
+        slot->data = dgram->send_buffers + i * max_size_;
+        memset (&slot->msg, 0, sizeof slot->msg);
+        slot->msg.msg_name = &slot->addr;
+        slot->msg.msg_iov = &slot->iov;
+        slot->msg.msg_iovlen = 1;
+        slot->iov.iov_base = slot->data;
+        slot->iov.iov_len = 0;
+        dgram->free_slots[io_uring_send_buffers - 1 - i] = slot;
+    }
+    dgram->free_count = io_uring_send_buffers;
+
+    pe->dgram = dgram;
+    return 0;
+}
+
+void zmq::io_uring_t::dgram_start_recv (handle_t handle_)
+{
+    check_thread ();
+    poll_entry_t *pe = static_cast<poll_entry_t *> (handle_);
+    zmq_assert (pe->dgram && pe->dgram->ring);
+    pe->dgram->recv_wanted = true;
+    if (!pe->dgram->recv_armed)
+        arm_recv (pe);
+}
+
+void zmq::io_uring_t::dgram_stop_recv (handle_t handle_)
+{
+    check_thread ();
+    poll_entry_t *pe = static_cast<poll_entry_t *> (handle_);
+    zmq_assert (pe->dgram);
+    //  Datagrams that complete before the cancellation are dropped.
+    pe->dgram->recv_wanted = false;
+    if (pe->dgram->recv_armed)
+        cancel (make_user_data (pe, recv_tag));
+}
+
+char *zmq::io_uring_t::dgram_send_buffer (handle_t handle_)
+{
+    check_thread ();
+    dgram_t *const dgram = static_cast<poll_entry_t *> (handle_)->dgram;
+    zmq_assert (dgram);
+    if (dgram->free_count == 0) {
+        dgram->send_blocked = true;
+        return NULL;
+    }
+    return dgram->free_slots[dgram->free_count - 1]->data;
+}
+
+void zmq::io_uring_t::dgram_send (handle_t handle_,
+                                  size_t size_,
+                                  const struct sockaddr *addr_,
+                                  size_t addr_len_)
+{
+    check_thread ();
+    poll_entry_t *pe = static_cast<poll_entry_t *> (handle_);
+    dgram_t *const dgram = pe->dgram;
+    zmq_assert (dgram && dgram->free_count > 0);
+    zmq_assert (size_ <= dgram->max_size);
+    zmq_assert (addr_len_ <= sizeof (sockaddr_storage));
+
+    send_slot_t *const slot = dgram->free_slots[--dgram->free_count];
+    memcpy (&slot->addr, addr_, addr_len_);
+    slot->msg.msg_namelen = static_cast<socklen_t> (addr_len_);
+    slot->iov.iov_len = size_;
+
+    io_uring_sqe *const sqe = get_sqe ();
+    sqe->opcode = IORING_OP_SENDMSG;
+    sqe->fd = pe->fd;
+    sqe->addr = reinterpret_cast<uintptr_t> (&slot->msg);
+    sqe->len = 1;
+    sqe->user_data = make_user_data (slot, send_tag);
+    pe->inflight++;
+}
+
+io_uring_sqe *zmq::io_uring_t::get_sqe ()
+{
+    if (_sqe_tail - __atomic_load_n (_sq_head, __ATOMIC_ACQUIRE)
+        == _sq_entries) {
+        //  Submission queue is full, submit without waiting.
+        enter (false, 0);
+        zmq_assert (_sqe_tail - __atomic_load_n (_sq_head, __ATOMIC_ACQUIRE)
+                    < _sq_entries);
+    }
+    io_uring_sqe *const sqe = &_sqes[_sqe_tail & _sq_mask];
+    memset (sqe, 0, sizeof (io_uring_sqe));
+    _sqe_tail++;
+    return sqe;
+}
+
+void zmq::io_uring_t::enter (bool wait_, int timeout_)
+{
+    __atomic_store_n (_sq_tail, _sqe_tail, __ATOMIC_RELEASE);
+    const unsigned int to_submit =
+      _sqe_tail - __atomic_load_n (_sq_head, __ATOMIC_ACQUIRE);
+
+    unsigned int flags = 0;
+    io_uring_getevents_arg arg;
+    __kernel_timespec ts;
+    if (wait_) {
+        flags = IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG;
+        memset (&arg, 0, sizeof arg);
+        arg.sigmask_sz = _NSIG / 8;
+        if (timeout_ > 0) {
+            ts.tv_sec = timeout_ / 1000;
+            ts.tv_nsec = (timeout_ % 1000) * 1000000LL;
+            arg.ts = reinterpret_cast<uintptr_t> (&ts);
+        }
+    }
+    const long rc =
+      syscall (__NR_io_uring_enter, _ring_fd, to_submit, wait_ ? 1 : 0, flags,
+               wait_ ? &arg : NULL, wait_ ? sizeof arg : 0);
+    if (rc == -1)
+        errno_assert (errno == EINTR || errno == ETIME || errno == EBUSY
+                      || errno == EAGAIN);
+}
+
+void zmq::io_uring_t::set_mask (poll_entry_t *pe_, unsigned int mask_)
+{
+    if (pe_->mask == mask_)
+        return;
+    pe_->mask = mask_;
+    if (!pe_->armed) {
+        if (mask_)
+            arm_poll (pe_);
+        return;
+    }
+    io_uring_sqe *const sqe = get_sqe ();
+    sqe->opcode = IORING_OP_POLL_REMOVE;
+    sqe->fd = -1;
+    sqe->addr = make_user_data (pe_, poll_tag);
+    if (mask_) {
+        //  Update the request in place. If it has completed meanwhile the
+        //  update fails and the completion re-arms with the new mask.
+        sqe->len = IORING_POLL_UPDATE_EVENTS;
+        sqe->poll32_events = poll_events (mask_);
+    }
+}
+
+void zmq::io_uring_t::arm_poll (poll_entry_t *pe_)
+{
+    io_uring_sqe *const sqe = get_sqe ();
+    sqe->opcode = IORING_OP_POLL_ADD;
+    sqe->fd = pe_->fd;
+    sqe->poll32_events = poll_events (pe_->mask);
+    sqe->user_data = make_user_data (pe_, poll_tag);
+    pe_->armed = true;
+    pe_->inflight++;
+}
+
+void zmq::io_uring_t::cancel (uint64_t user_data_)
+{
+    io_uring_sqe *const sqe = get_sqe ();
+    sqe->opcode = IORING_OP_ASYNC_CANCEL;
+    sqe->fd = -1;
+    sqe->addr = user_data_;
+}
+
+void zmq::io_uring_t::arm_recv (poll_entry_t *pe_)
+{
+    dgram_t *const dgram = pe_->dgram;
+    io_uring_sqe *const sqe = get_sqe ();
+    sqe->opcode = IORING_OP_RECVMSG;
+    sqe->fd = pe_->fd;
+    sqe->addr = reinterpret_cast<uintptr_t> (&dgram->recv_msg);
+    sqe->len = 1;
+    sqe->ioprio = IORING_RECV_MULTISHOT;
+    sqe->flags = IOSQE_BUFFER_SELECT;
+    sqe->buf_group = dgram->bgid;
+    sqe->user_data = make_user_data (pe_, recv_tag);
+    dgram->recv_armed = true;
+    pe_->inflight++;
+}
+
+void zmq::io_uring_t::recycle_buffer (dgram_t *dgram_, unsigned int bid_)
+{
+    //  The ring tail overlays the reserved field of the first entry.
+    io_uring_buf *const bufs = static_cast<io_uring_buf *> (dgram_->ring);
+    io_uring_buf *const buf =
+      &bufs[dgram_->ring_tail & (io_uring_recv_buffers - 1)];
+    buf->addr =
+      reinterpret_cast<uintptr_t> (dgram_->recv_buffers
+                                   + bid_ * dgram_->recv_buffer_size);
+    buf->len = static_cast<uint32_t> (dgram_->recv_buffer_size);
+    buf->bid = static_cast<uint16_t> (bid_);
+    dgram_->ring_tail++;
+    __atomic_store_n (&bufs[0].resv, dgram_->ring_tail, __ATOMIC_RELEASE);
+}
+
+void zmq::io_uring_t::poll_completion (poll_entry_t *pe_, int res_)
+{
+    pe_->armed = false;
+    pe_->inflight--;
+    if (pe_->fd == retired_fd)
+        return;
+
+    //  A negative result is a removal after the interest was dropped.
+    if (res_ >= 0) {
+        const unsigned int revents = static_cast<unsigned int> (res_);
+        if (revents & (POLLERR | POLLHUP))
+            pe_->events->in_event ();
+        if (pe_->fd == retired_fd)
+            return;
+        if ((revents & POLLOUT) && (pe_->mask & POLLOUT))
+            pe_->events->out_event ();
+        if (pe_->fd == retired_fd)
+            return;
+        if ((revents & POLLIN) && (pe_->mask & POLLIN))
+            pe_->events->in_event ();
+        if (pe_->fd == retired_fd)
+            return;
+    }
+
+    //  Still interested: poll again, which reports at once if the fd is
+    //  still ready.
+    if (!pe_->armed && pe_->mask)
+        arm_poll (pe_);
+}
+
+void zmq::io_uring_t::recv_completion (poll_entry_t *pe_,
+                                       int res_,
+                                       unsigned int flags_)
+{
+    dgram_t *const dgram = pe_->dgram;
+
+    if (flags_ & IORING_CQE_F_BUFFER) {
+        const unsigned int bid = flags_ >> IORING_CQE_BUFFER_SHIFT;
+        const char *const buffer =
+          dgram->recv_buffers + bid * dgram->recv_buffer_size;
+        if (res_ >= 0 && dgram->recv_wanted) {
+            const io_uring_recvmsg_out *const out =
+              reinterpret_cast<const io_uring_recvmsg_out *> (buffer);
+            const char *const name = buffer + sizeof (io_uring_recvmsg_out);
+            size_t name_len = out->namelen;
+            if (name_len > dgram->recv_msg.msg_namelen)
+                name_len = dgram->recv_msg.msg_namelen;
+            //  Truncated datagrams are delivered truncated, as recvfrom does.
+            size_t size = out->payloadlen;
+            if (size > dgram->max_size)
+                size = dgram->max_size;
+            if (!dgram->events->dgram_in (
+                  name + dgram->recv_msg.msg_namelen, size,
+                  reinterpret_cast<const sockaddr *> (name), name_len))
+                dgram_stop_recv (pe_);
+        }
+        recycle_buffer (dgram, bid);
+    }
+
+    if (flags_ & IORING_CQE_F_MORE)
+        return;
+
+    //  The multishot receive has ended: cancelled, out of buffers (they
+    //  are all recycled by now) or failed.
+    dgram->recv_armed = false;
+    pe_->inflight--;
+    if (!dgram->recv_wanted)
+        return;
+    if (res_ < 0 && res_ != -ENOBUFS && res_ != -ECANCELED) {
+        dgram->recv_wanted = false;
+        dgram->events->dgram_error (true, -res_);
+        return;
+    }
+    arm_recv (pe_);
+}
+
+void zmq::io_uring_t::send_completion (send_slot_t *slot_, int res_)
+{
+    poll_entry_t *const pe = slot_->pe;
+    dgram_t *const dgram = pe->dgram;
+    dgram->free_slots[dgram->free_count++] = slot_;
+    pe->inflight--;
+    if (pe->fd == retired_fd)
+        return;
+
+    //  A full socket buffer drops the datagram, like sendto on the
+    //  non-blocking socket does.
+    if (res_ < 0 && res_ != -EAGAIN) {
+        dgram->events->dgram_error (false, -res_);
+        if (pe->fd == retired_fd)
+            return;
+    }
+    if (dgram->send_blocked) {
+        dgram->send_blocked = false;
+        dgram->events->dgram_out ();
+    }
+}
+
+void zmq::io_uring_t::destroy_entry (poll_entry_t *pe_)
+{
+    dgram_t *dgram = pe_->dgram;
+    if (dgram) {
+        if (dgram->ring) {
+            io_uring_buf_reg reg;
+            memset (&reg, 0, sizeof reg);
+            reg.bgid = dgram->bgid;
+            syscall (__NR_io_uring_register, _ring_fd,
+                     IORING_UNREGISTER_PBUF_RING, &reg, 1);
+            munmap (dgram->ring, dgram->ring_size);
+            free (dgram->recv_buffers);
+        }
+        free (dgram->send_buffers);
+        LIBZMQ_DELETE (dgram);
+    }
+    LIBZMQ_DELETE (pe_);
+}
+
+void zmq::io_uring_t::loop ()
+{
+    while (true) {
+        //  Execute any due timers.
+        const int timeout = static_cast<int> (execute_timers ());
+
+        //  Destroy retired event sources whose requests have completed.
+        //  The others keep the loop alive until they have.
+        retired_t::iterator keep = _retired.begin ();
+        for (retired_t::iterator it = _retired.begin (), end = _retired.end ();
+             it != end; ++it) {
+            if ((*it)->inflight == 0)
+                destroy_entry (*it);
+            else
+                *keep++ = *it;
+        }
+        _retired.erase (keep, _retired.end ());
+
+        if (get_load () == 0 && _retired.empty ()) {
+            if (timeout == 0)
+                break;
+
+            // TODO sleep for timeout
+            continue;
+        }
+
+        //  Submit the requests queued since the last wait and wait for
+        //  completions.
+        enter (true, timeout);
+
+        unsigned int head = *_cq_head;
+        const unsigned int tail = __atomic_load_n (_cq_tail, __ATOMIC_ACQUIRE);
+        while (head != tail) {
+            const io_uring_cqe *const cqe = &_cqes[head & _cq_mask];
+            const uint64_t user_data = cqe->user_data;
+            const int res = cqe->res;
+            const unsigned int flags = cqe->flags;
+            __atomic_store_n (_cq_head, ++head, __ATOMIC_RELEASE);
+
+            void *const ptr = reinterpret_cast<void *> (
+              static_cast<uintptr_t> (user_data & ~uint64_t (tag_mask)));
+            switch (user_data & tag_mask) {
+                case poll_tag:
+                    poll_completion (static_cast<poll_entry_t *> (ptr), res);
+                    break;
+                case recv_tag:
+                    recv_completion (static_cast<poll_entry_t *> (ptr), res,
+                                     flags);
+                    break;
+                case send_tag:
+                    send_completion (static_cast<send_slot_t *> (ptr), res);
+                    break;
+                default:
+                    break;
+            }
+        }
+
+    }
+}
+
+#endif
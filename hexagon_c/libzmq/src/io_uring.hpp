@@ -0,0 +1,159 @@
+/* SPDX-License-Identifier: MPL-2.0 */
+
+#ifndef __ZMQ_IO_URING_HPP_INCLUDED__
+#define __ZMQ_IO_URING_HPP_INCLUDED__
+
+//  poller.hpp decides which polling mechanism to use.
+#include "poller.hpp"
+#if defined ZMQ_IOTHREAD_POLLER_USE_IO_URING
+
+#include <stddef.h>
+#include <vector>
+
+#include <linux/io_uring.h>
+
+#include "ctx.hpp"
+#include "fd.hpp"
+#include "thread.hpp"
+#include "poller_base.hpp"
+#include "i_dgram_events.hpp"
+
+namespace zmq
+{
+struct i_poll_events;
+
+//  This class implements socket polling mechanism using the Linux-specific
+//  io_uring interface (Linux 5.13 or newer).
+//
+//  Readiness is reported through one-shot IORING_OP_POLL_ADD requests that
+//  are re-armed after each event while the interest persists, which keeps
+//  the level-triggered contract of the other pollers. All requests queued
+//  while handling events are submitted together with the next wait, so one
+//  io_uring_enter per loop iteration does both.
+//
+//  On top of that, a handle can be switched to completion-based datagram
+//  I/O (dgram_*), which udp_engine_t uses: a multishot IORING_OP_RECVMSG
+//  receives into a ring of provided buffers (Linux 6.0 or newer) with no
+//  syscall per datagram, and sends are queued as IORING_OP_SENDMSG requests
+//  into a fixed set of send buffers and submitted in batches.
+
+class io_uring_t ZMQ_FINAL : public worker_poller_base_t
+{
+  public:
+    typedef void *handle_t;
+
+    io_uring_t (const thread_ctx_t &ctx_);
+    ~io_uring_t () ZMQ_OVERRIDE;
+
+    //  "poller" concept.
+    handle_t add_fd (fd_t fd_, zmq::i_poll_events *events_);
+    void rm_fd (handle_t handle_);
+    void set_pollin (handle_t handle_);
+    void reset_pollin (handle_t handle_);
+    void set_pollout (handle_t handle_);
+    void reset_pollout (handle_t handle_);
+    void stop ();
+
+    static int max_fds ();
+
+    //  Completion-based datagram I/O for handle_, reported to events_.
+    //  Sets up send buffers of max_size_ bytes and, if recv_, a ring of
+    //  receive buffers of the same size. Returns -1 if the running kernel
+    //  has no provided buffer rings; the handle then stays on readiness.
+    int dgram_attach (handle_t handle_,
+                      zmq::i_dgram_events *events_,
+                      size_t max_size_,
+                      bool recv_);
+
+    //  Start and stop the multishot receive on an attached handle.
+    void dgram_start_recv (handle_t handle_);
+    void dgram_stop_recv (handle_t handle_);
+
+    //  Returns a free send buffer of an attached handle, or NULL if all of
+    //  them are in flight; dgram_out is called once one is free again.
+    char *dgram_send_buffer (handle_t handle_);
+
+    //  Queues the buffer returned by dgram_send_buffer for sending size_
+    //  bytes of it to addr_.
+    void dgram_send (handle_t handle_,
+                     size_t size_,
+                     const struct sockaddr *addr_,
+                     size_t addr_len_);
+
+  private:
+    struct dgram_t;
+    struct send_slot_t;
+
+    struct poll_entry_t
+    {
+        fd_t fd;
+        //  POLLIN/POLLOUT currently requested.
+        unsigned int mask;
+        //  A poll request is in flight.
+        bool armed;
+        //  Requests whose completion is still due; a retired entry is
+        //  destroyed once there are none.
+        int inflight;
+        zmq::i_poll_events *events;
+        dgram_t *dgram;
+    };
+
+    //  Main event loop.
+    void loop () ZMQ_OVERRIDE;
+
+    //  Returns the next free submission queue entry, cleared.
+    io_uring_sqe *get_sqe ();
+
+    //  Submits queued requests and, if wait_ is set, waits up to timeout_
+    //  ms (0 for no limit) for a completion.
+    void enter (bool wait_, int timeout_);
+
+    void set_mask (poll_entry_t *pe_, unsigned int mask_);
+    void arm_poll (poll_entry_t *pe_);
+    void cancel (uint64_t user_data_);
+    void arm_recv (poll_entry_t *pe_);
+    void recycle_buffer (dgram_t *dgram_, unsigned int bid_);
+
+    void poll_completion (poll_entry_t *pe_, int res_);
+    void recv_completion (poll_entry_t *pe_, int res_, unsigned int flags_);
+    void send_completion (send_slot_t *slot_, int res_);
+
+    void destroy_entry (poll_entry_t *pe_);
+
+    //  The ring and its shared memory.
+    int _ring_fd;
+    void *_sq_ring;
+    size_t _sq_ring_size;
+    void *_cq_ring;
+    size_t _cq_ring_size;
+    io_uring_sqe *_sqes;
+    size_t _sqes_size;
+
+    unsigned int _sq_entries;
+    unsigned int _sq_mask;
+    unsigned int *_sq_head;
+    unsigned int *_sq_tail;
+    unsigned int _cq_mask;
+    unsigned int *_cq_head;
+    unsigned int *_cq_tail;
+    io_uring_cqe *_cqes;
+
+    //  Tail of the submission queue including not yet submitted entries.
+    unsigned int _sqe_tail;
+
+    //  Buffer group id for the next receive buffer ring.
+    unsigned short _next_bgid;
+
+    //  List of retired event sources.
+    typedef std::vector<poll_entry_t *> retired_t;
+    retired_t _retired;
+
+    ZMQ_NON_COPYABLE_NOR_MOVABLE (io_uring_t)
+};
+
+typedef io_uring_t poller_t;
+}
+
+#endif
+
+#endif
@@ -238,7 +238,10 @@ zmq::options_t::options_t () :
     norm_num_parity (4),
     norm_num_autoparity (0),
     norm_push_enable (false),
-    busy_poll (0)
+    busy_poll (0),
+    prefer_busy_poll (false),
+    incoming_cpu (-1),
+    udp_direct (false)
 {
     memset (curve_public_key, 0, CURVE_KEYSIZE);
     memset (curve_secret_key, 0, CURVE_KEYSIZE);
@@ -792,6 +795,21 @@ int zmq::options_t::setsockopt (int option_,
                 return 0;
             }
             break;
+
+        case ZMQ_PREFER_BUSY_POLL:
+            return do_setsockopt_int_as_bool_relaxed (optval_, optvallen_,
+                                                      &prefer_busy_poll);
+
+        case ZMQ_INCOMING_CPU:
+            if (is_int && value >= -1) {
+                incoming_cpu = value;
+                return 0;
+            }
+            break;
+
+        case ZMQ_UDP_DIRECT:
+            return do_setsockopt_int_as_bool_relaxed (optval_, optvallen_,
+                                                      &udp_direct);
 #ifdef ZMQ_HAVE_WSS
         case ZMQ_WSS_KEY_PEM:
             // TODO: check if valid certificate
@@ -1343,6 +1361,28 @@ int zmq::options_t::getsockopt (int option_,
         case ZMQ_BUSY_POLL:
             if (is_int) {
                 *value = busy_poll;
+                return 0;
+            }
+            break;
+
+        case ZMQ_PREFER_BUSY_POLL:
+            if (is_int) {
+                *value = prefer_busy_poll;
+                return 0;
+            }
+            break;
+
+        case ZMQ_INCOMING_CPU:
+            if (is_int) {
+                *value = incoming_cpu;
+                return 0;
+            }
+            break;
+
+        case ZMQ_UDP_DIRECT:
+            if (is_int) {
+                *value = udp_direct;
+                return 0;
             }
             break;
 
@@ -298,6 +298,17 @@ struct options_t
 
     //  This option removes several delays caused by scheduling, interrupts and context switching.
     int busy_poll;
+
+    //  Busy poll the socket even while the application is not waiting on
+    //  it, keeping the device's interrupts masked (SO_PREFER_BUSY_POLL).
+    bool prefer_busy_poll;
+
+    //  CPU whose receive queue should deliver to the socket, -1 for any.
+    int incoming_cpu;
+
+    //  RADIO/DISH drive their UDP socket from the application thread
+    //  instead of an I/O thread.
+    bool udp_direct;
 };
 
 inline bool get_effective_conflate_option (const options_t &options)
@@ -5,6 +5,7 @@
 
 #if defined ZMQ_IOTHREAD_POLLER_USE_KQUEUE                                     \
     + defined ZMQ_IOTHREAD_POLLER_USE_EPOLL                                    \
+    + defined ZMQ_IOTHREAD_POLLER_USE_IO_URING                                 \
     + defined ZMQ_IOTHREAD_POLLER_USE_DEVPOLL                                  \
     + defined ZMQ_IOTHREAD_POLLER_USE_POLLSET                                  \
     + defined ZMQ_IOTHREAD_POLLER_USE_POLL                                     \
@@ -17,6 +18,8 @@
 #include "kqueue.hpp"
 #elif defined ZMQ_IOTHREAD_POLLER_USE_EPOLL
 #include "epoll.hpp"
+#elif defined ZMQ_IOTHREAD_POLLER_USE_IO_URING
+#include "io_uring.hpp"
 #elif defined ZMQ_IOTHREAD_POLLER_USE_DEVPOLL
 #include "devpoll.hpp"
 #elif defined ZMQ_IOTHREAD_POLLER_USE_POLLSET
@@ -17,8 +17,8 @@ struct i_poll_events;
 // convention, this is done via a typedef.
 //
 // At the time of writing, the following implementations of the poller_t
-// concept exist: zmq::devpoll_t, zmq::epoll_t, zmq::kqueue_t, zmq::poll_t,
-// zmq::pollset_t, zmq::select_t
+// concept exist: zmq::devpoll_t, zmq::epoll_t, zmq::io_uring_t, zmq::kqueue_t,
+// zmq::poll_t, zmq::pollset_t, zmq::select_t
 //
 // An implementation of the poller_t concept must provide the following public
 // methods:
@@ -8,9 +8,10 @@
 #include "pipe.hpp"
 #include "err.hpp"
 #include "msg.hpp"
+#include "udp_direct.hpp"
 
 zmq::radio_t::radio_t (class ctx_t *parent_, uint32_t tid_, int sid_) :
-    socket_base_t (parent_, tid_, sid_, true), _lossy (true)
+    socket_base_t (parent_, tid_, sid_, true), _numeric (false), _lossy (true)
 {
     options.type = ZMQ_RADIO;
 }
@@ -48,26 +49,50 @@ void zmq::radio_t::xread_activated (pipe_t *pipe_)
     msg_t msg;
     while (pipe_->read (&msg)) {
         //  Apply the subscription to the trie
-        if (msg.is_join () || msg.is_leave ()) {
-            std::string group = std::string (msg.group ());
-
-            if (msg.is_join ())
-                _subscriptions.ZMQ_MAP_INSERT_OR_EMPLACE (ZMQ_MOVE (group),
-                                                          pipe_);
-            else {
-                std::pair<subscriptions_t::iterator, subscriptions_t::iterator>
-                  range = _subscriptions.equal_range (group);
-
-                for (subscriptions_t::iterator it = range.first;
-                     it != range.second; ++it) {
-                    if (it->second == pipe_) {
-                        _subscriptions.erase (it);
-                        break;
-                    }
-                }
+        if (msg.is_join () || msg.is_leave ())
+            apply_subscription (msg, pipe_);
+        msg.close ();
+    }
+}
+
+void zmq::radio_t::apply_subscription (const msg_t &msg_, pipe_t *pipe_)
+{
+    if (_numeric) {
+        //  Peers joining non-numeric groups can never be matched here.
+        uint32_t id;
+        if (!decode_group_id (msg_.group (), &id))
+            return;
+
+        if (msg_.is_join ()) {
+            bool inserted;
+            _group_ids.insert (id, &inserted).push_back (pipe_);
+        } else if (pipes_t *pipes = _group_ids.find (id)) {
+            const pipes_t::iterator it =
+              std::find (pipes->begin (), pipes->end (), pipe_);
+            if (it != pipes->end ()) {
+                pipes->erase (it);
+                if (pipes->empty ())
+                    _group_ids.erase (id);
+            }
+        }
+        return;
+    }
+
+    std::string group = std::string (msg_.group ());
+
+    if (msg_.is_join ())
+        _subscriptions.ZMQ_MAP_INSERT_OR_EMPLACE (ZMQ_MOVE (group), pipe_);
+    else {
+        std::pair<subscriptions_t::iterator, subscriptions_t::iterator> range =
+          _subscriptions.equal_range (group);
+
+        for (subscriptions_t::iterator it = range.first; it != range.second;
+             ++it) {
+            if (it->second == pipe_) {
+                _subscriptions.erase (it);
+                break;
             }
         }
-        msg.close ();
     }
 }
 
@@ -85,7 +110,14 @@ int zmq::radio_t::xsetsockopt (int option_,
     }
     if (option_ == ZMQ_XPUB_NODROP)
         _lossy = (*static_cast<const int *> (optval_) == 0);
-    else {
+    else if (option_ == ZMQ_GROUP_NUMERIC) {
+        //  The group representation cannot change under existing joins.
+        if (!_subscriptions.empty () || !_group_ids.empty ()) {
+            errno = EINVAL;
+            return -1;
+        }
+        _numeric = (*static_cast<const int *> (optval_) != 0);
+    } else {
         errno = EINVAL;
         return -1;
     }
@@ -108,6 +140,22 @@ void zmq::radio_t::xpipe_terminated (pipe_t *pipe_)
         }
     }
 
+    for (size_t i = 0; i < _group_ids.capacity (); ++i) {
+        if (!_group_ids.used (i))
+            continue;
+        pipes_t &pipes = _group_ids.value_at (i);
+        const pipes_t::iterator it =
+          std::find (pipes.begin (), pipes.end (), pipe_);
+        if (it == pipes.end ())
+            continue;
+        pipes.erase (it);
+        if (pipes.empty ()) {
+            //  Erasing shifts later entries back into slot i; revisit it.
+            _group_ids.erase (_group_ids.id_at (i));
+            --i;
+        }
+    }
+
     {
         const udp_pipes_t::iterator end = _udp_pipes.end ();
         const udp_pipes_t::iterator it =
@@ -127,13 +175,32 @@ int zmq::radio_t::xsend (msg_t *msg_)
         return -1;
     }
 
-    _dist.unmatch ();
+    //  A direct UDP endpoint sends on this thread. A full socket buffer
+    //  drops the datagram like a full pipe does, unless ZMQ_XPUB_NODROP.
+    udp_direct_t *const direct = udp_direct ();
+    if (direct && direct->send (msg_) != 0
+        && (errno != EAGAIN || !_lossy))
+        return -1;
 
-    const std::pair<subscriptions_t::iterator, subscriptions_t::iterator>
-      range = _subscriptions.equal_range (std::string (msg_->group ()));
+    _dist.unmatch ();
 
-    for (subscriptions_t::iterator it = range.first; it != range.second; ++it)
-        _dist.match (it->second);
+    if (_numeric) {
+        uint32_t id;
+        const pipes_t *pipes =
+          decode_group_id (msg_->group (), &id) ? _group_ids.find (id) : NULL;
+        if (pipes)
+            for (pipes_t::const_iterator it = pipes->begin (),
+                                         end = pipes->end ();
+                 it != end; ++it)
+                _dist.match (*it);
+    } else {
+        const std::pair<subscriptions_t::iterator, subscriptions_t::iterator>
+          range = _subscriptions.equal_range (std::string (msg_->group ()));
+
+        for (subscriptions_t::iterator it = range.first; it != range.second;
+             ++it)
+            _dist.match (it->second);
+    }
 
     for (udp_pipes_t::iterator it = _udp_pipes.begin (),
                                end = _udp_pipes.end ();
@@ -153,6 +220,9 @@ int zmq::radio_t::xsend (msg_t *msg_)
 
 bool zmq::radio_t::xhas_out ()
 {
+    //  Room in the UDP socket buffer shows through ZMQ_FD.
+    if (udp_direct ())
+        return true;
     return _dist.has_out ();
 }
 
@@ -11,6 +11,7 @@
 #include "session_base.hpp"
 #include "dist.hpp"
 #include "msg.hpp"
+#include "group_id.hpp"
 
 namespace zmq
 {
@@ -42,6 +43,16 @@ class radio_t ZMQ_FINAL : public socket_base_t
     typedef std::multimap<std::string, pipe_t *> subscriptions_t;
     subscriptions_t _subscriptions;
 
+    //  Subscriptions keyed by numeric group id, used instead of
+    //  _subscriptions when ZMQ_GROUP_NUMERIC is set.
+    typedef std::vector<pipe_t *> pipes_t;
+    typedef group_id_table_t<pipes_t> group_ids_t;
+    group_ids_t _group_ids;
+    bool _numeric;
+
+    //  Apply a JOIN or LEAVE read from pipe_ to the active repository.
+    void apply_subscription (const msg_t &msg_, pipe_t *pipe_);
+
     //  List of udp pipes
     typedef std::vector<pipe_t *> udp_pipes_t;
     udp_pipes_t _udp_pipes;
@@ -42,6 +42,7 @@
 #include "ipc_address.hpp"
 #include "tcp_address.hpp"
 #include "udp_address.hpp"
+#include "udp_direct.hpp"
 #include "tipc_address.hpp"
 #include "mailbox.hpp"
 #include "mailbox_safe.hpp"
@@ -228,6 +229,7 @@ zmq::socket_base_t::socket_base_t (ctx_t *parent_,
     _monitor_events (0),
     _thread_safe (thread_safe_),
     _reaper_signaler (NULL),
+    _udp_direct (NULL),
     _monitor_sync (),
     _disconnected (false)
 {
@@ -271,6 +273,9 @@ zmq::socket_base_t::~socket_base_t ()
     if (_reaper_signaler)
         LIBZMQ_DELETE (_reaper_signaler);
 
+    if (_udp_direct)
+        LIBZMQ_DELETE (_udp_direct);
+
     scoped_lock_t lock (_monitor_sync);
     stop_monitor ();
 
@@ -398,6 +403,72 @@ void zmq::socket_base_t::attach_pipe (pipe_t *pipe_,
     }
 }
 
+int zmq::socket_base_t::open_udp_direct (const std::string &address_,
+                                         bool bind_)
+{
+    //  The socket has a single UDP socket of its own.
+    if (_udp_direct) {
+        errno = EINVAL;
+        return -1;
+    }
+
+    address_t *paddr = new (std::nothrow)
+      address_t (protocol_name::udp, address_, this->get_ctx ());
+    alloc_assert (paddr);
+
+    paddr->resolved.udp_addr = new (std::nothrow) udp_address_t ();
+    alloc_assert (paddr->resolved.udp_addr);
+    int rc =
+      paddr->resolved.udp_addr->resolve (address_.c_str (), bind_, options.ipv6);
+    if (rc != 0) {
+        LIBZMQ_DELETE (paddr);
+        return -1;
+    }
+
+    udp_direct_t *direct = new (std::nothrow) udp_direct_t (options);
+    alloc_assert (direct);
+
+    rc = direct->init (paddr, !bind_, bind_);
+    if (rc != 0) {
+        const int err = errno;
+        LIBZMQ_DELETE (direct);
+        errno = err;
+        return -1;
+    }
+    _udp_direct = direct;
+
+    //  Save last endpoint URI
+    paddr->to_string (_last_endpoint);
+
+    //  Blocking send and recv wait on the UDP socket and this signaler.
+    add_signaler (_udp_direct->get_signaler ());
+
+    options.connected = true;
+    return 0;
+}
+
+zmq::udp_direct_t *zmq::socket_base_t::udp_direct () const
+{
+    return _udp_direct;
+}
+
+int zmq::socket_base_t::wait_udp_direct (short events_, int timeout_)
+{
+    //  Let other threads use the socket and post commands, which signal
+    //  the endpoint, while this one sleeps.
+    if (_thread_safe)
+        _sync.unlock ();
+    const int rc = _udp_direct->wait (events_, timeout_);
+    const int err = errno;
+    if (_thread_safe)
+        _sync.lock ();
+    if (rc != 0 && err == EINTR) {
+        errno = EINTR;
+        return -1;
+    }
+    return process_commands (0, false);
+}
+
 int zmq::socket_base_t::setsockopt (int option_,
                                     const void *optval_,
                                     size_t optvallen_)
@@ -445,6 +516,11 @@ int zmq::socket_base_t::getsockopt (int option_,
     }
 
     if (option_ == ZMQ_FD) {
+        //  With ZMQ_UDP_DIRECT the application polls the UDP socket.
+        if (_udp_direct)
+            return do_getsockopt<fd_t> (optval_, optvallen_,
+                                        _udp_direct->get_fd ());
+
         if (_thread_safe) {
             // thread safe socket doesn't provide file descriptor
             errno = EINVAL;
@@ -567,6 +643,9 @@ int zmq::socket_base_t::bind (const char *endpoint_uri_)
             return -1;
         }
 
+        if (options.udp_direct && options.type == ZMQ_DISH)
+            return open_udp_direct (address, true);
+
         //  Choose the I/O thread to run the session in.
         io_thread_t *io_thread = choose_io_thread (options.affinity);
         if (!io_thread) {
@@ -884,6 +963,11 @@ int zmq::socket_base_t::connect_internal (const char *endpoint_uri_)
         }
     }
 
+    //  A direct UDP endpoint needs no session, hence no I/O thread.
+    if (protocol == protocol_name::udp && options.udp_direct
+        && options.type == ZMQ_RADIO)
+        return open_udp_direct (address, false);
+
     //  Choose the I/O thread to run the session in.
     io_thread_t *io_thread = choose_io_thread (options.affinity);
     if (!io_thread) {
@@ -1269,7 +1353,9 @@ int zmq::socket_base_t::send (msg_t *msg_, int flags_)
     //  command, process it and try to send the message again.
     //  If timeout is reached in the meantime, return EAGAIN.
     while (true) {
-        if (unlikely (process_commands (timeout, false) != 0)) {
+        if (unlikely ((_udp_direct ? wait_udp_direct (ZMQ_POLLOUT, timeout)
+                                   : process_commands (timeout, false))
+                      != 0)) {
             return -1;
         }
         rc = xsend (msg_);
@@ -1361,7 +1447,11 @@ int zmq::socket_base_t::recv (msg_t *msg_, int flags_)
     //  we are able to fetch a message.
     bool block = (_ticks != 0);
     while (true) {
-        if (unlikely (process_commands (block ? timeout : 0, false) != 0)) {
+        if (block && _udp_direct)
+            rc = wait_udp_direct (ZMQ_POLLIN, timeout);
+        else
+            rc = process_commands (block ? timeout : 0, false);
+        if (unlikely (rc != 0)) {
             return -1;
         }
         rc = xrecv (msg_);
@@ -27,6 +27,7 @@ namespace zmq
 class ctx_t;
 class msg_t;
 class pipe_t;
+class udp_direct_t;
 
 class socket_base_t : public own_t,
                       public array_item_t<>,
@@ -187,6 +188,10 @@ class socket_base_t : public own_t,
 
     int connect_internal (const char *endpoint_uri_);
 
+    //  The UDP endpoint driven from the application thread when
+    //  ZMQ_UDP_DIRECT is set, NULL otherwise.
+    udp_direct_t *udp_direct () const;
+
     // Mutex for synchronize access to the socket in thread safe mode
     mutex_t _sync;
 
@@ -257,6 +262,13 @@ class socket_base_t : public own_t,
     //  bind, is available and compatible with the socket type.
     int check_protocol (const std::string &protocol_) const;
 
+    //  Opens the ZMQ_UDP_DIRECT endpoint for a udp:// address.
+    int open_udp_direct (const std::string &address_, bool bind_);
+
+    //  Blocks for up to timeout_ ms until the direct UDP endpoint is ready
+    //  for events_ or a command arrives, then processes the commands.
+    int wait_udp_direct (short events_, int timeout_);
+
     //  Register the pipe with this socket.
     void attach_pipe (zmq::pipe_t *pipe_,
                       bool subscribe_to_all_ = false,
@@ -321,6 +333,9 @@ class socket_base_t : public own_t,
     // Signaler to be used in the reaping stage
     signaler_t *_reaper_signaler;
 
+    // UDP endpoint owned by the application thread (ZMQ_UDP_DIRECT)
+    udp_direct_t *_udp_direct;
+
     // Mutex to synchronize access to the monitor Pair socket
     mutex_t _monitor_sync;
 
@@ -0,0 +1,245 @@
+/* SPDX-License-Identifier: MPL-2.0 */
+
+#include "precompiled.hpp"
+#include "polling_util.hpp"
+
+#if !defined ZMQ_HAVE_WINDOWS
+#include <sys/types.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#ifdef ZMQ_HAVE_VXWORKS
+#include <sockLib.h>
+#endif
+#if defined ZMQ_POLL_BASED_ON_POLL && !defined ZMQ_HAVE_AIX
+#include <poll.h>
+#endif
+#endif
+
+#include <string.h>
+
+#include "udp_direct.hpp"
+#include "udp_address.hpp"
+#include "address.hpp"
+#include "msg.hpp"
+#include "err.hpp"
+#include "ip.hpp"
+
+zmq::udp_direct_t::udp_direct_t (const options_t &options_) :
+    _options (options_),
+    _address (NULL),
+    _fd (retired_fd),
+    _out_address (NULL),
+    _out_address_len (0)
+{
+}
+
+zmq::udp_direct_t::~udp_direct_t ()
+{
+    if (_fd != retired_fd) {
+#ifdef ZMQ_HAVE_WINDOWS
+        const int rc = closesocket (_fd);
+        wsa_assert (rc != SOCKET_ERROR);
+#else
+        const int rc = close (_fd);
+        errno_assert (rc == 0);
+#endif
+        _fd = retired_fd;
+    }
+    LIBZMQ_DELETE (_address);
+}
+
+int zmq::udp_direct_t::init (address_t *address_, bool send_, bool recv_)
+{
+    zmq_assert (address_);
+    zmq_assert (send_ != recv_);
+    _address = address_;
+
+    if (!_signaler.valid ()) {
+        errno = EMFILE;
+        return -1;
+    }
+
+    const udp_address_t *const udp_addr = _address->resolved.udp_addr;
+
+    _fd = open_socket (udp_addr->family (), SOCK_DGRAM, IPPROTO_UDP);
+    if (_fd == retired_fd)
+        return -1;
+
+    unblock_socket (_fd);
+
+    if (!_options.bound_device.empty ()) {
+        const int rc = bind_to_device (_fd, _options.bound_device);
+        if (rc != 0) {
+            assert_success_or_recoverable (_fd, rc);
+            return -1;
+        }
+    }
+
+    if (send_) {
+        const ip_addr_t *out = udp_addr->target_addr ();
+        _out_address = out->as_sockaddr ();
+        _out_address_len = out->sockaddr_len ();
+    }
+
+    return udp_engine_t::setup_socket (_fd, _options, udp_addr, send_,
+                                       recv_);
+}
+
+zmq::fd_t zmq::udp_direct_t::get_fd () const
+{
+    return _fd;
+}
+
+zmq::signaler_t *zmq::udp_direct_t::get_signaler ()
+{
+    return &_signaler;
+}
+
+int zmq::udp_direct_t::send (msg_t *msg_)
+{
+    //  Same layout as udp_engine_t::pull_datagram: the group's length,
+    //  the group and the body.
+    const char *group = msg_->group ();
+    const size_t group_size = strlen (group);
+    const size_t body_size = msg_->size ();
+    const size_t size = 1 + group_size + body_size;
+    if (size > MAX_UDP_MSG) {
+        errno = EMSGSIZE;
+        return -1;
+    }
+
+    _out_buffer[0] = static_cast<char> (group_size);
+    memcpy (_out_buffer + 1, group, group_size);
+    memcpy (_out_buffer + 1 + group_size, msg_->data (), body_size);
+
+#ifdef ZMQ_HAVE_WINDOWS
+    const int rc = sendto (_fd, _out_buffer, static_cast<int> (size), 0,
+                           _out_address, _out_address_len);
+    if (rc == SOCKET_ERROR) {
+        const int last_error = WSAGetLastError ();
+        if (last_error == WSAEWOULDBLOCK || last_error == WSAENOBUFS) {
+            errno = EAGAIN;
+            return -1;
+        }
+        //  Anything else loses this datagram only, as in the UDP engine.
+        assert_success_or_recoverable (_fd, rc);
+    }
+#else
+#ifdef ZMQ_HAVE_VXWORKS
+    const int rc = sendto (_fd, reinterpret_cast<caddr_t> (_out_buffer), size,
+                           0, (sockaddr *) _out_address, _out_address_len);
+#else
+    const ssize_t rc =
+      sendto (_fd, _out_buffer, size, 0, _out_address, _out_address_len);
+#endif
+    if (rc < 0) {
+        if (errno == EAGAIN || errno == EWOULDBLOCK || errno == ENOBUFS) {
+            errno = EAGAIN;
+            return -1;
+        }
+        //  Anything else loses this datagram only, as in the UDP engine.
+        assert_success_or_recoverable (_fd, static_cast<int> (rc));
+    }
+#endif
+    return 0;
+}
+
+int zmq::udp_direct_t::recv (msg_t *msg_)
+{
+    while (true) {
+        const int nbytes = static_cast<int> (
+          recvfrom (_fd, _in_buffer, MAX_UDP_MSG, 0, NULL, NULL));
+        if (nbytes < 0) {
+#ifdef ZMQ_HAVE_WINDOWS
+            if (WSAGetLastError () != WSAEWOULDBLOCK)
+                assert_success_or_recoverable (_fd, nbytes);
+#else
+            if (errno != EAGAIN && errno != EWOULDBLOCK)
+                assert_success_or_recoverable (_fd, nbytes);
+#endif
+            errno = EAGAIN;
+            return -1;
+        }
+
+        //  Skip datagrams too short for the group they announce.
+        const int group_size =
+          nbytes > 0 ? static_cast<unsigned char> (_in_buffer[0]) : 0;
+        if (nbytes == 0 || nbytes - 1 < group_size)
+            continue;
+
+        const int body_size = nbytes - 1 - group_size;
+        int rc = msg_->close ();
+        errno_assert (rc == 0);
+        rc = msg_->init_size (body_size);
+        errno_assert (rc == 0);
+        memcpy (msg_->data (), _in_buffer + 1 + group_size, body_size);
+        rc = msg_->set_group (_in_buffer + 1, group_size);
+        errno_assert (rc == 0);
+        return 0;
+    }
+}
+
+int zmq::udp_direct_t::wait (short events_, int timeout_)
+{
+    const fd_t signaler_fd = _signaler.get_fd ();
+    bool ready = false;
+
+#if defined ZMQ_POLL_BASED_ON_POLL
+    pollfd items[2];
+    items[0].fd = _fd;
+    items[0].events = events_ == ZMQ_POLLOUT ? POLLOUT : POLLIN;
+    items[0].revents = 0;
+    items[1].fd = signaler_fd;
+    items[1].events = POLLIN;
+    items[1].revents = 0;
+    const int rc = poll (items, 2, timeout_);
+    if (rc < 0) {
+        errno_assert (errno == EINTR);
+        return -1;
+    }
+    ready = rc > 0;
+#elif defined ZMQ_POLL_BASED_ON_SELECT
+    optimized_fd_set_t inset (2);
+    optimized_fd_set_t outset (1);
+    FD_ZERO (inset.get ());
+    FD_ZERO (outset.get ());
+    if (events_ == ZMQ_POLLOUT)
+        FD_SET (_fd, outset.get ());
+    else
+        FD_SET (_fd, inset.get ());
+    FD_SET (signaler_fd, inset.get ());
+    struct timeval timeout;
+    if (timeout_ >= 0) {
+        timeout.tv_sec = timeout_ / 1000;
+        timeout.tv_usec = timeout_ % 1000 * 1000;
+    }
+#ifdef ZMQ_HAVE_WINDOWS
+    const int rc = select (0, inset.get (), outset.get (), NULL,
+                           timeout_ >= 0 ? &timeout : NULL);
+    wsa_assert (rc != SOCKET_ERROR);
+#else
+    const int rc =
+      select ((_fd > signaler_fd ? _fd : signaler_fd) + 1, inset.get (),
+              outset.get (), NULL, timeout_ >= 0 ? &timeout : NULL);
+    if (rc < 0) {
+        errno_assert (errno == EINTR);
+        return -1;
+    }
+#endif
+    ready = rc > 0;
+#else
+#error
+#endif
+
+    //  The commands themselves are processed by the socket; only clear
+    //  the wakeups.
+    while (_signaler.recv_failable () == 0)
+        ;
+
+    if (!ready) {
+        errno = EAGAIN;
+        return -1;
+    }
+    return 0;
+}
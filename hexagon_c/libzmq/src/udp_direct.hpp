@@ -0,0 +1,68 @@
+/* SPDX-License-Identifier: MPL-2.0 */
+
+#ifndef __ZMQ_UDP_DIRECT_HPP_INCLUDED__
+#define __ZMQ_UDP_DIRECT_HPP_INCLUDED__
+
+#include "fd.hpp"
+#include "macros.hpp"
+#include "options.hpp"
+#include "signaler.hpp"
+#include "udp_engine.hpp"
+
+namespace zmq
+{
+class address_t;
+class msg_t;
+
+//  UDP endpoint of a RADIO or DISH socket with ZMQ_UDP_DIRECT set. The
+//  application thread sends and receives on the socket itself, with the
+//  datagram format of udp_engine_t, so there is no session, pipe or I/O
+//  thread between the socket and the wire.
+
+class udp_direct_t
+{
+  public:
+    udp_direct_t (const options_t &options_);
+    ~udp_direct_t ();
+
+    //  Opens the socket for address_, which is owned from now on, and
+    //  binds it when receiving.
+    int init (address_t *address_, bool send_, bool recv_);
+
+    fd_t get_fd () const;
+
+    //  Signalled by the socket's mailbox so that wait returns when a
+    //  command arrives.
+    signaler_t *get_signaler ();
+
+    //  Sends msg_ as one datagram. Returns -1 with EAGAIN if the kernel
+    //  buffer is full or with EMSGSIZE if the datagram is too large.
+    int send (msg_t *msg_);
+
+    //  Receives the next datagram into msg_, with its group set. Returns
+    //  -1 with EAGAIN if there is none.
+    int recv (msg_t *msg_);
+
+    //  Waits up to timeout_ ms for events_ (ZMQ_POLLIN or ZMQ_POLLOUT) on
+    //  the socket or for a command. Returns -1 with EAGAIN on timeout.
+    int wait (short events_, int timeout_);
+
+  private:
+    const options_t _options;
+
+    address_t *_address;
+    fd_t _fd;
+
+    const struct sockaddr *_out_address;
+    zmq_socklen_t _out_address_len;
+
+    signaler_t _signaler;
+
+    char _out_buffer[MAX_UDP_MSG];
+    char _in_buffer[MAX_UDP_MSG];
+
+    ZMQ_NON_COPYABLE_NOR_MOVABLE (udp_direct_t)
+};
+}
+
+#endif
@@ -16,6 +16,7 @@
 #include "udp_address.hpp"
 #include "udp_engine.hpp"
 #include "session_base.hpp"
+#include "io_thread.hpp"
 #include "err.hpp"
 #include "ip.hpp"
 
@@ -37,6 +38,12 @@ zmq::udp_engine_t::udp_engine_t (const options_t &options_) :
     _options (options_),
     _send_enabled (false),
     _recv_enabled (false)
+#if defined ZMQ_IOTHREAD_POLLER_USE_IO_URING
+    ,
+    _poller (NULL),
+    _dgram_send (false),
+    _dgram_recv (false)
+#endif
 {
 }
 
@@ -87,6 +94,17 @@ void zmq::udp_engine_t::plug (io_thread_t *io_thread_, session_base_t *session_)
     io_object_t::plug (io_thread_);
     _handle = add_fd (_fd);
 
+#if defined ZMQ_IOTHREAD_POLLER_USE_IO_URING
+    //  Receive through a multishot recvmsg into provided buffers and send
+    //  in batches, unless the kernel is too old for it.
+    _poller = io_thread_->get_poller ();
+    if (_poller->dgram_attach (_handle, this, MAX_UDP_MSG, _recv_enabled)
+        == 0) {
+        _dgram_send = _send_enabled;
+        _dgram_recv = _recv_enabled;
+    }
+#endif
+
     const udp_address_t *const udp_addr = _address->resolved.udp_addr;
 
     int rc = 0;
@@ -106,21 +124,6 @@ void zmq::udp_engine_t::plug (io_thread_t *io_thread_, session_base_t *session_)
             const ip_addr_t *out = udp_addr->target_addr ();
             _out_address = out->as_sockaddr ();
             _out_address_len = out->sockaddr_len ();
-
-            if (out->is_multicast ()) {
-                const bool is_ipv6 = (out->family () == AF_INET6);
-                rc = rc
-                     | set_udp_multicast_loop (_fd, is_ipv6,
-                                               _options.multicast_loop);
-
-                if (_options.multicast_hops > 0) {
-                    rc = rc
-                         | set_udp_multicast_ttl (_fd, is_ipv6,
-                                                  _options.multicast_hops);
-                }
-
-                rc = rc | set_udp_multicast_iface (_fd, is_ipv6, udp_addr);
-            }
         } else {
             /// XXX fixme ?
             _out_address = reinterpret_cast<sockaddr *> (&_raw_address);
@@ -129,19 +132,86 @@ void zmq::udp_engine_t::plug (io_thread_t *io_thread_, session_base_t *session_)
         }
     }
 
-    if (_recv_enabled) {
-        rc = rc | set_udp_reuse_address (_fd, true);
+    rc = setup_socket (_fd, _options, udp_addr, _send_enabled, _recv_enabled);
+
+    if (rc != 0) {
+        error (protocol_error);
+    } else {
+        if (_send_enabled) {
+#if defined ZMQ_IOTHREAD_POLLER_USE_IO_URING
+            if (_dgram_send)
+                dgram_out ();
+            else
+#endif
+                set_pollout (_handle);
+        }
+
+        if (_recv_enabled) {
+#if defined ZMQ_IOTHREAD_POLLER_USE_IO_URING
+            if (_dgram_recv)
+                _poller->dgram_start_recv (_handle);
+            else
+#endif
+                set_pollin (_handle);
+
+            //  Call restart output to drop all join/leave commands
+            restart_output ();
+        }
+    }
+}
+
+int zmq::udp_engine_t::setup_socket (fd_t s_,
+                                     const options_t &options_,
+                                     const udp_address_t *addr_,
+                                     bool send_,
+                                     bool recv_)
+{
+    int rc = 0;
+
+    //  Latency knobs. The kernel may refuse these, e.g. for lack of
+    //  privileges, which leaves its defaults in place.
+    set_udp_buffers (s_, send_ ? options_.sndbuf : -1,
+                     recv_ ? options_.rcvbuf : -1);
+    if (options_.tos != 0)
+        set_ip_type_of_service (s_, options_.tos);
+    if (options_.priority != 0)
+        set_socket_priority (s_, options_.priority);
+    if (recv_) {
+        set_udp_busy_poll (s_, options_.busy_poll, options_.prefer_busy_poll);
+        set_udp_incoming_cpu (s_, options_.incoming_cpu);
+    }
+
+    if (send_ && !options_.raw_socket) {
+        const ip_addr_t *out = addr_->target_addr ();
+        if (out->is_multicast ()) {
+            const bool is_ipv6 = (out->family () == AF_INET6);
+            rc = rc
+                 | set_udp_multicast_loop (s_, is_ipv6,
+                                           options_.multicast_loop);
+
+            if (options_.multicast_hops > 0) {
+                rc = rc
+                     | set_udp_multicast_ttl (s_, is_ipv6,
+                                              options_.multicast_hops);
+            }
+
+            rc = rc | set_udp_multicast_iface (s_, is_ipv6, addr_);
+        }
+    }
+
+    if (recv_) {
+        rc = rc | set_udp_reuse_address (s_, true);
 
-        const ip_addr_t *bind_addr = udp_addr->bind_addr ();
+        const ip_addr_t *bind_addr = addr_->bind_addr ();
         ip_addr_t any = ip_addr_t::any (bind_addr->family ());
         const ip_addr_t *real_bind_addr;
 
-        const bool multicast = udp_addr->is_mcast ();
+        const bool multicast = addr_->is_mcast ();
 
         if (multicast) {
             //  Multicast addresses should be allowed to bind to more than
             //  one port as all ports should receive the message
-            rc = rc | set_udp_reuse_port (_fd, true);
+            rc = rc | set_udp_reuse_port (s_, true);
 
             //  In multicast we should bind ANY and use the mreq struct to
             //  specify the interface
@@ -152,45 +222,29 @@ void zmq::udp_engine_t::plug (io_thread_t *io_thread_, session_base_t *session_)
             real_bind_addr = bind_addr;
         }
 
-        if (rc != 0) {
-            error (protocol_error);
-            return;
-        }
+        if (rc != 0)
+            return -1;
 
 #ifdef ZMQ_HAVE_VXWORKS
         rc = rc
-             | bind (_fd, (sockaddr *) real_bind_addr->as_sockaddr (),
+             | bind (s_, (sockaddr *) real_bind_addr->as_sockaddr (),
                      real_bind_addr->sockaddr_len ());
 #else
         rc = rc
-             | bind (_fd, real_bind_addr->as_sockaddr (),
+             | bind (s_, real_bind_addr->as_sockaddr (),
                      real_bind_addr->sockaddr_len ());
 #endif
         if (rc != 0) {
-            assert_success_or_recoverable (_fd, rc);
-            error (protocol_error);
-            return;
+            assert_success_or_recoverable (s_, rc);
+            return -1;
         }
 
         if (multicast) {
-            rc = rc | add_membership (_fd, udp_addr);
+            rc = rc | add_membership (s_, addr_);
         }
     }
 
-    if (rc != 0) {
-        error (protocol_error);
-    } else {
-        if (_send_enabled) {
-            set_pollout (_handle);
-        }
-
-        if (_recv_enabled) {
-            set_pollin (_handle);
-
-            //  Call restart output to drop all join/leave commands
-            restart_output ();
-        }
-    }
+    return rc == 0 ? 0 : -1;
 }
 
 int zmq::udp_engine_t::set_udp_multicast_loop (fd_t s_,
@@ -314,6 +368,64 @@ int zmq::udp_engine_t::add_membership (fd_t s_, const udp_address_t *addr_)
     return rc;
 }
 
+void zmq::udp_engine_t::set_udp_buffers (fd_t s_, int sndbuf_, int rcvbuf_)
+{
+    if (sndbuf_ >= 0) {
+        const int rc =
+          setsockopt (s_, SOL_SOCKET, SO_SNDBUF,
+                      reinterpret_cast<char *> (&sndbuf_), sizeof (sndbuf_));
+        assert_success_or_recoverable (s_, rc);
+    }
+    if (rcvbuf_ >= 0) {
+        const int rc =
+          setsockopt (s_, SOL_SOCKET, SO_RCVBUF,
+                      reinterpret_cast<char *> (&rcvbuf_), sizeof (rcvbuf_));
+        assert_success_or_recoverable (s_, rc);
+    }
+}
+
+void zmq::udp_engine_t::set_udp_busy_poll (fd_t s_,
+                                           int busy_poll_,
+                                           bool prefer_)
+{
+#if defined ZMQ_HAVE_BUSY_POLL
+    if (busy_poll_ > 0) {
+        int rc =
+          setsockopt (s_, SOL_SOCKET, SO_BUSY_POLL,
+                      reinterpret_cast<char *> (&busy_poll_), sizeof (int));
+        assert_success_or_recoverable (s_, rc);
+
+#if defined ZMQ_HAVE_PREFER_BUSY_POLL
+        int prefer = prefer_ ? 1 : 0;
+        rc = setsockopt (s_, SOL_SOCKET, SO_PREFER_BUSY_POLL,
+                         reinterpret_cast<char *> (&prefer), sizeof (prefer));
+        assert_success_or_recoverable (s_, rc);
+#else
+        LIBZMQ_UNUSED (prefer_);
+#endif
+    }
+#else
+    LIBZMQ_UNUSED (s_);
+    LIBZMQ_UNUSED (busy_poll_);
+    LIBZMQ_UNUSED (prefer_);
+#endif
+}
+
+void zmq::udp_engine_t::set_udp_incoming_cpu (fd_t s_, int cpu_)
+{
+#if defined ZMQ_HAVE_SO_INCOMING_CPU
+    if (cpu_ >= 0) {
+        const int rc = setsockopt (s_, SOL_SOCKET, SO_INCOMING_CPU,
+                                   reinterpret_cast<char *> (&cpu_),
+                                   sizeof (cpu_));
+        assert_success_or_recoverable (s_, rc);
+    }
+#else
+    LIBZMQ_UNUSED (s_);
+    LIBZMQ_UNUSED (cpu_);
+#endif
+}
+
 void zmq::udp_engine_t::error (error_reason_t reason_)
 {
     zmq_assert (_session);
@@ -407,79 +519,92 @@ int zmq::udp_engine_t::resolve_raw_address (const char *name_, size_t length_)
     return 0;
 }
 
-void zmq::udp_engine_t::out_event ()
+int zmq::udp_engine_t::pull_datagram (char *buffer_)
 {
     msg_t group_msg;
     int rc = _session->pull_msg (&group_msg);
     errno_assert (rc == 0 || (rc == -1 && errno == EAGAIN));
 
-    if (rc == 0) {
-        msg_t body_msg;
-        rc = _session->pull_msg (&body_msg);
-        //  If there's a group, there should also be a body
-        errno_assert (rc == 0);
+    if (rc != 0)
+        return -1;
 
-        const size_t group_size = group_msg.size ();
-        const size_t body_size = body_msg.size ();
-        size_t size;
+    msg_t body_msg;
+    rc = _session->pull_msg (&body_msg);
+    //  If there's a group, there should also be a body
+    errno_assert (rc == 0);
 
-        if (_options.raw_socket) {
-            rc = resolve_raw_address (static_cast<char *> (group_msg.data ()),
-                                      group_size);
+    const size_t group_size = group_msg.size ();
+    const size_t body_size = body_msg.size ();
+    size_t size;
 
-            //  We discard the message if address is not valid
-            if (rc != 0) {
-                rc = group_msg.close ();
-                errno_assert (rc == 0);
+    if (_options.raw_socket) {
+        rc = resolve_raw_address (static_cast<char *> (group_msg.data ()),
+                                  group_size);
 
-                rc = body_msg.close ();
-                errno_assert (rc == 0);
+        //  We discard the message if address is not valid
+        if (rc != 0) {
+            rc = group_msg.close ();
+            errno_assert (rc == 0);
 
-                return;
-            }
+            rc = body_msg.close ();
+            errno_assert (rc == 0);
 
-            size = body_size;
+            return 0;
+        }
 
-            memcpy (_out_buffer, body_msg.data (), body_size);
-        } else {
-            size = group_size + body_size + 1;
+        size = body_size;
 
-            // TODO: check if larger than maximum size
-            _out_buffer[0] = static_cast<unsigned char> (group_size);
-            memcpy (_out_buffer + 1, group_msg.data (), group_size);
-            memcpy (_out_buffer + 1 + group_size, body_msg.data (), body_size);
-        }
+        memcpy (buffer_, body_msg.data (), body_size);
+    } else {
+        size = group_size + body_size + 1;
 
-        rc = group_msg.close ();
-        errno_assert (rc == 0);
+        // TODO: check if larger than maximum size
+        buffer_[0] = static_cast<unsigned char> (group_size);
+        memcpy (buffer_ + 1, group_msg.data (), group_size);
+        memcpy (buffer_ + 1 + group_size, body_msg.data (), body_size);
+    }
 
-        body_msg.close ();
-        errno_assert (rc == 0);
+    rc = group_msg.close ();
+    errno_assert (rc == 0);
+
+    body_msg.close ();
+    errno_assert (rc == 0);
+
+    return static_cast<int> (size);
+}
+
+void zmq::udp_engine_t::out_event ()
+{
+    const int size = pull_datagram (_out_buffer);
+    if (size < 0) {
+        reset_pollout (_handle);
+        return;
+    }
+    if (size == 0)
+        return;
 
 #ifdef ZMQ_HAVE_WINDOWS
-        rc = sendto (_fd, _out_buffer, static_cast<int> (size), 0, _out_address,
-                     _out_address_len);
+    const int rc = sendto (_fd, _out_buffer, size, 0, _out_address,
+                           _out_address_len);
 #elif defined ZMQ_HAVE_VXWORKS
-        rc = sendto (_fd, reinterpret_cast<caddr_t> (_out_buffer), size, 0,
-                     (sockaddr *) _out_address, _out_address_len);
+    const int rc = sendto (_fd, reinterpret_cast<caddr_t> (_out_buffer), size,
+                           0, (sockaddr *) _out_address, _out_address_len);
 #else
-        rc = sendto (_fd, _out_buffer, size, 0, _out_address, _out_address_len);
+    const int rc = sendto (_fd, _out_buffer, static_cast<size_t> (size), 0,
+                           _out_address, _out_address_len);
 #endif
-        if (rc < 0) {
+    if (rc < 0) {
 #ifdef ZMQ_HAVE_WINDOWS
-            if (WSAGetLastError () != WSAEWOULDBLOCK) {
-                assert_success_or_recoverable (_fd, rc);
-                error (connection_error);
-            }
+        if (WSAGetLastError () != WSAEWOULDBLOCK) {
+            assert_success_or_recoverable (_fd, rc);
+            error (connection_error);
+        }
 #else
-            if (rc != EWOULDBLOCK) {
-                assert_success_or_recoverable (_fd, rc);
-                error (connection_error);
-            }
-#endif
+        if (rc != EWOULDBLOCK) {
+            assert_success_or_recoverable (_fd, rc);
+            error (connection_error);
         }
-    } else {
-        reset_pollout (_handle);
+#endif
     }
 }
 
@@ -496,6 +621,12 @@ void zmq::udp_engine_t::restart_output ()
         while (_session->pull_msg (&msg) == 0)
             msg.close ();
     } else {
+#if defined ZMQ_IOTHREAD_POLLER_USE_IO_URING
+        if (_dgram_send) {
+            dgram_out ();
+            return;
+        }
+#endif
         set_pollout (_handle);
         out_event ();
     }
@@ -526,22 +657,31 @@ void zmq::udp_engine_t::in_event ()
         return;
     }
 
+    if (!push_datagram (_in_buffer, nbytes,
+                        reinterpret_cast<sockaddr *> (&in_address)))
+        reset_pollin (_handle);
+}
+
+bool zmq::udp_engine_t::push_datagram (const char *buffer_,
+                                       int nbytes_,
+                                       const sockaddr *from_)
+{
     int rc;
     int body_size;
     int body_offset;
     msg_t msg;
 
     if (_options.raw_socket) {
-        zmq_assert (in_address.ss_family == AF_INET);
-        sockaddr_to_msg (&msg, reinterpret_cast<sockaddr_in *> (&in_address));
+        zmq_assert (from_->sa_family == AF_INET);
+        sockaddr_to_msg (&msg, reinterpret_cast<const sockaddr_in *> (from_));
 
-        body_size = nbytes;
+        body_size = nbytes_;
         body_offset = 0;
     } else {
         // TODO in out_event, the group size is an *unsigned* char. what is
         // the maximum value?
-        const char *group_buffer = _in_buffer + 1;
-        const int group_size = _in_buffer[0];
+        const char *group_buffer = buffer_ + 1;
+        const int group_size = buffer_[0];
 
         rc = msg.init_size (group_size);
         errno_assert (rc == 0);
@@ -549,10 +689,10 @@ void zmq::udp_engine_t::in_event ()
         memcpy (msg.data (), group_buffer, group_size);
 
         //  This doesn't fit, just ignore
-        if (nbytes - 1 < group_size)
-            return;
+        if (nbytes_ - 1 < group_size)
+            return true;
 
-        body_size = nbytes - 1 - group_size;
+        body_size = nbytes_ - 1 - group_size;
         body_offset = 1 + group_size;
     }
     // Push group description to session
@@ -564,15 +704,14 @@ void zmq::udp_engine_t::in_event ()
         rc = msg.close ();
         errno_assert (rc == 0);
 
-        reset_pollin (_handle);
-        return;
+        return false;
     }
 
     rc = msg.close ();
     errno_assert (rc == 0);
     rc = msg.init_size (body_size);
     errno_assert (rc == 0);
-    memcpy (msg.data (), _in_buffer + body_offset, body_size);
+    memcpy (msg.data (), buffer_ + body_offset, body_size);
 
     // Push message body to session
     rc = _session->push_msg (&msg);
@@ -582,21 +721,65 @@ void zmq::udp_engine_t::in_event ()
         errno_assert (rc == 0);
 
         _session->reset ();
-        reset_pollin (_handle);
-        return;
+        return false;
     }
 
     rc = msg.close ();
     errno_assert (rc == 0);
     _session->flush ();
+    return true;
 }
 
 bool zmq::udp_engine_t::restart_input ()
 {
     if (_recv_enabled) {
+#if defined ZMQ_IOTHREAD_POLLER_USE_IO_URING
+        if (_dgram_recv) {
+            _poller->dgram_start_recv (_handle);
+            return true;
+        }
+#endif
         set_pollin (_handle);
         in_event ();
     }
 
     return true;
 }
+
+#if defined ZMQ_IOTHREAD_POLLER_USE_IO_URING
+bool zmq::udp_engine_t::dgram_in (const char *data_,
+                                  size_t size_,
+                                  const sockaddr *from_,
+                                  size_t from_len_)
+{
+    LIBZMQ_UNUSED (from_len_);
+    return push_datagram (data_, static_cast<int> (size_), from_);
+}
+
+void zmq::udp_engine_t::dgram_out ()
+{
+    //  Everything pulled here is submitted with the I/O thread's next
+    //  wait, as one batch.
+    char *buffer;
+    while ((buffer = _poller->dgram_send_buffer (_handle)) != NULL) {
+        const int size = pull_datagram (buffer);
+        if (size < 0)
+            return;
+        if (size > 0)
+            _poller->dgram_send (_handle, static_cast<size_t> (size),
+                                 _out_address, _out_address_len);
+    }
+}
+
+void zmq::udp_engine_t::dgram_error (bool recv_, int errno_)
+{
+    if (recv_ && (errno_ == EINVAL || errno_ == EOPNOTSUPP)) {
+        //  No multishot recvmsg before Linux 6.0, receive on readiness.
+        _dgram_recv = false;
+        set_pollin (_handle);
+        return;
+    }
+    error (connection_error);
+}
+#endif
+
@@ -4,6 +4,7 @@
 
 #include "io_object.hpp"
 #include "i_engine.hpp"
+#include "i_dgram_events.hpp"
 #include "address.hpp"
 #include "msg.hpp"
 
@@ -14,7 +15,13 @@ namespace zmq
 class io_thread_t;
 class session_base_t;
 
+#if defined ZMQ_IOTHREAD_POLLER_USE_IO_URING
+class udp_engine_t ZMQ_FINAL : public io_object_t,
+                               public i_engine,
+                               public i_dgram_events
+#else
 class udp_engine_t ZMQ_FINAL : public io_object_t, public i_engine
+#endif
 {
   public:
     udp_engine_t (const options_t &options_);
@@ -45,8 +52,27 @@ class udp_engine_t ZMQ_FINAL : public io_object_t, public i_engine
     void in_event ();
     void out_event ();
 
+#if defined ZMQ_IOTHREAD_POLLER_USE_IO_URING
+    //  i_dgram_events interface implementation.
+    bool dgram_in (const char *data_,
+                   size_t size_,
+                   const sockaddr *from_,
+                   size_t from_len_);
+    void dgram_out ();
+    void dgram_error (bool recv_, int errno_);
+#endif
+
     const endpoint_uri_pair_t &get_endpoint () const;
 
+    //  Applies the socket options to s_ and, if recv_, binds it to addr_.
+    //  Shared with udp_direct_t, which drives the socket from the
+    //  application thread.
+    static int setup_socket (fd_t s_,
+                             const options_t &options_,
+                             const udp_address_t *addr_,
+                             bool send_,
+                             bool recv_);
+
   private:
     int resolve_raw_address (const char *name_, size_t length_);
     static void sockaddr_to_msg (zmq::msg_t *msg_, const sockaddr_in *addr_);
@@ -58,11 +84,28 @@ class udp_engine_t ZMQ_FINAL : public io_object_t, public i_engine
     // Set multicast TTL
     static int set_udp_multicast_ttl (fd_t s_, bool is_ipv6_, int hops_);
     // Set multicast address/interface
-    int set_udp_multicast_iface (fd_t s_,
-                                 bool is_ipv6_,
-                                 const udp_address_t *addr_);
+    static int set_udp_multicast_iface (fd_t s_,
+                                        bool is_ipv6_,
+                                        const udp_address_t *addr_);
     // Join a multicast group
-    int add_membership (fd_t s_, const udp_address_t *addr_);
+    static int add_membership (fd_t s_, const udp_address_t *addr_);
+    // Set the kernel buffer sizes, -1 keeps the system default
+    static void set_udp_buffers (fd_t s_, int sndbuf_, int rcvbuf_);
+    // Busy poll the receive queue for busy_poll_ microseconds
+    static void set_udp_busy_poll (fd_t s_, int busy_poll_, bool prefer_);
+    // Prefer this socket for datagrams received on cpu_
+    static void set_udp_incoming_cpu (fd_t s_, int cpu_);
+
+    //  Pulls the next message from the session into buffer_ as a
+    //  datagram. Returns its size, 0 if the message was discarded or -1
+    //  if there is no message.
+    int pull_datagram (char *buffer_);
+
+    //  Pushes a received datagram to the session. Returns false if the
+    //  session did not take it.
+    bool push_datagram (const char *buffer_,
+                        int nbytes_,
+                        const sockaddr *from_);
 
     //  Function to handle network issues.
     void error (error_reason_t reason_);
@@ -86,6 +129,14 @@ class udp_engine_t ZMQ_FINAL : public io_object_t, public i_engine
     char _in_buffer[MAX_UDP_MSG];
     bool _send_enabled;
     bool _recv_enabled;
+
+#if defined ZMQ_IOTHREAD_POLLER_USE_IO_URING
+    //  Datagrams go through the poller's completions instead of
+    //  readiness and sendto/recvfrom.
+    poller_t *_poller;
+    bool _dgram_send;
+    bool _dgram_recv;
+#endif
 };
 }
 
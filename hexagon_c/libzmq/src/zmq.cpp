@@ -63,6 +63,7 @@ struct iovec
 #include "ctx.hpp"
 #include "err.hpp"
 #include "msg.hpp"
+#include "group_id.hpp"
 #include "fd.hpp"
 #include "metadata.hpp"
 #include "socket_poller.hpp"
@@ -296,6 +297,20 @@ int zmq_leave (void *s_, const char *group_)
     return s->leave (group_);
 }
 
+int zmq_join_id (void *s_, uint32_t group_id_)
+{
+    char group[zmq::group_id_length + 1];
+    zmq::encode_group_id (group_id_, group);
+    return zmq_join (s_, group);
+}
+
+int zmq_leave_id (void *s_, uint32_t group_id_)
+{
+    char group[zmq::group_id_length + 1];
+    zmq::encode_group_id (group_id_, group);
+    return zmq_leave (s_, group);
+}
+
 int zmq_bind (void *s_, const char *addr_)
 {
     zmq::socket_base_t *s = as_socket_base_t (s_);
@@ -706,6 +721,24 @@ const char *zmq_msg_group (zmq_msg_t *msg_)
     return (reinterpret_cast<zmq::msg_t *> (msg_))->group ();
 }
 
+int zmq_msg_set_group_id (zmq_msg_t *msg_, uint32_t group_id_)
+{
+    char group[zmq::group_id_length + 1];
+    zmq::encode_group_id (group_id_, group);
+    return (reinterpret_cast<zmq::msg_t *> (msg_))
+      ->set_group (group, zmq::group_id_length);
+}
+
+int zmq_msg_group_id (zmq_msg_t *msg_, uint32_t *group_id_)
+{
+    if (!zmq::decode_group_id (
+          (reinterpret_cast<zmq::msg_t *> (msg_))->group (), group_id_)) {
+        errno = EINVAL;
+        return -1;
+    }
+    return 0;
+}
+
 //  Get message metadata string
 
 const char *zmq_msg_gets (const zmq_msg_t *msg_, const char *property_)
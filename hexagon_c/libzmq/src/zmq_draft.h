@@ -54,6 +54,13 @@
 #define ZMQ_NORM_NUM_PARITY 122
 #define ZMQ_NORM_NUM_AUTOPARITY 123
 #define ZMQ_NORM_PUSH 124
+#define ZMQ_GROUP_NUMERIC 125
+#define ZMQ_PREFER_BUSY_POLL 126
+#define ZMQ_INCOMING_CPU 127
+#define ZMQ_UDP_DIRECT 128
+
+/*  DRAFT numeric RADIO/DISH groups: fixed-width lowercase hex on the wire   */
+#define ZMQ_GROUP_ID_LENGTH 8
 
 /*  DRAFT ZMQ_NORM_MODE options                                               */
 #define ZMQ_NORM_FIXED 0
@@ -83,12 +90,16 @@ int zmq_ctx_get_ext (void *context_,
 /*  DRAFT Socket methods.                                                     */
 int zmq_join (void *s_, const char *group_);
 int zmq_leave (void *s_, const char *group_);
+int zmq_join_id (void *s_, uint32_t group_id_);
+int zmq_leave_id (void *s_, uint32_t group_id_);
 
 /*  DRAFT Msg methods.                                                        */
 int zmq_msg_set_routing_id (zmq_msg_t *msg_, uint32_t routing_id_);
 uint32_t zmq_msg_routing_id (zmq_msg_t *msg_);
 int zmq_msg_set_group (zmq_msg_t *msg_, const char *group_);
 const char *zmq_msg_group (zmq_msg_t *msg_);
+int zmq_msg_set_group_id (zmq_msg_t *msg_, uint32_t group_id_);
+int zmq_msg_group_id (zmq_msg_t *msg_, uint32_t *group_id_);
 int zmq_msg_init_buffer (zmq_msg_t *msg_, const void *buf_, size_t size_);
 
 /*  DRAFT Msg property names.                                                 */
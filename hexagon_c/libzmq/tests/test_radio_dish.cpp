@@ -127,6 +127,138 @@ void test_join_twice_fails ()
     test_context_socket_close (dish);
 }
 
+void test_group_id_roundtrip ()
+{
+    zmq_msg_t msg;
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_msg_init (&msg));
+
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_msg_set_group_id (&msg, 0xdeadbeef));
+    TEST_ASSERT_EQUAL_STRING ("deadbeef", zmq_msg_group (&msg));
+
+    uint32_t id = 0;
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_msg_group_id (&msg, &id));
+    TEST_ASSERT_EQUAL_UINT32 (0xdeadbeef, id);
+
+    //  Only the fixed-width lowercase form is a group id
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_msg_set_group (&msg, "Movies"));
+    TEST_ASSERT_FAILURE_ERRNO (EINVAL, zmq_msg_group_id (&msg, &id));
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_msg_set_group (&msg, "0000002A"));
+    TEST_ASSERT_FAILURE_ERRNO (EINVAL, zmq_msg_group_id (&msg, &id));
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_msg_set_group (&msg, "0000002a0"));
+    TEST_ASSERT_FAILURE_ERRNO (EINVAL, zmq_msg_group_id (&msg, &id));
+
+    zmq_msg_close (&msg);
+}
+
+void test_numeric_join_rules ()
+{
+    void *dish = test_context_socket (ZMQ_DISH);
+    const int numeric = 1;
+
+    //  Cannot switch representation once groups are joined
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_join (dish, "Movies"));
+    TEST_ASSERT_FAILURE_ERRNO (
+      EINVAL, zmq_setsockopt (dish, ZMQ_GROUP_NUMERIC, &numeric, sizeof (int)));
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_leave (dish, "Movies"));
+    TEST_ASSERT_SUCCESS_ERRNO (
+      zmq_setsockopt (dish, ZMQ_GROUP_NUMERIC, &numeric, sizeof (int)));
+
+    //  String groups are rejected in numeric mode
+    TEST_ASSERT_FAILURE_ERRNO (EINVAL, zmq_join (dish, "Movies"));
+
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_join_id (dish, 42));
+    TEST_ASSERT_FAILURE_ERRNO (EINVAL, zmq_join_id (dish, 42));
+    TEST_ASSERT_FAILURE_ERRNO (EINVAL, zmq_join (dish, "0000002a"));
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_leave_id (dish, 42));
+    TEST_ASSERT_FAILURE_ERRNO (EINVAL, zmq_leave_id (dish, 42));
+
+    //  Many joins and leaves exercise growth and deletion of the table
+    for (uint32_t id = 0; id < 5000; ++id)
+        TEST_ASSERT_SUCCESS_ERRNO (zmq_join_id (dish, id * 7919));
+    for (uint32_t id = 0; id < 5000; id += 2)
+        TEST_ASSERT_SUCCESS_ERRNO (zmq_leave_id (dish, id * 7919));
+    for (uint32_t id = 0; id < 5000; ++id) {
+        if (id % 2) {
+            TEST_ASSERT_FAILURE_ERRNO (EINVAL, zmq_join_id (dish, id * 7919));
+        } else {
+            TEST_ASSERT_FAILURE_ERRNO (EINVAL, zmq_leave_id (dish, id * 7919));
+        }
+    }
+
+    test_context_socket_close (dish);
+}
+
+void msg_send_id_expect_success (void *s_, uint32_t group_id_, const char *body_)
+{
+    zmq_msg_t msg;
+    const size_t len = strlen (body_);
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_msg_init_size (&msg, len));
+    memcpy (zmq_msg_data (&msg), body_, len);
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_msg_set_group_id (&msg, group_id_));
+    TEST_ASSERT_EQUAL_INT ((int) len, zmq_msg_send (&msg, s_, 0));
+    zmq_msg_close (&msg);
+}
+
+void msg_recv_id_cmp (void *s_, uint32_t group_id_, const char *body_)
+{
+    zmq_msg_t msg;
+    const size_t len = strlen (body_);
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_msg_init (&msg));
+    TEST_ASSERT_EQUAL_INT ((int) len, zmq_msg_recv (&msg, s_, 0));
+
+    uint32_t id = 0;
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_msg_group_id (&msg, &id));
+    TEST_ASSERT_EQUAL_UINT32 (group_id_, id);
+    TEST_ASSERT_EQUAL_STRING_LEN (body_, zmq_msg_data (&msg), len);
+
+    zmq_msg_close (&msg);
+}
+
+void test_radio_dish_numeric ()
+{
+    const int ipv6_ = 0;
+    size_t len = MAX_SOCKET_STRING;
+    char my_endpoint[MAX_SOCKET_STRING];
+    const int numeric = 1;
+
+    void *radio = test_context_socket (ZMQ_RADIO);
+    TEST_ASSERT_SUCCESS_ERRNO (
+      zmq_setsockopt (radio, ZMQ_GROUP_NUMERIC, &numeric, sizeof (int)));
+    bind_loopback (radio, ipv6_, my_endpoint, len);
+
+    void *dish = test_context_socket (ZMQ_DISH);
+    TEST_ASSERT_SUCCESS_ERRNO (
+      zmq_setsockopt (dish, ZMQ_IPV6, &ipv6_, sizeof (int)));
+    TEST_ASSERT_SUCCESS_ERRNO (
+      zmq_setsockopt (dish, ZMQ_GROUP_NUMERIC, &numeric, sizeof (int)));
+
+    //  Joined before connecting: sent with the initial subscriptions
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_join_id (dish, 1001));
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_connect (dish, my_endpoint));
+
+    msleep (SETTLE_TIME);
+
+    msg_send_id_expect_success (radio, 1002, "dropped");
+    msg_send_id_expect_success (radio, 1001, "track 1001");
+    msg_recv_id_cmp (dish, 1001, "track 1001");
+
+    //  Joined while connected
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_join_id (dish, 1002));
+    msleep (SETTLE_TIME);
+    msg_send_id_expect_success (radio, 1002, "track 1002");
+    msg_recv_id_cmp (dish, 1002, "track 1002");
+
+    //  After leaving, only the remaining group is delivered
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_leave_id (dish, 1001));
+    msleep (SETTLE_TIME);
+    msg_send_id_expect_success (radio, 1001, "dropped");
+    msg_send_id_expect_success (radio, 1002, "still here");
+    msg_recv_id_cmp (dish, 1002, "still here");
+
+    test_context_socket_close (dish);
+    test_context_socket_close (radio);
+}
+
 void test_radio_dish_tcp_poll (int ipv6_)
 {
     size_t len = MAX_SOCKET_STRING;
@@ -255,6 +387,165 @@ void test_radio_dish_udp (int ipv6_)
 }
 MAKE_TEST_V4V6 (test_radio_dish_udp)
 
+void test_radio_dish_udp_latency_options ()
+{
+    const int buffer = 256 * 1024;
+    const int tos = 0xb8;
+    const int busy_poll = 50;
+    const int prefer = 1;
+    const int cpu = 0;
+    int value;
+    size_t size = sizeof (int);
+
+    void *radio = test_context_socket (ZMQ_RADIO);
+    void *dish = test_context_socket (ZMQ_DISH);
+
+    TEST_ASSERT_SUCCESS_ERRNO (
+      zmq_setsockopt (radio, ZMQ_SNDBUF, &buffer, sizeof (int)));
+    TEST_ASSERT_SUCCESS_ERRNO (
+      zmq_setsockopt (radio, ZMQ_TOS, &tos, sizeof (int)));
+    TEST_ASSERT_SUCCESS_ERRNO (
+      zmq_setsockopt (dish, ZMQ_RCVBUF, &buffer, sizeof (int)));
+    TEST_ASSERT_SUCCESS_ERRNO (
+      zmq_setsockopt (dish, ZMQ_BUSY_POLL, &busy_poll, sizeof (int)));
+    TEST_ASSERT_SUCCESS_ERRNO (
+      zmq_setsockopt (dish, ZMQ_PREFER_BUSY_POLL, &prefer, sizeof (int)));
+    TEST_ASSERT_SUCCESS_ERRNO (
+      zmq_setsockopt (dish, ZMQ_INCOMING_CPU, &cpu, sizeof (int)));
+
+    const int bad_cpu = -2;
+    TEST_ASSERT_FAILURE_ERRNO (
+      EINVAL, zmq_setsockopt (dish, ZMQ_INCOMING_CPU, &bad_cpu, sizeof (int)));
+
+    TEST_ASSERT_SUCCESS_ERRNO (
+      zmq_getsockopt (dish, ZMQ_BUSY_POLL, &value, &size));
+    TEST_ASSERT_EQUAL_INT (busy_poll, value);
+    TEST_ASSERT_SUCCESS_ERRNO (
+      zmq_getsockopt (dish, ZMQ_PREFER_BUSY_POLL, &value, &size));
+    TEST_ASSERT_EQUAL_INT (prefer, value);
+    TEST_ASSERT_SUCCESS_ERRNO (
+      zmq_getsockopt (dish, ZMQ_INCOMING_CPU, &value, &size));
+    TEST_ASSERT_EQUAL_INT (cpu, value);
+
+    //  Refused knobs (busy poll needs CAP_NET_ADMIN on older kernels) must
+    //  not keep the engines from working.
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_bind (dish, "udp://*:5556"));
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_connect (radio, "udp://127.0.0.1:5556"));
+
+    msleep (SETTLE_TIME);
+
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_join (dish, "TV"));
+
+    msg_send_expect_success (radio, "TV", "Friends");
+    msg_recv_cmp (dish, "TV", "Friends");
+
+    test_context_socket_close (dish);
+    test_context_socket_close (radio);
+}
+
+void test_radio_dish_udp_direct ()
+{
+    //  Direct endpoints need no I/O thread.
+    void *ctx = zmq_ctx_new ();
+    TEST_ASSERT_NOT_NULL (ctx);
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_ctx_set (ctx, ZMQ_IO_THREADS, 0));
+
+    void *radio = zmq_socket (ctx, ZMQ_RADIO);
+    void *dish = zmq_socket (ctx, ZMQ_DISH);
+    TEST_ASSERT_NOT_NULL (radio);
+    TEST_ASSERT_NOT_NULL (dish);
+
+    const int direct = 1;
+    int value = 0;
+    size_t size = sizeof (int);
+    TEST_ASSERT_SUCCESS_ERRNO (
+      zmq_setsockopt (radio, ZMQ_UDP_DIRECT, &direct, sizeof (int)));
+    TEST_ASSERT_SUCCESS_ERRNO (
+      zmq_setsockopt (dish, ZMQ_UDP_DIRECT, &direct, sizeof (int)));
+    TEST_ASSERT_SUCCESS_ERRNO (
+      zmq_getsockopt (dish, ZMQ_UDP_DIRECT, &value, &size));
+    TEST_ASSERT_EQUAL_INT (direct, value);
+
+    //  Thread-safe sockets have no ZMQ_FD until the UDP socket exists.
+    zmq_fd_t fd;
+    size = sizeof (fd);
+    TEST_ASSERT_FAILURE_ERRNO (EINVAL,
+                               zmq_getsockopt (dish, ZMQ_FD, &fd, &size));
+
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_bind (dish, "udp://*:5557"));
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_connect (radio, "udp://127.0.0.1:5557"));
+
+    //  One UDP socket per socket.
+    TEST_ASSERT_FAILURE_ERRNO (EINVAL, zmq_bind (dish, "udp://*:5558"));
+
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_getsockopt (dish, ZMQ_FD, &fd, &size));
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_join (dish, "TV"));
+
+    //  Datagrams of other groups are skipped on receive.
+    msg_send_expect_success (radio, "Movies", "Godfather");
+    msg_send_expect_success (radio, "TV", "Friends");
+
+    zmq_pollitem_t item = {NULL, fd, ZMQ_POLLIN, 0};
+    TEST_ASSERT_EQUAL_INT (1, TEST_ASSERT_SUCCESS_ERRNO (zmq_poll (
+                                &item, 1, SETTLE_TIME)));
+
+    int events = 0;
+    size = sizeof (int);
+    TEST_ASSERT_SUCCESS_ERRNO (
+      zmq_getsockopt (dish, ZMQ_EVENTS, &events, &size));
+    TEST_ASSERT_TRUE (events & ZMQ_POLLIN);
+    msg_recv_cmp (dish, "TV", "Friends");
+
+    //  A blocking receive waits on the UDP socket until the timeout.
+    const int timeout = 50;
+    TEST_ASSERT_SUCCESS_ERRNO (
+      zmq_setsockopt (dish, ZMQ_RCVTIMEO, &timeout, sizeof (int)));
+    char buffer[16];
+    TEST_ASSERT_FAILURE_ERRNO (EAGAIN,
+                               zmq_recv (dish, buffer, sizeof (buffer), 0));
+
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_close (dish));
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_close (radio));
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_ctx_term (ctx));
+}
+
+void test_radio_dish_udp_direct_engine_peers ()
+{
+    //  Direct endpoints use the datagram format of the UDP engine.
+    void *radio = test_context_socket (ZMQ_RADIO);
+    void *dish = test_context_socket (ZMQ_DISH);
+    void *direct_radio = test_context_socket (ZMQ_RADIO);
+    void *direct_dish = test_context_socket (ZMQ_DISH);
+
+    const int direct = 1;
+    TEST_ASSERT_SUCCESS_ERRNO (
+      zmq_setsockopt (direct_radio, ZMQ_UDP_DIRECT, &direct, sizeof (int)));
+    TEST_ASSERT_SUCCESS_ERRNO (
+      zmq_setsockopt (direct_dish, ZMQ_UDP_DIRECT, &direct, sizeof (int)));
+
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_bind (dish, "udp://*:5557"));
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_bind (direct_dish, "udp://*:5558"));
+    TEST_ASSERT_SUCCESS_ERRNO (
+      zmq_connect (direct_radio, "udp://127.0.0.1:5557"));
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_connect (radio, "udp://127.0.0.1:5558"));
+
+    msleep (SETTLE_TIME);
+
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_join (dish, "TV"));
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_join (direct_dish, "TV"));
+
+    msg_send_expect_success (direct_radio, "TV", "Friends");
+    msg_recv_cmp (dish, "TV", "Friends");
+
+    msg_send_expect_success (radio, "TV", "Seinfeld");
+    msg_recv_cmp (direct_dish, "TV", "Seinfeld");
+
+    test_context_socket_close (direct_dish);
+    test_context_socket_close (direct_radio);
+    test_context_socket_close (dish);
+    test_context_socket_close (radio);
+}
+
 #define MCAST_IPV4 "226.8.5.5"
 #define MCAST_IPV6 "ff02::7a65:726f:6df1:0a01"
 
@@ -520,6 +811,9 @@ int main (void)
     RUN_TEST (test_join_too_long_fails);
     RUN_TEST (test_long_group);
     RUN_TEST (test_join_twice_fails);
+    RUN_TEST (test_group_id_roundtrip);
+    RUN_TEST (test_numeric_join_rules);
+    RUN_TEST (test_radio_dish_numeric);
     RUN_TEST (test_radio_bind_fails_ipv4);
     RUN_TEST (test_radio_bind_fails_ipv6);
     RUN_TEST (test_dish_connect_fails_ipv4);
@@ -528,6 +822,9 @@ int main (void)
     RUN_TEST (test_radio_dish_tcp_poll_ipv6);
     RUN_TEST (test_radio_dish_udp_ipv4);
     RUN_TEST (test_radio_dish_udp_ipv6);
+    RUN_TEST (test_radio_dish_udp_latency_options);
+    RUN_TEST (test_radio_dish_udp_direct);
+    RUN_TEST (test_radio_dish_udp_direct_engine_peers);
 
     RUN_TEST (test_radio_dish_mcast_ipv4);
     RUN_TEST (test_radio_dish_no_loop_ipv4);
@@ -0,0 +1,339 @@
+/**
+ * @file CaptureFile.cpp
+ * @brief CaptureWriter, CaptureReader and ReplayPacer implementation
+ */
+
+#include "common/CaptureFile.h"
+#include "common/TscClock.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+#include <utility>
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace common {
+namespace capture {
+
+namespace {
+
+constexpr char SEGMENT_MAGIC[8] = {'H', 'X', 'C', 'A', 'P', '0', '1', '\0'};
+constexpr std::uint32_t SEGMENT_VERSION = 1U;
+constexpr const char* SEGMENT_SUFFIX = ".hxcap";
+constexpr std::size_t RECORD_ALIGN = 8U;
+
+std::size_t alignUp(std::size_t value) noexcept {
+    return (value + RECORD_ALIGN - 1U) & ~(RECORD_ALIGN - 1U);
+}
+
+std::string segmentPath(const std::string& directory, const std::string& prefix, std::uint64_t index) {
+    char name[32];
+    std::snprintf(name, sizeof(name), ".%06llu", static_cast<unsigned long long>(index));
+    return directory + "/" + prefix + name + SEGMENT_SUFFIX;
+}
+
+/// Index of "<prefix>.<digits>.hxcap"; false for other names
+bool parseSegmentName(const std::string& name, const std::string& prefix, std::uint64_t& index) {
+    const std::string suffix(SEGMENT_SUFFIX);
+    if (name.size() <= prefix.size() + 1U + suffix.size() || name.compare(0U, prefix.size(), prefix) != 0 ||
+        name[prefix.size()] != '.' || name.compare(name.size() - suffix.size(), suffix.size(), suffix) != 0) {
+        return false;
+    }
+    const std::string digits = name.substr(prefix.size() + 1U, name.size() - prefix.size() - 1U - suffix.size());
+    if (digits.find_first_not_of("0123456789") != std::string::npos) {
+        return false;
+    }
+    index = std::strtoull(digits.c_str(), nullptr, 10);
+    return true;
+}
+
+std::size_t envSize(const char* name, std::size_t fallback) {
+    const char* value = std::getenv(name);
+    if (value == nullptr || value[0] == '\0') {
+        return fallback;
+    }
+    char* end = nullptr;
+    const unsigned long long parsed = std::strtoull(value, &end, 10);
+    return (end != nullptr && *end == '\0') ? static_cast<std::size_t>(parsed) : fallback;
+}
+
+} // namespace
+
+// ---------------------------------------------------------------------------
+// CaptureWriter
+// ---------------------------------------------------------------------------
+
+CaptureWriter::CaptureWriter(const CaptureOptions& options) : options_(options) {
+    options_.segmentBytes = std::max(options_.segmentBytes, sizeof(SegmentHeader) + 4096U);
+    options_.segmentBytes = alignUp(options_.segmentBytes);
+
+    // Continue after segments of earlier runs instead of overwriting them
+    for (const std::string& path : CaptureReader::listSegments(options_.directory, options_.prefix)) {
+        std::uint64_t index = 0U;
+        const std::string name = path.substr(path.find_last_of('/') + 1U);
+        if (parseSegmentName(name, options_.prefix, index)) {
+            nextIndex_ = std::max(nextIndex_, index + 1U);
+        }
+    }
+    if (!openSegment()) {
+        throw std::runtime_error("CaptureWriter: cannot create " +
+                                 segmentPath(options_.directory, options_.prefix, nextIndex_) + ": " +
+                                 std::strerror(errno));
+    }
+}
+
+CaptureWriter::~CaptureWriter() {
+    close();
+}
+
+bool CaptureWriter::openSegment() noexcept {
+    const std::string path = segmentPath(options_.directory, options_.prefix, nextIndex_);
+    const int fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd < 0) {
+        return false;
+    }
+    if (::ftruncate(fd, static_cast<off_t>(options_.segmentBytes)) != 0) {
+        ::close(fd);
+        ::unlink(path.c_str());
+        return false;
+    }
+    void* mapped = ::mmap(nullptr, options_.segmentBytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (mapped == MAP_FAILED) {
+        ::close(fd);
+        ::unlink(path.c_str());
+        return false;
+    }
+
+    fd_ = fd;
+    base_ = static_cast<std::uint8_t*>(mapped);
+    SegmentHeader header{};
+    std::memcpy(header.magic, SEGMENT_MAGIC, sizeof(header.magic));
+    header.version = SEGMENT_VERSION;
+    header.headerBytes = static_cast<std::uint32_t>(sizeof(SegmentHeader));
+    header.createdNs = timing::TscClock::nowNanos();
+    header.segmentIndex = nextIndex_;
+    std::memcpy(base_, &header, sizeof(header));
+    used_ = sizeof(SegmentHeader);
+
+    written_.push_back(path);
+    ++nextIndex_;
+    ++segments_;
+    if (options_.maxSegments > 0U && written_.size() > options_.maxSegments) {
+        ::unlink(written_.front().c_str());
+        written_.erase(written_.begin());
+    }
+    return true;
+}
+
+void CaptureWriter::finishSegment() noexcept {
+    if (base_ == nullptr) {
+        return;
+    }
+    ::munmap(base_, options_.segmentBytes);
+    // The zero-filled tail is dropped; a reader stops at the end of the file as well
+    static_cast<void>(::ftruncate(fd_, static_cast<off_t>(used_)));
+    ::close(fd_);
+    base_ = nullptr;
+    fd_ = -1;
+    used_ = 0U;
+}
+
+bool CaptureWriter::append(std::int64_t receiveNs, std::string_view group, const void* data,
+                           std::size_t size) noexcept {
+    const std::size_t groupBytes = std::min<std::size_t>(group.size(), 0xFFFFU);
+    const std::size_t recordBytes = alignUp(sizeof(RecordHeader) + groupBytes + size);
+    if (base_ == nullptr || sizeof(SegmentHeader) + recordBytes > options_.segmentBytes) {
+        ++dropped_;
+        return false;
+    }
+    if (used_ + recordBytes > options_.segmentBytes) {
+        finishSegment();
+        if (!openSegment()) {
+            ++dropped_;
+            return false;
+        }
+    }
+
+    std::uint8_t* record = base_ + used_;
+    RecordHeader header{};
+    header.groupBytes = static_cast<std::uint16_t>(groupBytes);
+    header.receiveNs = receiveNs;
+    header.payloadBytes = static_cast<std::uint32_t>(size);
+    std::memcpy(record, &header, sizeof(header));
+    std::memcpy(record + sizeof(RecordHeader), group.data(), groupBytes);
+    if (size > 0U) {
+        std::memcpy(record + sizeof(RecordHeader) + groupBytes, data, size);
+    }
+    // Commit: a non-zero length makes the record visible to readers
+    const std::uint32_t committed = static_cast<std::uint32_t>(recordBytes);
+    __atomic_store_n(reinterpret_cast<std::uint32_t*>(record), committed, __ATOMIC_RELEASE);
+
+    used_ += recordBytes;
+    ++records_;
+    return true;
+}
+
+void CaptureWriter::close() noexcept {
+    finishSegment();
+}
+
+std::unique_ptr<CaptureWriter> CaptureWriter::fromEnvironment(const std::string& prefix) {
+    const char* directory = std::getenv("HEXAGON_CAPTURE_DIR");
+    if (directory == nullptr || directory[0] == '\0') {
+        return nullptr;
+    }
+    CaptureOptions options;
+    options.directory = directory;
+    options.prefix = prefix;
+    options.segmentBytes = envSize("HEXAGON_CAPTURE_SEGMENT_MB", options.segmentBytes >> 20U) << 20U;
+    options.maxSegments = envSize("HEXAGON_CAPTURE_MAX_SEGMENTS", options.maxSegments);
+    try {
+        std::unique_ptr<CaptureWriter> writer(new CaptureWriter(options));
+        std::cout << "[Capture] " << prefix << " frames -> " << options.directory << " ("
+                  << (options.segmentBytes >> 20U) << " MB segments)" << std::endl;
+        return writer;
+    } catch (const std::exception& e) {
+        std::cerr << "[Capture] disabled: " << e.what() << std::endl;
+        return nullptr;
+    }
+}
+
+// ---------------------------------------------------------------------------
+// CaptureReader
+// ---------------------------------------------------------------------------
+
+CaptureReader::CaptureReader(std::vector<std::string> segmentPaths) : paths_(std::move(segmentPaths)) {
+}
+
+CaptureReader::CaptureReader(const std::string& directory, const std::string& prefix)
+    : paths_(listSegments(directory, prefix)) {
+}
+
+CaptureReader::~CaptureReader() {
+    unmap();
+}
+
+std::vector<std::string> CaptureReader::listSegments(const std::string& directory, const std::string& prefix) {
+    std::vector<std::pair<std::uint64_t, std::string>> found;
+    DIR* dir = ::opendir(directory.c_str());
+    if (dir == nullptr) {
+        return {};
+    }
+    while (const dirent* entry = ::readdir(dir)) {
+        std::uint64_t index = 0U;
+        const std::string name(entry->d_name);
+        if (parseSegmentName(name, prefix, index)) {
+            found.emplace_back(index, directory + "/" + name);
+        }
+    }
+    ::closedir(dir);
+    std::sort(found.begin(), found.end());
+    std::vector<std::string> paths;
+    paths.reserve(found.size());
+    for (auto& segment : found) {
+        paths.push_back(std::move(segment.second));
+    }
+    return paths;
+}
+
+void CaptureReader::unmap() noexcept {
+    if (base_ != nullptr) {
+        ::munmap(const_cast<std::uint8_t*>(base_), size_);
+        base_ = nullptr;
+        size_ = 0U;
+    }
+}
+
+bool CaptureReader::openNext() {
+    unmap();
+    while (nextPath_ < paths_.size()) {
+        const std::string& path = paths_[nextPath_++];
+        const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            continue;
+        }
+        struct stat info{};
+        if (::fstat(fd, &info) != 0 || static_cast<std::size_t>(info.st_size) < sizeof(SegmentHeader)) {
+            ::close(fd);
+            continue;
+        }
+        const std::size_t size = static_cast<std::size_t>(info.st_size);
+        void* mapped = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (mapped == MAP_FAILED) {
+            continue;
+        }
+        SegmentHeader header{};
+        std::memcpy(&header, mapped, sizeof(header));
+        if (std::memcmp(header.magic, SEGMENT_MAGIC, sizeof(header.magic)) != 0 ||
+            header.version != SEGMENT_VERSION || header.headerBytes < sizeof(SegmentHeader) ||
+            header.headerBytes > size) {
+            ::munmap(mapped, size);
+            continue;
+        }
+        base_ = static_cast<const std::uint8_t*>(mapped);
+        size_ = size;
+        offset_ = header.headerBytes;
+        segmentIndex_ = header.segmentIndex;
+        return true;
+    }
+    return false;
+}
+
+bool CaptureReader::next(CaptureRecord& record) {
+    for (;;) {
+        if (base_ == nullptr || offset_ + sizeof(RecordHeader) > size_) {
+            if (!openNext()) {
+                return false;
+            }
+            continue;
+        }
+        const std::uint8_t* raw = base_ + offset_;
+        const std::uint32_t recordBytes =
+            __atomic_load_n(reinterpret_cast<const std::uint32_t*>(raw), __ATOMIC_ACQUIRE);
+        RecordHeader header{};
+        std::memcpy(&header, raw, sizeof(header));
+        const std::size_t needed = sizeof(RecordHeader) + header.groupBytes + header.payloadBytes;
+        if (recordBytes == 0U || recordBytes < needed || offset_ + recordBytes > size_) {
+            // End of the segment (or a torn tail after a crash)
+            unmap();
+            continue;
+        }
+        record.receiveNs = header.receiveNs;
+        record.group = std::string_view(reinterpret_cast<const char*>(raw + sizeof(RecordHeader)), header.groupBytes);
+        record.data = raw + sizeof(RecordHeader) + header.groupBytes;
+        record.size = header.payloadBytes;
+        record.segmentIndex = segmentIndex_;
+        offset_ += recordBytes;
+        return true;
+    }
+}
+
+// ---------------------------------------------------------------------------
+// ReplayPacer
+// ---------------------------------------------------------------------------
+
+std::int64_t ReplayPacer::dueAt(std::int64_t captureNs, std::int64_t nowNs) noexcept {
+    if (asFastAsPossible()) {
+        return nowNs;
+    }
+    if (!anchored_) {
+        anchored_ = true;
+        firstCaptureNs_ = captureNs;
+        startNs_ = nowNs;
+    }
+    const double elapsed = static_cast<double>(captureNs - firstCaptureNs_) / speed_;
+    return startNs_ + static_cast<std::int64_t>(elapsed);
+}
+
+} // namespace capture
+} // namespace common
@@ -0,0 +1,186 @@
+/**
+ * @file CaptureFile.h
+ * @brief Segment-rotated binary capture of received frames, and its reader
+ *
+ * The DISH adapters can tap every received frame into a capture so lab
+ * benchmarks and regressions run against production traffic shapes; the
+ * capture_replay tool publishes it back through RADIO.
+ *
+ * A capture is a series of segment files "<prefix>.<index>.hxcap" in one
+ * directory. Each segment is preallocated, memory-mapped and filled
+ * front to back; when a frame does not fit, the segment is truncated to
+ * its used length and the next one is opened. Layout, host byte order:
+ *
+ *   SegmentHeader (64 bytes)
+ *   RecordHeader (24 bytes) | group bytes | payload bytes | pad to 8
+ *   ...
+ *   recordBytes == 0 (zero fill) ends the segment
+ *
+ * recordBytes is written last, so a reader never sees a half-written
+ * record, even in the segment a crashed writer left behind.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace common {
+namespace capture {
+
+/// First bytes of every segment
+struct SegmentHeader {
+    char magic[8];               ///< "HXCAP01"
+    std::uint32_t version;
+    std::uint32_t headerBytes;   ///< sizeof(SegmentHeader)
+    std::int64_t createdNs;      ///< Epoch ns when the segment was opened
+    std::uint64_t segmentIndex;
+    std::uint8_t reserved[32];
+};
+static_assert(sizeof(SegmentHeader) == 64U, "capture segment header layout");
+
+/// In front of every frame
+struct RecordHeader {
+    std::uint32_t recordBytes;   ///< Header + group + payload + padding; 0 ends the segment
+    std::uint16_t groupBytes;
+    std::uint16_t reserved;
+    std::int64_t receiveNs;      ///< Epoch ns (TscClock) at receive
+    std::uint32_t payloadBytes;
+    std::uint32_t reserved2;
+};
+static_assert(sizeof(RecordHeader) == 24U, "capture record header layout");
+
+/// Where and how much to capture
+struct CaptureOptions {
+    std::string directory;
+    std::string prefix;
+    std::size_t segmentBytes = 64U * 1024U * 1024U;
+    std::size_t maxSegments = 0U;   ///< Oldest segments of this run are deleted beyond this; 0 keeps all
+};
+
+/**
+ * @class CaptureWriter
+ * @brief Appends frames to memory-mapped segments; one writer thread
+ */
+class CaptureWriter final {
+public:
+    /// @throws std::runtime_error if the first segment cannot be created
+    explicit CaptureWriter(const CaptureOptions& options);
+    ~CaptureWriter();
+
+    CaptureWriter(const CaptureWriter&) = delete;
+    CaptureWriter& operator=(const CaptureWriter&) = delete;
+
+    /**
+     * @brief Appends one frame
+     * @return false if the frame was dropped (larger than a segment, or I/O failure)
+     */
+    bool append(std::int64_t receiveNs, std::string_view group, const void* data, std::size_t size) noexcept;
+
+    /// Truncates the open segment to its used length; later appends are dropped
+    void close() noexcept;
+
+    std::uint64_t records() const noexcept { return records_; }
+    std::uint64_t dropped() const noexcept { return dropped_; }
+    std::uint64_t segments() const noexcept { return segments_; }
+
+    /**
+     * @brief Writer for an adapter if capture is enabled
+     *
+     * $HEXAGON_CAPTURE_DIR enables capture into that directory;
+     * $HEXAGON_CAPTURE_SEGMENT_MB and $HEXAGON_CAPTURE_MAX_SEGMENTS
+     * override the defaults. Returns nullptr when disabled or when the
+     * directory cannot be written (logged), so a tap never stops an adapter.
+     */
+    static std::unique_ptr<CaptureWriter> fromEnvironment(const std::string& prefix);
+
+private:
+    bool openSegment() noexcept;
+    void finishSegment() noexcept;
+
+    CaptureOptions options_;
+    std::uint64_t nextIndex_ = 0U;
+    std::vector<std::string> written_;
+
+    int fd_ = -1;
+    std::uint8_t* base_ = nullptr;
+    std::size_t used_ = 0U;
+
+    std::uint64_t records_ = 0U;
+    std::uint64_t dropped_ = 0U;
+    std::uint64_t segments_ = 0U;
+};
+
+/// One frame read back; pointers stay valid until the next CaptureReader::next()
+struct CaptureRecord {
+    std::int64_t receiveNs = 0;
+    std::string_view group;
+    const std::uint8_t* data = nullptr;
+    std::size_t size = 0U;
+    std::uint64_t segmentIndex = 0U;
+};
+
+/**
+ * @class CaptureReader
+ * @brief Iterates the records of a capture in order
+ */
+class CaptureReader final {
+public:
+    /// Reads the given segments in order; unreadable segments are skipped
+    explicit CaptureReader(std::vector<std::string> segmentPaths);
+
+    /// Reads all "<prefix>.<index>.hxcap" segments of directory in index order
+    CaptureReader(const std::string& directory, const std::string& prefix);
+
+    ~CaptureReader();
+
+    CaptureReader(const CaptureReader&) = delete;
+    CaptureReader& operator=(const CaptureReader&) = delete;
+
+    bool next(CaptureRecord& record);
+
+    /// Segment paths in index order
+    static std::vector<std::string> listSegments(const std::string& directory, const std::string& prefix);
+
+private:
+    bool openNext();
+    void unmap() noexcept;
+
+    std::vector<std::string> paths_;
+    std::size_t nextPath_ = 0U;
+
+    const std::uint8_t* base_ = nullptr;
+    std::size_t size_ = 0U;
+    std::size_t offset_ = 0U;
+    std::uint64_t segmentIndex_ = 0U;
+};
+
+/**
+ * @class ReplayPacer
+ * @brief Maps capture timestamps to send times for replay
+ *
+ * speed 1.0 keeps the original pacing, 4.0 replays four times faster,
+ * 0 sends as fast as possible.
+ */
+class ReplayPacer final {
+public:
+    explicit ReplayPacer(double speed) noexcept : speed_(speed) {}
+
+    /// Wall time (ns) at which the frame captured at captureNs is due; the first frame is due at nowNs
+    std::int64_t dueAt(std::int64_t captureNs, std::int64_t nowNs) noexcept;
+
+    bool asFastAsPossible() const noexcept { return !(speed_ > 0.0); }
+
+private:
+    double speed_;
+    bool anchored_ = false;
+    std::int64_t firstCaptureNs_ = 0;
+    std::int64_t startNs_ = 0;
+};
+
+} // namespace capture
+} // namespace common
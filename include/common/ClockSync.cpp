@@ -0,0 +1,427 @@
+/**
+ * @file ClockSync.cpp
+ * @brief Offset estimator and UDP side channel for ClockSync
+ */
+
+#include "common/ClockSync.h"
+#include "common/KeyValueFile.h"
+#include "common/TscClock.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+
+#include <arpa/inet.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+namespace common {
+namespace timing {
+
+namespace {
+
+constexpr const char* DEFAULT_CLOCK_SYNC_PATH = "config/clock_sync.conf";
+
+constexpr std::uint32_t PACKET_MAGIC = 0x48584353U;  // "HXCS"
+
+/// Samples whose round trip exceeds this multiple of the best one are left out of the fit
+constexpr double DELAY_FILTER_FACTOR = 2.0;
+constexpr std::int64_t DELAY_FILTER_SLACK_NS = 1000;
+
+/// Quartz drifts tens of ppm; a larger slope is noise from a short window
+constexpr double MAX_DRIFT_PPM = 500.0;
+
+/// Exchanges sent back to back at start-up so the first estimate is ready quickly
+constexpr int WARMUP_EXCHANGES = 8;
+constexpr int WARMUP_INTERVAL_MS = 10;
+
+constexpr int SERVER_POLL_MS = 100;
+
+struct Packet {
+    std::uint32_t magic;
+    std::uint32_t seq;
+    std::int64_t t1;
+    std::int64_t t2;
+    std::int64_t t3;
+};
+static_assert(sizeof(Packet) == 32U, "ClockSync packet layout");
+
+void setReceiveTimeout(int fd, int timeoutMs) {
+    timeval tv{};
+    tv.tv_sec = timeoutMs / 1000;
+    tv.tv_usec = static_cast<suseconds_t>((timeoutMs % 1000) * 1000);
+    setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+}
+
+int parseNumber(const std::string& text, const std::string& key, int minValue, int maxValue) {
+    std::size_t used = 0U;
+    int value = 0;
+    try {
+        value = std::stoi(text, &used);
+    } catch (const std::exception&) {
+        used = 0U;
+    }
+    if (used == 0U || used != text.size() || value < minValue || value > maxValue) {
+        throw std::invalid_argument("ClockSync: invalid " + key + ": '" + text + "'");
+    }
+    return value;
+}
+
+} // namespace
+
+// ---------------------------------------------------------------------------
+// ClockOffsetEstimator
+// ---------------------------------------------------------------------------
+
+ClockOffsetEstimator::ClockOffsetEstimator(std::size_t window)
+    : window_(std::max<std::size_t>(window, 4U)) {
+}
+
+void ClockOffsetEstimator::addSample(const OffsetSample& sample) {
+    if (sample.t4 < sample.t1 || sample.t3 < sample.t2 || sample.delay() < 0) {
+        return;
+    }
+    window_[next_] = Point{sample.t4, sample.offset(), sample.delay()};
+    next_ = (next_ + 1U) % window_.size();
+    count_ = std::min(count_ + 1U, window_.size());
+
+    std::int64_t minDelay = window_[0].delayNs;
+    std::int64_t latest = window_[0].localNs;
+    for (std::size_t i = 0U; i < count_; ++i) {
+        minDelay = std::min(minDelay, window_[i].delayNs);
+        latest = std::max(latest, window_[i].localNs);
+    }
+    const double cutoff = static_cast<double>(minDelay) * DELAY_FILTER_FACTOR +
+                          static_cast<double>(DELAY_FILTER_SLACK_NS);
+
+    // Least squares of offset against local time (relative to the latest sample)
+    double n = 0.0;
+    double sumX = 0.0;
+    double sumY = 0.0;
+    double sumXX = 0.0;
+    double sumXY = 0.0;
+    for (std::size_t i = 0U; i < count_; ++i) {
+        const Point& p = window_[i];
+        if (static_cast<double>(p.delayNs) > cutoff) {
+            continue;
+        }
+        const double x = static_cast<double>(p.localNs - latest);
+        const double y = static_cast<double>(p.offsetNs);
+        n += 1.0;
+        sumX += x;
+        sumY += y;
+        sumXX += x * x;
+        sumXY += x * y;
+    }
+
+    double slope = 0.0;
+    double intercept = sumY / n;
+    const double varX = sumXX - sumX * sumX / n;
+    if (n >= 4.0 && varX > 0.0) {
+        slope = (sumXY - sumX * sumY / n) / varX;
+        slope = std::max(-MAX_DRIFT_PPM * 1e-6, std::min(MAX_DRIFT_PPM * 1e-6, slope));
+        intercept = (sumY - slope * sumX) / n;
+    }
+
+    double residual = 0.0;
+    for (std::size_t i = 0U; i < count_; ++i) {
+        const Point& p = window_[i];
+        if (static_cast<double>(p.delayNs) > cutoff) {
+            continue;
+        }
+        const double error = static_cast<double>(p.offsetNs) -
+                             (intercept + slope * static_cast<double>(p.localNs - latest));
+        residual += error * error;
+    }
+    const double spread = std::sqrt(residual / n);
+
+    ClockOffset estimate;
+    estimate.valid = true;
+    estimate.offsetNs = std::llround(intercept);
+    estimate.driftPpm = slope * 1e6;
+    estimate.uncertaintyNs = minDelay / 2 + std::llround(spread);
+    estimate.referenceNs = latest;
+    estimate.samples = static_cast<std::uint32_t>(n);
+    publish(estimate);
+}
+
+void ClockOffsetEstimator::publish(const ClockOffset& estimate) noexcept {
+    const std::uint32_t seq = seq_.load(std::memory_order_relaxed);
+    seq_.store(seq + 1U, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    valid_.store(estimate.valid, std::memory_order_relaxed);
+    offsetNs_.store(estimate.offsetNs, std::memory_order_relaxed);
+    driftPpm_.store(estimate.driftPpm, std::memory_order_relaxed);
+    uncertaintyNs_.store(estimate.uncertaintyNs, std::memory_order_relaxed);
+    referenceNs_.store(estimate.referenceNs, std::memory_order_relaxed);
+    samples_.store(estimate.samples, std::memory_order_relaxed);
+    seq_.store(seq + 2U, std::memory_order_release);
+}
+
+ClockOffset ClockOffsetEstimator::estimate() const noexcept {
+    ClockOffset result;
+    for (;;) {
+        const std::uint32_t seq = seq_.load(std::memory_order_acquire);
+        if ((seq & 1U) != 0U) {
+            continue;
+        }
+        result.valid = valid_.load(std::memory_order_relaxed);
+        result.offsetNs = offsetNs_.load(std::memory_order_relaxed);
+        result.driftPpm = driftPpm_.load(std::memory_order_relaxed);
+        result.uncertaintyNs = uncertaintyNs_.load(std::memory_order_relaxed);
+        result.referenceNs = referenceNs_.load(std::memory_order_relaxed);
+        result.samples = samples_.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (seq_.load(std::memory_order_relaxed) == seq) {
+            break;
+        }
+    }
+    if (result.valid && TscClock::nowNanos() - result.referenceNs > maxAgeNs_.load(std::memory_order_relaxed)) {
+        result.valid = false;
+    }
+    return result;
+}
+
+std::int64_t ClockOffsetEstimator::toPeerMicros(std::int64_t localMicros) const noexcept {
+    const ClockOffset offset = estimate();
+    if (!offset.valid) {
+        return localMicros;
+    }
+    return localMicros + offset.offsetAt(localMicros * 1000) / 1000;
+}
+
+// ---------------------------------------------------------------------------
+// ClockSyncServer
+// ---------------------------------------------------------------------------
+
+ClockSyncServer::ClockSyncServer(std::uint16_t port) {
+    fd_ = ::socket(AF_INET, SOCK_DGRAM, 0);
+    if (fd_ < 0) {
+        throw std::runtime_error(std::string("ClockSyncServer: socket: ") + std::strerror(errno));
+    }
+    const int reuse = 1;
+    setsockopt(fd_, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_ANY);
+    addr.sin_port = htons(port);
+    socklen_t length = sizeof(addr);
+    if (::bind(fd_, reinterpret_cast<const sockaddr*>(&addr), sizeof(addr)) != 0 ||
+        ::getsockname(fd_, reinterpret_cast<sockaddr*>(&addr), &length) != 0) {
+        const std::string error = std::strerror(errno);
+        ::close(fd_);
+        throw std::runtime_error("ClockSyncServer: bind port " + std::to_string(port) + ": " + error);
+    }
+    port_ = ntohs(addr.sin_port);
+    setReceiveTimeout(fd_, SERVER_POLL_MS);
+    thread_ = std::thread(&ClockSyncServer::run, this);
+}
+
+ClockSyncServer::~ClockSyncServer() {
+    running_.store(false);
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+    ::close(fd_);
+}
+
+void ClockSyncServer::run() {
+    while (running_.load(std::memory_order_relaxed)) {
+        Packet packet{};
+        sockaddr_in from{};
+        socklen_t fromLength = sizeof(from);
+        const ssize_t received = ::recvfrom(fd_, &packet, sizeof(packet), 0,
+                                            reinterpret_cast<sockaddr*>(&from), &fromLength);
+        packet.t2 = TscClock::nowNanos();
+        if (received != static_cast<ssize_t>(sizeof(packet)) || packet.magic != PACKET_MAGIC) {
+            continue;
+        }
+        packet.t3 = TscClock::nowNanos();
+        if (::sendto(fd_, &packet, sizeof(packet), 0, reinterpret_cast<const sockaddr*>(&from), fromLength) ==
+            static_cast<ssize_t>(sizeof(packet))) {
+            answered_.fetch_add(1U, std::memory_order_relaxed);
+        }
+    }
+}
+
+// ---------------------------------------------------------------------------
+// ClockSyncClient
+// ---------------------------------------------------------------------------
+
+ClockSyncClient::ClockSyncClient(const std::string& host, std::uint16_t port, int intervalMs)
+    : intervalMs_(std::max(intervalMs, 1)) {
+    addrinfo hints{};
+    hints.ai_family = AF_INET;
+    hints.ai_socktype = SOCK_DGRAM;
+    addrinfo* resolved = nullptr;
+    const int status = ::getaddrinfo(host.c_str(), std::to_string(port).c_str(), &hints, &resolved);
+    if (status != 0) {
+        throw std::runtime_error("ClockSyncClient: cannot resolve " + host + ": " + ::gai_strerror(status));
+    }
+    fd_ = ::socket(AF_INET, SOCK_DGRAM, 0);
+    const bool connected = fd_ >= 0 && ::connect(fd_, resolved->ai_addr, resolved->ai_addrlen) == 0;
+    ::freeaddrinfo(resolved);
+    if (!connected) {
+        const std::string error = std::strerror(errno);
+        if (fd_ >= 0) {
+            ::close(fd_);
+        }
+        throw std::runtime_error("ClockSyncClient: " + host + ":" + std::to_string(port) + ": " + error);
+    }
+    setReceiveTimeout(fd_, std::min(intervalMs_, 1000));
+    thread_ = std::thread(&ClockSyncClient::run, this);
+}
+
+ClockSyncClient::~ClockSyncClient() {
+    running_.store(false);
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+    ::close(fd_);
+}
+
+void ClockSyncClient::run() {
+    std::uint32_t seq = 0U;
+    int exchanges = 0;
+    while (running_.load(std::memory_order_relaxed)) {
+        Packet request{PACKET_MAGIC, ++seq, TscClock::nowNanos(), 0, 0};
+        sent_.fetch_add(1U, std::memory_order_relaxed);
+        bool answered = false;
+        if (::send(fd_, &request, sizeof(request), 0) == static_cast<ssize_t>(sizeof(request))) {
+            Packet reply{};
+            // Late replies to earlier requests are skipped until ours arrives or the timeout hits
+            for (;;) {
+                const ssize_t received = ::recv(fd_, &reply, sizeof(reply), 0);
+                const std::int64_t t4 = TscClock::nowNanos();
+                if (received < 0) {
+                    break;
+                }
+                if (received == static_cast<ssize_t>(sizeof(reply)) && reply.magic == PACKET_MAGIC &&
+                    reply.seq == seq) {
+                    estimator_.addSample(OffsetSample{reply.t1, reply.t2, reply.t3, t4});
+                    answered = true;
+                    break;
+                }
+            }
+        }
+        if (!answered) {
+            lost_.fetch_add(1U, std::memory_order_relaxed);
+        }
+
+        const int pauseMs = (++exchanges < WARMUP_EXCHANGES) ? WARMUP_INTERVAL_MS : intervalMs_;
+        for (int waited = 0; waited < pauseMs && running_.load(std::memory_order_relaxed); waited += 10) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(std::min(10, pauseMs - waited)));
+        }
+    }
+}
+
+// ---------------------------------------------------------------------------
+// ClockSync
+// ---------------------------------------------------------------------------
+
+std::unique_ptr<ClockSync> ClockSync::fromConfig(const std::map<std::string, std::string>& config) {
+    std::unique_ptr<ClockSync> sync(new ClockSync());
+    int intervalMs = 200;
+    int maxAgeMs = 10000;
+    int listenPort = -1;
+    std::map<std::string, std::pair<std::string, std::uint16_t>> peers;
+
+    for (const auto& entry : config) {
+        const std::string& key = entry.first;
+        const std::string& value = entry.second;
+        if (key == "listen_port") {
+            listenPort = parseNumber(value, key, 0, 65535);
+        } else if (key == "interval_ms") {
+            intervalMs = parseNumber(value, key, 1, 60000);
+        } else if (key == "max_age_ms") {
+            maxAgeMs = parseNumber(value, key, 1, 3600000);
+        } else if (key.compare(0U, 5U, "peer.") == 0 && key.size() > 5U) {
+            const std::size_t colon = value.rfind(':');
+            if (colon == std::string::npos || colon == 0U) {
+                throw std::invalid_argument("ClockSync: " + key + " must be host:port, got '" + value + "'");
+            }
+            peers[key.substr(5U)] = std::make_pair(
+                value.substr(0U, colon),
+                static_cast<std::uint16_t>(parseNumber(value.substr(colon + 1U), key, 1, 65535)));
+        } else {
+            throw std::invalid_argument("ClockSync: unknown key '" + key + "'");
+        }
+    }
+
+    if (listenPort >= 0) {
+        sync->server_.reset(new ClockSyncServer(static_cast<std::uint16_t>(listenPort)));
+    }
+    for (const auto& peer : peers) {
+        std::unique_ptr<ClockSyncClient> client(
+            new ClockSyncClient(peer.second.first, peer.second.second, intervalMs));
+        client->estimator().setMaxAge(
+            static_cast<std::int64_t>(maxAgeMs) * 1000000);
+        sync->peers_[peer.first] = std::move(client);
+    }
+    return sync;
+}
+
+std::unique_ptr<ClockSync> ClockSync::fromFile(const std::string& path) {
+    return fromConfig(config::readKeyValueFile(path, "ClockSync"));
+}
+
+ClockSync& ClockSync::process() {
+    static std::unique_ptr<ClockSync> sync = []() {
+        const char* env = std::getenv("HEXAGON_CLOCK_SYNC");
+        const std::string path = (env != nullptr && env[0] != '\0') ? env : DEFAULT_CLOCK_SYNC_PATH;
+        try {
+            return fromFile(path);
+        } catch (const std::exception& e) {
+            std::cerr << "[ClockSync] " << path << " ignored: " << e.what() << std::endl;
+            return std::unique_ptr<ClockSync>(new ClockSync());
+        }
+    }();
+    return *sync;
+}
+
+const ClockOffsetEstimator* ClockSync::peer(const std::string& name) const {
+    const auto it = peers_.find(name);
+    return it != peers_.end() ? &it->second->estimator() : nullptr;
+}
+
+std::uint16_t ClockSync::listenPort() const noexcept {
+    return server_ ? server_->port() : static_cast<std::uint16_t>(0U);
+}
+
+std::string ClockSync::report() const {
+    std::ostringstream out;
+    if (server_) {
+        out << "serving on udp port " << server_->port() << ", " << server_->answered() << " requests answered\n";
+    }
+    for (const auto& peer : peers_) {
+        out << peer.first << ": " << toString(peer.second->estimator().estimate())
+            << " (sent " << peer.second->sent() << ", lost " << peer.second->lost() << ")\n";
+    }
+    return out.str();
+}
+
+std::string toString(const ClockOffset& offset) {
+    if (!offset.valid) {
+        return "unsynchronized";
+    }
+    std::ostringstream out;
+    out << std::fixed << std::setprecision(1) << std::showpos
+        << static_cast<double>(offset.offsetNs) / 1000.0 << " µs" << std::noshowpos
+        << " ± " << static_cast<double>(offset.uncertaintyNs) / 1000.0 << " µs"
+        << ", drift " << std::setprecision(2) << offset.driftPpm << " ppm";
+    return out.str();
+}
+
+} // namespace timing
+} // namespace common
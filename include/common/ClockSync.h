@@ -0,0 +1,224 @@
+/**
+ * @file ClockSync.h
+ * @brief Cross-host clock offset and drift estimation for hop delays
+ *
+ * firstHopDelayTime and secondHopDelayTime subtract timestamps taken on
+ * different hosts, so any offset between their clocks ends up in the
+ * delay. Each hexagon can serve its clock on a small UDP side channel and
+ * poll its upstream peers NTP-style:
+ *
+ *   client t1 --request--> t2 server
+ *   client t4 <--reply---- t3 server
+ *
+ *   offset = ((t2 - t1) + (t3 - t4)) / 2    (peer clock minus local clock)
+ *   delay  = (t4 - t1) - (t3 - t2)          (round trip on the wire)
+ *
+ * A sample's offset is off by at most delay / 2, so the estimator keeps
+ * the low-delay samples of a sliding window and fits offset against local
+ * time; the slope is the drift. The uncertainty reported with the estimate
+ * is half the best round trip plus the fit's residual spread.
+ *
+ * @code
+ * # clock_sync.conf
+ * listen_port      = 7790                  # serve this host's clock
+ * peer.a_hexagon   = 10.0.0.11:7790        # poll a peer
+ * interval_ms      = 200
+ * @endcode
+ *
+ * All timestamps come from TscClock. Packets use host byte order; the
+ * hexagons run on the same architecture.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace common {
+namespace timing {
+
+/// One request/reply exchange, nanoseconds
+struct OffsetSample {
+    std::int64_t t1 = 0;  ///< Client send (local clock)
+    std::int64_t t2 = 0;  ///< Server receive (peer clock)
+    std::int64_t t3 = 0;  ///< Server send (peer clock)
+    std::int64_t t4 = 0;  ///< Client receive (local clock)
+
+    std::int64_t offset() const noexcept { return ((t2 - t1) + (t3 - t4)) / 2; }
+    std::int64_t delay() const noexcept { return (t4 - t1) - (t3 - t2); }
+};
+
+/// Peer clock relative to the local clock
+struct ClockOffset {
+    bool valid = false;
+    std::int64_t offsetNs = 0;       ///< Peer minus local at referenceNs
+    double driftPpm = 0.0;           ///< Offset change per local second, in µs
+    std::int64_t uncertaintyNs = 0;  ///< Bound on the offset error
+    std::int64_t referenceNs = 0;    ///< Local time of the estimate
+    std::uint32_t samples = 0;       ///< Samples the fit used
+
+    /// Offset extrapolated to localNs with the drift
+    std::int64_t offsetAt(std::int64_t localNs) const noexcept {
+        return offsetNs + static_cast<std::int64_t>(driftPpm * 1e-6 * static_cast<double>(localNs - referenceNs));
+    }
+};
+
+/**
+ * @class ClockOffsetEstimator
+ * @brief Filters exchange samples into an offset/drift estimate
+ *
+ * addSample() is called by one thread (the sync client); estimate() is
+ * lock-free and safe from any thread, so delay calculators can read it per
+ * message.
+ */
+class ClockOffsetEstimator final {
+public:
+    static constexpr std::size_t DEFAULT_WINDOW = 64;
+
+    explicit ClockOffsetEstimator(std::size_t window = DEFAULT_WINDOW);
+
+    ClockOffsetEstimator(const ClockOffsetEstimator&) = delete;
+    ClockOffsetEstimator& operator=(const ClockOffsetEstimator&) = delete;
+
+    /// Adds an exchange; samples with negative delay or out-of-order stamps are dropped
+    void addSample(const OffsetSample& sample);
+
+    ClockOffset estimate() const noexcept;
+
+    /// Converts a local timestamp (µs) to the peer's clock; unchanged while invalid
+    std::int64_t toPeerMicros(std::int64_t localMicros) const noexcept;
+
+    /// Estimates older than this are reported invalid
+    void setMaxAge(std::int64_t maxAgeNs) noexcept { maxAgeNs_.store(maxAgeNs, std::memory_order_relaxed); }
+
+private:
+    struct Point {
+        std::int64_t localNs;
+        std::int64_t offsetNs;
+        std::int64_t delayNs;
+    };
+
+    void publish(const ClockOffset& estimate) noexcept;
+
+    std::vector<Point> window_;
+    std::size_t next_ = 0U;
+    std::size_t count_ = 0U;
+
+    std::atomic<std::int64_t> maxAgeNs_{10000000000};
+
+    // Seqlock-published estimate
+    std::atomic<std::uint32_t> seq_{0};
+    std::atomic<bool> valid_{false};
+    std::atomic<std::int64_t> offsetNs_{0};
+    std::atomic<double> driftPpm_{0.0};
+    std::atomic<std::int64_t> uncertaintyNs_{0};
+    std::atomic<std::int64_t> referenceNs_{0};
+    std::atomic<std::uint32_t> samples_{0};
+};
+
+/**
+ * @class ClockSyncServer
+ * @brief Answers offset requests on a UDP port with this host's TscClock
+ */
+class ClockSyncServer final {
+public:
+    /// Binds 0.0.0.0:port; port 0 picks a free one (see port())
+    explicit ClockSyncServer(std::uint16_t port);
+    ~ClockSyncServer();
+
+    ClockSyncServer(const ClockSyncServer&) = delete;
+    ClockSyncServer& operator=(const ClockSyncServer&) = delete;
+
+    std::uint16_t port() const noexcept { return port_; }
+    std::uint64_t answered() const noexcept { return answered_.load(std::memory_order_relaxed); }
+
+private:
+    void run();
+
+    int fd_ = -1;
+    std::uint16_t port_ = 0U;
+    std::atomic<bool> running_{true};
+    std::atomic<std::uint64_t> answered_{0};
+    std::thread thread_;
+};
+
+/**
+ * @class ClockSyncClient
+ * @brief Polls one peer's ClockSyncServer and feeds an estimator
+ */
+class ClockSyncClient final {
+public:
+    ClockSyncClient(const std::string& host, std::uint16_t port, int intervalMs = 200);
+    ~ClockSyncClient();
+
+    ClockSyncClient(const ClockSyncClient&) = delete;
+    ClockSyncClient& operator=(const ClockSyncClient&) = delete;
+
+    const ClockOffsetEstimator& estimator() const noexcept { return estimator_; }
+    ClockOffsetEstimator& estimator() noexcept { return estimator_; }
+    std::uint64_t sent() const noexcept { return sent_.load(std::memory_order_relaxed); }
+    std::uint64_t lost() const noexcept { return lost_.load(std::memory_order_relaxed); }
+
+private:
+    void run();
+
+    int fd_ = -1;
+    int intervalMs_;
+    ClockOffsetEstimator estimator_;
+    std::atomic<bool> running_{true};
+    std::atomic<std::uint64_t> sent_{0};
+    std::atomic<std::uint64_t> lost_{0};
+    std::thread thread_;
+};
+
+/**
+ * @class ClockSync
+ * @brief Per-process server and peer clients loaded from configuration
+ */
+class ClockSync final {
+public:
+    ClockSync() = default;
+
+    /**
+     * @brief Starts what config asks for
+     * @throws std::invalid_argument on unknown keys or bad values
+     * @throws std::runtime_error if a socket cannot be set up
+     */
+    static std::unique_ptr<ClockSync> fromConfig(const std::map<std::string, std::string>& config);
+
+    /// Reads "key = value" lines ('#' starts a comment); a missing file disables sync
+    static std::unique_ptr<ClockSync> fromFile(const std::string& path);
+
+    /**
+     * @brief Process-wide instance, started once
+     *
+     * Path: $HEXAGON_CLOCK_SYNC, else config/clock_sync.conf relative to the
+     * working directory. Configuration errors are logged and disable sync.
+     */
+    static ClockSync& process();
+
+    /// Estimator for a configured peer; nullptr if the peer is not configured
+    const ClockOffsetEstimator* peer(const std::string& name) const;
+
+    /// Port served, 0 if not serving
+    std::uint16_t listenPort() const noexcept;
+
+    /// One line per peer with offset, drift and uncertainty, for logs
+    std::string report() const;
+
+private:
+    std::unique_ptr<ClockSyncServer> server_;
+    std::map<std::string, std::unique_ptr<ClockSyncClient>> peers_;
+};
+
+/// Formats an estimate as "+12.3 µs ± 4.5 µs, drift 1.2 ppm" or "unsynchronized"
+std::string toString(const ClockOffset& offset);
+
+} // namespace timing
+} // namespace common
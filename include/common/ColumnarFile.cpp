@@ -0,0 +1,438 @@
+/**
+ * @file ColumnarFile.cpp
+ * @brief ColumnarWriter, ColumnarExporter and ColumnarReader implementation
+ */
+
+#include "common/ColumnarFile.h"
+#include "common/TscClock.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace common {
+namespace store {
+
+namespace {
+
+constexpr char FILE_MAGIC[8] = {'H', 'X', 'C', 'O', 'L', '0', '1', '\0'};
+constexpr char CHUNK_MAGIC[8] = {'H', 'X', 'C', 'H', 'U', 'N', 'K', '\0'};
+constexpr char FOOTER_MAGIC[8] = {'H', 'X', 'C', 'O', 'L', 'E', 'N', 'D'};
+constexpr std::uint32_t FILE_VERSION = 1U;
+constexpr std::size_t WRITE_BUFFER_BYTES = 1U << 20U;
+
+std::size_t chunkBytes(std::size_t columns, std::size_t rows) noexcept {
+    return sizeof(ChunkHeader) + columns * (sizeof(ColumnChunkStats) + rows * sizeof(ColumnCell));
+}
+
+ColumnChunkStats columnStats(ColumnType type, const ColumnCell* cells, std::size_t rows) noexcept {
+    ColumnChunkStats stats{};
+    if (type == ColumnType::Int64) {
+        stats.min.asInt = std::numeric_limits<std::int64_t>::max();
+        stats.max.asInt = std::numeric_limits<std::int64_t>::min();
+        for (std::size_t row = 0U; row < rows; ++row) {
+            stats.min.asInt = std::min(stats.min.asInt, cells[row].asInt);
+            stats.max.asInt = std::max(stats.max.asInt, cells[row].asInt);
+        }
+    } else {
+        // An all-NaN column keeps an empty range and never matches
+        stats.min.asDouble = std::numeric_limits<double>::infinity();
+        stats.max.asDouble = -std::numeric_limits<double>::infinity();
+        for (std::size_t row = 0U; row < rows; ++row) {
+            const double value = cells[row].asDouble;
+            if (!std::isnan(value)) {
+                stats.min.asDouble = std::min(stats.min.asDouble, value);
+                stats.max.asDouble = std::max(stats.max.asDouble, value);
+            }
+        }
+    }
+    return stats;
+}
+
+bool inside(ColumnType type, ColumnCell value, const ColumnRange& range) noexcept {
+    if (type == ColumnType::Int64) {
+        return value.asInt >= range.min.asInt && value.asInt <= range.max.asInt;
+    }
+    return value.asDouble >= range.min.asDouble && value.asDouble <= range.max.asDouble;
+}
+
+bool overlaps(ColumnType type, const ColumnChunkStats& stats, const ColumnRange& range) noexcept {
+    if (type == ColumnType::Int64) {
+        return stats.max.asInt >= range.min.asInt && stats.min.asInt <= range.max.asInt;
+    }
+    return stats.max.asDouble >= range.min.asDouble && stats.min.asDouble <= range.max.asDouble;
+}
+
+} // namespace
+
+// ---------------------------------------------------------------------------
+// ColumnBuffer
+// ---------------------------------------------------------------------------
+
+ColumnBuffer::ColumnBuffer(std::size_t columns, std::size_t capacity)
+    : columns_(columns),
+      capacity_(std::max<std::size_t>(capacity, 1U)),
+      cells_(columns_ * capacity_) {
+}
+
+void ColumnBuffer::append(const ColumnCell* row) noexcept {
+    for (std::size_t column = 0U; column < columns_; ++column) {
+        cells_[column * capacity_ + rows_] = row[column];
+    }
+    ++rows_;
+}
+
+// ---------------------------------------------------------------------------
+// ColumnarWriter
+// ---------------------------------------------------------------------------
+
+ColumnarWriter::ColumnarWriter(const std::string& path, const ColumnSchema& schema)
+    : schema_(schema),
+      stats_(schema.size()) {
+    if (schema_.empty()) {
+        throw std::invalid_argument("ColumnarWriter: schema has no columns");
+    }
+    std::vector<ColumnDescriptor> descriptors(schema_.size());
+    for (std::size_t column = 0U; column < schema_.size(); ++column) {
+        if (schema_[column].name.size() >= sizeof(descriptors[column].name)) {
+            throw std::invalid_argument("ColumnarWriter: column name too long: " + schema_[column].name);
+        }
+        std::memset(&descriptors[column], 0, sizeof(ColumnDescriptor));
+        std::memcpy(descriptors[column].name, schema_[column].name.data(), schema_[column].name.size());
+        descriptors[column].type = static_cast<std::uint32_t>(schema_[column].type);
+    }
+
+    file_ = std::fopen(path.c_str(), "wb");
+    if (file_ == nullptr) {
+        throw std::runtime_error("ColumnarWriter: cannot create " + path + ": " + std::strerror(errno));
+    }
+    std::setvbuf(file_, nullptr, _IOFBF, WRITE_BUFFER_BYTES);
+
+    ColumnarFileHeader header{};
+    std::memcpy(header.magic, FILE_MAGIC, sizeof(header.magic));
+    header.version = FILE_VERSION;
+    header.headerBytes = sizeof(ColumnarFileHeader);
+    header.columns = static_cast<std::uint32_t>(schema_.size());
+    header.descriptorBytes = sizeof(ColumnDescriptor);
+    header.createdNs = timing::TscClock::nowNanos();
+    if (!write(&header, sizeof(header)) ||
+        !write(descriptors.data(), descriptors.size() * sizeof(ColumnDescriptor))) {
+        std::fclose(file_);
+        file_ = nullptr;
+        throw std::runtime_error("ColumnarWriter: cannot write header of " + path);
+    }
+}
+
+ColumnarWriter::~ColumnarWriter() {
+    close();
+}
+
+bool ColumnarWriter::write(const void* data, std::size_t bytes) noexcept {
+    if (std::fwrite(data, 1U, bytes, file_) != bytes) {
+        return false;
+    }
+    offset_ += bytes;
+    return true;
+}
+
+bool ColumnarWriter::writeChunk(const ColumnBuffer& buffer) noexcept {
+    if (file_ == nullptr || buffer.empty() || buffer.columns() != schema_.size()) {
+        return false;
+    }
+    ChunkHeader header{};
+    std::memcpy(header.magic, CHUNK_MAGIC, sizeof(header.magic));
+    header.rows = buffer.rows();
+    header.columns = schema_.size();
+    header.chunkBytes = chunkBytes(schema_.size(), buffer.rows());
+    for (std::size_t column = 0U; column < schema_.size(); ++column) {
+        stats_[column] = columnStats(schema_[column].type, buffer.column(column), buffer.rows());
+    }
+
+    const std::uint64_t start = offset_;
+    bool ok = write(&header, sizeof(header)) && write(stats_.data(), stats_.size() * sizeof(ColumnChunkStats));
+    for (std::size_t column = 0U; ok && column < schema_.size(); ++column) {
+        ok = write(buffer.column(column), buffer.rows() * sizeof(ColumnCell));
+    }
+    if (!ok) {
+        return false;
+    }
+    offsets_.push_back(start);
+    rows_ += buffer.rows();
+    return true;
+}
+
+bool ColumnarWriter::close() noexcept {
+    if (file_ == nullptr) {
+        return true;
+    }
+    ColumnarFooter footer{};
+    footer.chunks = offsets_.size();
+    footer.directoryOffset = offset_;
+    footer.rows = rows_;
+    std::memcpy(footer.magic, FOOTER_MAGIC, sizeof(footer.magic));
+    const bool ok = write(offsets_.data(), offsets_.size() * sizeof(std::uint64_t)) &&
+                    write(&footer, sizeof(footer));
+    const bool closed = std::fclose(file_) == 0;
+    file_ = nullptr;
+    return ok && closed;
+}
+
+// ---------------------------------------------------------------------------
+// ColumnarExporter
+// ---------------------------------------------------------------------------
+
+ColumnarExporter::ColumnarExporter(const std::string& path, const ColumnSchema& schema,
+                                   std::size_t rowsPerChunk, std::size_t queuedChunks)
+    : writer_(path, schema),
+      queuedChunks_(std::max<std::size_t>(queuedChunks, 1U)) {
+    // Current, in writing and queued: handOver() always finds a free buffer
+    for (std::size_t i = 0U; i < queuedChunks_ + 1U; ++i) {
+        free_.push_back(std::make_unique<ColumnBuffer>(schema.size(), rowsPerChunk));
+    }
+    current_ = std::make_unique<ColumnBuffer>(schema.size(), rowsPerChunk);
+    thread_ = std::thread(&ColumnarExporter::writerLoop, this);
+}
+
+ColumnarExporter::~ColumnarExporter() {
+    flush();
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    wake_.notify_one();
+    thread_.join();
+    writer_.close();
+}
+
+void ColumnarExporter::append(const ColumnCell* row) noexcept {
+    current_->append(row);
+    rows_.fetch_add(1U, std::memory_order_relaxed);
+    if (current_->full()) {
+        handOver();
+    }
+}
+
+void ColumnarExporter::flush() noexcept {
+    if (!current_->empty()) {
+        handOver();
+    }
+}
+
+void ColumnarExporter::handOver() noexcept {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (pending_.size() < queuedChunks_ && !free_.empty()) {
+            pending_.push_back(std::move(current_));
+            current_ = std::move(free_.back());
+            free_.pop_back();
+        } else {
+            droppedRows_.fetch_add(current_->rows(), std::memory_order_relaxed);
+            current_->clear();
+            return;
+        }
+    }
+    wake_.notify_one();
+}
+
+void ColumnarExporter::writerLoop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    for (;;) {
+        wake_.wait(lock, [this] { return stopping_ || !pending_.empty(); });
+        if (pending_.empty()) {
+            return;
+        }
+        std::unique_ptr<ColumnBuffer> buffer = std::move(pending_.front());
+        pending_.pop_front();
+        lock.unlock();
+
+        if (writer_.writeChunk(*buffer)) {
+            chunks_.fetch_add(1U, std::memory_order_relaxed);
+        } else {
+            droppedRows_.fetch_add(buffer->rows(), std::memory_order_relaxed);
+        }
+        buffer->clear();
+
+        lock.lock();
+        free_.push_back(std::move(buffer));
+    }
+}
+
+ExportStats ColumnarExporter::stats() const noexcept {
+    ExportStats result;
+    result.rows = rows_.load(std::memory_order_relaxed);
+    result.chunks = chunks_.load(std::memory_order_relaxed);
+    result.droppedRows = droppedRows_.load(std::memory_order_relaxed);
+    return result;
+}
+
+// ---------------------------------------------------------------------------
+// ColumnRange / ChunkView
+// ---------------------------------------------------------------------------
+
+ColumnRange ColumnRange::ints(std::size_t column, std::int64_t min, std::int64_t max) noexcept {
+    ColumnRange range{};
+    range.column = column;
+    range.min.asInt = min;
+    range.max.asInt = max;
+    return range;
+}
+
+ColumnRange ColumnRange::doubles(std::size_t column, double min, double max) noexcept {
+    ColumnRange range{};
+    range.column = column;
+    range.min.asDouble = min;
+    range.max.asDouble = max;
+    return range;
+}
+
+ChunkView::ChunkView(const ColumnSchema& schema, const ChunkHeader* header) noexcept
+    : schema_(&schema),
+      header_(header),
+      stats_(reinterpret_cast<const ColumnChunkStats*>(header + 1)),
+      data_(reinterpret_cast<const ColumnCell*>(stats_ + header->columns)) {
+}
+
+bool ChunkView::mayMatch(const std::vector<ColumnRange>& ranges) const noexcept {
+    for (const ColumnRange& range : ranges) {
+        if (!overlaps((*schema_)[range.column].type, stats_[range.column], range)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool ChunkView::rowMatches(std::size_t row, const std::vector<ColumnRange>& ranges) const noexcept {
+    for (const ColumnRange& range : ranges) {
+        if (!inside((*schema_)[range.column].type, column(range.column)[row], range)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+// ColumnarReader
+// ---------------------------------------------------------------------------
+
+ColumnarReader::ColumnarReader(const std::string& path) {
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error("ColumnarReader: cannot open " + path + ": " + std::strerror(errno));
+    }
+    struct stat info {};
+    if (::fstat(fd, &info) != 0 || static_cast<std::size_t>(info.st_size) < sizeof(ColumnarFileHeader)) {
+        ::close(fd);
+        throw std::runtime_error("ColumnarReader: " + path + " is too short");
+    }
+    size_ = static_cast<std::size_t>(info.st_size);
+    void* mapped = ::mmap(nullptr, size_, PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (mapped == MAP_FAILED) {
+        throw std::runtime_error("ColumnarReader: cannot map " + path);
+    }
+    base_ = static_cast<const std::uint8_t*>(mapped);
+
+    ColumnarFileHeader header{};
+    std::memcpy(&header, base_, sizeof(header));
+    dataOffset_ = sizeof(header) + static_cast<std::size_t>(header.columns) * sizeof(ColumnDescriptor);
+    if (std::memcmp(header.magic, FILE_MAGIC, sizeof(header.magic)) != 0 || header.version != FILE_VERSION ||
+        header.headerBytes != sizeof(ColumnarFileHeader) || header.descriptorBytes != sizeof(ColumnDescriptor) ||
+        header.columns == 0U || dataOffset_ > size_) {
+        ::munmap(const_cast<std::uint8_t*>(base_), size_);
+        throw std::runtime_error("ColumnarReader: " + path + " is not a columnar export file");
+    }
+    for (std::uint32_t column = 0U; column < header.columns; ++column) {
+        ColumnDescriptor descriptor{};
+        std::memcpy(&descriptor, base_ + sizeof(header) + column * sizeof(ColumnDescriptor), sizeof(descriptor));
+        descriptor.name[sizeof(descriptor.name) - 1U] = '\0';
+        schema_.push_back(ColumnSpec{descriptor.name, static_cast<ColumnType>(descriptor.type)});
+    }
+    readDirectory();
+}
+
+ColumnarReader::~ColumnarReader() {
+    ::munmap(const_cast<std::uint8_t*>(base_), size_);
+}
+
+const ChunkHeader* ColumnarReader::chunkAt(std::uint64_t offset) const noexcept {
+    if (offset < dataOffset_ || offset % sizeof(ColumnCell) != 0U || offset + sizeof(ChunkHeader) > size_) {
+        return nullptr;
+    }
+    const auto* header = reinterpret_cast<const ChunkHeader*>(base_ + offset);
+    if (std::memcmp(header->magic, CHUNK_MAGIC, sizeof(header->magic)) != 0 || header->columns != schema_.size() ||
+        header->rows == 0U || header->rows > size_ ||
+        header->chunkBytes != chunkBytes(schema_.size(), static_cast<std::size_t>(header->rows)) ||
+        header->chunkBytes > size_ - offset) {
+        return nullptr;
+    }
+    return header;
+}
+
+void ColumnarReader::readDirectory() {
+    if (size_ >= dataOffset_ + sizeof(ColumnarFooter)) {
+        ColumnarFooter footer{};
+        std::memcpy(&footer, base_ + size_ - sizeof(footer), sizeof(footer));
+        const std::size_t directoryBytes = static_cast<std::size_t>(footer.chunks) * sizeof(std::uint64_t);
+        if (std::memcmp(footer.magic, FOOTER_MAGIC, sizeof(footer.magic)) == 0 &&
+            footer.directoryOffset + directoryBytes + sizeof(footer) == size_) {
+            const auto* offsets = reinterpret_cast<const std::uint64_t*>(base_ + footer.directoryOffset);
+            for (std::uint64_t chunk = 0U; chunk < footer.chunks; ++chunk) {
+                const ChunkHeader* header = chunkAt(offsets[chunk]);
+                if (header == nullptr) {
+                    chunks_.clear();
+                    rows_ = 0U;
+                    break;
+                }
+                chunks_.push_back(header);
+                rows_ += header->rows;
+            }
+            if (chunks_.size() == footer.chunks) {
+                complete_ = true;
+                return;
+            }
+        }
+    }
+    walkChunks(dataOffset_);
+}
+
+void ColumnarReader::walkChunks(std::size_t offset) {
+    while (const ChunkHeader* header = chunkAt(offset)) {
+        chunks_.push_back(header);
+        rows_ += header->rows;
+        offset += static_cast<std::size_t>(header->chunkBytes);
+    }
+}
+
+std::size_t ColumnarReader::columnIndex(const std::string& name) const {
+    for (std::size_t column = 0U; column < schema_.size(); ++column) {
+        if (schema_[column].name == name) {
+            return column;
+        }
+    }
+    throw std::invalid_argument("ColumnarReader: no column named " + name);
+}
+
+std::size_t ColumnarReader::scan(const std::vector<ColumnRange>& ranges, const ChunkVisitor& visit) const {
+    std::size_t visited = 0U;
+    for (const ChunkHeader* header : chunks_) {
+        const ChunkView view(schema_, header);
+        if (view.mayMatch(ranges)) {
+            visit(view);
+            ++visited;
+        }
+    }
+    return visited;
+}
+
+} // namespace store
+} // namespace common
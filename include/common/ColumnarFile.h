@@ -0,0 +1,299 @@
+/**
+ * @file ColumnarFile.h
+ * @brief Self-describing columnar export files with per-chunk min/max statistics
+ *
+ * A file holds rows of a fixed schema of int64 and double columns, cut
+ * into chunks. Inside a chunk every column is one contiguous array, so an
+ * analysis that reads two columns of a million rows touches 16 MB and
+ * nothing else. Layout, host byte order, every part a multiple of 8 bytes:
+ *
+ *   ColumnarFileHeader (32 bytes)
+ *   ColumnDescriptor[columns]          name and type of each column
+ *   chunk*                             ChunkHeader | ColumnChunkStats[columns] | column arrays
+ *   uint64 chunkOffsets[chunks]        directory
+ *   ColumnarFooter (32 bytes)
+ *
+ * The footer is written when the file is closed. A file cut short by a
+ * crash has no footer; the reader then walks the chunk headers from the
+ * front and keeps every chunk that is complete.
+ *
+ * ColumnarExporter buffers rows on the caller's thread and hands full
+ * chunks to its own writer thread, so the caller never does I/O. When
+ * the writer falls behind by more than queuedChunks chunks, new chunks
+ * are dropped and counted instead of blocking the caller.
+ *
+ * ColumnarReader maps a file read-only and hands out chunk views that
+ * point straight into the mapping. scan() tests each chunk's statistics
+ * against the query's column ranges and skips chunks that cannot match.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace common {
+namespace store {
+
+enum class ColumnType : std::uint32_t {
+    Int64 = 1U,
+    Double = 2U
+};
+
+/// One value; the column type says which member is meaningful
+union ColumnCell {
+    std::int64_t asInt;
+    double asDouble;
+};
+static_assert(sizeof(ColumnCell) == 8U, "column cell layout");
+
+struct ColumnSpec {
+    std::string name;
+    ColumnType type;
+};
+
+using ColumnSchema = std::vector<ColumnSpec>;
+
+/// First bytes of every file
+struct ColumnarFileHeader {
+    char magic[8];                  ///< "HXCOL01"
+    std::uint32_t version;
+    std::uint32_t headerBytes;      ///< sizeof(ColumnarFileHeader)
+    std::uint32_t columns;
+    std::uint32_t descriptorBytes;  ///< sizeof(ColumnDescriptor)
+    std::int64_t createdNs;
+};
+static_assert(sizeof(ColumnarFileHeader) == 32U, "columnar header layout");
+
+struct ColumnDescriptor {
+    char name[56];                  ///< NUL-terminated
+    std::uint32_t type;             ///< ColumnType
+    std::uint32_t reserved;
+};
+static_assert(sizeof(ColumnDescriptor) == 64U, "column descriptor layout");
+
+struct ChunkHeader {
+    char magic[8];                  ///< "HXCHUNK"
+    std::uint64_t rows;
+    std::uint64_t columns;
+    std::uint64_t chunkBytes;       ///< Header, statistics and column arrays
+};
+static_assert(sizeof(ChunkHeader) == 32U, "chunk header layout");
+
+/// Smallest and largest value of a column in one chunk; NaN is ignored
+struct ColumnChunkStats {
+    ColumnCell min;
+    ColumnCell max;
+};
+
+struct ColumnarFooter {
+    std::uint64_t chunks;
+    std::uint64_t directoryOffset;
+    std::uint64_t rows;
+    char magic[8];                  ///< "HXCOLEND"
+};
+static_assert(sizeof(ColumnarFooter) == 32U, "columnar footer layout");
+
+/**
+ * @class ColumnBuffer
+ * @brief Rows of one chunk being collected, column-major
+ */
+class ColumnBuffer final {
+public:
+    ColumnBuffer(std::size_t columns, std::size_t capacity);
+
+    /// Copies one cell per column; the buffer must not be full
+    void append(const ColumnCell* row) noexcept;
+
+    std::size_t rows() const noexcept { return rows_; }
+    std::size_t columns() const noexcept { return columns_; }
+    bool full() const noexcept { return rows_ == capacity_; }
+    bool empty() const noexcept { return rows_ == 0U; }
+    const ColumnCell* column(std::size_t index) const noexcept { return cells_.data() + index * capacity_; }
+    void clear() noexcept { rows_ = 0U; }
+
+private:
+    std::size_t columns_;
+    std::size_t capacity_;
+    std::size_t rows_ = 0U;
+    std::vector<ColumnCell> cells_;
+};
+
+/**
+ * @class ColumnarWriter
+ * @brief Writes chunks to one file on the calling thread
+ */
+class ColumnarWriter final {
+public:
+    /// @throws std::invalid_argument for an empty schema or a column name longer than 55 bytes
+    /// @throws std::runtime_error if the file cannot be created
+    ColumnarWriter(const std::string& path, const ColumnSchema& schema);
+
+    /// Writes the footer if close() was not called
+    ~ColumnarWriter();
+
+    ColumnarWriter(const ColumnarWriter&) = delete;
+    ColumnarWriter& operator=(const ColumnarWriter&) = delete;
+
+    /// Appends the buffer's rows as one chunk; false on a write error
+    bool writeChunk(const ColumnBuffer& buffer) noexcept;
+
+    /// Writes the chunk directory and footer and closes the file
+    bool close() noexcept;
+
+    std::uint64_t rows() const noexcept { return rows_; }
+    std::size_t chunks() const noexcept { return offsets_.size(); }
+
+private:
+    bool write(const void* data, std::size_t bytes) noexcept;
+
+    ColumnSchema schema_;
+    std::FILE* file_ = nullptr;
+    std::uint64_t offset_ = 0U;
+    std::uint64_t rows_ = 0U;
+    std::vector<std::uint64_t> offsets_;
+    std::vector<ColumnChunkStats> stats_;
+};
+
+/// Exporter counters
+struct ExportStats {
+    std::uint64_t rows = 0U;         ///< Rows accepted by append()
+    std::uint64_t chunks = 0U;       ///< Chunks on disk
+    std::uint64_t droppedRows = 0U;  ///< Rows lost to a full queue or a write error
+};
+
+/**
+ * @class ColumnarExporter
+ * @brief One producer thread appends; a writer thread owns the file
+ */
+class ColumnarExporter final {
+public:
+    /// @throws like ColumnarWriter
+    ColumnarExporter(const std::string& path, const ColumnSchema& schema,
+                     std::size_t rowsPerChunk = 65536U, std::size_t queuedChunks = 4U);
+
+    /// Writes the partial chunk and the footer
+    ~ColumnarExporter();
+
+    ColumnarExporter(const ColumnarExporter&) = delete;
+    ColumnarExporter& operator=(const ColumnarExporter&) = delete;
+
+    /// Buffers one row, one cell per schema column; never blocks on I/O
+    void append(const ColumnCell* row) noexcept;
+
+    /// Hands the partial chunk to the writer thread
+    void flush() noexcept;
+
+    ExportStats stats() const noexcept;
+
+private:
+    void handOver() noexcept;
+    void writerLoop();
+
+    ColumnarWriter writer_;
+    std::unique_ptr<ColumnBuffer> current_;   ///< Producer-owned
+    std::size_t queuedChunks_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable wake_;
+    std::deque<std::unique_ptr<ColumnBuffer>> pending_;
+    std::vector<std::unique_ptr<ColumnBuffer>> free_;
+    bool stopping_ = false;
+    std::thread thread_;
+
+    std::atomic<std::uint64_t> rows_{0U};
+    std::atomic<std::uint64_t> chunks_{0U};
+    std::atomic<std::uint64_t> droppedRows_{0U};
+};
+
+/// Inclusive value range of one column; a row or chunk matches if its values can fall inside
+struct ColumnRange {
+    std::size_t column;
+    ColumnCell min;
+    ColumnCell max;
+
+    static ColumnRange ints(std::size_t column, std::int64_t min, std::int64_t max) noexcept;
+    static ColumnRange doubles(std::size_t column, double min, double max) noexcept;
+};
+
+/**
+ * @class ChunkView
+ * @brief One chunk of a mapped file; valid while its reader lives
+ */
+class ChunkView final {
+public:
+    ChunkView(const ColumnSchema& schema, const ChunkHeader* header) noexcept;
+
+    std::size_t rows() const noexcept { return static_cast<std::size_t>(header_->rows); }
+    const ColumnChunkStats& stats(std::size_t column) const noexcept { return stats_[column]; }
+    const ColumnCell* column(std::size_t index) const noexcept { return data_ + index * header_->rows; }
+
+    /// True if the chunk statistics overlap every range
+    bool mayMatch(const std::vector<ColumnRange>& ranges) const noexcept;
+
+    /// True if the row lies inside every range
+    bool rowMatches(std::size_t row, const std::vector<ColumnRange>& ranges) const noexcept;
+
+private:
+    const ColumnSchema* schema_;
+    const ChunkHeader* header_;
+    const ColumnChunkStats* stats_;
+    const ColumnCell* data_;
+};
+
+/**
+ * @class ColumnarReader
+ * @brief Read-only view of one file
+ */
+class ColumnarReader final {
+public:
+    using ChunkVisitor = std::function<void(const ChunkView& chunk)>;
+
+    /// @throws std::runtime_error if the file cannot be mapped or has no valid header
+    explicit ColumnarReader(const std::string& path);
+    ~ColumnarReader();
+
+    ColumnarReader(const ColumnarReader&) = delete;
+    ColumnarReader& operator=(const ColumnarReader&) = delete;
+
+    const ColumnSchema& schema() const noexcept { return schema_; }
+
+    /// @throws std::invalid_argument if the schema has no such column
+    std::size_t columnIndex(const std::string& name) const;
+
+    std::size_t chunks() const noexcept { return chunks_.size(); }
+    std::uint64_t rows() const noexcept { return rows_; }
+    ChunkView chunk(std::size_t index) const noexcept { return ChunkView(schema_, chunks_[index]); }
+
+    /// False if the footer was missing and the chunks were recovered by walking the file
+    bool complete() const noexcept { return complete_; }
+
+    /// Visits every chunk whose statistics overlap all ranges; returns chunks visited
+    std::size_t scan(const std::vector<ColumnRange>& ranges, const ChunkVisitor& visit) const;
+
+private:
+    void readDirectory();
+    void walkChunks(std::size_t offset);
+    const ChunkHeader* chunkAt(std::uint64_t offset) const noexcept;
+
+    const std::uint8_t* base_ = nullptr;
+    std::size_t size_ = 0U;
+    std::size_t dataOffset_ = 0U;
+    ColumnSchema schema_;
+    std::vector<const ChunkHeader*> chunks_;
+    std::uint64_t rows_ = 0U;
+    bool complete_ = false;
+};
+
+} // namespace store
+} // namespace common
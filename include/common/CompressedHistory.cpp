@@ -0,0 +1,153 @@
+/**
+ * @file CompressedHistory.cpp
+ * @brief CompressedHistory implementation
+ */
+
+#include "common/CompressedHistory.h"
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+namespace common {
+namespace store {
+
+CompressedHistory::CompressedHistory(const CompressedOptions& options)
+    : options_(options) {
+    if (options_.samplesPerBlock == 0U) {
+        throw std::invalid_argument("CompressedHistory: samplesPerBlock must be positive");
+    }
+}
+
+void CompressedHistory::append(int trackId, std::int64_t time, const double* doubles, const std::int64_t* ints) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Track& track = tracks_.try_emplace(trackId, options_).first->second;
+    track.open.append(time, doubles, ints);
+    ++samples_;
+    if (track.open.rows() >= options_.samplesPerBlock) {
+        auto block = std::make_shared<const SeriesBlock>(track.open.finish());
+        sealedBytes_ += block->bytes();
+        track.sealed.push_back(std::move(block));
+    }
+}
+
+void CompressedHistory::collect(int trackId, const Track& track, std::int64_t start, std::int64_t end,
+                                BlockList& blocks) const {
+    for (const std::shared_ptr<const SeriesBlock>& block : track.sealed) {
+        if (block->maxTime >= start && block->minTime <= end) {
+            blocks.emplace_back(trackId, block);
+        }
+    }
+    const SeriesBlock& open = track.open.block();
+    if (open.rows > 0U && open.maxTime >= start && open.minTime <= end) {
+        // The open block keeps growing, so readers decode a copy
+        blocks.emplace_back(trackId, std::make_shared<const SeriesBlock>(open));
+    }
+}
+
+std::size_t CompressedHistory::decode(const BlockList& blocks, std::int64_t start, std::int64_t end,
+                                      HistoryRows& out) const {
+    std::vector<double> doubles(options_.doubleColumns);
+    std::vector<std::int64_t> ints(options_.intColumns);
+    std::size_t added = 0U;
+    for (const auto& entry : blocks) {
+        SeriesDecoder decoder(*entry.second);
+        std::int64_t time = 0;
+        while (decoder.next(time, doubles.data(), ints.data())) {
+            if (time < start || time > end) {
+                continue;
+            }
+            out.trackIds.push_back(entry.first);
+            out.times.push_back(time);
+            out.doubles.insert(out.doubles.end(), doubles.begin(), doubles.end());
+            out.ints.insert(out.ints.end(), ints.begin(), ints.end());
+            ++added;
+        }
+    }
+    return added;
+}
+
+std::size_t CompressedHistory::readRange(std::int64_t start, std::int64_t end, HistoryRows& out) const {
+    BlockList blocks;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (const auto& entry : tracks_) {
+            collect(entry.first, entry.second, start, end, blocks);
+        }
+    }
+    // Grouped by track, oldest block first within a track
+    std::stable_sort(blocks.begin(), blocks.end(),
+                     [](const auto& left, const auto& right) { return left.first < right.first; });
+    return decode(blocks, start, end, out);
+}
+
+std::size_t CompressedHistory::readTrack(int trackId, std::int64_t start, std::int64_t end, HistoryRows& out) const {
+    BlockList blocks;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        const auto found = tracks_.find(trackId);
+        if (found == tracks_.end()) {
+            return 0U;
+        }
+        collect(trackId, found->second, start, end, blocks);
+    }
+    return decode(blocks, start, end, out);
+}
+
+std::size_t CompressedHistory::evictBefore(std::int64_t cutoff) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::size_t removed = 0U;
+    for (auto it = tracks_.begin(); it != tracks_.end();) {
+        auto& sealed = it->second.sealed;
+        const auto keep = std::find_if(sealed.begin(), sealed.end(),
+                                       [cutoff](const auto& block) { return block->maxTime >= cutoff; });
+        for (auto block = sealed.begin(); block != keep; ++block) {
+            removed += (*block)->rows;
+            sealedBytes_ -= (*block)->bytes();
+        }
+        sealed.erase(sealed.begin(), keep);
+        if (sealed.empty() && it->second.open.rows() == 0U) {
+            it = tracks_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    samples_ -= removed;
+    evicted_ += removed;
+    return removed;
+}
+
+std::int64_t CompressedHistory::oldestTime() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::int64_t oldest = std::numeric_limits<std::int64_t>::max();
+    for (const auto& entry : tracks_) {
+        const Track& track = entry.second;
+        if (!track.sealed.empty()) {
+            oldest = std::min(oldest, track.sealed.front()->minTime);
+        } else if (track.open.rows() > 0U) {
+            oldest = std::min(oldest, track.open.block().minTime);
+        }
+    }
+    return tracks_.empty() ? 0 : oldest;
+}
+
+CompressedStats CompressedHistory::stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    CompressedStats result;
+    result.tracks = tracks_.size();
+    result.samples = samples_;
+    result.compressedBytes = sealedBytes_;
+    result.evicted = evicted_;
+    for (const auto& entry : tracks_) {
+        result.blocks += entry.second.sealed.size();
+        if (entry.second.open.rows() > 0U) {
+            ++result.blocks;
+            result.compressedBytes += entry.second.open.block().bytes();
+        }
+    }
+    result.rawBytes = samples_ * (8U + 8U * (options_.doubleColumns + options_.intColumns));
+    return result;
+}
+
+} // namespace store
+} // namespace common
@@ -0,0 +1,105 @@
+/**
+ * @file CompressedHistory.h
+ * @brief Long-retention per-track history kept as compressed blocks
+ *
+ * Each track appends into an open SeriesEncoder (common/TimeSeriesCodec.h).
+ * After samplesPerBlock rows the block is sealed and becomes immutable and
+ * shared. On a 5 ms grid with smoothly moving positions a sample
+ * shrinks from 88 raw bytes to a small fraction of that, so hours of
+ * history fit in the memory the ring store spends on minutes.
+ *
+ * Readers hold the lock only while they collect shared pointers to the
+ * sealed blocks and copy the open one. Decoding happens outside the
+ * lock, so a long range scan never stalls the writer. Blocks whose
+ * min/max time misses the range are skipped without decoding.
+ * Expiry drops whole sealed blocks whose newest sample is older than the
+ * cutoff.
+ */
+
+#pragma once
+
+#include "common/TimeSeriesCodec.h"
+#include "common/TrackHistoryStore.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace common {
+namespace store {
+
+/// Shape of an archive
+struct CompressedOptions {
+    std::size_t doubleColumns = 0U;
+    std::size_t intColumns = 0U;            ///< int64 columns besides the key time
+    std::size_t samplesPerBlock = 1024U;    ///< Rows per sealed block
+};
+
+/// Size and content counters
+struct CompressedStats {
+    std::size_t tracks = 0U;
+    std::size_t blocks = 0U;                ///< Sealed and open blocks
+    std::uint64_t samples = 0U;
+    std::uint64_t compressedBytes = 0U;
+    std::uint64_t rawBytes = 0U;            ///< samples * (8 + 8 * columns)
+    std::uint64_t evicted = 0U;
+};
+
+/**
+ * @class CompressedHistory
+ * @brief Thread-safe; any number of readers alongside one or more writers
+ */
+class CompressedHistory final {
+public:
+    /// @throws std::invalid_argument if samplesPerBlock is zero
+    explicit CompressedHistory(const CompressedOptions& options);
+
+    CompressedHistory(const CompressedHistory&) = delete;
+    CompressedHistory& operator=(const CompressedHistory&) = delete;
+
+    /// Appends one sample; time should not decrease within a track
+    void append(int trackId, std::int64_t time, const double* doubles, const std::int64_t* ints);
+
+    /// Appends every sample with start <= time <= end to out, grouped by track; returns rows added
+    std::size_t readRange(std::int64_t start, std::int64_t end, HistoryRows& out) const;
+
+    /// Same as readRange for a single track
+    std::size_t readTrack(int trackId, std::int64_t start, std::int64_t end, HistoryRows& out) const;
+
+    /// Drops sealed blocks whose newest sample is older than cutoff; returns samples dropped
+    std::size_t evictBefore(std::int64_t cutoff);
+
+    /// Oldest time still held; 0 when empty
+    std::int64_t oldestTime() const;
+
+    CompressedStats stats() const;
+
+    const CompressedOptions& options() const noexcept { return options_; }
+
+private:
+    struct Track {
+        explicit Track(const CompressedOptions& options)
+            : open(options.doubleColumns, options.intColumns) {}
+
+        std::vector<std::shared_ptr<const SeriesBlock>> sealed;   ///< Oldest first
+        SeriesEncoder open;
+    };
+
+    using BlockList = std::vector<std::pair<int, std::shared_ptr<const SeriesBlock>>>;
+
+    void collect(int trackId, const Track& track, std::int64_t start, std::int64_t end, BlockList& blocks) const;
+    std::size_t decode(const BlockList& blocks, std::int64_t start, std::int64_t end, HistoryRows& out) const;
+
+    CompressedOptions options_;
+    mutable std::mutex mutex_;
+    std::unordered_map<int, Track> tracks_;
+    std::uint64_t samples_ = 0U;
+    std::uint64_t sealedBytes_ = 0U;
+    std::uint64_t evicted_ = 0U;
+};
+
+} // namespace store
+} // namespace common
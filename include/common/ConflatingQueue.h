@@ -0,0 +1,155 @@
+/**
+ * @file ConflatingQueue.h
+ * @brief Latest-value-wins handoff keyed by track id
+ *
+ * Holds at most one pending value per key. A push for a key that is
+ * already pending replaces the value in place and counts the old one as
+ * superseded; the key keeps its place in line. Keys are served in the
+ * order they became pending, so a busy track cannot starve the others.
+ *
+ * The depth is bounded by the number of distinct keys, not by the
+ * arrival rate: when the consumer falls behind, stale samples are
+ * dropped here instead of piling up in socket and kernel buffers, and
+ * every track's next delivery is its newest sample.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+namespace common {
+namespace flow {
+
+/// Counters since construction
+struct ConflationStats {
+    std::uint64_t pushed = 0U;
+    std::uint64_t delivered = 0U;
+    std::uint64_t superseded = 0U;   ///< Values replaced before anyone popped them
+    std::size_t depth = 0U;          ///< Keys pending now
+    std::size_t maxDepth = 0U;
+    std::size_t keys = 0U;           ///< Distinct keys seen
+};
+
+/**
+ * @class ConflatingQueue
+ * @brief Any number of producers and consumers
+ */
+template <typename T>
+class ConflatingQueue final {
+public:
+    ConflatingQueue() = default;
+    ConflatingQueue(const ConflatingQueue&) = delete;
+    ConflatingQueue& operator=(const ConflatingQueue&) = delete;
+
+    /// Stores value as the pending value of key; false once closed
+    bool push(int key, T value) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (closed_) {
+                return false;
+            }
+            ++stats_.pushed;
+            const auto found = slotOf_.find(key);
+            std::size_t index = 0U;
+            if (found == slotOf_.end()) {
+                index = slots_.size();
+                slots_.emplace_back();
+                slotOf_.emplace(key, index);
+            } else {
+                index = found->second;
+            }
+            Slot& slot = slots_[index];
+            slot.value = std::move(value);
+            if (slot.pending) {
+                ++stats_.superseded;
+                return true;
+            }
+            slot.pending = true;
+            order_.push_back(index);
+            if (order_.size() > stats_.maxDepth) {
+                stats_.maxDepth = order_.size();
+            }
+        }
+        ready_.notify_one();
+        return true;
+    }
+
+    /// Takes the longest-waiting pending value; blocks until one arrives or the queue is closed
+    bool pop(T& out) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        ready_.wait(lock, [this] { return closed_ || !order_.empty(); });
+        return take(out);
+    }
+
+    /// Like pop, but gives up after timeout
+    template <typename Rep, typename Period>
+    bool popFor(T& out, const std::chrono::duration<Rep, Period>& timeout) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        ready_.wait_for(lock, timeout, [this] { return closed_ || !order_.empty(); });
+        return take(out);
+    }
+
+    /// Takes a pending value if there is one; never blocks
+    bool tryPop(T& out) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return take(out);
+    }
+
+    /// Refuses further pushes and wakes every waiting consumer; pending values can still be popped
+    void close() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            closed_ = true;
+        }
+        ready_.notify_all();
+    }
+
+    bool closed() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return closed_;
+    }
+
+    ConflationStats stats() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ConflationStats result = stats_;
+        result.depth = order_.size();
+        result.keys = slots_.size();
+        return result;
+    }
+
+private:
+    struct Slot {
+        T value{};
+        bool pending = false;
+    };
+
+    bool take(T& out) {
+        if (order_.empty()) {
+            return false;
+        }
+        Slot& slot = slots_[order_.front()];
+        order_.pop_front();
+        out = std::move(slot.value);
+        slot.pending = false;
+        ++stats_.delivered;
+        return true;
+    }
+
+    mutable std::mutex mutex_;
+    std::condition_variable ready_;
+    std::unordered_map<int, std::size_t> slotOf_;
+    std::deque<Slot> slots_;                 ///< Stable addresses; one per key ever seen
+    std::deque<std::size_t> order_;          ///< Pending slots, oldest first
+    ConflationStats stats_;
+    bool closed_ = false;
+};
+
+} // namespace flow
+} // namespace common
@@ -0,0 +1,299 @@
+/**
+ * @file FlightRecorder.cpp
+ * @brief FlightRecorder ring, dump thread and dump reader
+ */
+
+#include "common/FlightRecorder.h"
+
+#include "common/TscClock.h"
+
+#include <algorithm>
+#include <chrono>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+
+#include <unistd.h>
+
+namespace common {
+namespace capture {
+
+namespace {
+
+constexpr char DUMP_MAGIC[8] = {'H', 'X', 'F', 'L', 'T', '0', '1', '\0'};
+constexpr std::uint32_t DUMP_VERSION = 1U;
+constexpr std::chrono::milliseconds POLL_INTERVAL(50);
+
+/// Set by the SIGUSR1 handler, consumed by the process recorder's dump thread
+std::atomic<bool> g_signalDump{false};
+
+extern "C" void onDumpSignal(int) {
+    g_signalDump.store(true, std::memory_order_relaxed);
+}
+
+std::size_t roundUpPow2(std::size_t value) noexcept {
+    std::size_t rounded = 1U;
+    while (rounded < value) {
+        rounded <<= 1U;
+    }
+    return rounded;
+}
+
+std::size_t envSize(const char* name, std::size_t fallback) {
+    const char* value = std::getenv(name);
+    if (value == nullptr || value[0] == '\0') {
+        return fallback;
+    }
+    char* end = nullptr;
+    const unsigned long long parsed = std::strtoull(value, &end, 10);
+    return (end != nullptr && *end == '\0') ? static_cast<std::size_t>(parsed) : fallback;
+}
+
+const char* toString(DumpReason reason) noexcept {
+    switch (reason) {
+        case DumpReason::Signal:
+            return "SIGUSR1";
+        case DumpReason::Threshold:
+            return "latency threshold";
+        case DumpReason::Request:
+            return "request";
+        default:
+            return "unknown";
+    }
+}
+
+} // namespace
+
+/// One entry; version is odd while the slot is being written
+struct alignas(64) FlightRecorder::Slot {
+    std::atomic<std::uint64_t> version{0U};
+    std::atomic<std::int64_t> trackId{0};
+    std::atomic<std::uint64_t> sequence{0U};
+    std::atomic<std::int64_t> receiveNs{0};
+    std::atomic<std::int64_t> decodeNs{0};
+    std::atomic<std::int64_t> computeNs{0};
+    std::atomic<std::int64_t> sendNs{0};
+    std::atomic<std::uint32_t> flags{0U};
+};
+static_assert(sizeof(std::atomic<std::int64_t>) == 8U, "lock-free 64-bit slot fields");
+
+std::int64_t FlightEntry::latencyNs() const noexcept {
+    std::int64_t first = 0;
+    std::int64_t last = 0;
+    for (const std::int64_t stamp : {receiveNs, decodeNs, computeNs, sendNs}) {
+        if (stamp != 0) {
+            first = (first == 0) ? stamp : std::min(first, stamp);
+            last = std::max(last, stamp);
+        }
+    }
+    return last - first;
+}
+
+FlightEntry& currentFlight() noexcept {
+    thread_local FlightEntry entry;
+    return entry;
+}
+
+// ---------------------------------------------------------------------------
+// FlightRecorder
+// ---------------------------------------------------------------------------
+
+FlightRecorder::FlightRecorder(const FlightOptions& options) : options_(options) {
+    if (options_.slots == 0U) {
+        throw std::invalid_argument("FlightRecorder: slots must be positive");
+    }
+    const std::size_t slots = roundUpPow2(options_.slots);
+    options_.slots = slots;
+    mask_ = slots - 1U;
+    slots_.reset(new Slot[slots]);
+    thread_ = std::thread(&FlightRecorder::dumpLoop, this);
+}
+
+FlightRecorder::~FlightRecorder() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    wake_.notify_all();
+    thread_.join();
+}
+
+void FlightRecorder::record(const FlightEntry& entry) noexcept {
+    const std::uint64_t ticket = next_.fetch_add(1U, std::memory_order_relaxed);
+    std::uint32_t flags = entry.flags;
+    if (options_.thresholdNs > 0 && entry.latencyNs() > options_.thresholdNs) {
+        flags |= FLIGHT_OVER_THRESHOLD;
+        std::uint32_t none = 0U;
+        pending_.compare_exchange_strong(none, static_cast<std::uint32_t>(DumpReason::Threshold),
+                                         std::memory_order_relaxed);
+    }
+
+    Slot& slot = slots_[ticket & mask_];
+    slot.version.store(ticket * 2U + 1U, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.trackId.store(entry.trackId, std::memory_order_relaxed);
+    slot.sequence.store(entry.sequence, std::memory_order_relaxed);
+    slot.receiveNs.store(entry.receiveNs, std::memory_order_relaxed);
+    slot.decodeNs.store(entry.decodeNs, std::memory_order_relaxed);
+    slot.computeNs.store(entry.computeNs, std::memory_order_relaxed);
+    slot.sendNs.store(entry.sendNs, std::memory_order_relaxed);
+    slot.flags.store(flags, std::memory_order_relaxed);
+    slot.version.store(ticket * 2U + 2U, std::memory_order_release);
+}
+
+void FlightRecorder::requestDump(DumpReason reason) noexcept {
+    pending_.store(static_cast<std::uint32_t>(reason), std::memory_order_relaxed);
+    wake_.notify_all();
+}
+
+std::vector<FlightEntry> FlightRecorder::snapshot() const {
+    std::vector<FlightEntry> entries;
+    entries.reserve(options_.slots);
+    for (std::size_t index = 0U; index <= mask_; ++index) {
+        const Slot& slot = slots_[index];
+        const std::uint64_t before = slot.version.load(std::memory_order_acquire);
+        if (before == 0U || (before & 1U) != 0U) {
+            continue;
+        }
+        FlightEntry entry;
+        entry.ticket = before / 2U - 1U;
+        entry.trackId = slot.trackId.load(std::memory_order_relaxed);
+        entry.sequence = slot.sequence.load(std::memory_order_relaxed);
+        entry.receiveNs = slot.receiveNs.load(std::memory_order_relaxed);
+        entry.decodeNs = slot.decodeNs.load(std::memory_order_relaxed);
+        entry.computeNs = slot.computeNs.load(std::memory_order_relaxed);
+        entry.sendNs = slot.sendNs.load(std::memory_order_relaxed);
+        entry.flags = slot.flags.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot.version.load(std::memory_order_relaxed) == before) {
+            entries.push_back(entry);
+        }
+    }
+    std::sort(entries.begin(), entries.end(),
+              [](const FlightEntry& a, const FlightEntry& b) { return a.ticket < b.ticket; });
+    return entries;
+}
+
+std::string FlightRecorder::dump(DumpReason reason) {
+    const std::vector<FlightEntry> entries = snapshot();
+    const std::int64_t nowNs = common::timing::TscClock::nowNanos();
+    const std::string path = options_.directory + "/flight." + std::to_string(::getpid()) + "." +
+                             std::to_string(nowNs / 1000) + ".hxflt";
+    const std::string partial = path + ".tmp";
+
+    FlightDumpHeader header{};
+    std::memcpy(header.magic, DUMP_MAGIC, sizeof(header.magic));
+    header.version = DUMP_VERSION;
+    header.entryBytes = static_cast<std::uint32_t>(sizeof(FlightEntry));
+    header.entries = entries.size();
+    header.createdNs = nowNs;
+    header.thresholdNs = options_.thresholdNs;
+    header.reason = static_cast<std::uint32_t>(reason);
+    header.pid = static_cast<std::uint32_t>(::getpid());
+
+    std::FILE* file = std::fopen(partial.c_str(), "wb");
+    if (file == nullptr) {
+        std::cerr << "[Flight] cannot create " << partial << std::endl;
+        return std::string();
+    }
+    bool written = std::fwrite(&header, sizeof(header), 1U, file) == 1U;
+    if (written && !entries.empty()) {
+        written = std::fwrite(entries.data(), sizeof(FlightEntry), entries.size(), file) == entries.size();
+    }
+    written = (std::fclose(file) == 0) && written;
+    if (!written || std::rename(partial.c_str(), path.c_str()) != 0) {
+        std::remove(partial.c_str());
+        std::cerr << "[Flight] dump to " << path << " failed" << std::endl;
+        return std::string();
+    }
+    dumps_.fetch_add(1U, std::memory_order_relaxed);
+    std::cout << "[Flight] " << entries.size() << " messages (" << toString(reason) << ") -> " << path << std::endl;
+    return path;
+}
+
+void FlightRecorder::dumpLoop() {
+    std::chrono::steady_clock::time_point lastThresholdDump;
+    bool thresholdDumped = false;
+    std::unique_lock<std::mutex> lock(mutex_);
+    for (;;) {
+        wake_.wait_for(lock, POLL_INTERVAL);
+        const bool stopping = stopping_;
+        lock.unlock();
+
+        if (options_.handleSignal && g_signalDump.exchange(false, std::memory_order_relaxed)) {
+            dump(DumpReason::Signal);
+        }
+        const auto reason = static_cast<DumpReason>(pending_.exchange(0U, std::memory_order_relaxed));
+        if (reason == DumpReason::Threshold) {
+            const auto now = std::chrono::steady_clock::now();
+            if (!thresholdDumped ||
+                now - lastThresholdDump >= std::chrono::milliseconds(options_.minDumpIntervalMs)) {
+                dump(reason);
+                lastThresholdDump = now;
+                thresholdDumped = true;
+            }
+        } else if (static_cast<std::uint32_t>(reason) != 0U) {
+            dump(reason);
+        }
+
+        if (stopping) {
+            return;
+        }
+        lock.lock();
+    }
+}
+
+FlightRecorder& FlightRecorder::process() {
+    static FlightRecorder recorder([]() {
+        FlightOptions options;
+        options.slots = std::max<std::size_t>(envSize("HEXAGON_FLIGHT_SLOTS", options.slots), 1U);
+        options.thresholdNs = static_cast<std::int64_t>(envSize("HEXAGON_FLIGHT_THRESHOLD_US", 0U)) * 1000;
+        const char* directory = std::getenv("HEXAGON_FLIGHT_DIR");
+        if (directory != nullptr && directory[0] != '\0') {
+            options.directory = directory;
+        }
+        options.handleSignal = true;
+
+        struct sigaction action{};
+        action.sa_handler = onDumpSignal;
+        sigemptyset(&action.sa_mask);
+        action.sa_flags = SA_RESTART;
+        sigaction(SIGUSR1, &action, nullptr);
+        return options;
+    }());
+    return recorder;
+}
+
+// ---------------------------------------------------------------------------
+// Dump reader
+// ---------------------------------------------------------------------------
+
+std::vector<FlightEntry> readFlightDump(const std::string& path, FlightDumpHeader& header) {
+    std::FILE* file = std::fopen(path.c_str(), "rb");
+    if (file == nullptr) {
+        throw std::runtime_error("FlightRecorder: cannot open " + path);
+    }
+    std::vector<FlightEntry> entries;
+    const bool headerRead = std::fread(&header, sizeof(header), 1U, file) == 1U;
+    const bool valid = headerRead && std::memcmp(header.magic, DUMP_MAGIC, sizeof(DUMP_MAGIC)) == 0 &&
+                       header.version == DUMP_VERSION && header.entryBytes == sizeof(FlightEntry);
+    if (valid) {
+        entries.resize(header.entries);
+        if (!entries.empty() && std::fread(entries.data(), sizeof(FlightEntry), entries.size(), file) != entries.size()) {
+            entries.clear();
+            std::fclose(file);
+            throw std::runtime_error("FlightRecorder: truncated dump " + path);
+        }
+    }
+    std::fclose(file);
+    if (!valid) {
+        throw std::runtime_error("FlightRecorder: not a flight dump: " + path);
+    }
+    return entries;
+}
+
+} // namespace capture
+} // namespace common
@@ -0,0 +1,161 @@
+/**
+ * @file FlightRecorder.h
+ * @brief Always-on ring of the last N messages' stage timestamps, dumped on demand
+ *
+ * Every message a hexagon handles leaves one 64-byte FlightEntry: track
+ * id, sequence and the TscClock time at receive, decode, compute and
+ * send. When p99 spikes, the ring holds what the last messages went
+ * through. It is written to "<dir>/flight.<pid>.<epoch us>.hxflt":
+ *
+ *  - on SIGUSR1 (kill -USR1 <pid>);
+ *  - automatically when a message's receive-to-send latency crosses the
+ *    threshold, at most once per minDumpIntervalMs;
+ *  - when requestDump() is called.
+ *
+ * Recording is a fetch_add and nine relaxed stores into a cache-line
+ * slot guarded by a per-slot sequence number, so it never blocks and
+ * costs a few tens of nanoseconds. Dumps run on the recorder's own
+ * thread and skip slots being overwritten at that moment.
+ *
+ * Stage stamps are collected in currentFlight(), a per-thread entry for
+ * the message the thread is handling. A stage that hands the message to
+ * another thread copies the entry along and installs it there before
+ * calling downstream; the last stage calls record(currentFlight()).
+ *
+ * Dump layout, host byte order: FlightDumpHeader (64 bytes), then
+ * FlightEntry[entries] oldest first.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace common {
+namespace capture {
+
+/// One message; stamps are TscClock epoch ns, 0 for stages the message did not pass
+struct FlightEntry {
+    std::uint64_t ticket = 0U;      ///< Recorder-wide order, assigned by record()
+    std::int64_t trackId = 0;
+    std::uint64_t sequence = 0U;    ///< Message sequence of the recording process
+    std::int64_t receiveNs = 0;
+    std::int64_t decodeNs = 0;
+    std::int64_t computeNs = 0;
+    std::int64_t sendNs = 0;
+    std::uint32_t flags = 0U;       ///< FLIGHT_OVER_THRESHOLD
+    std::uint32_t reserved = 0U;
+
+    /// Last stamp minus first stamp; 0 with fewer than two stamps
+    std::int64_t latencyNs() const noexcept;
+};
+static_assert(sizeof(FlightEntry) == 64U, "flight entry layout");
+
+constexpr std::uint32_t FLIGHT_OVER_THRESHOLD = 1U;
+
+enum class DumpReason : std::uint32_t {
+    Signal = 1U,
+    Threshold = 2U,
+    Request = 3U
+};
+
+/// First bytes of a dump file
+struct FlightDumpHeader {
+    char magic[8];                  ///< "HXFLT01"
+    std::uint32_t version;
+    std::uint32_t entryBytes;       ///< sizeof(FlightEntry)
+    std::uint64_t entries;
+    std::int64_t createdNs;
+    std::int64_t thresholdNs;
+    std::uint32_t reason;           ///< DumpReason
+    std::uint32_t pid;
+    std::uint8_t reserved[16];
+};
+static_assert(sizeof(FlightDumpHeader) == 64U, "flight dump header layout");
+
+struct FlightOptions {
+    std::size_t slots = 4096U;              ///< Rounded up to a power of two
+    std::int64_t thresholdNs = 0;           ///< Latency that triggers a dump; 0 disables
+    std::int64_t minDumpIntervalMs = 10000; ///< Between threshold dumps
+    std::string directory = "/tmp";
+    bool handleSignal = false;              ///< Dump on SIGUSR1 (one recorder per process)
+};
+
+/// Entry of the message this thread is handling
+FlightEntry& currentFlight() noexcept;
+
+/**
+ * @class FlightRecorder
+ * @brief Lock-free ring of FlightEntry plus the thread that writes dumps
+ */
+class FlightRecorder final {
+public:
+    /// @throws std::invalid_argument for zero slots
+    explicit FlightRecorder(const FlightOptions& options);
+
+    /// Stops the dump thread; a pending dump is written first
+    ~FlightRecorder();
+
+    FlightRecorder(const FlightRecorder&) = delete;
+    FlightRecorder& operator=(const FlightRecorder&) = delete;
+
+    /// Copies entry into the ring; any thread, never blocks
+    void record(const FlightEntry& entry) noexcept;
+
+    /// Next message sequence number (starts at 1)
+    std::uint64_t nextSequence() noexcept { return sequence_.fetch_add(1U, std::memory_order_relaxed) + 1U; }
+
+    /// Asks the dump thread for a dump; returns at once
+    void requestDump(DumpReason reason) noexcept;
+
+    /// Entries in the ring, oldest first; slots being written are skipped
+    std::vector<FlightEntry> snapshot() const;
+
+    /// Writes a dump now on the calling thread; returns its path, empty on failure
+    std::string dump(DumpReason reason);
+
+    std::uint64_t recorded() const noexcept { return next_.load(std::memory_order_relaxed); }
+    std::uint64_t dumps() const noexcept { return dumps_.load(std::memory_order_relaxed); }
+    const FlightOptions& options() const noexcept { return options_; }
+
+    /**
+     * @brief Recorder shared by the process
+     *
+     * $HEXAGON_FLIGHT_SLOTS (default 4096), $HEXAGON_FLIGHT_THRESHOLD_US
+     * (default 0, off) and $HEXAGON_FLIGHT_DIR (default /tmp) configure
+     * it. SIGUSR1 dumps it.
+     */
+    static FlightRecorder& process();
+
+private:
+    struct Slot;
+
+    void dumpLoop();
+
+    FlightOptions options_;
+    std::size_t mask_ = 0U;
+    std::unique_ptr<Slot[]> slots_;
+
+    alignas(64) std::atomic<std::uint64_t> next_{0U};
+    alignas(64) std::atomic<std::uint64_t> sequence_{0U};
+    std::atomic<std::uint32_t> pending_{0U};   ///< DumpReason, 0 if none
+    std::atomic<std::uint64_t> dumps_{0U};
+
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    bool stopping_ = false;
+    std::thread thread_;
+};
+
+/// Reads a dump written by FlightRecorder; @throws std::runtime_error
+std::vector<FlightEntry> readFlightDump(const std::string& path, FlightDumpHeader& header);
+
+} // namespace capture
+} // namespace common
@@ -0,0 +1,419 @@
+/**
+ * @file GeoTransforms.cpp
+ * @brief Scalar reference and AVX2 batch kernels for GeoTransforms.h
+ */
+
+#include "common/GeoTransforms.h"
+
+#include <cmath>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace common {
+namespace geo {
+
+namespace {
+
+// Prime vertical radius of curvature N(lat) = a / sqrt(1 - e2 sin^2(lat))
+inline double primeVerticalRadius(double sinLat) noexcept {
+    return WGS84_A / std::sqrt(1.0 - WGS84_E2 * sinLat * sinLat);
+}
+
+#if defined(__AVX2__)
+
+// ---------------------------------------------------------------------------
+// Vector math helpers (Cephes polynomials, double precision)
+// ---------------------------------------------------------------------------
+
+const __m256d kSignMask = _mm256_set1_pd(-0.0);
+const __m256d kOne = _mm256_set1_pd(1.0);
+const __m256d kHalf = _mm256_set1_pd(0.5);
+const __m256d kZero = _mm256_setzero_pd();
+const __m256d kPi = _mm256_set1_pd(3.14159265358979323846);
+const __m256d kPiOver2 = _mm256_set1_pd(1.57079632679489661923);
+const __m256d kPiOver4 = _mm256_set1_pd(0.78539816339744830962);
+
+inline __m256d vabs(__m256d v) noexcept {
+    return _mm256_andnot_pd(kSignMask, v);
+}
+
+inline __m256d vpoly(__m256d x, const double* c, int n) noexcept {
+    __m256d r = _mm256_set1_pd(c[0]);
+    for (int i = 1; i < n; ++i) {
+        r = _mm256_add_pd(_mm256_mul_pd(r, x), _mm256_set1_pd(c[i]));
+    }
+    return r;
+}
+
+// atan(r) for r in [0, 1]
+inline __m256d vatanUnit(__m256d r) noexcept {
+    static const double P[] = {
+        -8.750608600031904122785E-1, -1.615753718733365076637E1,
+        -7.500855792314704667340E1, -1.228866684490136173410E2,
+        -6.485021904942025371773E1};
+    static const double Q[] = {
+        1.0, 2.485846490142306297962E1, 1.650270098316988542046E2,
+        4.328810604912902668951E2, 4.853903996359136964868E2,
+        1.945506571482613964425E2};
+    const __m256d moreBitsHalf = _mm256_set1_pd(0.5 * 6.123233995736765886130E-17);
+
+    // r > 0.66: atan(r) = pi/4 + atan((r-1)/(r+1))
+    const __m256d big = _mm256_cmp_pd(r, _mm256_set1_pd(0.66), _CMP_GT_OQ);
+    const __m256d reduced = _mm256_div_pd(_mm256_sub_pd(r, kOne), _mm256_add_pd(r, kOne));
+    const __m256d x = _mm256_blendv_pd(r, reduced, big);
+    const __m256d base = _mm256_and_pd(big, _mm256_add_pd(kPiOver4, moreBitsHalf));
+
+    const __m256d z = _mm256_mul_pd(x, x);
+    const __m256d pz = _mm256_div_pd(vpoly(z, P, 5), vpoly(z, Q, 6));
+    return _mm256_add_pd(base, _mm256_add_pd(x, _mm256_mul_pd(_mm256_mul_pd(x, z), pz)));
+}
+
+inline __m256d vatan2(__m256d y, __m256d x) noexcept {
+    const __m256d ax = vabs(x);
+    const __m256d ay = vabs(y);
+    const __m256d mx = _mm256_max_pd(ax, ay);
+    const __m256d mn = _mm256_min_pd(ax, ay);
+    // 0/0 -> 0 (atan2(0, 0) == 0)
+    const __m256d safe = _mm256_blendv_pd(mx, kOne, _mm256_cmp_pd(mx, kZero, _CMP_EQ_OQ));
+    __m256d a = vatanUnit(_mm256_div_pd(mn, safe));
+
+    a = _mm256_blendv_pd(a, _mm256_sub_pd(kPiOver2, a), _mm256_cmp_pd(ay, ax, _CMP_GT_OQ));
+    a = _mm256_blendv_pd(a, _mm256_sub_pd(kPi, a), _mm256_cmp_pd(x, kZero, _CMP_LT_OQ));
+    return _mm256_or_pd(a, _mm256_and_pd(y, kSignMask));
+}
+
+// sin and cos of v, |v| within a few multiples of pi
+inline void vsincos(__m256d v, __m256d& s, __m256d& c) noexcept {
+    static const double S[] = {
+        1.58962301576546568060E-10, -2.50507477628578072866E-8,
+        2.75573136213857245213E-6, -1.98412698295895385996E-4,
+        8.33333333332211858878E-3, -1.66666666666666307295E-1};
+    static const double C[] = {
+        -1.13585365213876817300E-11, 2.08757008419747316778E-9,
+        -2.75573141792967388112E-7, 2.48015872888517045348E-5,
+        -1.38888888888730564116E-3, 4.16666666666665929218E-2};
+
+    // Quadrant q = round(v / (pi/2)); Cody-Waite reduction to [-pi/4, pi/4]
+    const __m256d q = _mm256_round_pd(_mm256_mul_pd(v, _mm256_set1_pd(0.63661977236758134308)),
+                                      _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    __m256d r = _mm256_sub_pd(v, _mm256_mul_pd(q, _mm256_set1_pd(1.57079625129699707031E0)));
+    r = _mm256_sub_pd(r, _mm256_mul_pd(q, _mm256_set1_pd(7.54978941586159635335E-8)));
+    r = _mm256_sub_pd(r, _mm256_mul_pd(q, _mm256_set1_pd(5.39030285815811905290E-15)));
+
+    const __m256d zz = _mm256_mul_pd(r, r);
+    const __m256d sr = _mm256_add_pd(r, _mm256_mul_pd(_mm256_mul_pd(r, zz), vpoly(zz, S, 6)));
+    const __m256d cr = _mm256_add_pd(_mm256_sub_pd(kOne, _mm256_mul_pd(kHalf, zz)),
+                                     _mm256_mul_pd(_mm256_mul_pd(zz, zz), vpoly(zz, C, 6)));
+
+    // quadrant = q mod 4 in [0, 3]
+    const __m256d quarter = _mm256_floor_pd(_mm256_mul_pd(q, _mm256_set1_pd(0.25)));
+    const __m256d quad = _mm256_sub_pd(q, _mm256_mul_pd(quarter, _mm256_set1_pd(4.0)));
+    const __m256d q1 = _mm256_cmp_pd(quad, kOne, _CMP_EQ_OQ);
+    const __m256d q2 = _mm256_cmp_pd(quad, _mm256_set1_pd(2.0), _CMP_EQ_OQ);
+    const __m256d q3 = _mm256_cmp_pd(quad, _mm256_set1_pd(3.0), _CMP_EQ_OQ);
+
+    const __m256d swap = _mm256_or_pd(q1, q3);
+    s = _mm256_blendv_pd(sr, cr, swap);
+    c = _mm256_blendv_pd(cr, sr, swap);
+    s = _mm256_xor_pd(s, _mm256_and_pd(_mm256_or_pd(q2, q3), kSignMask));
+    c = _mm256_xor_pd(c, _mm256_and_pd(_mm256_or_pd(q1, q2), kSignMask));
+}
+
+inline __m256d vload(const double* p) noexcept { return _mm256_loadu_pd(p); }
+inline void vstore(double* p, __m256d v) noexcept { _mm256_storeu_pd(p, v); }
+
+#endif // __AVX2__
+
+} // namespace
+
+bool isVectorized() noexcept {
+#if defined(__AVX2__)
+    return true;
+#else
+    return false;
+#endif
+}
+
+// ---------------------------------------------------------------------------
+// Scalar reference
+// ---------------------------------------------------------------------------
+
+void ecefToGeodetic(double x, double y, double z,
+                    double& lat, double& lon, double& alt) noexcept {
+    const double p = std::sqrt(x * x + y * y);
+
+    // Parametric latitude without trig: tan(theta) = z a / (p b)
+    const double pb = p * WGS84_B;
+    const double za = z * WGS84_A;
+    double d = std::sqrt(pb * pb + za * za);
+    if (!(d > 0.0)) {
+        d = 1.0; // Earth centre: degenerate, report lat = 0
+    }
+    const double cosT = pb / d;
+    const double sinT = za / d;
+
+    const double num = z + WGS84_EP2 * WGS84_B * sinT * sinT * sinT;
+    const double den = p - WGS84_E2 * WGS84_A * cosT * cosT * cosT;
+    double r = std::sqrt(num * num + den * den);
+    if (!(r > 0.0)) {
+        r = 1.0;
+    }
+    const double sinLat = num / r;
+    const double cosLat = den / r;
+
+    lat = std::atan2(num, den);
+    lon = std::atan2(y, x);
+    // h = p cos(lat) + z sin(lat) - a^2/N, well-conditioned at the poles
+    alt = p * cosLat + z * sinLat - WGS84_A * std::sqrt(1.0 - WGS84_E2 * sinLat * sinLat);
+}
+
+void geodeticToEcef(double lat, double lon, double alt,
+                    double& x, double& y, double& z) noexcept {
+    const double sinLat = std::sin(lat);
+    const double cosLat = std::cos(lat);
+    const double n = primeVerticalRadius(sinLat);
+    x = (n + alt) * cosLat * std::cos(lon);
+    y = (n + alt) * cosLat * std::sin(lon);
+    z = (n * (1.0 - WGS84_E2) + alt) * sinLat;
+}
+
+// ---------------------------------------------------------------------------
+// Batch kernels
+// ---------------------------------------------------------------------------
+
+void ecefToGeodetic(const double* x, const double* y, const double* z,
+                    double* lat, double* lon, double* alt,
+                    std::size_t count) noexcept {
+    std::size_t i = 0U;
+#if defined(__AVX2__)
+    const std::size_t vectorEnd = count & ~static_cast<std::size_t>(3U);
+    const __m256d a = _mm256_set1_pd(WGS84_A);
+    const __m256d b = _mm256_set1_pd(WGS84_B);
+    const __m256d ep2b = _mm256_set1_pd(WGS84_EP2 * WGS84_B);
+    const __m256d e2a = _mm256_set1_pd(WGS84_E2 * WGS84_A);
+    const __m256d e2 = _mm256_set1_pd(WGS84_E2);
+
+    for (; i < vectorEnd; i += 4U) {
+        const __m256d vx = vload(x + i);
+        const __m256d vy = vload(y + i);
+        const __m256d vz = vload(z + i);
+
+        const __m256d p = _mm256_sqrt_pd(_mm256_add_pd(_mm256_mul_pd(vx, vx), _mm256_mul_pd(vy, vy)));
+        const __m256d pb = _mm256_mul_pd(p, b);
+        const __m256d za = _mm256_mul_pd(vz, a);
+        __m256d d = _mm256_sqrt_pd(_mm256_add_pd(_mm256_mul_pd(pb, pb), _mm256_mul_pd(za, za)));
+        d = _mm256_blendv_pd(d, kOne, _mm256_cmp_pd(d, kZero, _CMP_EQ_OQ));
+        const __m256d cosT = _mm256_div_pd(pb, d);
+        const __m256d sinT = _mm256_div_pd(za, d);
+
+        const __m256d sin3 = _mm256_mul_pd(_mm256_mul_pd(sinT, sinT), sinT);
+        const __m256d cos3 = _mm256_mul_pd(_mm256_mul_pd(cosT, cosT), cosT);
+        const __m256d num = _mm256_add_pd(vz, _mm256_mul_pd(ep2b, sin3));
+        const __m256d den = _mm256_sub_pd(p, _mm256_mul_pd(e2a, cos3));
+
+        __m256d r = _mm256_sqrt_pd(_mm256_add_pd(_mm256_mul_pd(num, num), _mm256_mul_pd(den, den)));
+        r = _mm256_blendv_pd(r, kOne, _mm256_cmp_pd(r, kZero, _CMP_EQ_OQ));
+        const __m256d sinLat = _mm256_div_pd(num, r);
+        const __m256d cosLat = _mm256_div_pd(den, r);
+
+        const __m256d a2n = _mm256_mul_pd(a, _mm256_sqrt_pd(
+            _mm256_sub_pd(kOne, _mm256_mul_pd(e2, _mm256_mul_pd(sinLat, sinLat)))));
+        const __m256d h = _mm256_sub_pd(
+            _mm256_add_pd(_mm256_mul_pd(p, cosLat), _mm256_mul_pd(vz, sinLat)), a2n);
+
+        vstore(lat + i, vatan2(num, den));
+        vstore(lon + i, vatan2(vy, vx));
+        vstore(alt + i, h);
+    }
+#endif
+    for (; i < count; ++i) {
+        ecefToGeodetic(x[i], y[i], z[i], lat[i], lon[i], alt[i]);
+    }
+}
+
+void geodeticToEcef(const double* lat, const double* lon, const double* alt,
+                    double* x, double* y, double* z,
+                    std::size_t count) noexcept {
+    std::size_t i = 0U;
+#if defined(__AVX2__)
+    const std::size_t vectorEnd = count & ~static_cast<std::size_t>(3U);
+    const __m256d a = _mm256_set1_pd(WGS84_A);
+    const __m256d e2 = _mm256_set1_pd(WGS84_E2);
+    const __m256d oneMinusE2 = _mm256_set1_pd(1.0 - WGS84_E2);
+
+    for (; i < vectorEnd; i += 4U) {
+        __m256d sinLat;
+        __m256d cosLat;
+        __m256d sinLon;
+        __m256d cosLon;
+        vsincos(vload(lat + i), sinLat, cosLat);
+        vsincos(vload(lon + i), sinLon, cosLon);
+        const __m256d h = vload(alt + i);
+
+        const __m256d n = _mm256_div_pd(a, _mm256_sqrt_pd(
+            _mm256_sub_pd(kOne, _mm256_mul_pd(e2, _mm256_mul_pd(sinLat, sinLat)))));
+        const __m256d rc = _mm256_mul_pd(_mm256_add_pd(n, h), cosLat);
+
+        vstore(x + i, _mm256_mul_pd(rc, cosLon));
+        vstore(y + i, _mm256_mul_pd(rc, sinLon));
+        vstore(z + i, _mm256_mul_pd(_mm256_add_pd(_mm256_mul_pd(n, oneMinusE2), h), sinLat));
+    }
+#endif
+    for (; i < count; ++i) {
+        geodeticToEcef(lat[i], lon[i], alt[i], x[i], y[i], z[i]);
+    }
+}
+
+// ---------------------------------------------------------------------------
+// EnuFrame
+// ---------------------------------------------------------------------------
+
+EnuFrame::EnuFrame(double refLat, double refLon, double refAlt) noexcept
+    : r_{}, refX_(0.0), refY_(0.0), refZ_(0.0) {
+    geodeticToEcef(refLat, refLon, refAlt, refX_, refY_, refZ_);
+
+    const double sinLat = std::sin(refLat);
+    const double cosLat = std::cos(refLat);
+    const double sinLon = std::sin(refLon);
+    const double cosLon = std::cos(refLon);
+
+    // East
+    r_[0] = -sinLon;
+    r_[1] = cosLon;
+    r_[2] = 0.0;
+    // North
+    r_[3] = -sinLat * cosLon;
+    r_[4] = -sinLat * sinLon;
+    r_[5] = cosLat;
+    // Up
+    r_[6] = cosLat * cosLon;
+    r_[7] = cosLat * sinLon;
+    r_[8] = sinLat;
+}
+
+void EnuFrame::ecefToEnu(double x, double y, double z,
+                         double& e, double& n, double& u) const noexcept {
+    const double dx = x - refX_;
+    const double dy = y - refY_;
+    const double dz = z - refZ_;
+    e = r_[0] * dx + r_[1] * dy + r_[2] * dz;
+    n = r_[3] * dx + r_[4] * dy + r_[5] * dz;
+    u = r_[6] * dx + r_[7] * dy + r_[8] * dz;
+}
+
+void EnuFrame::enuToEcef(double e, double n, double u,
+                         double& x, double& y, double& z) const noexcept {
+    // Inverse rotation is the transpose
+    x = r_[0] * e + r_[3] * n + r_[6] * u + refX_;
+    y = r_[1] * e + r_[4] * n + r_[7] * u + refY_;
+    z = r_[2] * e + r_[5] * n + r_[8] * u + refZ_;
+}
+
+void EnuFrame::ecefVectorToEnu(const double* vx, const double* vy, const double* vz,
+                               double* ve, double* vn, double* vu, std::size_t count) const noexcept {
+    std::size_t i = 0U;
+#if defined(__AVX2__)
+    const std::size_t vectorEnd = count & ~static_cast<std::size_t>(3U);
+    const __m256d m0 = _mm256_set1_pd(r_[0]);
+    const __m256d m1 = _mm256_set1_pd(r_[1]);
+    const __m256d m3 = _mm256_set1_pd(r_[3]);
+    const __m256d m4 = _mm256_set1_pd(r_[4]);
+    const __m256d m5 = _mm256_set1_pd(r_[5]);
+    const __m256d m6 = _mm256_set1_pd(r_[6]);
+    const __m256d m7 = _mm256_set1_pd(r_[7]);
+    const __m256d m8 = _mm256_set1_pd(r_[8]);
+    for (; i < vectorEnd; i += 4U) {
+        const __m256d dx = vload(vx + i);
+        const __m256d dy = vload(vy + i);
+        const __m256d dz = vload(vz + i);
+        vstore(ve + i, _mm256_add_pd(_mm256_mul_pd(m0, dx), _mm256_mul_pd(m1, dy)));
+        vstore(vn + i, _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(m3, dx), _mm256_mul_pd(m4, dy)),
+                                     _mm256_mul_pd(m5, dz)));
+        vstore(vu + i, _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(m6, dx), _mm256_mul_pd(m7, dy)),
+                                     _mm256_mul_pd(m8, dz)));
+    }
+#endif
+    for (; i < count; ++i) {
+        ve[i] = r_[0] * vx[i] + r_[1] * vy[i] + r_[2] * vz[i];
+        vn[i] = r_[3] * vx[i] + r_[4] * vy[i] + r_[5] * vz[i];
+        vu[i] = r_[6] * vx[i] + r_[7] * vy[i] + r_[8] * vz[i];
+    }
+}
+
+void EnuFrame::enuVectorToEcef(const double* ve, const double* vn, const double* vu,
+                               double* vx, double* vy, double* vz, std::size_t count) const noexcept {
+    std::size_t i = 0U;
+#if defined(__AVX2__)
+    const std::size_t vectorEnd = count & ~static_cast<std::size_t>(3U);
+    const __m256d m0 = _mm256_set1_pd(r_[0]);
+    const __m256d m1 = _mm256_set1_pd(r_[1]);
+    const __m256d m3 = _mm256_set1_pd(r_[3]);
+    const __m256d m4 = _mm256_set1_pd(r_[4]);
+    const __m256d m5 = _mm256_set1_pd(r_[5]);
+    const __m256d m6 = _mm256_set1_pd(r_[6]);
+    const __m256d m7 = _mm256_set1_pd(r_[7]);
+    const __m256d m8 = _mm256_set1_pd(r_[8]);
+    for (; i < vectorEnd; i += 4U) {
+        const __m256d e = vload(ve + i);
+        const __m256d n = vload(vn + i);
+        const __m256d u = vload(vu + i);
+        vstore(vx + i, _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(m0, e), _mm256_mul_pd(m3, n)),
+                                     _mm256_mul_pd(m6, u)));
+        vstore(vy + i, _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(m1, e), _mm256_mul_pd(m4, n)),
+                                     _mm256_mul_pd(m7, u)));
+        vstore(vz + i, _mm256_add_pd(_mm256_mul_pd(m5, n), _mm256_mul_pd(m8, u)));
+    }
+#endif
+    for (; i < count; ++i) {
+        vx[i] = r_[0] * ve[i] + r_[3] * vn[i] + r_[6] * vu[i];
+        vy[i] = r_[1] * ve[i] + r_[4] * vn[i] + r_[7] * vu[i];
+        vz[i] = r_[2] * ve[i] + r_[5] * vn[i] + r_[8] * vu[i];
+    }
+}
+
+void EnuFrame::ecefToEnu(const double* x, const double* y, const double* z,
+                         double* e, double* n, double* u, std::size_t count) const noexcept {
+    std::size_t i = 0U;
+#if defined(__AVX2__)
+    const std::size_t vectorEnd = count & ~static_cast<std::size_t>(3U);
+    const __m256d rx = _mm256_set1_pd(refX_);
+    const __m256d ry = _mm256_set1_pd(refY_);
+    const __m256d rz = _mm256_set1_pd(refZ_);
+    const __m256d m0 = _mm256_set1_pd(r_[0]);
+    const __m256d m1 = _mm256_set1_pd(r_[1]);
+    const __m256d m3 = _mm256_set1_pd(r_[3]);
+    const __m256d m4 = _mm256_set1_pd(r_[4]);
+    const __m256d m5 = _mm256_set1_pd(r_[5]);
+    const __m256d m6 = _mm256_set1_pd(r_[6]);
+    const __m256d m7 = _mm256_set1_pd(r_[7]);
+    const __m256d m8 = _mm256_set1_pd(r_[8]);
+    for (; i < vectorEnd; i += 4U) {
+        const __m256d dx = _mm256_sub_pd(vload(x + i), rx);
+        const __m256d dy = _mm256_sub_pd(vload(y + i), ry);
+        const __m256d dz = _mm256_sub_pd(vload(z + i), rz);
+        vstore(e + i, _mm256_add_pd(_mm256_mul_pd(m0, dx), _mm256_mul_pd(m1, dy)));
+        vstore(n + i, _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(m3, dx), _mm256_mul_pd(m4, dy)),
+                                    _mm256_mul_pd(m5, dz)));
+        vstore(u + i, _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(m6, dx), _mm256_mul_pd(m7, dy)),
+                                    _mm256_mul_pd(m8, dz)));
+    }
+#endif
+    for (; i < count; ++i) {
+        ecefToEnu(x[i], y[i], z[i], e[i], n[i], u[i]);
+    }
+}
+
+void EnuFrame::enuToEcef(const double* e, const double* n, const double* u,
+                         double* x, double* y, double* z, std::size_t count) const noexcept {
+    enuVectorToEcef(e, n, u, x, y, z, count);
+    for (std::size_t i = 0U; i < count; ++i) {
+        x[i] += refX_;
+        y[i] += refY_;
+        z[i] += refZ_;
+    }
+}
+
+} // namespace geo
+} // namespace common
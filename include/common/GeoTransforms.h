@@ -0,0 +1,125 @@
+/**
+ * @file GeoTransforms.h
+ * @brief Batch ECEF <-> geodetic (WGS-84) and ECEF <-> local ENU transforms
+ *
+ * Shared by all hexagons: every track model carries raw ECEF, and consumers
+ * that need lat/lon/alt or a sensor-local frame convert whole ticks at once
+ * over structure-of-arrays columns instead of one object at a time.
+ *
+ * - ECEF -> geodetic uses Bowring's closed-form single step (no iteration,
+ *   sub-millimetre for altitudes below ~1000 km).
+ * - All angles are radians, all distances metres.
+ * - When compiled with AVX2 the batch kernels process four tracks per
+ *   instruction; otherwise they fall back to the scalar reference.
+ */
+
+#pragma once
+
+#include <cstddef>
+
+namespace common {
+namespace geo {
+
+/// WGS-84 semi-major axis (m)
+constexpr double WGS84_A = 6378137.0;
+/// WGS-84 flattening
+constexpr double WGS84_F = 1.0 / 298.257223563;
+/// WGS-84 semi-minor axis (m)
+constexpr double WGS84_B = WGS84_A * (1.0 - WGS84_F);
+/// First eccentricity squared
+constexpr double WGS84_E2 = WGS84_F * (2.0 - WGS84_F);
+/// Second eccentricity squared
+constexpr double WGS84_EP2 = WGS84_E2 / (1.0 - WGS84_E2);
+
+/**
+ * @brief True when the batch kernels were compiled with AVX2
+ */
+bool isVectorized() noexcept;
+
+// ---------------------------------------------------------------------------
+// Scalar reference (single point)
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Convert one ECEF position to geodetic coordinates
+ * @param x,y,z ECEF position (m)
+ * @param lat,lon Geodetic latitude / longitude (rad)
+ * @param alt Height above the ellipsoid (m)
+ */
+void ecefToGeodetic(double x, double y, double z,
+                    double& lat, double& lon, double& alt) noexcept;
+
+/**
+ * @brief Convert one geodetic position to ECEF
+ */
+void geodeticToEcef(double lat, double lon, double alt,
+                    double& x, double& y, double& z) noexcept;
+
+// ---------------------------------------------------------------------------
+// Batch (structure-of-arrays) kernels
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Convert count ECEF positions to geodetic coordinates
+ *
+ * Input and output columns must not overlap. No alignment is required.
+ */
+void ecefToGeodetic(const double* x, const double* y, const double* z,
+                    double* lat, double* lon, double* alt,
+                    std::size_t count) noexcept;
+
+/**
+ * @brief Convert count geodetic positions to ECEF
+ */
+void geodeticToEcef(const double* lat, const double* lon, const double* alt,
+                    double* x, double* y, double* z,
+                    std::size_t count) noexcept;
+
+/**
+ * @class EnuFrame
+ * @brief Local East-North-Up frame anchored at a reference geodetic point
+ *
+ * The rotation and reference ECEF position are computed once at
+ * construction, so per-track conversion is a translation plus a 3x3
+ * rotation. Positions use ecefToEnu/enuToEcef; velocities and other free
+ * vectors use the rotation-only variants.
+ */
+class EnuFrame final {
+public:
+    /**
+     * @param refLat Reference latitude (rad)
+     * @param refLon Reference longitude (rad)
+     * @param refAlt Reference height above the ellipsoid (m)
+     */
+    EnuFrame(double refLat, double refLon, double refAlt) noexcept;
+
+    /// Single-point position transforms
+    void ecefToEnu(double x, double y, double z, double& e, double& n, double& u) const noexcept;
+    void enuToEcef(double e, double n, double u, double& x, double& y, double& z) const noexcept;
+
+    /// Batch position transforms
+    void ecefToEnu(const double* x, const double* y, const double* z,
+                   double* e, double* n, double* u, std::size_t count) const noexcept;
+    void enuToEcef(const double* e, const double* n, const double* u,
+                   double* x, double* y, double* z, std::size_t count) const noexcept;
+
+    /// Batch rotation-only transforms (velocities)
+    void ecefVectorToEnu(const double* vx, const double* vy, const double* vz,
+                         double* ve, double* vn, double* vu, std::size_t count) const noexcept;
+    void enuVectorToEcef(const double* ve, const double* vn, const double* vu,
+                         double* vx, double* vy, double* vz, std::size_t count) const noexcept;
+
+    double getRefX() const noexcept { return refX_; }
+    double getRefY() const noexcept { return refY_; }
+    double getRefZ() const noexcept { return refZ_; }
+
+private:
+    /// Rotation ECEF -> ENU, row-major (rows: east, north, up)
+    double r_[9];
+    double refX_;
+    double refY_;
+    double refZ_;
+};
+
+} // namespace geo
+} // namespace common
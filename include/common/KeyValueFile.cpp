@@ -0,0 +1,49 @@
+/**
+ * @file KeyValueFile.cpp
+ * @brief Key/value configuration file reader
+ */
+
+#include "common/KeyValueFile.h"
+
+#include <fstream>
+#include <stdexcept>
+
+namespace common {
+namespace config {
+
+std::string trim(const std::string& text) {
+    const std::size_t first = text.find_first_not_of(" \t\r\n");
+    if (first == std::string::npos) {
+        return std::string();
+    }
+    const std::size_t last = text.find_last_not_of(" \t\r\n");
+    return text.substr(first, last - first + 1U);
+}
+
+std::map<std::string, std::string> readKeyValueFile(const std::string& path, const std::string& owner) {
+    std::ifstream file(path);
+    std::map<std::string, std::string> config;
+    if (!file.is_open()) {
+        return config;
+    }
+    std::string line;
+    while (std::getline(file, line)) {
+        const std::size_t hash = line.find('#');
+        if (hash != std::string::npos) {
+            line.erase(hash);
+        }
+        line = trim(line);
+        if (line.empty()) {
+            continue;
+        }
+        const std::size_t eq = line.find('=');
+        if (eq == std::string::npos) {
+            throw std::invalid_argument(owner + ": expected key = value in " + path + ": '" + line + "'");
+        }
+        config[trim(line.substr(0U, eq))] = trim(line.substr(eq + 1U));
+    }
+    return config;
+}
+
+} // namespace config
+} // namespace common
@@ -0,0 +1,27 @@
+/**
+ * @file KeyValueFile.h
+ * @brief Reader for the "key = value" configuration files under config/
+ */
+
+#pragma once
+
+#include <map>
+#include <string>
+
+namespace common {
+namespace config {
+
+/**
+ * @brief Reads "key = value" lines; '#' starts a comment, blank lines are skipped
+ *
+ * A missing file yields an empty map so optional features stay off.
+ * @param owner Prefix for error messages (e.g. "ThreadTopology")
+ * @throws std::invalid_argument on a line without '='
+ */
+std::map<std::string, std::string> readKeyValueFile(const std::string& path, const std::string& owner);
+
+/// Strips leading and trailing whitespace
+std::string trim(const std::string& text);
+
+} // namespace config
+} // namespace common
@@ -0,0 +1,169 @@
+/**
+ * @file MessageBufferPool.cpp
+ * @brief MessageBufferPool implementation
+ */
+
+#include "common/MessageBufferPool.h"
+
+#include <new>
+
+namespace common {
+namespace pool {
+
+namespace {
+
+thread_local MessageBufferPool* localPool = nullptr;
+
+} // namespace
+
+/// Drops the owning thread's reference at thread exit
+struct PoolOwner {
+    MessageBufferPool* pool = nullptr;
+    ~PoolOwner() {
+        if (pool != nullptr) {
+            localPool = nullptr;
+            pool->unref();
+        }
+    }
+};
+
+namespace {
+
+thread_local PoolOwner poolOwner;
+
+} // namespace
+
+constexpr std::array<std::size_t, 7> MessageBufferPool::SIZE_CLASSES;
+
+PooledBuffer::~PooledBuffer() {
+    if (block_ != nullptr) {
+        MessageBufferPool::release(data(), block_);
+    }
+}
+
+PooledBuffer& PooledBuffer::operator=(PooledBuffer&& other) noexcept {
+    if (this != &other) {
+        if (block_ != nullptr) {
+            MessageBufferPool::release(data(), block_);
+        }
+        block_ = other.block_;
+        other.block_ = nullptr;
+    }
+    return *this;
+}
+
+std::uint8_t* PooledBuffer::data() const noexcept {
+    return block_ != nullptr ? reinterpret_cast<std::uint8_t*>(block_ + 1) : nullptr;
+}
+
+MessageBufferPool::MessageBufferPool()
+    : freeLists_(),
+      returned_(),
+      slabs_(),
+      refs_(1U),
+      stats_() {
+    freeLists_.fill(nullptr);
+    for (std::atomic<BlockHeader*>& head : returned_) {
+        head.store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+MessageBufferPool& MessageBufferPool::local() {
+    if (localPool == nullptr) {
+        poolOwner.pool = new MessageBufferPool();
+        localPool = poolOwner.pool;
+    }
+    return *localPool;
+}
+
+std::size_t MessageBufferPool::classFor(std::size_t size) noexcept {
+    std::size_t sizeClass = 0U;
+    while (sizeClass < CLASS_COUNT && SIZE_CLASSES[sizeClass] < size) {
+        ++sizeClass;
+    }
+    return sizeClass;
+}
+
+PooledBuffer MessageBufferPool::acquire(std::size_t size) {
+    ++stats_.acquired;
+    const std::size_t sizeClass = classFor(size);
+    if (sizeClass == CLASS_COUNT) {
+        // Oversize: plain heap block, freed again in release()
+        ++stats_.oversize;
+        std::uint8_t* raw = new std::uint8_t[sizeof(BlockHeader) + size];
+        BlockHeader* block = new (raw) BlockHeader{nullptr, nullptr, 0U, static_cast<std::uint32_t>(size)};
+        return PooledBuffer(block);
+    }
+
+    BlockHeader* block = freeLists_[sizeClass];
+    if (block == nullptr) {
+        // Take back everything other threads have released since the last drain
+        block = returned_[sizeClass].exchange(nullptr, std::memory_order_acquire);
+        for (const BlockHeader* b = block; b != nullptr; b = b->next) {
+            ++stats_.reclaimed;
+        }
+        if (block == nullptr) {
+            grow(sizeClass);
+            block = freeLists_[sizeClass];
+        }
+    }
+    freeLists_[sizeClass] = block->next;
+    block->next = nullptr;
+    refs_.fetch_add(1U, std::memory_order_relaxed);
+    return PooledBuffer(block);
+}
+
+void MessageBufferPool::grow(std::size_t sizeClass) {
+    const std::size_t stride = sizeof(BlockHeader) + SIZE_CLASSES[sizeClass];
+    std::unique_ptr<std::uint8_t[]> slab(new std::uint8_t[stride * BLOCKS_PER_SLAB]);
+    BlockHeader* head = freeLists_[sizeClass];
+    for (std::size_t i = BLOCKS_PER_SLAB; i > 0U; --i) {
+        head = new (slab.get() + (i - 1U) * stride) BlockHeader{
+            this, head, static_cast<std::uint32_t>(sizeClass), static_cast<std::uint32_t>(SIZE_CLASSES[sizeClass])};
+    }
+    freeLists_[sizeClass] = head;
+    slabs_.push_back(std::move(slab));
+    ++stats_.slabs;
+}
+
+void MessageBufferPool::release(void* /*data*/, void* hint) noexcept {
+    BlockHeader* block = static_cast<BlockHeader*>(hint);
+    if (block == nullptr) {
+        return;
+    }
+    MessageBufferPool* owner = block->owner;
+    if (owner == nullptr) {
+        delete[] reinterpret_cast<std::uint8_t*>(block);
+        return;
+    }
+    if (owner == localPool) {
+        block->next = owner->freeLists_[block->sizeClass];
+        owner->freeLists_[block->sizeClass] = block;
+    } else {
+        owner->pushRemote(block);
+    }
+    owner->unref();
+}
+
+void MessageBufferPool::pushRemote(BlockHeader* block) noexcept {
+    std::atomic<BlockHeader*>& head = returned_[block->sizeClass];
+    BlockHeader* expected = head.load(std::memory_order_relaxed);
+    do {
+        block->next = expected;
+    } while (!head.compare_exchange_weak(expected, block, std::memory_order_release, std::memory_order_relaxed));
+}
+
+void MessageBufferPool::unref() noexcept {
+    if (refs_.fetch_sub(1U, std::memory_order_acq_rel) == 1U) {
+        // Owning thread gone and every block back: slabs go with the pool
+        delete this;
+    }
+}
+
+std::size_t MessageBufferPool::outstanding() const noexcept {
+    const std::size_t refs = refs_.load(std::memory_order_acquire);
+    return refs > 0U ? refs - 1U : 0U;
+}
+
+} // namespace pool
+} // namespace common
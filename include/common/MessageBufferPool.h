@@ -0,0 +1,131 @@
+/**
+ * @file MessageBufferPool.h
+ * @brief Size-classed, per-thread pool of zmq::message_t payload buffers
+ *
+ * Serialized track messages are 84-124 bytes, above libzmq's inline
+ * very-small-message limit, so each send used to allocate a std::vector
+ * from serialize() plus a content block inside libzmq. The pool hands out
+ * preallocated blocks that the adapters serialize into directly; the block
+ * is wrapped with zmq_msg_init_data and comes back through release() when
+ * libzmq drops the message.
+ *
+ * release() usually runs on a libzmq I/O thread, not on the thread that
+ * acquired the block. Blocks released by their owning thread go straight to
+ * its freelist; blocks released elsewhere are pushed onto a lock-free return
+ * stack that the owner drains when its freelist runs dry. A pool outlives
+ * its thread until the last in-flight block has come back.
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace common {
+namespace pool {
+
+class MessageBufferPool;
+
+/// Header in front of every block; the payload follows it
+struct alignas(16) BlockHeader {
+    MessageBufferPool* owner;  ///< nullptr for oversize blocks
+    BlockHeader* next;         ///< Freelist / return stack link
+    std::uint32_t sizeClass;
+    std::uint32_t capacity;
+};
+
+/**
+ * @class PooledBuffer
+ * @brief Owns one block until it is handed to libzmq with detach()
+ *
+ * Dropping a PooledBuffer without detaching returns the block to its pool,
+ * so an exception between acquire and send does not leak.
+ */
+class PooledBuffer final {
+public:
+    PooledBuffer() noexcept = default;
+    explicit PooledBuffer(BlockHeader* block) noexcept : block_(block) {}
+    ~PooledBuffer();
+
+    PooledBuffer(PooledBuffer&& other) noexcept : block_(other.block_) { other.block_ = nullptr; }
+    PooledBuffer& operator=(PooledBuffer&& other) noexcept;
+    PooledBuffer(const PooledBuffer&) = delete;
+    PooledBuffer& operator=(const PooledBuffer&) = delete;
+
+    std::uint8_t* data() const noexcept;
+    std::size_t capacity() const noexcept { return block_ != nullptr ? block_->capacity : 0U; }
+
+    /// Hint to pass along with MessageBufferPool::release as zmq free function
+    void* hint() const noexcept { return block_; }
+
+    /// Gives up ownership once libzmq holds the block
+    void detach() noexcept { block_ = nullptr; }
+
+private:
+    BlockHeader* block_ = nullptr;
+};
+
+/**
+ * @class MessageBufferPool
+ * @brief Per-thread pool; obtain it with local() on the sending thread
+ */
+class MessageBufferPool final {
+public:
+    /// Payload capacities of the size classes
+    static constexpr std::array<std::size_t, 7> SIZE_CLASSES = {{64U, 128U, 256U, 512U, 1024U, 2048U, 4096U}};
+    static constexpr std::size_t CLASS_COUNT = SIZE_CLASSES.size();
+
+    /// Blocks carved from one slab allocation
+    static constexpr std::size_t BLOCKS_PER_SLAB = 64U;
+
+    /// Owner-thread counters
+    struct Stats {
+        std::uint64_t acquired = 0U;   ///< Blocks handed out (pooled and oversize)
+        std::uint64_t reclaimed = 0U;  ///< Blocks drained from the return stack
+        std::uint64_t slabs = 0U;      ///< Slab allocations
+        std::uint64_t oversize = 0U;   ///< Requests above the largest class
+    };
+
+    /// Pool of the calling thread, created on first use
+    static MessageBufferPool& local();
+
+    /// Block of at least size bytes; sizes above the largest class fall back to the heap
+    PooledBuffer acquire(std::size_t size);
+
+    /// zmq_free_fn-compatible release; hint is PooledBuffer::hint()
+    static void release(void* data, void* hint) noexcept;
+
+    /// Blocks acquired and not yet released
+    std::size_t outstanding() const noexcept;
+
+    const Stats& getStats() const noexcept { return stats_; }
+
+    MessageBufferPool(const MessageBufferPool&) = delete;
+    MessageBufferPool& operator=(const MessageBufferPool&) = delete;
+
+private:
+    friend struct PoolOwner;
+
+    MessageBufferPool();
+    ~MessageBufferPool() = default;
+
+    static std::size_t classFor(std::size_t size) noexcept;
+    void grow(std::size_t sizeClass);
+    void pushRemote(BlockHeader* block) noexcept;
+    void unref() noexcept;
+
+    std::array<BlockHeader*, CLASS_COUNT> freeLists_;
+    std::array<std::atomic<BlockHeader*>, CLASS_COUNT> returned_;
+    std::vector<std::unique_ptr<std::uint8_t[]>> slabs_;
+
+    /// One reference per outstanding block plus one for the owning thread
+    std::atomic<std::size_t> refs_;
+    Stats stats_;
+};
+
+} // namespace pool
+} // namespace common
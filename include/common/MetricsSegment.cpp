@@ -0,0 +1,287 @@
+/**
+ * @file MetricsSegment.cpp
+ * @brief Segment mapping, metric registration and the read-only view
+ */
+
+#include "common/MetricsSegment.h"
+
+#include "common/TscClock.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <stdexcept>
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace common {
+namespace metrics {
+
+namespace {
+
+constexpr char SEGMENT_MAGIC[8] = {'H', 'X', 'M', 'E', 'T', '0', '1', '\0'};
+constexpr std::uint32_t SEGMENT_VERSION = 1U;
+constexpr const char* SEGMENT_PREFIX = "hexagon.";
+
+std::size_t segmentBytes(std::size_t capacity) noexcept {
+    return sizeof(MetricsHeader) + capacity * sizeof(MetricSlot);
+}
+
+std::string fixedString(const char* text, std::size_t bytes) {
+    return std::string(text, strnlen(text, bytes));
+}
+
+/// Program name without directories, as a fallback service name
+std::string programName() {
+    char buffer[256] = {};
+    const ssize_t length = ::readlink("/proc/self/exe", buffer, sizeof(buffer) - 1U);
+    if (length <= 0) {
+        return "hexagon";
+    }
+    const std::string path(buffer, static_cast<std::size_t>(length));
+    return path.substr(path.find_last_of('/') + 1U);
+}
+
+} // namespace
+
+static_assert(sizeof(MetricsHeader) % alignof(MetricSlot) == 0U, "slots follow the header aligned");
+static_assert(std::atomic<std::uint64_t>::is_always_lock_free, "segment atomics must be address-free");
+
+std::uint64_t histogramBucketLow(std::size_t bucket) noexcept {
+    if (bucket < 8U) {
+        return bucket;
+    }
+    const unsigned msb = static_cast<unsigned>(bucket / 8U) + 2U;
+    return (8U + (bucket % 8U)) << (msb - 3U);
+}
+
+double histogramPercentile(const std::vector<std::uint64_t>& buckets, double quantile) {
+    std::uint64_t total = 0U;
+    for (const std::uint64_t count : buckets) {
+        total += count;
+    }
+    if (total == 0U) {
+        return 0.0;
+    }
+    const double target = std::min(std::max(quantile, 0.0), 1.0) * static_cast<double>(total);
+    double cumulative = 0.0;
+    for (std::size_t bucket = 0U; bucket < buckets.size(); ++bucket) {
+        const double count = static_cast<double>(buckets[bucket]);
+        if (count > 0.0 && cumulative + count >= target) {
+            const double low = static_cast<double>(histogramBucketLow(bucket));
+            const double high = static_cast<double>(histogramBucketLow(bucket + 1U));
+            return low + (high - low) * ((target - cumulative) / count);
+        }
+        cumulative += count;
+    }
+    return static_cast<double>(histogramBucketLow(buckets.size() - 1U));
+}
+
+double Histogram::mean() const noexcept {
+    const std::uint64_t count = this->count();
+    return count == 0U ? 0.0
+                       : static_cast<double>(slot_->sum.load(std::memory_order_relaxed)) / static_cast<double>(count);
+}
+
+// ---------------------------------------------------------------------------
+// MetricsSegment
+// ---------------------------------------------------------------------------
+
+MetricsSegment::MetricsSegment(const std::string& service, std::size_t capacity, Backing backing)
+    : bytes_(segmentBytes(capacity)) {
+    if (capacity == 0U) {
+        throw std::invalid_argument("MetricsSegment: capacity must be positive");
+    }
+    const std::uint32_t pid = static_cast<std::uint32_t>(::getpid());
+    void* base = MAP_FAILED;
+    if (backing == Backing::Shared) {
+        path_ = pathFor(service, pid);
+        const int fd = ::open(path_.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+        if (fd < 0) {
+            throw std::runtime_error("MetricsSegment: cannot create " + path_ + ": " + std::strerror(errno));
+        }
+        if (::ftruncate(fd, static_cast<off_t>(bytes_)) == 0) {
+            base = ::mmap(nullptr, bytes_, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        }
+        const int error = errno;
+        ::close(fd);
+        if (base == MAP_FAILED) {
+            ::unlink(path_.c_str());
+            throw std::runtime_error("MetricsSegment: cannot map " + path_ + ": " + std::strerror(error));
+        }
+    } else {
+        base = ::mmap(nullptr, bytes_, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (base == MAP_FAILED) {
+            throw std::runtime_error(std::string("MetricsSegment: cannot map private segment: ") + std::strerror(errno));
+        }
+    }
+
+    // Fresh pages are zero: construct the atomics in place, then fill the header
+    header_ = new (base) MetricsHeader();
+    slots_ = reinterpret_cast<MetricSlot*>(static_cast<char*>(base) + sizeof(MetricsHeader));
+    for (std::size_t index = 0U; index < capacity; ++index) {
+        new (&slots_[index]) MetricSlot();
+    }
+    std::memcpy(header_->magic, SEGMENT_MAGIC, sizeof(header_->magic));
+    header_->version = SEGMENT_VERSION;
+    header_->slotBytes = static_cast<std::uint32_t>(sizeof(MetricSlot));
+    header_->capacity = static_cast<std::uint32_t>(capacity);
+    header_->createdNs = common::timing::TscClock::nowNanos();
+    header_->pid = pid;
+    header_->buckets = static_cast<std::uint32_t>(HISTOGRAM_BUCKETS);
+    std::strncpy(header_->service, service.c_str(), sizeof(header_->service) - 1U);
+    header_->count.store(0U, std::memory_order_release);
+}
+
+MetricsSegment::~MetricsSegment() {
+    ::munmap(header_, bytes_);
+    if (!path_.empty()) {
+        ::unlink(path_.c_str());
+    }
+}
+
+MetricSlot* MetricsSegment::slotFor(const std::string& name, MetricKind kind) {
+    if (name.empty() || name.size() >= METRIC_NAME_BYTES) {
+        throw std::invalid_argument("MetricsSegment: metric name must be 1.." +
+                                    std::to_string(METRIC_NAME_BYTES - 1U) + " characters: " + name);
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    const std::uint32_t count = header_->count.load(std::memory_order_relaxed);
+    for (std::uint32_t index = 0U; index < count; ++index) {
+        MetricSlot& slot = slots_[index];
+        if (name == slot.name) {
+            if (slot.kind != kind) {
+                throw std::invalid_argument("MetricsSegment: " + name + " already registered as another kind");
+            }
+            return &slot;
+        }
+    }
+    if (count == header_->capacity) {
+        throw std::runtime_error("MetricsSegment: segment full, cannot register " + name);
+    }
+    MetricSlot& slot = slots_[count];
+    std::memcpy(slot.name, name.c_str(), name.size() + 1U);
+    slot.kind = kind;
+    header_->count.store(count + 1U, std::memory_order_release);
+    return &slot;
+}
+
+std::string MetricsSegment::pathFor(const std::string& service, std::uint32_t pid) {
+    return std::string("/dev/shm/") + SEGMENT_PREFIX + service + "." + std::to_string(pid);
+}
+
+MetricsSegment& MetricsSegment::process() {
+    static std::unique_ptr<MetricsSegment> segment = []() {
+        const char* env = std::getenv("HEXAGON_METRICS_NAME");
+        const std::string service = (env != nullptr && env[0] != '\0') ? std::string(env) : programName();
+        try {
+            std::unique_ptr<MetricsSegment> shared(new MetricsSegment(service));
+            std::cout << "[Metrics] publishing to " << shared->path() << std::endl;
+            return shared;
+        } catch (const std::exception& e) {
+            std::cerr << "[Metrics] " << e.what() << "; metrics stay private" << std::endl;
+            return std::unique_ptr<MetricsSegment>(new MetricsSegment(service, DEFAULT_CAPACITY, Backing::Private));
+        }
+    }();
+    return *segment;
+}
+
+// ---------------------------------------------------------------------------
+// MetricsReader
+// ---------------------------------------------------------------------------
+
+MetricsReader::MetricsReader(const std::string& path) : path_(path) {
+    const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        throw std::runtime_error("MetricsReader: cannot open " + path + ": " + std::strerror(errno));
+    }
+    struct stat info{};
+    void* base = MAP_FAILED;
+    if (::fstat(fd, &info) == 0 && static_cast<std::size_t>(info.st_size) >= sizeof(MetricsHeader)) {
+        bytes_ = static_cast<std::size_t>(info.st_size);
+        base = ::mmap(nullptr, bytes_, PROT_READ, MAP_SHARED, fd, 0);
+    }
+    ::close(fd);
+    if (base == MAP_FAILED) {
+        throw std::runtime_error("MetricsReader: cannot map " + path);
+    }
+    header_ = static_cast<const MetricsHeader*>(base);
+    const bool known = std::memcmp(header_->magic, SEGMENT_MAGIC, sizeof(SEGMENT_MAGIC)) == 0 &&
+                       header_->version == SEGMENT_VERSION && header_->slotBytes == sizeof(MetricSlot) &&
+                       header_->buckets == HISTOGRAM_BUCKETS && segmentBytes(header_->capacity) <= bytes_;
+    if (!known) {
+        ::munmap(base, bytes_);
+        throw std::runtime_error("MetricsReader: " + path + " is not a metrics segment of this version");
+    }
+}
+
+MetricsReader::~MetricsReader() {
+    ::munmap(const_cast<MetricsHeader*>(header_), bytes_);
+}
+
+MetricsSnapshot MetricsReader::read() const {
+    MetricsSnapshot snapshot;
+    snapshot.service = fixedString(header_->service, sizeof(header_->service));
+    snapshot.pid = header_->pid;
+    snapshot.createdNs = header_->createdNs;
+    snapshot.takenNs = common::timing::TscClock::nowNanos();
+
+    const auto* slots = reinterpret_cast<const MetricSlot*>(reinterpret_cast<const char*>(header_) + sizeof(MetricsHeader));
+    const std::uint32_t count = std::min(header_->count.load(std::memory_order_acquire), header_->capacity);
+    snapshot.metrics.reserve(count);
+    for (std::uint32_t index = 0U; index < count; ++index) {
+        const MetricSlot& slot = slots[index];
+        MetricSample sample;
+        sample.name = fixedString(slot.name, sizeof(slot.name));
+        sample.kind = slot.kind;
+        sample.value = slot.value.load(std::memory_order_relaxed);
+        if (slot.kind == MetricKind::Histogram) {
+            sample.sum = slot.sum.load(std::memory_order_relaxed);
+            sample.max = slot.max.load(std::memory_order_relaxed);
+            sample.buckets.resize(HISTOGRAM_BUCKETS);
+            for (std::size_t bucket = 0U; bucket < HISTOGRAM_BUCKETS; ++bucket) {
+                sample.buckets[bucket] = slot.buckets[bucket].load(std::memory_order_relaxed);
+            }
+        }
+        snapshot.metrics.push_back(std::move(sample));
+    }
+    return snapshot;
+}
+
+bool MetricsReader::alive() const noexcept {
+    struct stat info{};
+    if (::stat(path_.c_str(), &info) != 0) {
+        return false;   // Unlinked by a clean shutdown
+    }
+    return ::kill(static_cast<pid_t>(header_->pid), 0) == 0 || errno == EPERM;
+}
+
+std::vector<std::string> MetricsReader::listSegments(const std::string& service, const std::string& directory) {
+    const std::string prefix = std::string(SEGMENT_PREFIX) + (service.empty() ? std::string() : service + ".");
+    std::vector<std::string> paths;
+    DIR* dir = ::opendir(directory.c_str());
+    if (dir == nullptr) {
+        return paths;
+    }
+    while (const dirent* entry = ::readdir(dir)) {
+        const std::string name = entry->d_name;
+        if (name.compare(0U, prefix.size(), prefix) == 0) {
+            paths.push_back(directory + "/" + name);
+        }
+    }
+    ::closedir(dir);
+    std::sort(paths.begin(), paths.end());
+    return paths;
+}
+
+} // namespace metrics
+} // namespace common
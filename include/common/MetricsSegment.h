@@ -0,0 +1,265 @@
+/**
+ * @file MetricsSegment.h
+ * @brief Counters, gauges and latency histograms published in a /dev/shm segment
+ *
+ * Each process maps one file, /dev/shm/hexagon.<service>.<pid>, laid out as
+ * a MetricsHeader followed by fixed-size MetricSlot records. Metrics are
+ * registered by name at startup (mutex, cold path) and updated through
+ * Counter / Gauge / Histogram handles. An update is a relaxed load and
+ * store on the metric's own cache lines: no syscall, no lock and no
+ * locked instruction. That is only correct with ONE writer thread per
+ * metric, so a metric updated from several threads needs one name per
+ * thread.
+ *
+ * Readers (tools/hexstat) map the file read-only and load the same atomics
+ * relaxed. A histogram's count, sum and buckets are not read as one unit;
+ * percentiles are computed from the buckets alone.
+ *
+ * Histogram buckets: values 0..7 get a bucket each, above that every
+ * power of two is split into 8 buckets (at most 12.5% wide), up to 2^42.
+ *
+ * The segment is versioned by magic + version + slotBytes; a reader
+ * refuses a segment whose layout it does not know. The file is unlinked
+ * when the segment is destroyed; a crashed process leaves it behind and
+ * hexstat skips segments whose pid is gone.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace common {
+namespace metrics {
+
+enum class MetricKind : std::uint32_t {
+    Counter = 1U,
+    Gauge = 2U,
+    Histogram = 3U
+};
+
+constexpr std::size_t METRIC_NAME_BYTES = 48U;
+constexpr std::size_t HISTOGRAM_BUCKETS = 320U;
+
+/// Bucket holding value
+inline std::size_t histogramBucket(std::uint64_t value) noexcept {
+    if (value < 8U) {
+        return value;
+    }
+    const unsigned msb = 63U - static_cast<unsigned>(__builtin_clzll(value));
+    const std::size_t bucket = (msb - 2U) * 8U + ((value >> (msb - 3U)) & 7U);
+    return bucket < HISTOGRAM_BUCKETS ? bucket : HISTOGRAM_BUCKETS - 1U;
+}
+
+/// Smallest value of bucket
+std::uint64_t histogramBucketLow(std::size_t bucket) noexcept;
+
+/// Value at quantile (0..1) of a bucket array, interpolated inside the bucket; 0 if empty
+double histogramPercentile(const std::vector<std::uint64_t>& buckets, double quantile);
+
+/// First bytes of a segment
+struct MetricsHeader {
+    char magic[8];                          ///< "HXMET01"
+    std::uint32_t version;
+    std::uint32_t slotBytes;                ///< sizeof(MetricSlot)
+    std::uint32_t capacity;                 ///< Slots in the file
+    std::atomic<std::uint32_t> count;       ///< Registered slots, published after the slot is filled
+    std::int64_t createdNs;                 ///< TscClock epoch ns
+    std::uint32_t pid;
+    std::uint32_t buckets;                  ///< HISTOGRAM_BUCKETS
+    char service[24];
+};
+static_assert(sizeof(MetricsHeader) == 64U, "metrics header layout");
+
+/// One metric; value is the counter total, the gauge value or the histogram count
+struct alignas(64) MetricSlot {
+    char name[METRIC_NAME_BYTES];
+    MetricKind kind;
+    std::uint32_t reserved;
+    std::atomic<std::uint64_t> value;
+    std::atomic<std::uint64_t> sum;         ///< Histogram only
+    std::atomic<std::uint64_t> max;         ///< Histogram only
+    std::atomic<std::uint64_t> buckets[HISTOGRAM_BUCKETS];
+};
+
+/// Monotonic count; one writer thread
+class Counter final {
+public:
+    Counter() = default;
+
+    void add(std::uint64_t amount = 1U) noexcept {
+        if (slot_ != nullptr) {
+            slot_->value.store(slot_->value.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+        }
+    }
+
+    std::uint64_t value() const noexcept { return slot_ ? slot_->value.load(std::memory_order_relaxed) : 0U; }
+
+private:
+    friend class MetricsSegment;
+    explicit Counter(MetricSlot* slot) noexcept : slot_(slot) {}
+
+    MetricSlot* slot_ = nullptr;
+};
+
+/// Last written value; one writer thread
+class Gauge final {
+public:
+    Gauge() = default;
+
+    void set(std::int64_t value) noexcept {
+        if (slot_ != nullptr) {
+            slot_->value.store(static_cast<std::uint64_t>(value), std::memory_order_relaxed);
+        }
+    }
+
+    std::int64_t value() const noexcept {
+        return slot_ ? static_cast<std::int64_t>(slot_->value.load(std::memory_order_relaxed)) : 0;
+    }
+
+private:
+    friend class MetricsSegment;
+    explicit Gauge(MetricSlot* slot) noexcept : slot_(slot) {}
+
+    MetricSlot* slot_ = nullptr;
+};
+
+/// Value distribution, e.g. latencies in ns; one writer thread
+class Histogram final {
+public:
+    Histogram() = default;
+
+    void record(std::uint64_t value) noexcept {
+        if (slot_ == nullptr) {
+            return;
+        }
+        std::atomic<std::uint64_t>& bucket = slot_->buckets[histogramBucket(value)];
+        bucket.store(bucket.load(std::memory_order_relaxed) + 1U, std::memory_order_relaxed);
+        slot_->sum.store(slot_->sum.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+        if (value > slot_->max.load(std::memory_order_relaxed)) {
+            slot_->max.store(value, std::memory_order_relaxed);
+        }
+        slot_->value.store(slot_->value.load(std::memory_order_relaxed) + 1U, std::memory_order_relaxed);
+    }
+
+    std::uint64_t count() const noexcept { return slot_ ? slot_->value.load(std::memory_order_relaxed) : 0U; }
+
+    /// Mean of all recorded values; 0 before the first
+    double mean() const noexcept;
+
+private:
+    friend class MetricsSegment;
+    explicit Histogram(MetricSlot* slot) noexcept : slot_(slot) {}
+
+    MetricSlot* slot_ = nullptr;
+};
+
+/**
+ * @class MetricsSegment
+ * @brief Writer side: owns the mapping and registers metrics
+ */
+class MetricsSegment final {
+public:
+    enum class Backing {
+        Shared,     ///< /dev/shm file other processes can attach to
+        Private     ///< Anonymous memory; metrics work but nothing can read them
+    };
+
+    static constexpr std::size_t DEFAULT_CAPACITY = 64U;
+
+    /// @throws std::invalid_argument for zero capacity, std::runtime_error if the file cannot be created
+    explicit MetricsSegment(const std::string& service, std::size_t capacity = DEFAULT_CAPACITY,
+                            Backing backing = Backing::Shared);
+
+    /// Unmaps and unlinks the file; handles must not be used afterwards
+    ~MetricsSegment();
+
+    MetricsSegment(const MetricsSegment&) = delete;
+    MetricsSegment& operator=(const MetricsSegment&) = delete;
+
+    /**
+     * Registering a name again returns the same metric.
+     * @throws std::invalid_argument for an empty or too long name or a kind mismatch
+     * @throws std::runtime_error when the segment is full
+     */
+    Counter counter(const std::string& name) { return Counter(slotFor(name, MetricKind::Counter)); }
+    Gauge gauge(const std::string& name) { return Gauge(slotFor(name, MetricKind::Gauge)); }
+    Histogram histogram(const std::string& name) { return Histogram(slotFor(name, MetricKind::Histogram)); }
+
+    /// File path; empty for private segments
+    const std::string& path() const noexcept { return path_; }
+
+    /**
+     * @brief Segment shared by the process
+     *
+     * Named after $HEXAGON_METRICS_NAME, else the program name. Falls back
+     * to private memory when /dev/shm is not writable.
+     */
+    static MetricsSegment& process();
+
+    static std::string pathFor(const std::string& service, std::uint32_t pid);
+
+private:
+    MetricSlot* slotFor(const std::string& name, MetricKind kind);
+
+    std::string path_;
+    std::size_t bytes_ = 0U;
+    MetricsHeader* header_ = nullptr;
+    MetricSlot* slots_ = nullptr;
+    std::mutex mutex_;
+};
+
+/// One metric as read from a segment
+struct MetricSample {
+    std::string name;
+    MetricKind kind = MetricKind::Counter;
+    std::uint64_t value = 0U;
+    std::uint64_t sum = 0U;
+    std::uint64_t max = 0U;
+    std::vector<std::uint64_t> buckets;     ///< Histograms only
+};
+
+struct MetricsSnapshot {
+    std::string service;
+    std::uint32_t pid = 0U;
+    std::int64_t createdNs = 0;
+    std::int64_t takenNs = 0;
+    std::vector<MetricSample> metrics;
+};
+
+/**
+ * @class MetricsReader
+ * @brief Read-only attachment to another process's segment
+ */
+class MetricsReader final {
+public:
+    /// @throws std::runtime_error if the file is missing or not a known segment layout
+    explicit MetricsReader(const std::string& path);
+    ~MetricsReader();
+
+    MetricsReader(const MetricsReader&) = delete;
+    MetricsReader& operator=(const MetricsReader&) = delete;
+
+    MetricsSnapshot read() const;
+
+    /// False once the writing process has exited
+    bool alive() const noexcept;
+
+    const std::string& path() const noexcept { return path_; }
+
+    /// Segment files in /dev/shm (or directory), optionally of one service only
+    static std::vector<std::string> listSegments(const std::string& service = std::string(),
+                                                 const std::string& directory = "/dev/shm");
+
+private:
+    std::string path_;
+    std::size_t bytes_ = 0U;
+    const MetricsHeader* header_ = nullptr;
+};
+
+} // namespace metrics
+} // namespace common
@@ -0,0 +1,28 @@
+/**
+ * @file PooledMessage.h
+ * @brief Wraps a pooled buffer in a zmq::message_t without copying
+ */
+
+#pragma once
+
+#include "common/MessageBufferPool.h"
+
+#include <zmq.hpp>
+
+namespace common {
+namespace pool {
+
+/**
+ * @brief Hands the first size bytes of buffer to a zmq::message_t
+ *
+ * libzmq calls MessageBufferPool::release once the last reference to the
+ * message is gone. buffer keeps ownership if construction throws.
+ */
+inline zmq::message_t toMessage(PooledBuffer& buffer, std::size_t size) {
+    zmq::message_t message(buffer.data(), size, &MessageBufferPool::release, buffer.hint());
+    buffer.detach();
+    return message;
+}
+
+} // namespace pool
+} // namespace common
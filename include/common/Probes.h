@@ -0,0 +1,68 @@
+/**
+ * @file Probes.h
+ * @brief USDT probe points on every hexagon's message path
+ *
+ * Probes of provider "hexagon", one per message and stage; timestamps are
+ * TscClock epoch ns, sequence is the FlightRecorder sequence of the
+ * process (0 where a hexagon does not assign one):
+ *
+ *   received(sequence, ns, bytes)
+ *   decoded(trackId, sequence, ns)
+ *   computed(trackId, sequence, ns)
+ *   sent(trackId, sequence, ns, latencyNs)    latencyNs: receive (or compute) to send
+ *   dropped(trackId, sequence, ns, reason)    reason: PROBE_DROP_*
+ *
+ * A probe that is not attached is a single nop plus the argument moves,
+ * and needs no build switch. For example, the live receive-to-send
+ * distribution of b_hexagon:
+ *
+ *   bpftrace -e 'usdt:./b_hexagon_app:hexagon:sent { @ns = hist(arg3); }'
+ *   bpftrace -e 'usdt:./b_hexagon_app:hexagon:dropped { @[arg3] = count(); }'
+ *
+ * `readelf -n <binary>` lists the compiled probes. The probes need the
+ * header-only <sys/sdt.h> (systemtap-sdt-dev / systemtap-sdt-devel); without
+ * it, or with HEXAGON_NO_USDT defined, the macros compile to nothing.
+ */
+
+#pragma once
+
+#if !defined(HEXAGON_NO_USDT) && defined(__has_include)
+#if __has_include(<sys/sdt.h>)
+#include <sys/sdt.h>
+#define HEXAGON_USDT 1
+#endif
+#endif
+
+#ifndef HEXAGON_USDT
+#define HEXAGON_USDT 0
+#endif
+
+namespace common {
+namespace probes {
+
+/// dropped() reasons
+enum DropReason : int {
+    PROBE_DROP_DECODE = 1,      ///< Payload did not deserialize
+    PROBE_DROP_INVALID = 2,     ///< Input field out of range
+    PROBE_DROP_RANGE = 3,       ///< Computed field out of range
+    PROBE_DROP_SEND = 4         ///< Send failed
+};
+
+} // namespace probes
+} // namespace common
+
+#if HEXAGON_USDT
+#define HEXAGON_PROBE_RECEIVED(sequence, ns, bytes) DTRACE_PROBE3(hexagon, received, sequence, ns, bytes)
+#define HEXAGON_PROBE_DECODED(trackId, sequence, ns) DTRACE_PROBE3(hexagon, decoded, trackId, sequence, ns)
+#define HEXAGON_PROBE_COMPUTED(trackId, sequence, ns) DTRACE_PROBE3(hexagon, computed, trackId, sequence, ns)
+#define HEXAGON_PROBE_SENT(trackId, sequence, ns, latencyNs) \
+    DTRACE_PROBE4(hexagon, sent, trackId, sequence, ns, latencyNs)
+#define HEXAGON_PROBE_DROPPED(trackId, sequence, ns, reason) \
+    DTRACE_PROBE4(hexagon, dropped, trackId, sequence, ns, reason)
+#else
+#define HEXAGON_PROBE_RECEIVED(sequence, ns, bytes) static_cast<void>(0)
+#define HEXAGON_PROBE_DECODED(trackId, sequence, ns) static_cast<void>(0)
+#define HEXAGON_PROBE_COMPUTED(trackId, sequence, ns) static_cast<void>(0)
+#define HEXAGON_PROBE_SENT(trackId, sequence, ns, latencyNs) static_cast<void>(0)
+#define HEXAGON_PROBE_DROPPED(trackId, sequence, ns, reason) static_cast<void>(0)
+#endif
@@ -0,0 +1,64 @@
+/**
+ * @file ScopeTimer.cpp
+ * @brief Scope site ids and lazy per-thread histogram registration
+ */
+
+#include "common/ScopeTimer.h"
+
+#include <atomic>
+#include <exception>
+#include <iostream>
+#include <mutex>
+#include <string>
+
+namespace common {
+namespace timing {
+
+namespace {
+
+std::atomic<std::size_t> g_nextSite{0U};
+std::atomic<std::uint32_t> g_nextThread{0U};
+std::once_flag g_frequencyOnce;
+
+/// Histogram of sites that could not be registered; recording into it does nothing
+metrics::Histogram g_unregistered;
+
+} // namespace
+
+namespace detail {
+
+thread_local ThreadScopes threadScopes;
+
+metrics::Histogram& registerScope(const ScopeSite& site) noexcept {
+    const std::size_t id = site.id();
+    if (id >= MAX_SCOPE_SITES) {
+        return g_unregistered;
+    }
+    thread_local const std::uint32_t threadIndex = g_nextThread.fetch_add(1U, std::memory_order_relaxed);
+    metrics::MetricsSegment& segment = metrics::MetricsSegment::process();
+    try {
+        std::call_once(g_frequencyOnce, [&segment]() {
+            segment.gauge("cycles.per_us").set(static_cast<std::int64_t>(TscClock::calibration().cyclesPerMicro));
+        });
+        threadScopes.histograms[id] =
+            segment.histogram("cycles." + std::string(site.name()) + "." + std::to_string(threadIndex));
+    } catch (const std::exception& e) {
+        std::cerr << "[ScopeTimer] " << site.name() << " not recorded: " << e.what() << std::endl;
+    }
+    threadScopes.registered[id] = true;
+    return threadScopes.histograms[id];
+}
+
+} // namespace detail
+
+ScopeSite::ScopeSite(const char* name) noexcept
+    : name_(name), id_(g_nextSite.fetch_add(1U, std::memory_order_relaxed)) {
+    if (id_ >= MAX_SCOPE_SITES) {
+        id_ = MAX_SCOPE_SITES;
+        std::cerr << "[ScopeTimer] more than " << MAX_SCOPE_SITES << " scopes, " << name << " not recorded"
+                  << std::endl;
+    }
+}
+
+} // namespace timing
+} // namespace common
@@ -0,0 +1,133 @@
+/**
+ * @file ScopeTimer.h
+ * @brief Cycle-accurate RAII timers for hot-path scopes, compiled out by default
+ *
+ *   {
+ *       HEXAGON_SCOPE_TIMER("deserialize");
+ *       data.deserialize(bytes);
+ *   }
+ *
+ * With HEXAGON_SCOPE_TIMERS=1 (CMake option of the same name) each use
+ * reads the TSC fenced on both sides, lfence;rdtsc at entry and
+ * rdtscp;lfence at exit, so the measured window is exactly the scope's
+ * instructions (plus ~25-40 cycles of timer overhead, visible as the
+ * floor of an empty scope). The difference goes into a histogram of the
+ * calling thread: metrics "cycles.<scope>.<thread>" in the process
+ * MetricsSegment, so hexstat shows per-stage cycle percentiles live and
+ * every histogram keeps a single writer. "cycles.per_us" holds the TSC
+ * frequency for converting.
+ *
+ * Without the flag the macro expands to nothing: no code, no data, no
+ * TLS. On non-x86 targets the timers count steady_clock nanoseconds.
+ *
+ * At most MAX_SCOPE_SITES distinct scopes per process; later ones, and
+ * any that do not fit in the metrics segment, are not recorded.
+ */
+
+#pragma once
+
+#include "common/MetricsSegment.h"
+#include "common/TscClock.h"
+
+#include <cstddef>
+#include <cstdint>
+
+#ifndef HEXAGON_SCOPE_TIMERS
+#define HEXAGON_SCOPE_TIMERS 0
+#endif
+
+namespace common {
+namespace timing {
+
+constexpr std::size_t MAX_SCOPE_SITES = 32U;
+
+/// Counter read at scope entry; later instructions do not start before it
+inline std::uint64_t cyclesBegin() noexcept {
+#if HEXAGON_TSC_CLOCK_X86
+    _mm_lfence();
+    const std::uint64_t cycles = __rdtsc();
+    _mm_lfence();
+    return cycles;
+#else
+    return static_cast<std::uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+}
+
+/// Counter read at scope exit; earlier instructions have completed
+inline std::uint64_t cyclesEnd() noexcept {
+#if HEXAGON_TSC_CLOCK_X86
+    unsigned int aux = 0U;
+    const std::uint64_t cycles = __rdtscp(&aux);
+    _mm_lfence();
+    return cycles;
+#else
+    return static_cast<std::uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+}
+
+/// One instrumented scope; a function-local static created by HEXAGON_SCOPE_TIMER
+class ScopeSite final {
+public:
+    /// @param name Literal; "cycles.<name>.<thread>" must fit in METRIC_NAME_BYTES
+    explicit ScopeSite(const char* name) noexcept;
+
+    const char* name() const noexcept { return name_; }
+    std::size_t id() const noexcept { return id_; }    ///< MAX_SCOPE_SITES if none was left
+
+private:
+    const char* name_;
+    std::size_t id_;
+};
+
+namespace detail {
+
+struct ThreadScopes {
+    bool registered[MAX_SCOPE_SITES] = {};
+    metrics::Histogram histograms[MAX_SCOPE_SITES];
+};
+
+extern thread_local ThreadScopes threadScopes;
+
+/// Registers site's histogram for the calling thread
+metrics::Histogram& registerScope(const ScopeSite& site) noexcept;
+
+inline metrics::Histogram& scopeHistogram(const ScopeSite& site) noexcept {
+    const std::size_t id = site.id();
+    if (id < MAX_SCOPE_SITES && threadScopes.registered[id]) {
+        return threadScopes.histograms[id];
+    }
+    return registerScope(site);
+}
+
+} // namespace detail
+
+/// Records the cycles between construction and destruction
+class ScopeTimer final {
+public:
+    explicit ScopeTimer(const ScopeSite& site) noexcept
+        : histogram_(detail::scopeHistogram(site)), started_(cyclesBegin()) {}
+
+    ~ScopeTimer() { histogram_.record(cyclesEnd() - started_); }
+
+    ScopeTimer(const ScopeTimer&) = delete;
+    ScopeTimer& operator=(const ScopeTimer&) = delete;
+
+private:
+    metrics::Histogram& histogram_;
+    const std::uint64_t started_;
+};
+
+} // namespace timing
+} // namespace common
+
+#define HEXAGON_SCOPE_CONCAT_INNER(a, b) a##b
+#define HEXAGON_SCOPE_CONCAT(a, b) HEXAGON_SCOPE_CONCAT_INNER(a, b)
+
+#if HEXAGON_SCOPE_TIMERS
+#define HEXAGON_SCOPE_TIMER(name)                                                                       \
+    static const ::common::timing::ScopeSite HEXAGON_SCOPE_CONCAT(hexagonScopeSite, __LINE__)(name);   \
+    const ::common::timing::ScopeTimer HEXAGON_SCOPE_CONCAT(hexagonScopeTimer, __LINE__)(              \
+        HEXAGON_SCOPE_CONCAT(hexagonScopeSite, __LINE__))
+#else
+#define HEXAGON_SCOPE_TIMER(name) static_cast<void>(0)
+#endif
@@ -0,0 +1,482 @@
+/**
+ * @file SegmentStore.cpp
+ * @brief SegmentStore implementation
+ */
+
+#include "common/SegmentStore.h"
+#include "common/TscClock.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace common {
+namespace store {
+
+namespace {
+
+constexpr char SEGMENT_MAGIC[8] = {'H', 'X', 'S', 'E', 'G', '0', '1', '\0'};
+constexpr std::uint32_t SEGMENT_VERSION = 1U;
+constexpr const char* SEGMENT_SUFFIX = ".hxseg";
+constexpr std::int64_t NO_MIN = std::numeric_limits<std::int64_t>::max();
+constexpr std::int64_t NO_MAX = std::numeric_limits<std::int64_t>::min();
+
+std::size_t alignUp(std::size_t value, std::size_t alignment) noexcept {
+    return (value + alignment - 1U) / alignment * alignment;
+}
+
+std::string segmentPath(const std::string& directory, const std::string& prefix, std::uint64_t index) {
+    char name[32];
+    std::snprintf(name, sizeof(name), ".%06llu", static_cast<unsigned long long>(index));
+    return directory + "/" + prefix + name + SEGMENT_SUFFIX;
+}
+
+/// (index, path) of every "<prefix>.<digits>.hxseg" in directory, in index order
+std::vector<std::pair<std::uint64_t, std::string>> listSegments(const std::string& directory,
+                                                                const std::string& prefix) {
+    std::vector<std::pair<std::uint64_t, std::string>> found;
+    DIR* dir = ::opendir(directory.c_str());
+    if (dir == nullptr) {
+        return found;
+    }
+    const std::string suffix(SEGMENT_SUFFIX);
+    while (const dirent* entry = ::readdir(dir)) {
+        const std::string name(entry->d_name);
+        if (name.size() <= prefix.size() + 1U + suffix.size() || name.compare(0U, prefix.size(), prefix) != 0 ||
+            name[prefix.size()] != '.' || name.compare(name.size() - suffix.size(), suffix.size(), suffix) != 0) {
+            continue;
+        }
+        const std::string digits = name.substr(prefix.size() + 1U, name.size() - prefix.size() - 1U - suffix.size());
+        if (digits.find_first_not_of("0123456789") != std::string::npos) {
+            continue;
+        }
+        found.emplace_back(std::strtoull(digits.c_str(), nullptr, 10), directory + "/" + name);
+    }
+    ::closedir(dir);
+    std::sort(found.begin(), found.end());
+    return found;
+}
+
+std::uint32_t checksum(std::int64_t time, const std::uint8_t* record, std::size_t size) noexcept {
+    std::uint32_t hash = 2166136261U;
+    const auto mix = [&hash](const std::uint8_t* bytes, std::size_t count) {
+        for (std::size_t i = 0U; i < count; ++i) {
+            hash = (hash ^ bytes[i]) * 16777619U;
+        }
+    };
+    mix(reinterpret_cast<const std::uint8_t*>(&time), sizeof(time));
+    mix(record, size);
+    return hash;
+}
+
+} // namespace
+
+/// One mapped segment file
+struct SegmentStore::Segment {
+    std::string path;
+    std::uint64_t index = 0U;
+    int fd = -1;
+    std::uint8_t* base = nullptr;
+    std::size_t bytes = 0U;
+    SegmentFileHeader* header = nullptr;
+    IndexEntry* entries = nullptr;
+    std::uint8_t* slots = nullptr;
+
+    std::atomic<std::uint64_t> committed{0U};   ///< Slots readers may see
+    std::atomic<std::int64_t> minTime{NO_MIN};
+    std::atomic<std::int64_t> maxTime{NO_MAX};
+    std::atomic<bool> sealed{false};
+    std::uint64_t synced = 0U;                  ///< Sync thread: slots known to be on disk
+    bool finalSynced = false;
+
+    ~Segment() {
+        if (base != nullptr) {
+            ::munmap(base, bytes);
+        }
+        if (fd >= 0) {
+            ::close(fd);
+        }
+    }
+};
+
+SegmentStore::SegmentStore(const SegmentOptions& options) : options_(options) {
+    if (options_.recordBytes == 0U || options_.recordsPerSegment == 0U || options_.indexStride == 0U ||
+        options_.recordsPerSegment >= std::numeric_limits<std::uint32_t>::max()) {
+        throw std::invalid_argument("SegmentStore: record size, segment capacity and index stride must be positive");
+    }
+    const std::size_t page = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+    slotBytes_ = alignUp(sizeof(SlotHeader) + options_.recordBytes, 8U);
+    indexEntries_ = (options_.recordsPerSegment + options_.indexStride - 1U) / options_.indexStride;
+    indexOffset_ = sizeof(SegmentFileHeader);
+    slotOffset_ = alignUp(indexOffset_ + indexEntries_ * sizeof(IndexEntry), 64U);
+    fileBytes_ = alignUp(slotOffset_ + options_.recordsPerSegment * slotBytes_, page);
+
+    // Recovery: one header read and a short tail scan per segment
+    for (const auto& found : listSegments(options_.directory, options_.prefix)) {
+        nextIndex_ = std::max(nextIndex_, found.first + 1U);
+        std::shared_ptr<Segment> segment = recoverSegment(found.second, found.first);
+        if (segment) {
+            recovered_ += segment->committed.load(std::memory_order_relaxed);
+            segments_.push_back(std::move(segment));
+        }
+    }
+    if (!segments_.empty() && segments_.back()->committed.load(std::memory_order_relaxed) < options_.recordsPerSegment) {
+        active_ = segments_.back().get();
+        activeMax_ = active_->maxTime.load(std::memory_order_relaxed);
+        for (std::size_t i = 0U; i + 1U < segments_.size(); ++i) {
+            segments_[i]->sealed.store(true, std::memory_order_relaxed);
+        }
+    } else {
+        for (const std::shared_ptr<Segment>& segment : segments_) {
+            segment->sealed.store(true, std::memory_order_relaxed);
+        }
+        if (!rotate()) {
+            throw std::runtime_error("SegmentStore: cannot create a segment in " + options_.directory);
+        }
+        inlineRotations_.store(0U, std::memory_order_relaxed);
+    }
+    for (const std::shared_ptr<Segment>& segment : segments_) {
+        segment->synced = segment->committed.load(std::memory_order_relaxed);
+    }
+    syncThread_ = std::thread(&SegmentStore::syncLoop, this);
+}
+
+SegmentStore::~SegmentStore() {
+    {
+        std::lock_guard<std::mutex> lock(syncMutex_);
+        stopping_ = true;
+    }
+    syncWake_.notify_one();
+    if (syncThread_.joinable()) {
+        syncThread_.join();
+    }
+    syncActive();
+    std::lock_guard<std::mutex> lock(spareMutex_);
+    if (spare_) {
+        // Never written: leave no empty segment behind
+        ::unlink(spare_->path.c_str());
+        spare_.reset();
+    }
+}
+
+std::shared_ptr<SegmentStore::Segment> SegmentStore::createSegment(std::uint64_t index) noexcept {
+    auto segment = std::make_shared<Segment>();
+    segment->path = segmentPath(options_.directory, options_.prefix, index);
+    segment->index = index;
+    segment->fd = ::open(segment->path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (segment->fd < 0) {
+        return nullptr;
+    }
+    if (::ftruncate(segment->fd, static_cast<off_t>(fileBytes_)) != 0) {
+        ::unlink(segment->path.c_str());
+        return nullptr;
+    }
+    void* mapped = ::mmap(nullptr, fileBytes_, PROT_READ | PROT_WRITE, MAP_SHARED, segment->fd, 0);
+    if (mapped == MAP_FAILED) {
+        ::unlink(segment->path.c_str());
+        return nullptr;
+    }
+    segment->base = static_cast<std::uint8_t*>(mapped);
+    segment->bytes = fileBytes_;
+    segment->header = reinterpret_cast<SegmentFileHeader*>(segment->base);
+    segment->entries = reinterpret_cast<IndexEntry*>(segment->base + indexOffset_);
+    segment->slots = segment->base + slotOffset_;
+
+    SegmentFileHeader header{};
+    std::memcpy(header.magic, SEGMENT_MAGIC, sizeof(header.magic));
+    header.version = SEGMENT_VERSION;
+    header.headerBytes = static_cast<std::uint32_t>(sizeof(SegmentFileHeader));
+    header.recordBytes = static_cast<std::uint32_t>(options_.recordBytes);
+    header.slotBytes = static_cast<std::uint32_t>(slotBytes_);
+    header.capacity = options_.recordsPerSegment;
+    header.indexStride = static_cast<std::uint32_t>(options_.indexStride);
+    header.indexEntries = static_cast<std::uint32_t>(indexEntries_);
+    header.indexOffset = indexOffset_;
+    header.slotOffset = slotOffset_;
+    header.segmentIndex = index;
+    header.createdNs = timing::TscClock::nowNanos();
+    header.minTime = NO_MIN;
+    header.maxTime = NO_MAX;
+    std::memcpy(segment->base, &header, sizeof(header));
+    return segment;
+}
+
+std::shared_ptr<SegmentStore::Segment> SegmentStore::recoverSegment(const std::string& path,
+                                                                    std::uint64_t index) noexcept {
+    auto segment = std::make_shared<Segment>();
+    segment->path = path;
+    segment->index = index;
+    segment->fd = ::open(path.c_str(), O_RDWR | O_CLOEXEC);
+    struct stat info{};
+    if (segment->fd < 0 || ::fstat(segment->fd, &info) != 0 || static_cast<std::size_t>(info.st_size) != fileBytes_) {
+        std::cerr << "[SegmentStore] skipping " << path << ": unreadable or written with another layout" << std::endl;
+        return nullptr;
+    }
+    void* mapped = ::mmap(nullptr, fileBytes_, PROT_READ | PROT_WRITE, MAP_SHARED, segment->fd, 0);
+    if (mapped == MAP_FAILED) {
+        std::cerr << "[SegmentStore] skipping " << path << ": mmap failed" << std::endl;
+        return nullptr;
+    }
+    segment->base = static_cast<std::uint8_t*>(mapped);
+    segment->bytes = fileBytes_;
+    segment->header = reinterpret_cast<SegmentFileHeader*>(segment->base);
+    segment->entries = reinterpret_cast<IndexEntry*>(segment->base + indexOffset_);
+    segment->slots = segment->base + slotOffset_;
+
+    SegmentFileHeader& header = *segment->header;
+    if (std::memcmp(header.magic, SEGMENT_MAGIC, sizeof(header.magic)) != 0 || header.version != SEGMENT_VERSION ||
+        header.recordBytes != options_.recordBytes || header.capacity != options_.recordsPerSegment ||
+        header.indexStride != options_.indexStride || header.slotOffset != slotOffset_) {
+        std::cerr << "[SegmentStore] skipping " << path << ": written with another layout" << std::endl;
+        return nullptr;
+    }
+
+    const auto written = [this, &segment](std::uint64_t slot) {
+        const std::uint8_t* raw = segment->slots + slot * slotBytes_;
+        SlotHeader slotHeader{};
+        std::memcpy(&slotHeader, raw, sizeof(slotHeader));
+        return slotHeader.tag == slot + 1U &&
+               slotHeader.checksum == checksum(slotHeader.time, raw + sizeof(SlotHeader), options_.recordBytes);
+    };
+    std::uint64_t committed = std::min<std::uint64_t>(header.committed, options_.recordsPerSegment);
+    // Back over slots the header counted but the disk never got, forward over slots newer than the header
+    while (committed > 0U && !written(committed - 1U)) {
+        --committed;
+    }
+    std::int64_t minTime = header.minTime;
+    std::int64_t maxTime = header.maxTime;
+    while (committed < options_.recordsPerSegment && written(committed)) {
+        std::int64_t time = 0;
+        std::memcpy(&time, segment->slots + committed * slotBytes_ + offsetof(SlotHeader, time), sizeof(time));
+        minTime = std::min(minTime, time);
+        maxTime = std::max(maxTime, time);
+        ++committed;
+    }
+    header.committed = committed;
+    header.minTime = minTime;
+    header.maxTime = maxTime;
+    segment->committed.store(committed, std::memory_order_relaxed);
+    segment->minTime.store(minTime, std::memory_order_relaxed);
+    segment->maxTime.store(maxTime, std::memory_order_relaxed);
+    return segment;
+}
+
+bool SegmentStore::rotate() noexcept {
+    if (active_ != nullptr) {
+        active_->sealed.store(true, std::memory_order_release);
+    }
+    std::shared_ptr<Segment> next;
+    {
+        // The sync thread holds this lock while it builds the spare, which is what we would do here anyway
+        std::lock_guard<std::mutex> lock(spareMutex_);
+        next = std::move(spare_);
+        if (!next) {
+            next = createSegment(nextIndex_);
+            if (!next) {
+                return false;
+            }
+            ++nextIndex_;
+            inlineRotations_.fetch_add(1U, std::memory_order_relaxed);
+        }
+    }
+    {
+        std::lock_guard<std::mutex> lock(segmentsMutex_);
+        segments_.push_back(next);
+    }
+    active_ = next.get();
+    activeMax_ = NO_MAX;
+    syncWake_.notify_one();
+    return true;
+}
+
+bool SegmentStore::append(std::int64_t time, const void* record) noexcept {
+    if (active_ == nullptr || active_->committed.load(std::memory_order_relaxed) >= options_.recordsPerSegment) {
+        if (!rotate()) {
+            dropped_.fetch_add(1U, std::memory_order_relaxed);
+            return false;
+        }
+    }
+    Segment& segment = *active_;
+    const std::uint64_t slot = segment.committed.load(std::memory_order_relaxed);
+    std::uint8_t* raw = segment.slots + slot * slotBytes_;
+    SlotHeader* slotHeader = reinterpret_cast<SlotHeader*>(raw);
+    std::memcpy(raw + sizeof(SlotHeader), record, options_.recordBytes);
+    slotHeader->time = time;
+    slotHeader->checksum = checksum(time, raw + sizeof(SlotHeader), options_.recordBytes);
+    __atomic_store_n(&slotHeader->tag, static_cast<std::uint32_t>(slot + 1U), __ATOMIC_RELEASE);
+
+    activeMax_ = std::max(activeMax_, time);
+    if (slot % options_.indexStride == 0U) {
+        IndexEntry& entry = segment.entries[slot / options_.indexStride];
+        entry.maxTime = activeMax_;
+        __atomic_store_n(&entry.tag, slot / options_.indexStride + 1U, __ATOMIC_RELEASE);
+    }
+    if (time < segment.minTime.load(std::memory_order_relaxed)) {
+        segment.minTime.store(time, std::memory_order_relaxed);
+        __atomic_store_n(&segment.header->minTime, time, __ATOMIC_RELAXED);
+    }
+    if (time > segment.maxTime.load(std::memory_order_relaxed)) {
+        segment.maxTime.store(time, std::memory_order_relaxed);
+        __atomic_store_n(&segment.header->maxTime, time, __ATOMIC_RELAXED);
+    }
+    segment.committed.store(slot + 1U, std::memory_order_release);
+    __atomic_store_n(&segment.header->committed, slot + 1U, __ATOMIC_RELAXED);
+    appended_.fetch_add(1U, std::memory_order_relaxed);
+    return true;
+}
+
+std::vector<std::shared_ptr<SegmentStore::Segment>> SegmentStore::snapshot() const {
+    std::lock_guard<std::mutex> lock(segmentsMutex_);
+    return segments_;
+}
+
+std::size_t SegmentStore::readRange(std::int64_t start, std::int64_t end, const RecordVisitor& visit) const {
+    std::size_t visited = 0U;
+    if (start > end) {
+        return visited;
+    }
+    for (const std::shared_ptr<Segment>& segment : snapshot()) {
+        const std::uint64_t count = segment->committed.load(std::memory_order_acquire);
+        if (count == 0U || segment->minTime.load(std::memory_order_relaxed) > end ||
+            segment->maxTime.load(std::memory_order_relaxed) < start) {
+            continue;
+        }
+        // Skip every leading block whose running maximum is still below start
+        std::uint64_t first = 0U;
+        for (std::size_t k = 0U; k < indexEntries_ && k * options_.indexStride < count; ++k) {
+            const IndexEntry& entry = segment->entries[k];
+            if (__atomic_load_n(&entry.tag, __ATOMIC_ACQUIRE) != k + 1U || entry.maxTime >= start) {
+                break;
+            }
+            first = k * options_.indexStride + 1U;
+        }
+        for (std::uint64_t slot = first; slot < count; ++slot) {
+            const std::uint8_t* raw = segment->slots + slot * slotBytes_;
+            const std::int64_t time = reinterpret_cast<const SlotHeader*>(raw)->time;
+            if (time >= start && time <= end) {
+                visit(time, raw + sizeof(SlotHeader));
+                ++visited;
+            }
+        }
+    }
+    return visited;
+}
+
+std::size_t SegmentStore::readLatest(std::size_t count, const RecordVisitor& visit) const {
+    const std::vector<std::shared_ptr<Segment>> segments = snapshot();
+    // Walk back to the segment holding the count-th newest record, then read forward
+    std::size_t firstSegment = segments.size();
+    std::uint64_t firstSlot = 0U;
+    std::size_t remaining = count;
+    std::vector<std::uint64_t> counts(segments.size());
+    while (firstSegment > 0U && remaining > 0U) {
+        --firstSegment;
+        counts[firstSegment] = segments[firstSegment]->committed.load(std::memory_order_acquire);
+        const std::uint64_t available = counts[firstSegment];
+        firstSlot = available > remaining ? available - remaining : 0U;
+        remaining -= static_cast<std::size_t>(available - firstSlot);
+    }
+    std::size_t visited = 0U;
+    for (std::size_t i = firstSegment; i < segments.size(); ++i) {
+        const std::uint64_t from = i == firstSegment ? firstSlot : 0U;
+        for (std::uint64_t slot = from; slot < counts[i]; ++slot) {
+            const std::uint8_t* raw = segments[i]->slots + slot * slotBytes_;
+            visit(reinterpret_cast<const SlotHeader*>(raw)->time, raw + sizeof(SlotHeader));
+            ++visited;
+        }
+    }
+    return visited;
+}
+
+void SegmentStore::syncActive() {
+    const std::size_t page = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+    for (const std::shared_ptr<Segment>& segment : snapshot()) {
+        const bool sealed = segment->sealed.load(std::memory_order_acquire);
+        const std::uint64_t committed = segment->committed.load(std::memory_order_acquire);
+        if (segment->finalSynced || (committed == segment->synced && !sealed)) {
+            continue;
+        }
+        // Header and index first page-aligned span, then the newly written slots
+        const std::size_t fromSlot = slotOffset_ + static_cast<std::size_t>(segment->synced) * slotBytes_;
+        const std::size_t toSlot = slotOffset_ + static_cast<std::size_t>(committed) * slotBytes_;
+        const std::size_t begin = fromSlot / page * page;
+        const std::size_t end = std::min(alignUp(toSlot, page), segment->bytes);
+        if (end > begin) {
+            ::msync(segment->base + begin, end - begin, MS_SYNC);
+        }
+        ::msync(segment->base, alignUp(slotOffset_, page), MS_SYNC);
+        segment->synced = committed;
+        segment->finalSynced = sealed;
+        syncs_.fetch_add(1U, std::memory_order_relaxed);
+    }
+}
+
+void SegmentStore::sync() {
+    std::lock_guard<std::mutex> lock(syncMutex_);
+    syncActive();
+}
+
+void SegmentStore::syncLoop() {
+    std::unique_lock<std::mutex> lock(syncMutex_);
+    while (!stopping_) {
+        syncWake_.wait_for(lock, std::chrono::milliseconds(std::max(options_.syncIntervalMs, 1)));
+        if (stopping_) {
+            break;
+        }
+        syncActive();
+
+        {
+            std::lock_guard<std::mutex> spareLock(spareMutex_);
+            if (!spare_) {
+                spare_ = createSegment(nextIndex_);
+                if (spare_) {
+                    ++nextIndex_;
+                }
+            }
+        }
+
+        if (options_.maxSegments > 0U) {
+            std::vector<std::shared_ptr<Segment>> expired;
+            {
+                std::lock_guard<std::mutex> segmentsLock(segmentsMutex_);
+                while (segments_.size() > options_.maxSegments) {
+                    expired.push_back(segments_.front());
+                    segments_.erase(segments_.begin());
+                }
+            }
+            // Readers that still hold a segment keep its mapping until they are done
+            for (const std::shared_ptr<Segment>& segment : expired) {
+                ::unlink(segment->path.c_str());
+            }
+        }
+    }
+}
+
+SegmentStats SegmentStore::stats() const {
+    SegmentStats result;
+    for (const std::shared_ptr<Segment>& segment : snapshot()) {
+        ++result.segments;
+        result.records += segment->committed.load(std::memory_order_relaxed);
+    }
+    result.recovered = recovered_;
+    result.appended = appended_.load(std::memory_order_relaxed);
+    result.dropped = dropped_.load(std::memory_order_relaxed);
+    result.syncs = syncs_.load(std::memory_order_relaxed);
+    result.inlineRotations = inlineRotations_.load(std::memory_order_relaxed);
+    return result;
+}
+
+} // namespace store
+} // namespace common
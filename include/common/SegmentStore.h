@@ -0,0 +1,185 @@
+/**
+ * @file SegmentStore.h
+ * @brief Crash-consistent append-only store of fixed-size timestamped records
+ *
+ * Records go into preallocated, memory-mapped segment files
+ * "<prefix>.<index>.hxseg". An append is a memcpy into the mapping plus a
+ * few stores; the writer never calls into the kernel except when it has
+ * to create a segment itself. A background thread msyncs the written
+ * range of the active segment every syncIntervalMs, seals full segments,
+ * prepares the next segment ahead of time and deletes segments beyond
+ * maxSegments. Layout, host byte order:
+ *
+ *   SegmentFileHeader (128 bytes)
+ *   IndexEntry[capacity / indexStride]   sparse time index
+ *   slot[capacity]                       SlotHeader (16 bytes) | record | pad to 8
+ *
+ * A slot counts as written only if its tag equals its position + 1 and
+ * its checksum matches, and the tag is stored last. Recovery opens each
+ * segment, starts from the committed count in its header and moves that
+ * boundary back over slots that never reached the disk, then forward
+ * over slots written after the header was last flushed; the cost is
+ * O(segments) plus the unsynced tail, never a full scan.
+ *
+ * Index entry k holds the largest time among slots 0 .. k * indexStride,
+ * so a range query starts scanning past every block whose running
+ * maximum is below the range start, and skips segments whose min/max
+ * time in the header misses the range entirely.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace common {
+namespace store {
+
+/// First bytes of every segment file
+struct SegmentFileHeader {
+    char magic[8];                  ///< "HXSEG01"
+    std::uint32_t version;
+    std::uint32_t headerBytes;      ///< sizeof(SegmentFileHeader)
+    std::uint32_t recordBytes;
+    std::uint32_t slotBytes;
+    std::uint64_t capacity;         ///< Slots in this segment
+    std::uint32_t indexStride;
+    std::uint32_t indexEntries;
+    std::uint64_t indexOffset;
+    std::uint64_t slotOffset;
+    std::uint64_t segmentIndex;
+    std::int64_t createdNs;
+    // Updated by the writer after every append
+    std::uint64_t committed;        ///< Slots written, as last seen by the disk
+    std::int64_t minTime;
+    std::int64_t maxTime;
+    std::uint8_t reserved[32];
+};
+static_assert(sizeof(SegmentFileHeader) == 128U, "segment header layout");
+
+/// One entry of the sparse time index
+struct IndexEntry {
+    std::int64_t maxTime;           ///< Largest time among slots 0 .. k * indexStride
+    std::uint64_t tag;              ///< k + 1 once written
+};
+
+/// In front of every record
+struct SlotHeader {
+    std::uint32_t tag;              ///< Slot position + 1; stored last
+    std::uint32_t checksum;         ///< FNV-1a over time and record bytes
+    std::int64_t time;
+};
+static_assert(sizeof(SlotHeader) == 16U, "segment slot header layout");
+
+/// Where and how to store
+struct SegmentOptions {
+    std::string directory;
+    std::string prefix;
+    std::size_t recordBytes = 0U;
+    std::size_t recordsPerSegment = 65536U;
+    std::size_t indexStride = 256U;
+    int syncIntervalMs = 1000;
+    std::size_t maxSegments = 0U;   ///< Oldest segments are deleted beyond this; 0 keeps all
+};
+
+/// Counters since the store was opened
+struct SegmentStats {
+    std::size_t segments = 0U;
+    std::uint64_t records = 0U;     ///< Readable records in all segments
+    std::uint64_t recovered = 0U;   ///< Records found on disk at open
+    std::uint64_t appended = 0U;
+    std::uint64_t dropped = 0U;     ///< Appends lost because no segment could be created
+    std::uint64_t syncs = 0U;
+    std::uint64_t inlineRotations = 0U;  ///< Segments the writer had to create itself
+};
+
+/**
+ * @class SegmentStore
+ * @brief Appends on one writer thread; reads from any thread
+ */
+class SegmentStore final {
+public:
+    /// Receives one record of a query; record points at options.recordBytes bytes
+    using RecordVisitor = std::function<void(std::int64_t time, const std::uint8_t* record)>;
+
+    /**
+     * @brief Opens the directory, recovers existing segments and starts the sync thread
+     * @throws std::invalid_argument for a zero record size or segment capacity
+     * @throws std::runtime_error if no segment can be created
+     */
+    explicit SegmentStore(const SegmentOptions& options);
+
+    /// Stops the sync thread and flushes everything written
+    ~SegmentStore();
+
+    SegmentStore(const SegmentStore&) = delete;
+    SegmentStore& operator=(const SegmentStore&) = delete;
+
+    /**
+     * @brief Appends one record of options.recordBytes bytes
+     * @return false if the record was dropped because no segment could be created
+     */
+    bool append(std::int64_t time, const void* record) noexcept;
+
+    /// Visits every record with start <= time <= end, oldest segment first; returns records visited
+    std::size_t readRange(std::int64_t start, std::int64_t end, const RecordVisitor& visit) const;
+
+    /// Visits the newest count records (fewer if the store holds fewer), oldest first
+    std::size_t readLatest(std::size_t count, const RecordVisitor& visit) const;
+
+    /// Flushes every written byte to disk now; blocks the caller, not the writer
+    void sync();
+
+    SegmentStats stats() const;
+
+    const SegmentOptions& options() const noexcept { return options_; }
+
+private:
+    struct Segment;
+
+    std::shared_ptr<Segment> createSegment(std::uint64_t index) noexcept;
+    std::shared_ptr<Segment> recoverSegment(const std::string& path, std::uint64_t index) noexcept;
+    bool rotate() noexcept;
+    void syncLoop();
+    void syncActive();
+    std::vector<std::shared_ptr<Segment>> snapshot() const;
+
+    SegmentOptions options_;
+    std::size_t slotBytes_ = 0U;
+    std::size_t indexEntries_ = 0U;
+    std::size_t indexOffset_ = 0U;
+    std::size_t slotOffset_ = 0U;
+    std::size_t fileBytes_ = 0U;
+
+    mutable std::mutex segmentsMutex_;
+    std::vector<std::shared_ptr<Segment>> segments_;   ///< Oldest first; back() is active
+    std::uint64_t nextIndex_ = 0U;
+
+    Segment* active_ = nullptr;                        ///< Writer-owned
+    std::int64_t activeMax_ = 0;
+
+    std::mutex spareMutex_;
+    std::shared_ptr<Segment> spare_;
+
+    std::mutex syncMutex_;
+    std::condition_variable syncWake_;
+    bool stopping_ = false;
+    std::thread syncThread_;
+
+    std::uint64_t recovered_ = 0U;
+    std::atomic<std::uint64_t> appended_{0U};
+    std::atomic<std::uint64_t> dropped_{0U};
+    std::atomic<std::uint64_t> syncs_{0U};
+    std::atomic<std::uint64_t> inlineRotations_{0U};
+};
+
+} // namespace store
+} // namespace common
@@ -0,0 +1,95 @@
+/**
+ * @file SpscRing.h
+ * @brief Bounded lock-free ring between exactly one producer and one consumer thread
+ *
+ * Capacity is rounded up to a power of two. Head and tail live on their
+ * own cache lines and each side keeps a cached copy of the other side's
+ * index, so a push or pop touches the shared line only when the cached
+ * view says the ring looks full or empty.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+namespace common {
+namespace flow {
+
+template <typename T>
+class SpscRing final {
+public:
+    /// @throws std::invalid_argument if capacity is zero
+    explicit SpscRing(std::size_t capacity) {
+        if (capacity == 0U) {
+            throw std::invalid_argument("SpscRing: capacity must be positive");
+        }
+        std::size_t rounded = 1U;
+        while (rounded < capacity) {
+            rounded <<= 1U;
+        }
+        mask_ = rounded - 1U;
+        slots_.reset(new T[rounded]);
+    }
+
+    SpscRing(const SpscRing&) = delete;
+    SpscRing& operator=(const SpscRing&) = delete;
+
+    /// Producer only; false if the ring is full
+    bool tryPush(T&& value) {
+        const std::size_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail - headCache_ > mask_) {
+            headCache_ = head_.load(std::memory_order_acquire);
+            if (tail - headCache_ > mask_) {
+                return false;
+            }
+        }
+        slots_[tail & mask_] = std::move(value);
+        tail_.store(tail + 1U, std::memory_order_release);
+        return true;
+    }
+
+    bool tryPush(const T& value) {
+        T copy(value);
+        return tryPush(std::move(copy));
+    }
+
+    /// Consumer only; false if the ring is empty
+    bool tryPop(T& out) {
+        const std::size_t head = head_.load(std::memory_order_relaxed);
+        if (head == tailCache_) {
+            tailCache_ = tail_.load(std::memory_order_acquire);
+            if (head == tailCache_) {
+                return false;
+            }
+        }
+        out = std::move(slots_[head & mask_]);
+        head_.store(head + 1U, std::memory_order_release);
+        return true;
+    }
+
+    /// Items in the ring; exact on either side's own thread, a snapshot elsewhere
+    std::size_t size() const noexcept {
+        const std::size_t head = head_.load(std::memory_order_acquire);
+        const std::size_t tail = tail_.load(std::memory_order_acquire);
+        return tail - head;
+    }
+
+    std::size_t capacity() const noexcept { return mask_ + 1U; }
+
+private:
+    static constexpr std::size_t CACHE_LINE = 64U;
+
+    alignas(CACHE_LINE) std::atomic<std::size_t> head_{0U};   ///< Next slot to pop
+    std::size_t tailCache_ = 0U;                               ///< Consumer's view of tail_
+    alignas(CACHE_LINE) std::atomic<std::size_t> tail_{0U};   ///< Next slot to push
+    std::size_t headCache_ = 0U;                               ///< Producer's view of head_
+    alignas(CACHE_LINE) std::size_t mask_ = 0U;
+    std::unique_ptr<T[]> slots_;
+};
+
+} // namespace flow
+} // namespace common
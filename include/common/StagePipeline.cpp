@@ -0,0 +1,78 @@
+/**
+ * @file StagePipeline.cpp
+ * @brief StageMetrics and stage report formatting
+ */
+
+#include "common/StagePipeline.h"
+
+#include <cstdio>
+
+namespace common {
+namespace flow {
+
+namespace {
+
+template <typename Value>
+void raise(std::atomic<Value>& maximum, Value value) noexcept {
+    Value current = maximum.load(std::memory_order_relaxed);
+    while (value > current && !maximum.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+    }
+}
+
+} // namespace
+
+StageMetrics::StageMetrics(std::string name, std::size_t capacity)
+    : name_(std::move(name)),
+      capacity_(capacity) {
+}
+
+void StageMetrics::record(std::int64_t serviceNs, std::size_t depth) noexcept {
+    const std::uint64_t service = serviceNs > 0 ? static_cast<std::uint64_t>(serviceNs) : 0U;
+    items_.fetch_add(1U, std::memory_order_relaxed);
+    serviceNs_.fetch_add(service, std::memory_order_relaxed);
+    depthSum_.fetch_add(depth, std::memory_order_relaxed);
+    raise(maxServiceNs_, service);
+    raise(maxDepth_, depth);
+}
+
+StageSnapshot StageMetrics::take() noexcept {
+    StageSnapshot snapshot;
+    snapshot.name = name_;
+    snapshot.capacity = capacity_;
+    snapshot.items = items_.load(std::memory_order_relaxed);
+    snapshot.serviceNs = serviceNs_.load(std::memory_order_relaxed);
+    snapshot.depthSum = depthSum_.load(std::memory_order_relaxed);
+    snapshot.fullWaits = fullWaits_.load(std::memory_order_relaxed);
+    snapshot.maxServiceNs = maxServiceNs_.exchange(0U, std::memory_order_relaxed);
+    snapshot.maxDepth = maxDepth_.exchange(0U, std::memory_order_relaxed);
+    return snapshot;
+}
+
+std::string formatStages(const std::vector<StageSnapshot>& before, const std::vector<StageSnapshot>& now,
+                         double intervalSeconds) {
+    std::string report;
+    for (std::size_t stage = 0U; stage < now.size(); ++stage) {
+        const StageSnapshot& current = now[stage];
+        const StageSnapshot previous = stage < before.size() ? before[stage] : StageSnapshot();
+        const std::uint64_t items = current.items - previous.items;
+        const double perItem = items > 0U ? 1.0 / static_cast<double>(items) : 0.0;
+        char line[256];
+        std::snprintf(line, sizeof(line),
+                      "%s: %.0f/s svc avg %.1f us max %.1f us, depth avg %.1f max %zu/%zu, full waits %llu",
+                      current.name.c_str(),
+                      intervalSeconds > 0.0 ? static_cast<double>(items) / intervalSeconds : 0.0,
+                      static_cast<double>(current.serviceNs - previous.serviceNs) * perItem / 1000.0,
+                      static_cast<double>(current.maxServiceNs) / 1000.0,
+                      static_cast<double>(current.depthSum - previous.depthSum) * perItem,
+                      current.maxDepth, current.capacity,
+                      static_cast<unsigned long long>(current.fullWaits - previous.fullWaits));
+        if (!report.empty()) {
+            report += '\n';
+        }
+        report += line;
+    }
+    return report;
+}
+
+} // namespace flow
+} // namespace common
@@ -0,0 +1,416 @@
+/**
+ * @file ThreadTopology.cpp
+ * @brief ThreadTopology implementation (Linux; other platforms report "unsupported")
+ */
+
+#include "common/ThreadTopology.h"
+#include "common/KeyValueFile.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace common {
+namespace topology {
+
+namespace {
+
+/// MPOL_PREFERRED from <numaif.h>, which needs libnuma headers
+constexpr int MPOL_PREFERRED_MODE = 1;
+
+constexpr const char* DEFAULT_TOPOLOGY_PATH = "config/thread_topology.conf";
+
+using config::trim;
+
+int parseInt(const std::string& text, const std::string& key) {
+    std::size_t used = 0U;
+    int value = 0;
+    try {
+        value = std::stoi(text, &used);
+    } catch (const std::exception&) {
+        used = 0U;
+    }
+    if (used == 0U || used != text.size()) {
+        throw std::invalid_argument("ThreadTopology: invalid " + key + ": '" + text + "'");
+    }
+    return value;
+}
+
+std::vector<int> readCpuListFile(const std::string& path) {
+    std::ifstream file(path);
+    std::string line;
+    if (!file.is_open() || !std::getline(file, line)) {
+        return {};
+    }
+    line = trim(line);
+    if (line.empty()) {
+        return {};
+    }
+    try {
+        return ThreadTopology::parseCpuList(line);
+    } catch (const std::invalid_argument&) {
+        return {};
+    }
+}
+
+std::string joinCpus(const std::vector<int>& cpus) {
+    if (cpus.empty()) {
+        return "-";
+    }
+    std::ostringstream out;
+    for (std::size_t i = 0U; i < cpus.size(); ++i) {
+        out << (i == 0U ? "" : ",") << cpus[i];
+    }
+    return out.str();
+}
+
+void appendError(std::string& error, const std::string& what) {
+    error += (error.empty() ? "" : "; ") + what;
+}
+
+#ifdef __linux__
+int nativePolicy(SchedPolicy policy) noexcept {
+    switch (policy) {
+        case SchedPolicy::Fifo:
+            return SCHED_FIFO;
+        case SchedPolicy::RoundRobin:
+            return SCHED_RR;
+        case SchedPolicy::Other:
+            return SCHED_OTHER;
+        default:
+            return SCHED_OTHER;
+    }
+}
+
+std::vector<int> currentAffinity() {
+    std::vector<int> cpus;
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (pthread_getaffinity_np(pthread_self(), sizeof(set), &set) == 0) {
+        for (std::size_t cpu = 0U; cpu < static_cast<std::size_t>(CPU_SETSIZE); ++cpu) {
+            if (CPU_ISSET(cpu, &set)) {
+                cpus.push_back(static_cast<int>(cpu));
+            }
+        }
+    }
+    return cpus;
+}
+#endif
+
+} // namespace
+
+ThreadTopology::ThreadTopology(const ThreadTopology& other)
+    : roles_(other.roles_),
+      appliedMutex_(),
+      applied_() {
+    const std::lock_guard<std::mutex> lock(other.appliedMutex_);
+    applied_ = other.applied_;
+}
+
+ThreadTopology& ThreadTopology::operator=(const ThreadTopology& other) {
+    if (this != &other) {
+        std::vector<AppliedPlacement> applied;
+        {
+            const std::lock_guard<std::mutex> lock(other.appliedMutex_);
+            applied = other.applied_;
+        }
+        roles_ = other.roles_;
+        const std::lock_guard<std::mutex> lock(appliedMutex_);
+        applied_ = std::move(applied);
+    }
+    return *this;
+}
+
+std::vector<int> ThreadTopology::parseCpuList(const std::string& text) {
+    std::vector<int> cpus;
+    std::istringstream stream(text);
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+        item = trim(item);
+        const std::size_t dash = item.find('-');
+        const int first = parseInt(item.substr(0U, dash), "cpu list");
+        const int last = dash == std::string::npos ? first : parseInt(item.substr(dash + 1U), "cpu list");
+        if (first < 0 || last < first) {
+            throw std::invalid_argument("ThreadTopology: invalid cpu range '" + item + "'");
+        }
+        for (int cpu = first; cpu <= last; ++cpu) {
+            cpus.push_back(cpu);
+        }
+    }
+    std::sort(cpus.begin(), cpus.end());
+    cpus.erase(std::unique(cpus.begin(), cpus.end()), cpus.end());
+    if (cpus.empty()) {
+        throw std::invalid_argument("ThreadTopology: empty cpu list");
+    }
+    return cpus;
+}
+
+std::vector<int> ThreadTopology::isolatedCpus() {
+    return readCpuListFile("/sys/devices/system/cpu/isolated");
+}
+
+std::vector<int> ThreadTopology::numaNodeCpus(int node) {
+    if (node < 0) {
+        return {};
+    }
+    return readCpuListFile("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+}
+
+ThreadTopology ThreadTopology::fromConfig(const std::map<std::string, std::string>& config) {
+    ThreadTopology topology;
+    for (const auto& entry : config) {
+        const std::size_t dot = entry.first.rfind('.');
+        if (dot == std::string::npos || dot == 0U) {
+            throw std::invalid_argument("ThreadTopology: key must be <role>.<field>: '" + entry.first + "'");
+        }
+        const std::string role = entry.first.substr(0U, dot);
+        const std::string field = entry.first.substr(dot + 1U);
+        const std::string& value = entry.second;
+        RolePlacement& placement = topology.roles_[role];
+        placement.configured = true;
+
+        if (field == "cpus") {
+            placement.cpuSpec = value;
+        } else if (field == "policy") {
+            if (value == "other") {
+                placement.policy = SchedPolicy::Other;
+            } else if (value == "fifo") {
+                placement.policy = SchedPolicy::Fifo;
+            } else if (value == "rr") {
+                placement.policy = SchedPolicy::RoundRobin;
+            } else {
+                throw std::invalid_argument("ThreadTopology: unknown policy '" + value + "' for " + role);
+            }
+        } else if (field == "priority") {
+            placement.priority = parseInt(value, entry.first);
+        } else if (field == "numa_node") {
+            placement.numaNode = parseInt(value, entry.first);
+        } else if (field == "threads") {
+            placement.ioThreads = parseInt(value, entry.first);
+        } else {
+            throw std::invalid_argument("ThreadTopology: unknown key '" + entry.first + "'");
+        }
+    }
+
+    for (auto& entry : topology.roles_) {
+        RolePlacement& placement = entry.second;
+        if (placement.policy == SchedPolicy::Other) {
+            placement.priority = 0;
+        } else if (placement.priority < 1 || placement.priority > 99) {
+            throw std::invalid_argument("ThreadTopology: priority of " + entry.first + " must be 1..99");
+        }
+        if (placement.ioThreads < 0) {
+            throw std::invalid_argument("ThreadTopology: threads of " + entry.first + " must not be negative");
+        }
+        if (placement.cpuSpec == "isolated") {
+            placement.cpus = isolatedCpus();
+        } else if (placement.cpuSpec == "node") {
+            if (placement.numaNode < 0) {
+                throw std::invalid_argument("ThreadTopology: cpus = node needs numa_node for " + entry.first);
+            }
+            placement.cpus = numaNodeCpus(placement.numaNode);
+        } else if (!placement.cpuSpec.empty()) {
+            placement.cpus = parseCpuList(placement.cpuSpec);
+        }
+    }
+    return topology;
+}
+
+ThreadTopology ThreadTopology::fromFile(const std::string& path) {
+    return fromConfig(config::readKeyValueFile(path, "ThreadTopology"));
+}
+
+ThreadTopology& ThreadTopology::process() {
+    static ThreadTopology topology = []() {
+        const char* env = std::getenv("HEXAGON_THREAD_TOPOLOGY");
+        const std::string path = (env != nullptr && env[0] != '\0') ? env : DEFAULT_TOPOLOGY_PATH;
+        try {
+            ThreadTopology loaded = fromFile(path);
+            for (const std::string& warning : loaded.validate()) {
+                std::cerr << "[ThreadTopology] " << warning << std::endl;
+            }
+            return loaded;
+        } catch (const std::exception& e) {
+            std::cerr << "[ThreadTopology] " << path << " ignored: " << e.what() << std::endl;
+            return ThreadTopology();
+        }
+    }();
+    return topology;
+}
+
+bool ThreadTopology::hasRole(const std::string& role) const {
+    return roles_.find(role) != roles_.end();
+}
+
+RolePlacement ThreadTopology::placementFor(const std::string& role) const {
+    const auto it = roles_.find(role);
+    return it != roles_.end() ? it->second : RolePlacement();
+}
+
+AppliedPlacement ThreadTopology::applyToCurrentThread(const std::string& role) {
+    const AppliedPlacement result = applyPlacement(role, placementFor(role));
+    recordApplied(result);
+    return result;
+}
+
+AppliedPlacement ThreadTopology::probe(const std::string& role) const {
+    const RolePlacement placement = placementFor(role);
+    AppliedPlacement result;
+    std::thread probeThread([&result, &role, &placement]() {
+        result = applyPlacement(role, placement);
+    });
+    probeThread.join();
+    return result;
+}
+
+AppliedPlacement ThreadTopology::applyPlacement(const std::string& role, const RolePlacement& placement) {
+    AppliedPlacement result;
+    result.role = role;
+    result.policy = placement.policy;
+    result.priority = placement.priority;
+    result.numaNode = placement.numaNode;
+
+#ifdef __linux__
+    if (!placement.configured) {
+        appendError(result.error, "not configured");
+    } else {
+        if (!placement.cpus.empty()) {
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            for (const int cpu : placement.cpus) {
+                if (cpu >= 0 && cpu < CPU_SETSIZE) {
+                    CPU_SET(static_cast<std::size_t>(cpu), &set);
+                }
+            }
+            const int rc = pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+            result.affinityApplied = rc == 0;
+            if (rc != 0) {
+                appendError(result.error, std::string("affinity: ") + std::strerror(rc));
+            }
+        } else if (!placement.cpuSpec.empty()) {
+            appendError(result.error, "cpus '" + placement.cpuSpec + "' resolved to none");
+        }
+
+        sched_param param{};
+        param.sched_priority = placement.priority;
+        const int rc = pthread_setschedparam(pthread_self(), nativePolicy(placement.policy), &param);
+        result.schedApplied = rc == 0;
+        if (rc != 0) {
+            appendError(result.error, std::string("sched: ") + std::strerror(rc));
+        }
+
+        if (placement.numaNode >= 0) {
+            constexpr std::size_t BITS = sizeof(unsigned long) * 8U;
+            const std::size_t node = static_cast<std::size_t>(placement.numaNode);
+            std::vector<unsigned long> mask(node / BITS + 1U, 0UL);
+            mask[node / BITS] = 1UL << (node % BITS);
+            if (syscall(SYS_set_mempolicy, MPOL_PREFERRED_MODE, mask.data(), mask.size() * BITS + 1U) == 0) {
+                result.numaApplied = true;
+            } else {
+                appendError(result.error, std::string("numa: ") + std::strerror(errno));
+            }
+        }
+    }
+    result.effectiveCpus = currentAffinity();
+#else
+    appendError(result.error, "unsupported platform");
+#endif
+    return result;
+}
+
+void ThreadTopology::recordApplied(const AppliedPlacement& placement) {
+    const std::lock_guard<std::mutex> lock(appliedMutex_);
+    applied_.push_back(placement);
+}
+
+std::vector<std::string> ThreadTopology::validate() const {
+    std::vector<std::string> warnings;
+    const std::vector<int> online = readCpuListFile("/sys/devices/system/cpu/online");
+    const std::vector<int> isolated = isolatedCpus();
+    std::map<int, std::vector<std::string>> users;
+
+    for (const auto& entry : roles_) {
+        const RolePlacement& placement = entry.second;
+        const bool realtime = placement.policy != SchedPolicy::Other;
+        if (placement.cpus.empty() && !placement.cpuSpec.empty()) {
+            warnings.push_back(entry.first + ": cpus '" + placement.cpuSpec + "' resolved to none on this host");
+        }
+        for (const int cpu : placement.cpus) {
+            if (!online.empty() && !std::binary_search(online.begin(), online.end(), cpu)) {
+                warnings.push_back(entry.first + ": cpu " + std::to_string(cpu) + " is not online");
+            }
+            if (realtime && !isolated.empty() && !std::binary_search(isolated.begin(), isolated.end(), cpu)) {
+                warnings.push_back(entry.first + ": real-time on cpu " + std::to_string(cpu) + " outside isolcpus");
+            }
+            users[cpu].push_back(entry.first);
+        }
+    }
+
+    for (const auto& entry : users) {
+        if (entry.second.size() < 2U) {
+            continue;
+        }
+        bool realtime = false;
+        std::string names;
+        for (const std::string& role : entry.second) {
+            realtime = realtime || roles_.at(role).policy != SchedPolicy::Other;
+            names += (names.empty() ? "" : ", ") + role;
+        }
+        if (realtime) {
+            warnings.push_back("cpu " + std::to_string(entry.first) + " shared by real-time roles: " + names);
+        }
+    }
+    return warnings;
+}
+
+std::string ThreadTopology::report() const {
+    const std::lock_guard<std::mutex> lock(appliedMutex_);
+    std::string out;
+    for (const AppliedPlacement& placement : applied_) {
+        out += toString(placement) + "\n";
+    }
+    return out;
+}
+
+const char* ThreadTopology::toString(SchedPolicy policy) noexcept {
+    switch (policy) {
+        case SchedPolicy::Fifo:
+            return "fifo";
+        case SchedPolicy::RoundRobin:
+            return "rr";
+        case SchedPolicy::Other:
+            return "other";
+        default:
+            return "other";
+    }
+}
+
+std::string ThreadTopology::toString(const AppliedPlacement& placement) {
+    std::ostringstream out;
+    out << placement.role << ": cpus=" << joinCpus(placement.effectiveCpus)
+        << " sched=" << toString(placement.policy) << "/" << placement.priority;
+    if (placement.numaNode >= 0) {
+        out << " numa=" << placement.numaNode << (placement.numaApplied ? "" : "(not applied)");
+    }
+    if (!placement.error.empty()) {
+        out << " [" << placement.error << "]";
+    }
+    return out.str();
+}
+
+} // namespace topology
+} // namespace common
@@ -0,0 +1,148 @@
+/**
+ * @file ThreadTopology.h
+ * @brief Config-driven CPU affinity, real-time priority and NUMA placement
+ *
+ * Hot threads used to pin themselves with hard-coded values (SCHED_FIFO 95
+ * on CPU 1 for the DISH receiver, 94 on CPU 0 for the RADIO publisher) and
+ * libzmq's I/O thread ran wherever the scheduler put it. ThreadTopology
+ * reads one placement per role from a key/value file so each host can keep
+ * hot threads off IRQ cores and off each other:
+ *
+ * @code
+ * # thread_topology.conf
+ * dish_receiver.cpus     = 3          # "2-3,6", "isolated" or "node"
+ * dish_receiver.policy   = fifo       # other | fifo | rr
+ * dish_receiver.priority = 95
+ * dish_receiver.numa_node = 0         # preferred memory node
+ * zmq_io.cpus            = 4          # libzmq I/O threads (see ZmqTopology.h)
+ * zmq_io.threads         = 1
+ * @endcode
+ *
+ * "isolated" expands to the kernel's isolcpus set, "node" to the CPUs of
+ * numa_node. Roles that are not configured are left alone. Failures such as
+ * EPERM for SCHED_FIFO are reported, never thrown, since a thread should
+ * still run when it cannot be pinned.
+ */
+
+#pragma once
+
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace common {
+namespace topology {
+
+/// Scheduling class of a role
+enum class SchedPolicy {
+    Other,      ///< SCHED_OTHER (normal time sharing)
+    Fifo,       ///< SCHED_FIFO
+    RoundRobin  ///< SCHED_RR
+};
+
+/// Configured placement of one role
+struct RolePlacement {
+    std::vector<int> cpus;                 ///< Empty: affinity left alone
+    std::string cpuSpec;                   ///< As configured ("2-3", "isolated", ...)
+    SchedPolicy policy = SchedPolicy::Other;
+    int priority = 0;                      ///< 1..99 for Fifo/RoundRobin
+    int numaNode = -1;                     ///< -1: memory policy left alone
+    int ioThreads = 0;                     ///< zmq_io only; 0 keeps the context's count
+    bool configured = false;
+};
+
+/// What applyToCurrentThread actually achieved
+struct AppliedPlacement {
+    std::string role;
+    std::vector<int> effectiveCpus;        ///< Affinity after the call
+    SchedPolicy policy = SchedPolicy::Other;
+    int priority = 0;
+    int numaNode = -1;
+    bool affinityApplied = false;
+    bool schedApplied = false;
+    bool numaApplied = false;
+    std::string error;                     ///< Empty on full success
+};
+
+/**
+ * @class ThreadTopology
+ * @brief Per-role thread placement loaded from configuration
+ */
+class ThreadTopology final {
+public:
+    ThreadTopology() = default;
+
+    /**
+     * @brief Builds the topology from "<role>.<key>" entries
+     * @throws std::invalid_argument on unknown keys or out-of-range values
+     */
+    static ThreadTopology fromConfig(const std::map<std::string, std::string>& config);
+
+    /// Reads "key = value" lines ('#' starts a comment); a missing file yields an empty topology
+    static ThreadTopology fromFile(const std::string& path);
+
+    /**
+     * @brief Process-wide topology, loaded once
+     *
+     * Path: $HEXAGON_THREAD_TOPOLOGY, else config/thread_topology.conf
+     * relative to the working directory.
+     */
+    static ThreadTopology& process();
+
+    /// Parses "1-3,5"; "isolated" and "node" are resolved by fromConfig
+    static std::vector<int> parseCpuList(const std::string& text);
+
+    /// CPUs listed in /sys/devices/system/cpu/isolated (isolcpus=)
+    static std::vector<int> isolatedCpus();
+
+    /// CPUs of a NUMA node from sysfs; empty if the node does not exist
+    static std::vector<int> numaNodeCpus(int node);
+
+    bool hasRole(const std::string& role) const;
+
+    /// Placement of role; an unconfigured placement if the role is unknown
+    RolePlacement placementFor(const std::string& role) const;
+
+    /// Pins, schedules and binds memory of the calling thread; records the result
+    AppliedPlacement applyToCurrentThread(const std::string& role);
+
+    /**
+     * @brief Applies role on a short-lived thread and reports what worked
+     *
+     * Used before handing a placement to libzmq, which aborts when its
+     * threads cannot apply the requested policy or affinity.
+     */
+    AppliedPlacement probe(const std::string& role) const;
+
+    /// Records a placement applied elsewhere (e.g. libzmq I/O threads)
+    void recordApplied(const AppliedPlacement& placement);
+
+    /**
+     * @brief Configuration problems worth a warning
+     *
+     * Real-time roles sharing a CPU, real-time roles outside isolcpus when
+     * the host isolates CPUs, and CPUs that are not online.
+     */
+    std::vector<std::string> validate() const;
+
+    /// One line per applied placement, for startup logs
+    std::string report() const;
+
+    static const char* toString(SchedPolicy policy) noexcept;
+    static std::string toString(const AppliedPlacement& placement);
+
+    ThreadTopology(const ThreadTopology& other);
+    ThreadTopology& operator=(const ThreadTopology& other);
+
+private:
+    static AppliedPlacement applyPlacement(const std::string& role, const RolePlacement& placement);
+
+    std::map<std::string, RolePlacement> roles_;
+
+    mutable std::mutex appliedMutex_;
+    std::vector<AppliedPlacement> applied_;
+};
+
+} // namespace topology
+} // namespace common
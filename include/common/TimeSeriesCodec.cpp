@@ -0,0 +1,235 @@
+/**
+ * @file TimeSeriesCodec.cpp
+ * @brief SeriesEncoder and SeriesDecoder implementation
+ */
+
+#include "common/TimeSeriesCodec.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace common {
+namespace store {
+
+namespace {
+
+std::uint64_t toBits(double value) noexcept {
+    std::uint64_t bits = 0U;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+double fromBits(std::uint64_t bits) noexcept {
+    double value = 0.0;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+std::uint64_t lowMask(unsigned count) noexcept {
+    return count >= 64U ? ~std::uint64_t{0} : (std::uint64_t{1} << count) - 1U;
+}
+
+} // namespace
+
+// ---------------------------------------------------------------------------
+// SeriesEncoder
+// ---------------------------------------------------------------------------
+
+SeriesEncoder::SeriesEncoder(std::size_t doubleColumns, std::size_t intColumns)
+    : ints_(intColumns),
+      doubles_(doubleColumns) {
+    block_.doubleColumns = doubleColumns;
+    block_.intColumns = intColumns;
+}
+
+void SeriesEncoder::writeBits(std::uint64_t value, unsigned count) {
+    if (count == 0U) {
+        return;
+    }
+    value &= lowMask(count);
+    const unsigned used = static_cast<unsigned>(block_.bits % 64U);
+    if (used == 0U) {
+        block_.words.push_back(0U);
+    }
+    const unsigned room = 64U - used;
+    if (count <= room) {
+        block_.words.back() |= value << (room - count);
+    } else {
+        block_.words.back() |= value >> (count - room);
+        block_.words.push_back(value << (64U - (count - room)));
+    }
+    block_.bits += count;
+}
+
+void SeriesEncoder::encodeDelta(DeltaState& state, std::int64_t value) {
+    if (block_.rows == 0U) {
+        writeBits(static_cast<std::uint64_t>(value), 64U);
+        state.previous = value;
+        state.delta = 0;
+        return;
+    }
+    // Wrapping arithmetic: any pair of int64 values round-trips through the 64-bit bucket
+    const std::int64_t delta = static_cast<std::int64_t>(static_cast<std::uint64_t>(value) -
+                                                         static_cast<std::uint64_t>(state.previous));
+    const std::int64_t dod = static_cast<std::int64_t>(static_cast<std::uint64_t>(delta) -
+                                                       static_cast<std::uint64_t>(state.delta));
+    if (dod == 0) {
+        writeBits(0U, 1U);
+    } else if (dod >= -63 && dod <= 64) {
+        writeBits(0x2U, 2U);
+        writeBits(static_cast<std::uint64_t>(dod + 63), 7U);
+    } else if (dod >= -255 && dod <= 256) {
+        writeBits(0x6U, 3U);
+        writeBits(static_cast<std::uint64_t>(dod + 255), 9U);
+    } else if (dod >= -2047 && dod <= 2048) {
+        writeBits(0xEU, 4U);
+        writeBits(static_cast<std::uint64_t>(dod + 2047), 12U);
+    } else {
+        writeBits(0xFU, 4U);
+        writeBits(static_cast<std::uint64_t>(dod), 64U);
+    }
+    state.previous = value;
+    state.delta = delta;
+}
+
+void SeriesEncoder::encodeXor(XorState& state, double value) {
+    const std::uint64_t bits = toBits(value);
+    if (block_.rows == 0U) {
+        writeBits(bits, 64U);
+        state.previous = bits;
+        return;
+    }
+    const std::uint64_t difference = bits ^ state.previous;
+    state.previous = bits;
+    if (difference == 0U) {
+        writeBits(0U, 1U);
+        return;
+    }
+    const unsigned leading = std::min(static_cast<unsigned>(__builtin_clzll(difference)), 31U);
+    const unsigned trailing = static_cast<unsigned>(__builtin_ctzll(difference));
+    if (state.window && leading >= state.leading && trailing >= state.trailing) {
+        writeBits(0x2U, 2U);
+        writeBits(difference >> state.trailing, 64U - state.leading - state.trailing);
+        return;
+    }
+    const unsigned meaningful = 64U - leading - trailing;
+    writeBits(0x3U, 2U);
+    writeBits(leading, 5U);
+    writeBits(meaningful & 63U, 6U);   // 64 is stored as 0
+    writeBits(difference >> trailing, meaningful);
+    state.leading = leading;
+    state.trailing = trailing;
+    state.window = true;
+}
+
+void SeriesEncoder::append(std::int64_t time, const double* doubles, const std::int64_t* ints) {
+    encodeDelta(time_, time);
+    for (std::size_t column = 0U; column < doubles_.size(); ++column) {
+        encodeXor(doubles_[column], doubles[column]);
+    }
+    for (std::size_t column = 0U; column < ints_.size(); ++column) {
+        encodeDelta(ints_[column], ints[column]);
+    }
+    block_.minTime = block_.rows == 0U ? time : std::min(block_.minTime, time);
+    block_.maxTime = block_.rows == 0U ? time : std::max(block_.maxTime, time);
+    ++block_.rows;
+}
+
+SeriesBlock SeriesEncoder::finish() {
+    SeriesBlock finished = std::move(block_);
+    finished.words.shrink_to_fit();
+    block_ = SeriesBlock();
+    block_.doubleColumns = finished.doubleColumns;
+    block_.intColumns = finished.intColumns;
+    std::fill(doubles_.begin(), doubles_.end(), XorState());
+    std::fill(ints_.begin(), ints_.end(), DeltaState());
+    time_ = DeltaState();
+    return finished;
+}
+
+// ---------------------------------------------------------------------------
+// SeriesDecoder
+// ---------------------------------------------------------------------------
+
+SeriesDecoder::SeriesDecoder(const SeriesBlock& block)
+    : block_(block),
+      ints_(block.intColumns),
+      doubles_(block.doubleColumns) {
+}
+
+std::uint64_t SeriesDecoder::readBits(unsigned count) noexcept {
+    if (count == 0U) {
+        return 0U;
+    }
+    const std::size_t word = position_ / 64U;
+    const unsigned used = static_cast<unsigned>(position_ % 64U);
+    const unsigned room = 64U - used;
+    position_ += count;
+    if (count <= room) {
+        return (block_.words[word] >> (room - count)) & lowMask(count);
+    }
+    const unsigned rest = count - room;
+    const std::uint64_t high = block_.words[word] & lowMask(room);
+    return (high << rest) | (block_.words[word + 1U] >> (64U - rest));
+}
+
+std::int64_t SeriesDecoder::decodeDelta(DeltaState& state) noexcept {
+    if (row_ == 0U) {
+        state.previous = static_cast<std::int64_t>(readBits(64U));
+        state.delta = 0;
+        return state.previous;
+    }
+    std::int64_t dod = 0;
+    if (readBit()) {
+        if (!readBit()) {
+            dod = static_cast<std::int64_t>(readBits(7U)) - 63;
+        } else if (!readBit()) {
+            dod = static_cast<std::int64_t>(readBits(9U)) - 255;
+        } else if (!readBit()) {
+            dod = static_cast<std::int64_t>(readBits(12U)) - 2047;
+        } else {
+            dod = static_cast<std::int64_t>(readBits(64U));
+        }
+    }
+    state.delta = static_cast<std::int64_t>(static_cast<std::uint64_t>(state.delta) + static_cast<std::uint64_t>(dod));
+    state.previous = static_cast<std::int64_t>(static_cast<std::uint64_t>(state.previous) +
+                                               static_cast<std::uint64_t>(state.delta));
+    return state.previous;
+}
+
+double SeriesDecoder::decodeXor(XorState& state) noexcept {
+    if (row_ == 0U) {
+        state.previous = readBits(64U);
+        return fromBits(state.previous);
+    }
+    if (readBit()) {
+        if (readBit()) {
+            state.leading = static_cast<unsigned>(readBits(5U));
+            state.meaningful = static_cast<unsigned>(readBits(6U));
+            if (state.meaningful == 0U) {
+                state.meaningful = 64U;
+            }
+        }
+        const unsigned trailing = 64U - state.leading - state.meaningful;
+        state.previous ^= readBits(state.meaningful) << trailing;
+    }
+    return fromBits(state.previous);
+}
+
+bool SeriesDecoder::next(std::int64_t& time, double* doubles, std::int64_t* ints) {
+    if (row_ >= block_.rows) {
+        return false;
+    }
+    time = decodeDelta(time_);
+    for (std::size_t column = 0U; column < doubles_.size(); ++column) {
+        doubles[column] = decodeXor(doubles_[column]);
+    }
+    for (std::size_t column = 0U; column < ints_.size(); ++column) {
+        ints[column] = decodeDelta(ints_[column]);
+    }
+    ++row_;
+    return true;
+}
+
+} // namespace store
+} // namespace common
@@ -0,0 +1,129 @@
+/**
+ * @file TimeSeriesCodec.h
+ * @brief Gorilla-style compression of timestamped rows of double and int64 columns
+ *
+ * Rows are packed into one bit stream, column after column:
+ *
+ *  - the key time and every int64 column are delta-of-delta coded. A
+ *    series on a fixed grid (5 ms updates, or a hop time that moves in
+ *    step with it) costs one bit per row;
+ *  - every double column is XOR coded against its previous value, and
+ *    only the meaningful bits between the leading and trailing zeros are
+ *    kept. Smoothly changing positions and velocities share most of
+ *    their sign, exponent and high mantissa bits.
+ *
+ * The first row is stored raw. A block is immutable once finished;
+ * SeriesDecoder streams it back row by row without allocating.
+ *
+ * Delta-of-delta buckets (value stored with a bias):
+ *   '0'                      dod == 0
+ *   '10'   + 7 bits          -63 .. 64
+ *   '110'  + 9 bits          -255 .. 256
+ *   '1110' + 12 bits         -2047 .. 2048
+ *   '1111' + 64 bits         anything else
+ *
+ * XOR coding:
+ *   '0'                      same value
+ *   '10' + meaningful bits   fits the previous leading/trailing window
+ *   '11' + 5 bits leading + 6 bits length + meaningful bits
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace common {
+namespace store {
+
+/// A finished run of encoded rows
+struct SeriesBlock {
+    std::size_t doubleColumns = 0U;
+    std::size_t intColumns = 0U;
+    std::size_t rows = 0U;
+    std::int64_t minTime = 0;
+    std::int64_t maxTime = 0;
+    std::vector<std::uint64_t> words;   ///< Bit stream, most significant bit first
+    std::size_t bits = 0U;
+
+    std::size_t bytes() const noexcept { return (bits + 7U) / 8U; }
+};
+
+/**
+ * @class SeriesEncoder
+ * @brief Appends rows to a growing block
+ */
+class SeriesEncoder final {
+public:
+    SeriesEncoder(std::size_t doubleColumns, std::size_t intColumns);
+
+    void append(std::int64_t time, const double* doubles, const std::int64_t* ints);
+
+    std::size_t rows() const noexcept { return block_.rows; }
+
+    /// The rows so far, as a block; the encoder keeps going
+    const SeriesBlock& block() const noexcept { return block_; }
+
+    /// Hands the block over and starts an empty one
+    SeriesBlock finish();
+
+private:
+    struct DeltaState {
+        std::int64_t previous = 0;
+        std::int64_t delta = 0;
+    };
+    struct XorState {
+        std::uint64_t previous = 0U;
+        unsigned leading = 0U;
+        unsigned trailing = 0U;
+        bool window = false;
+    };
+
+    void writeBits(std::uint64_t value, unsigned count);
+    void encodeDelta(DeltaState& state, std::int64_t value);
+    void encodeXor(XorState& state, double value);
+
+    SeriesBlock block_;
+    DeltaState time_;
+    std::vector<DeltaState> ints_;
+    std::vector<XorState> doubles_;
+};
+
+/**
+ * @class SeriesDecoder
+ * @brief Streams the rows of a block back; the block must outlive the decoder
+ */
+class SeriesDecoder final {
+public:
+    explicit SeriesDecoder(const SeriesBlock& block);
+
+    /// Decodes the next row; false after the last one
+    bool next(std::int64_t& time, double* doubles, std::int64_t* ints);
+
+private:
+    struct DeltaState {
+        std::int64_t previous = 0;
+        std::int64_t delta = 0;
+    };
+    struct XorState {
+        std::uint64_t previous = 0U;
+        unsigned leading = 0U;
+        unsigned meaningful = 0U;
+    };
+
+    std::uint64_t readBits(unsigned count) noexcept;
+    bool readBit() noexcept { return readBits(1U) != 0U; }
+    std::int64_t decodeDelta(DeltaState& state) noexcept;
+    double decodeXor(XorState& state) noexcept;
+
+    const SeriesBlock& block_;
+    std::size_t position_ = 0U;
+    std::size_t row_ = 0U;
+    DeltaState time_;
+    std::vector<DeltaState> ints_;
+    std::vector<XorState> doubles_;
+};
+
+} // namespace store
+} // namespace common
@@ -0,0 +1,200 @@
+/**
+ * @file TimingWheel.cpp
+ * @brief TimingWheel implementation
+ */
+
+#include "common/TimingWheel.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace common {
+namespace timing {
+
+constexpr unsigned TimingWheel::LEVELS;
+constexpr unsigned TimingWheel::SLOT_BITS;
+constexpr unsigned TimingWheel::SLOTS;
+
+namespace {
+
+constexpr std::int64_t SLOT_MASK = TimingWheel::SLOTS - 1U;
+
+/// Ticks covered by one window of the given level
+constexpr std::int64_t windowBits(unsigned level) {
+    return static_cast<std::int64_t>(TimingWheel::SLOT_BITS) * (level + 1U);
+}
+
+} // namespace
+
+TimingWheel::TimingWheel(std::size_t capacity, std::int64_t resolution)
+    : resolution_(resolution),
+      nodes_(capacity),
+      heads_(LEVELS * SLOTS + 2U, NIL) {
+    if (capacity == 0U || resolution <= 0) {
+        throw std::invalid_argument("TimingWheel: capacity and resolution must be positive");
+    }
+}
+
+std::int64_t TimingWheel::tickOf(std::int64_t time) const noexcept {
+    const std::int64_t quotient = time / resolution_;
+    return (time % resolution_ != 0 && time < 0) ? quotient - 1 : quotient;
+}
+
+void TimingWheel::schedule(std::uint32_t id, std::int64_t when) {
+    unlink(id);
+    const std::int64_t tick = tickOf(when);
+    if (size_ == 0U && (!started_ || tick > current_)) {
+        // Nothing to cascade: the wheel can jump straight to the first deadline
+        current_ = tick;
+        started_ = true;
+    }
+    nodes_[id].tick = tick;
+    if (tick < current_) {
+        link(id, OVERDUE_LIST);
+    } else {
+        place(id);
+    }
+    ++size_;
+}
+
+void TimingWheel::cancel(std::uint32_t id) noexcept {
+    if (pending(id)) {
+        unlink(id);
+    }
+}
+
+void TimingWheel::place(std::uint32_t id) {
+    const std::int64_t tick = nodes_[id].tick;
+    for (unsigned level = 0U; level < LEVELS; ++level) {
+        // Same window of this level as the cursor: the slot inside it is exact
+        if ((tick >> windowBits(level)) == (current_ >> windowBits(level))) {
+            const std::int64_t slot = (tick >> (SLOT_BITS * level)) & SLOT_MASK;
+            link(id, static_cast<std::uint16_t>(level * SLOTS + static_cast<unsigned>(slot)));
+            return;
+        }
+    }
+    link(id, OVERFLOW_LIST);
+}
+
+void TimingWheel::link(std::uint32_t id, std::uint16_t list) {
+    Node& node = nodes_[id];
+    node.list = list;
+    node.prev = NIL;
+    node.next = heads_[list];
+    if (node.next != NIL) {
+        nodes_[node.next].prev = id;
+    }
+    heads_[list] = id;
+    if (list < OVERFLOW_LIST) {
+        occupied_[list / SLOTS][(list % SLOTS) / 64U] |= std::uint64_t{1} << (list % 64U);
+    }
+}
+
+void TimingWheel::unlink(std::uint32_t id) noexcept {
+    Node& node = nodes_[id];
+    if (node.list == NO_LIST) {
+        return;
+    }
+    if (node.prev != NIL) {
+        nodes_[node.prev].next = node.next;
+    } else {
+        heads_[node.list] = node.next;
+    }
+    if (node.next != NIL) {
+        nodes_[node.next].prev = node.prev;
+    }
+    if (heads_[node.list] == NIL && node.list < OVERFLOW_LIST) {
+        occupied_[node.list / SLOTS][(node.list % SLOTS) / 64U] &= ~(std::uint64_t{1} << (node.list % 64U));
+    }
+    node.list = NO_LIST;
+    node.prev = NIL;
+    node.next = NIL;
+    --size_;
+}
+
+void TimingWheel::cascade(std::uint16_t list) {
+    std::uint32_t id = heads_[list];
+    while (id != NIL) {
+        const std::uint32_t next = nodes_[id].next;
+        unlink(id);
+        place(id);
+        ++size_;
+        id = next;
+    }
+}
+
+void TimingWheel::crossBoundary() {
+    // Highest level first, so entries cascade all the way down in one pass
+    if ((current_ & ((std::int64_t{1} << windowBits(LEVELS - 1U)) - 1)) == 0) {
+        cascade(OVERFLOW_LIST);
+    }
+    for (unsigned level = LEVELS - 1U; level > 0U; --level) {
+        if ((current_ & ((std::int64_t{1} << (SLOT_BITS * level)) - 1)) == 0) {
+            const std::int64_t slot = (current_ >> (SLOT_BITS * level)) & SLOT_MASK;
+            cascade(static_cast<std::uint16_t>(level * SLOTS + static_cast<unsigned>(slot)));
+        }
+    }
+}
+
+int TimingWheel::nextOccupied(unsigned level, unsigned from) const noexcept {
+    for (unsigned word = from / 64U; word < SLOTS / 64U; ++word) {
+        std::uint64_t bits = occupied_[level][word];
+        if (word == from / 64U) {
+            bits &= ~std::uint64_t{0} << (from % 64U);
+        }
+        if (bits != 0U) {
+            return static_cast<int>(word * 64U + static_cast<unsigned>(__builtin_ctzll(bits)));
+        }
+    }
+    return -1;
+}
+
+bool TimingWheel::advance(std::int64_t until, std::size_t budget, std::vector<std::uint32_t>& expired) {
+    const std::int64_t target = tickOf(until);
+    std::size_t collected = 0U;
+    for (std::uint32_t id = heads_[OVERDUE_LIST]; id != NIL;) {
+        const std::uint32_t next = nodes_[id].next;
+        if (nodes_[id].tick < target) {
+            if (collected == budget) {
+                return false;
+            }
+            unlink(id);
+            expired.push_back(id);
+            ++collected;
+        }
+        id = next;
+    }
+    while (current_ < target) {
+        if (size_ == 0U) {
+            current_ = target;
+            break;
+        }
+        const std::uint16_t list = static_cast<std::uint16_t>(current_ & SLOT_MASK);
+        while (heads_[list] != NIL) {
+            if (collected == budget) {
+                return false;
+            }
+            const std::uint32_t id = heads_[list];
+            unlink(id);
+            expired.push_back(id);
+            ++collected;
+        }
+        // Skip to the next occupied level-0 slot of this window, or to the window end
+        const std::int64_t windowStart = current_ & ~SLOT_MASK;
+        const int slot = (current_ & SLOT_MASK) == SLOT_MASK
+                             ? -1
+                             : nextOccupied(0U, static_cast<unsigned>((current_ & SLOT_MASK) + 1));
+        if (slot >= 0) {
+            current_ = std::min(windowStart + slot, target);
+        } else if (windowStart + static_cast<std::int64_t>(SLOTS) <= target) {
+            current_ = windowStart + static_cast<std::int64_t>(SLOTS);
+            crossBoundary();
+        } else {
+            current_ = target;
+        }
+    }
+    return true;
+}
+
+} // namespace timing
+} // namespace common
@@ -0,0 +1,98 @@
+/**
+ * @file TimingWheel.h
+ * @brief Hierarchical timing wheel over a fixed set of integer ids
+ *
+ * Each id has at most one pending deadline. Deadlines are bucketed into
+ * four levels of 256 slots (level L slot width 256^L ticks); deadlines
+ * more than 2^32 ticks ahead wait in an overflow list, and deadlines
+ * behind the cursor (the wheel jumps ahead while empty) in an overdue
+ * list that advance() checks first. Scheduling, rescheduling and
+ * cancelling are O(1). advance() walks the level-0
+ * slots up to a target time, skipping empty slots through an occupancy
+ * bitmap, and cascades a higher-level slot down whenever a window
+ * boundary is crossed, so every entry is touched a bounded number of
+ * times before it expires.
+ *
+ * advance() takes a budget and resumes where the previous call stopped,
+ * so expiry work can be cut into slices of bounded length. Not
+ * thread-safe; the owner serializes access.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace common {
+namespace timing {
+
+class TimingWheel final {
+public:
+    static constexpr unsigned LEVELS = 4U;
+    static constexpr unsigned SLOT_BITS = 8U;
+    static constexpr unsigned SLOTS = 1U << SLOT_BITS;
+
+    /**
+     * @param capacity Ids are 0 .. capacity-1
+     * @param resolution Time units per tick; deadlines in the same tick expire together
+     * @throws std::invalid_argument if capacity or resolution is zero
+     */
+    TimingWheel(std::size_t capacity, std::int64_t resolution = 1);
+
+    /// Sets or moves the deadline of id
+    void schedule(std::uint32_t id, std::int64_t when);
+
+    void cancel(std::uint32_t id) noexcept;
+
+    bool pending(std::uint32_t id) const noexcept { return nodes_[id].list != NO_LIST; }
+
+    /// Deadline of a pending id, rounded down to a tick boundary
+    std::int64_t deadline(std::uint32_t id) const noexcept { return nodes_[id].tick * resolution_; }
+
+    std::size_t size() const noexcept { return size_; }
+
+    /**
+     * @brief Collects ids whose deadline tick lies before the tick of until
+     *
+     * Collected ids are no longer pending. At most budget ids are appended
+     * to expired; a later call continues from there.
+     *
+     * @return true once every deadline before until has been collected
+     */
+    bool advance(std::int64_t until, std::size_t budget, std::vector<std::uint32_t>& expired);
+
+private:
+    static constexpr std::uint32_t NIL = 0xFFFFFFFFU;
+    static constexpr std::uint16_t NO_LIST = 0xFFFFU;
+    static constexpr std::uint16_t OVERFLOW_LIST = LEVELS * SLOTS;
+    static constexpr std::uint16_t OVERDUE_LIST = LEVELS * SLOTS + 1U;
+
+    struct Node {
+        std::int64_t tick = 0;
+        std::uint32_t prev = NIL;
+        std::uint32_t next = NIL;
+        std::uint16_t list = NO_LIST;
+    };
+
+    std::int64_t tickOf(std::int64_t time) const noexcept;
+    void place(std::uint32_t id);
+    void link(std::uint32_t id, std::uint16_t list);
+    void unlink(std::uint32_t id) noexcept;
+    void cascade(std::uint16_t list);
+    void crossBoundary();
+    int nextOccupied(unsigned level, unsigned from) const noexcept;
+
+    std::int64_t resolution_;
+    std::int64_t current_ = 0;      ///< Cursor tick; later deadlines sit in the wheel, earlier ones are overdue
+    bool started_ = false;
+    std::size_t size_ = 0U;
+
+    std::vector<Node> nodes_;
+    std::vector<std::uint32_t> heads_;                             ///< LEVELS * SLOTS + overflow + overdue
+    std::array<std::array<std::uint64_t, SLOTS / 64U>, LEVELS> occupied_{};
+};
+
+} // namespace timing
+} // namespace common
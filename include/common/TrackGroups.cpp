@@ -0,0 +1,273 @@
+/**
+ * @file TrackGroups.cpp
+ * @brief TrackGroupScheme implementation
+ */
+
+#include "common/TrackGroups.h"
+#include "common/GeoTransforms.h"
+
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+#include <stdexcept>
+
+namespace common {
+namespace groups {
+
+namespace {
+
+constexpr std::uint32_t PARTITION_MASK = (1U << TrackGroupScheme::PARTITION_BITS) - 1U;
+
+/// Upper bound on the groups one selection may expand to
+constexpr std::size_t MAX_SELECTED_GROUPS = 65536U;
+
+constexpr double RAD_TO_DEG = 180.0 / 3.14159265358979323846;
+
+std::uint32_t topicTagOf(const std::string& baseGroup) noexcept {
+    // FNV-1a, folded to 8 bits
+    std::uint32_t h = 2166136261U;
+    for (const char c : baseGroup) {
+        h ^= static_cast<std::uint8_t>(c);
+        h *= 16777619U;
+    }
+    return (h ^ (h >> 8) ^ (h >> 16) ^ (h >> 24)) & 0xFFU;
+}
+
+int parseInt(const std::string& text, const char* what) {
+    std::size_t used = 0U;
+    int value = 0;
+    try {
+        value = std::stoi(text, &used);
+    } catch (const std::exception&) {
+        used = 0U;
+    }
+    if (used == 0U || used != text.size()) {
+        throw std::invalid_argument(std::string("TrackGroupScheme: invalid ") + what + ": '" + text + "'");
+    }
+    return value;
+}
+
+double parseDouble(const std::string& text, const char* what) {
+    std::size_t used = 0U;
+    double value = 0.0;
+    try {
+        value = std::stod(text, &used);
+    } catch (const std::exception&) {
+        used = 0U;
+    }
+    if (used == 0U || used != text.size()) {
+        throw std::invalid_argument(std::string("TrackGroupScheme: invalid ") + what + ": '" + text + "'");
+    }
+    return value;
+}
+
+std::vector<std::string> splitTrimmed(const std::string& text, char separator) {
+    std::vector<std::string> parts;
+    std::istringstream stream(text);
+    std::string part;
+    while (std::getline(stream, part, separator)) {
+        const std::size_t first = part.find_first_not_of(" \t");
+        const std::size_t last = part.find_last_not_of(" \t");
+        parts.push_back(first == std::string::npos ? std::string() : part.substr(first, last - first + 1U));
+    }
+    return parts;
+}
+
+} // namespace
+
+TrackGroupScheme::TrackGroupScheme(const std::string& baseGroup)
+    : TrackGroupScheme(baseGroup, Partitioning::None, 1, 0.0) {
+}
+
+TrackGroupScheme::TrackGroupScheme(const std::string& baseGroup, Partitioning partitioning,
+                                   int rangeSize, double cellSizeDeg)
+    : baseGroup_(baseGroup),
+      partitioning_(partitioning),
+      rangeSize_(rangeSize),
+      cellSizeDeg_(cellSizeDeg),
+      latCells_(0),
+      lonCells_(0),
+      topicTag_(topicTagOf(baseGroup)) {
+    if (baseGroup_.empty()) {
+        throw std::invalid_argument("TrackGroupScheme: base group must not be empty");
+    }
+    if (partitioning_ == Partitioning::TrackRange && rangeSize_ <= 0) {
+        throw std::invalid_argument("TrackGroupScheme: group_track_range_size must be positive");
+    }
+    if (partitioning_ == Partitioning::GeoCell) {
+        if (!(cellSizeDeg_ > 0.0) || cellSizeDeg_ > 180.0) {
+            throw std::invalid_argument("TrackGroupScheme: group_cell_size_deg must be in (0, 180]");
+        }
+        const double latCells = std::ceil(180.0 / cellSizeDeg_);
+        const double lonCells = std::ceil(360.0 / cellSizeDeg_);
+        if (latCells * lonCells > static_cast<double>(PARTITION_MASK) + 1.0) {
+            throw std::invalid_argument("TrackGroupScheme: group_cell_size_deg too small for 24-bit partitions");
+        }
+        latCells_ = static_cast<int>(latCells);
+        lonCells_ = static_cast<int>(lonCells);
+    }
+}
+
+TrackGroupScheme TrackGroupScheme::byTrackRange(const std::string& baseGroup, int rangeSize) {
+    return TrackGroupScheme(baseGroup, Partitioning::TrackRange, rangeSize, 0.0);
+}
+
+TrackGroupScheme TrackGroupScheme::byGeoCell(const std::string& baseGroup, double cellSizeDeg) {
+    return TrackGroupScheme(baseGroup, Partitioning::GeoCell, 1, cellSizeDeg);
+}
+
+TrackGroupScheme TrackGroupScheme::fromMetadata(const std::string& baseGroup,
+                                                const std::map<std::string, std::string>& metadata) {
+    const auto mode = metadata.find("group_partitioning");
+    if (mode == metadata.end() || mode->second.empty() || mode->second == "none") {
+        return TrackGroupScheme(baseGroup);
+    }
+    if (mode->second == "track_range") {
+        const auto size = metadata.find("group_track_range_size");
+        if (size == metadata.end()) {
+            throw std::invalid_argument("TrackGroupScheme: group_track_range_size missing");
+        }
+        return byTrackRange(baseGroup, parseInt(size->second, "group_track_range_size"));
+    }
+    if (mode->second == "geo_cell") {
+        const auto size = metadata.find("group_cell_size_deg");
+        if (size == metadata.end()) {
+            throw std::invalid_argument("TrackGroupScheme: group_cell_size_deg missing");
+        }
+        return byGeoCell(baseGroup, parseDouble(size->second, "group_cell_size_deg"));
+    }
+    throw std::invalid_argument("TrackGroupScheme: unknown group_partitioning '" + mode->second + "'");
+}
+
+TrackGroupScheme TrackGroupScheme::fromSettings(const std::string& baseGroup, const std::string& partitioning,
+                                                int trackRangeSize, double cellSizeDeg) {
+    if (partitioning.empty() || partitioning == "none") {
+        return TrackGroupScheme(baseGroup);
+    }
+    if (partitioning == "track_range") {
+        return byTrackRange(baseGroup, trackRangeSize);
+    }
+    if (partitioning == "geo_cell") {
+        return byGeoCell(baseGroup, cellSizeDeg);
+    }
+    throw std::invalid_argument("TrackGroupScheme: unknown group_partitioning '" + partitioning + "'");
+}
+
+std::uint32_t TrackGroupScheme::makeId(std::uint32_t partition) const noexcept {
+    return (topicTag_ << PARTITION_BITS) | (partition & PARTITION_MASK);
+}
+
+std::uint32_t TrackGroupScheme::cellPartition(int latIndex, int lonIndex) const noexcept {
+    return static_cast<std::uint32_t>(latIndex) * static_cast<std::uint32_t>(lonCells_)
+           + static_cast<std::uint32_t>(lonIndex);
+}
+
+std::uint32_t TrackGroupScheme::groupIdFor(int trackId, double x, double y, double z) const noexcept {
+    if (partitioning_ == Partitioning::TrackRange) {
+        // Floor division keeps negative ids in their own partitions; indices
+        // beyond 24 bits alias modulo 2^24
+        int partition = trackId / rangeSize_;
+        if (trackId < 0 && (trackId % rangeSize_) != 0) {
+            --partition;
+        }
+        return makeId(static_cast<std::uint32_t>(partition));
+    }
+    if (partitioning_ == Partitioning::GeoCell) {
+        double lat = 0.0;
+        double lon = 0.0;
+        double alt = 0.0;
+        geo::ecefToGeodetic(x, y, z, lat, lon, alt);
+        const int latIndex = std::min(latCells_ - 1, std::max(0,
+            static_cast<int>(std::floor((lat * RAD_TO_DEG + 90.0) / cellSizeDeg_))));
+        const int lonIndex = std::min(lonCells_ - 1, std::max(0,
+            static_cast<int>(std::floor((lon * RAD_TO_DEG + 180.0) / cellSizeDeg_))));
+        return makeId(cellPartition(latIndex, lonIndex));
+    }
+    return makeId(0U);
+}
+
+std::vector<std::uint32_t> TrackGroupScheme::groupIdsForTrackRange(int firstTrackId, int lastTrackId) const {
+    if (partitioning_ != Partitioning::TrackRange) {
+        throw std::invalid_argument("TrackGroupScheme: scheme is not partitioned by track range");
+    }
+    if (lastTrackId < firstTrackId) {
+        throw std::invalid_argument("TrackGroupScheme: empty track range");
+    }
+    const std::uint32_t first = groupIdFor(firstTrackId, 0.0, 0.0, 0.0) & PARTITION_MASK;
+    const std::uint32_t last = groupIdFor(lastTrackId, 0.0, 0.0, 0.0) & PARTITION_MASK;
+    const std::size_t count = static_cast<std::size_t>((last - first) & PARTITION_MASK) + 1U;
+    if (count > MAX_SELECTED_GROUPS) {
+        throw std::invalid_argument("TrackGroupScheme: track range selects too many groups");
+    }
+    std::vector<std::uint32_t> ids;
+    ids.reserve(count);
+    for (std::size_t i = 0U; i < count; ++i) {
+        ids.push_back(makeId(first + static_cast<std::uint32_t>(i)));
+    }
+    return ids;
+}
+
+std::vector<std::uint32_t> TrackGroupScheme::groupIdsForRegion(double minLatDeg, double maxLatDeg,
+                                                               double minLonDeg, double maxLonDeg) const {
+    if (partitioning_ != Partitioning::GeoCell) {
+        throw std::invalid_argument("TrackGroupScheme: scheme is not partitioned by geo cell");
+    }
+    if (!(minLatDeg <= maxLatDeg) || !(minLonDeg <= maxLonDeg)) {
+        throw std::invalid_argument("TrackGroupScheme: empty region");
+    }
+    const auto latIndex = [this](double deg) {
+        return std::min(latCells_ - 1, std::max(0, static_cast<int>(std::floor((deg + 90.0) / cellSizeDeg_))));
+    };
+    const auto lonIndex = [this](double deg) {
+        return std::min(lonCells_ - 1, std::max(0, static_cast<int>(std::floor((deg + 180.0) / cellSizeDeg_))));
+    };
+    const int lat0 = latIndex(minLatDeg);
+    const int lat1 = latIndex(maxLatDeg);
+    const int lon0 = lonIndex(minLonDeg);
+    const int lon1 = lonIndex(maxLonDeg);
+
+    const std::size_t count = static_cast<std::size_t>(lat1 - lat0 + 1) * static_cast<std::size_t>(lon1 - lon0 + 1);
+    if (count > MAX_SELECTED_GROUPS) {
+        throw std::invalid_argument("TrackGroupScheme: region selects too many groups");
+    }
+    std::vector<std::uint32_t> ids;
+    ids.reserve(count);
+    for (int la = lat0; la <= lat1; ++la) {
+        for (int lo = lon0; lo <= lon1; ++lo) {
+            ids.push_back(makeId(cellPartition(la, lo)));
+        }
+    }
+    return ids;
+}
+
+std::vector<std::uint32_t> TrackGroupScheme::groupIdsForSelection(const std::string& selection) const {
+    if (partitioning_ == Partitioning::TrackRange) {
+        std::vector<std::uint32_t> ids;
+        for (const std::string& item : splitTrimmed(selection, ',')) {
+            // '-' after the first character separates a range ("-5-10" is allowed)
+            const std::size_t dash = item.find('-', 1U);
+            const int first = parseInt(item.substr(0U, dash), "track selection");
+            const int last = dash == std::string::npos ? first : parseInt(item.substr(dash + 1U), "track selection");
+            const std::vector<std::uint32_t> part = groupIdsForTrackRange(first, last);
+            ids.insert(ids.end(), part.begin(), part.end());
+        }
+        std::sort(ids.begin(), ids.end());
+        ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+        if (ids.empty() || ids.size() > MAX_SELECTED_GROUPS) {
+            throw std::invalid_argument("TrackGroupScheme: invalid track selection '" + selection + "'");
+        }
+        return ids;
+    }
+    if (partitioning_ == Partitioning::GeoCell) {
+        const std::vector<std::string> parts = splitTrimmed(selection, ',');
+        if (parts.size() != 4U) {
+            throw std::invalid_argument("TrackGroupScheme: region selection needs minLat,maxLat,minLon,maxLon");
+        }
+        return groupIdsForRegion(parseDouble(parts[0], "region"), parseDouble(parts[1], "region"),
+                                 parseDouble(parts[2], "region"), parseDouble(parts[3], "region"));
+    }
+    throw std::invalid_argument("TrackGroupScheme: scheme is not partitioned");
+}
+
+} // namespace groups
+} // namespace common
@@ -0,0 +1,135 @@
+/**
+ * @file TrackGroups.h
+ * @brief Per-track and per-region RADIO/DISH group scheme
+ *
+ * By default each message type is published on one string group
+ * ("ExtrapTrackData", "DelayCalcTrackData", ...), and every DISH receives
+ * and deserializes every track. A partitioned scheme spreads the tracks of
+ * one message type over many numeric groups (libzmq ZMQ_GROUP_NUMERIC),
+ * so a DISH joins only the partitions it needs and libzmq drops the rest
+ * with one integer lookup before the payload reaches the adapter.
+ *
+ * Group id layout: bits 31..24 are a topic tag derived from the base group
+ * name, bits 23..0 the partition index, so message types sharing one
+ * multicast endpoint land in disjoint id ranges (topicTag() lets a
+ * deployment check that its base names map to distinct tags).
+ *
+ * Partitioning is read from x-service-metadata:
+ * - "group_partitioning": "none" | "track_range" | "geo_cell"
+ * - "group_track_range_size": track ids per group (track_range)
+ * - "group_cell_size_deg": cell edge in degrees (geo_cell)
+ * - "group_selection": partitions a DISH joins (see groupIdsForSelection)
+ *
+ * a_hexagon parses the schema at run time; b_hexagon and hexagon_c get the
+ * same keys as GROUP_* constants on their generated models (schemeOf()).
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace common {
+namespace groups {
+
+/// How the tracks of one message type are spread over groups
+enum class Partitioning {
+    None,       ///< One string group per message type (legacy behaviour)
+    TrackRange, ///< trackId / rangeSize
+    GeoCell     ///< Latitude/longitude cell of the ECEF position
+};
+
+/**
+ * @class TrackGroupScheme
+ * @brief Maps tracks to group ids (RADIO side) and selections to the set of
+ *        group ids to join (DISH side)
+ *
+ * Both ends must be built from the same configuration. Invalid parameters
+ * throw std::invalid_argument at construction, never on the send path.
+ */
+class TrackGroupScheme final {
+public:
+    /// Number of bits available for the partition index
+    static constexpr int PARTITION_BITS = 24;
+
+    /// Unpartitioned scheme publishing on baseGroup
+    explicit TrackGroupScheme(const std::string& baseGroup);
+
+    /// trackId / rangeSize partitions
+    static TrackGroupScheme byTrackRange(const std::string& baseGroup, int rangeSize);
+
+    /// Latitude/longitude cells of cellSizeDeg degrees
+    static TrackGroupScheme byGeoCell(const std::string& baseGroup, double cellSizeDeg);
+
+    /**
+     * @brief Builds the scheme from x-service-metadata key/values
+     *
+     * Missing or "none" partitioning yields the unpartitioned scheme.
+     */
+    static TrackGroupScheme fromMetadata(const std::string& baseGroup,
+                                         const std::map<std::string, std::string>& metadata);
+
+    /**
+     * @brief Builds the scheme from already parsed settings
+     * @param partitioning "none" (or empty), "track_range" or "geo_cell"
+     * @throws std::invalid_argument on an unknown mode or a bad size for the chosen mode
+     */
+    static TrackGroupScheme fromSettings(const std::string& baseGroup, const std::string& partitioning,
+                                         int trackRangeSize, double cellSizeDeg);
+
+    Partitioning getPartitioning() const noexcept { return partitioning_; }
+    bool isPartitioned() const noexcept { return partitioning_ != Partitioning::None; }
+    const std::string& getBaseGroup() const noexcept { return baseGroup_; }
+    std::uint32_t topicTag() const noexcept { return topicTag_; }
+
+    /**
+     * @brief Group id a RADIO publishes the track on (partitioned schemes only)
+     * @param trackId Track identifier (TrackRange)
+     * @param x,y,z ECEF position in metres (GeoCell)
+     */
+    std::uint32_t groupIdFor(int trackId, double x, double y, double z) const noexcept;
+
+    /// Group ids covering track ids [firstTrackId, lastTrackId]
+    std::vector<std::uint32_t> groupIdsForTrackRange(int firstTrackId, int lastTrackId) const;
+
+    /// Group ids of every cell intersecting the latitude/longitude box (degrees)
+    std::vector<std::uint32_t> groupIdsForRegion(double minLatDeg, double maxLatDeg,
+                                                 double minLonDeg, double maxLonDeg) const;
+
+    /**
+     * @brief Parses a DISH selection string into group ids
+     *
+     * - TrackRange: comma separated ids or ranges, e.g. "100-299,512"
+     * - GeoCell: "minLat,maxLat,minLon,maxLon" in degrees
+     *
+     * @throws std::invalid_argument on malformed input or an unpartitioned scheme
+     */
+    std::vector<std::uint32_t> groupIdsForSelection(const std::string& selection) const;
+
+private:
+    TrackGroupScheme(const std::string& baseGroup, Partitioning partitioning,
+                     int rangeSize, double cellSizeDeg);
+
+    std::uint32_t makeId(std::uint32_t partition) const noexcept;
+    std::uint32_t cellPartition(int latIndex, int lonIndex) const noexcept;
+
+    std::string baseGroup_;
+    Partitioning partitioning_;
+    int rangeSize_;
+    double cellSizeDeg_;
+    int latCells_;
+    int lonCells_;
+    std::uint32_t topicTag_;
+};
+
+/// Scheme from the GROUP_* constants the model generator emits for Model
+template <typename Model>
+TrackGroupScheme schemeOf(const std::string& baseGroup) {
+    return TrackGroupScheme::fromSettings(baseGroup, Model::GROUP_PARTITIONING, Model::GROUP_TRACK_RANGE_SIZE,
+                                          Model::GROUP_CELL_SIZE_DEG);
+}
+
+} // namespace groups
+} // namespace common
@@ -0,0 +1,518 @@
+/**
+ * @file TrackHistoryStore.cpp
+ * @brief TrackHistoryStore implementation
+ */
+
+#include "common/TrackHistoryStore.h"
+#include "common/TimingWheel.h"
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <thread>
+
+namespace common {
+namespace store {
+
+namespace {
+
+constexpr std::int64_t EMPTY_KEY = std::numeric_limits<std::int64_t>::min();
+constexpr std::int64_t NO_BUCKET = std::numeric_limits<std::int64_t>::min();
+constexpr std::int64_t EARLIEST = std::numeric_limits<std::int64_t>::min();
+constexpr std::int64_t LATEST = std::numeric_limits<std::int64_t>::max();
+constexpr std::uint32_t NOT_QUEUED = std::numeric_limits<std::uint32_t>::max();
+constexpr int SPINS_BEFORE_YIELD = 64;
+
+std::size_t roundUpPow2(std::size_t value) noexcept {
+    std::size_t result = 1U;
+    while (result < value) {
+        result <<= 1U;
+    }
+    return result;
+}
+
+std::int64_t floorDiv(std::int64_t value, std::int64_t divisor) noexcept {
+    const std::int64_t quotient = value / divisor;
+    return (value % divisor != 0 && value < 0) ? quotient - 1 : quotient;
+}
+
+std::size_t hashTrack(int trackId) noexcept {
+    return static_cast<std::size_t>(static_cast<std::uint32_t>(trackId) * 2654435761U);
+}
+
+void backOff(int& spins) {
+    if (++spins > SPINS_BEFORE_YIELD) {
+        std::this_thread::yield();
+    }
+}
+
+} // namespace
+
+/// Ring bookkeeping of one track; head and tail count samples ever written / removed
+struct alignas(64) TrackHistoryStore::Track {
+    std::atomic<std::uint64_t> seq{0U};
+    std::atomic<std::uint64_t> head{0U};
+    std::atomic<std::uint64_t> tail{0U};
+    int trackId = 0;
+    // Writer-only: time bounds of the ring and whether it holds samples in time order
+    std::int64_t oldest = LATEST;
+    std::int64_t newest = EARLIEST;
+    bool ordered = true;
+};
+
+/// Which time bucket a slot of the index currently describes
+struct alignas(64) TrackHistoryStore::Bucket {
+    std::atomic<std::int64_t> epoch{NO_BUCKET};
+};
+
+void HistoryRows::clear() noexcept {
+    trackIds.clear();
+    times.clear();
+    doubles.clear();
+    ints.clear();
+}
+
+TrackHistoryStore::TrackHistoryStore(const HistoryOptions& options)
+    : options_(options),
+      latestBucket_(NO_BUCKET),
+      oldestTime_(LATEST),
+      newestTime_(EARLIEST) {
+    if (options_.maxTracks == 0U || options_.samplesPerTrack == 0U || options_.buckets == 0U ||
+        options_.bucketWidth <= 0 || options_.expiryResolution <= 0) {
+        throw std::invalid_argument("TrackHistoryStore: capacities and bucket width must be positive");
+    }
+    options_.samplesPerTrack = roundUpPow2(options_.samplesPerTrack);
+    mask_ = options_.samplesPerTrack - 1U;
+    words_ = (options_.maxTracks + 63U) / 64U;
+
+    tracks_.reset(new Track[options_.maxTracks]);
+    expiry_.reset(new timing::TimingWheel(options_.maxTracks, options_.expiryResolution));
+    oldestHeap_.reserve(options_.maxTracks);
+    heapIndex_.assign(options_.maxTracks, NOT_QUEUED);
+
+    const std::size_t tableSize = roundUpPow2(options_.maxTracks * 2U);
+    tableMask_ = tableSize - 1U;
+    tableKeys_.reset(new std::atomic<std::int64_t>[tableSize]);
+    tableSlots_.reset(new std::atomic<std::uint32_t>[tableSize]);
+    for (std::size_t i = 0U; i < tableSize; ++i) {
+        tableKeys_[i].store(EMPTY_KEY, std::memory_order_relaxed);
+        tableSlots_[i].store(0U, std::memory_order_relaxed);
+    }
+
+    const std::size_t cells = options_.maxTracks * options_.samplesPerTrack;
+    times_.reset(new std::atomic<std::int64_t>[cells]);
+    doubles_.reset(new std::atomic<double>[cells * std::max<std::size_t>(options_.doubleColumns, 1U)]);
+    ints_.reset(new std::atomic<std::int64_t>[cells * std::max<std::size_t>(options_.intColumns, 1U)]);
+
+    bucketIndex_.reset(new Bucket[options_.buckets]);
+    bucketBits_.reset(new std::atomic<std::uint64_t>[options_.buckets * words_]);
+    for (std::size_t i = 0U; i < options_.buckets * words_; ++i) {
+        bucketBits_[i].store(0U, std::memory_order_relaxed);
+    }
+}
+
+TrackHistoryStore::~TrackHistoryStore() = default;
+
+HistoryRows TrackHistoryStore::makeRows() const {
+    HistoryRows rows;
+    rows.doubleColumns = options_.doubleColumns;
+    rows.intColumns = options_.intColumns;
+    return rows;
+}
+
+int TrackHistoryStore::findSlot(int trackId) const noexcept {
+    for (std::size_t probe = hashTrack(trackId) & tableMask_;; probe = (probe + 1U) & tableMask_) {
+        const std::int64_t key = tableKeys_[probe].load(std::memory_order_acquire);
+        if (key == EMPTY_KEY) {
+            return -1;
+        }
+        if (key == trackId) {
+            return static_cast<int>(tableSlots_[probe].load(std::memory_order_relaxed));
+        }
+    }
+}
+
+int TrackHistoryStore::findOrInsertSlot(int trackId) {
+    std::size_t probe = hashTrack(trackId) & tableMask_;
+    for (;; probe = (probe + 1U) & tableMask_) {
+        const std::int64_t key = tableKeys_[probe].load(std::memory_order_relaxed);
+        if (key == trackId) {
+            return static_cast<int>(tableSlots_[probe].load(std::memory_order_relaxed));
+        }
+        if (key == EMPTY_KEY) {
+            break;
+        }
+    }
+    const std::size_t slot = trackCount_.load(std::memory_order_relaxed);
+    if (slot >= options_.maxTracks) {
+        return -1;
+    }
+    tracks_[slot].trackId = trackId;
+    tableSlots_[probe].store(static_cast<std::uint32_t>(slot), std::memory_order_relaxed);
+    tableKeys_[probe].store(trackId, std::memory_order_release);
+    trackCount_.store(slot + 1U, std::memory_order_release);
+    return static_cast<int>(slot);
+}
+
+bool TrackHistoryStore::append(int trackId, std::int64_t time, const double* doubles, const std::int64_t* ints) {
+    std::lock_guard<std::mutex> lock(writeMutex_);
+    const int found = findOrInsertSlot(trackId);
+    if (found < 0) {
+        rejected_.fetch_add(1U, std::memory_order_relaxed);
+        return false;
+    }
+    const std::size_t slot = static_cast<std::size_t>(found);
+    Track& track = tracks_[slot];
+    const std::size_t base = slot * options_.samplesPerTrack;
+    const std::size_t cells = options_.maxTracks * options_.samplesPerTrack;
+
+    const std::uint64_t head = track.head.load(std::memory_order_relaxed);
+    std::uint64_t tail = track.tail.load(std::memory_order_relaxed);
+    const bool wasEmpty = head == tail;
+
+    const std::uint64_t seq = track.seq.load(std::memory_order_relaxed);
+    track.seq.store(seq + 1U, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    bool droppedOldest = false;
+    if (head - tail == options_.samplesPerTrack) {
+        const std::int64_t dropped = times_[base + (tail & mask_)].load(std::memory_order_relaxed);
+        track.tail.store(++tail, std::memory_order_relaxed);
+        records_.fetch_sub(1U, std::memory_order_relaxed);
+        overwritten_.fetch_add(1U, std::memory_order_relaxed);
+        droppedOldest = dropped <= track.oldest;
+    }
+
+    const std::size_t cell = base + (head & mask_);
+    times_[cell].store(time, std::memory_order_relaxed);
+    for (std::size_t column = 0U; column < options_.doubleColumns; ++column) {
+        doubles_[column * cells + cell].store(doubles[column], std::memory_order_relaxed);
+    }
+    for (std::size_t column = 0U; column < options_.intColumns; ++column) {
+        ints_[column * cells + cell].store(ints[column], std::memory_order_relaxed);
+    }
+    track.head.store(head + 1U, std::memory_order_relaxed);
+    track.seq.store(seq + 2U, std::memory_order_release);
+
+    if (wasEmpty) {
+        activeTracks_.fetch_add(1U, std::memory_order_relaxed);
+        track.ordered = true;
+        track.newest = time;
+    } else {
+        track.ordered = track.ordered && time >= track.newest;
+        track.newest = std::max(track.newest, time);
+    }
+    if (wasEmpty || time < expiry_->deadline(static_cast<std::uint32_t>(slot))) {
+        expiry_->schedule(static_cast<std::uint32_t>(slot), time);
+    }
+    records_.fetch_add(1U, std::memory_order_relaxed);
+    appended_.fetch_add(1U, std::memory_order_relaxed);
+    if (droppedOldest) {
+        refreshOldest(slot);
+    } else if (wasEmpty || time < track.oldest) {
+        track.oldest = time;
+        queueOldest(slot);
+    }
+    if (time > newestTime_.load(std::memory_order_relaxed)) {
+        newestTime_.store(time, std::memory_order_relaxed);
+    }
+    indexSample(slot, time);
+    return true;
+}
+
+void TrackHistoryStore::indexSample(std::size_t slot, std::int64_t time) {
+    const std::int64_t bucket = floorDiv(time, options_.bucketWidth);
+    const std::int64_t latest = latestBucket_.load(std::memory_order_relaxed);
+    const std::int64_t window = static_cast<std::int64_t>(options_.buckets);
+    if (latest != NO_BUCKET && bucket <= latest - window) {
+        return;   // Older than the index window; range queries there scan every track
+    }
+    const std::size_t index = static_cast<std::size_t>(bucket % window + (bucket % window < 0 ? window : 0));
+    Bucket& entry = bucketIndex_[index];
+    std::atomic<std::uint64_t>* bits = &bucketBits_[index * words_];
+    if (entry.epoch.load(std::memory_order_relaxed) != bucket) {
+        entry.epoch.store(NO_BUCKET, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        for (std::size_t word = 0U; word < words_; ++word) {
+            bits[word].store(0U, std::memory_order_relaxed);
+        }
+        entry.epoch.store(bucket, std::memory_order_release);
+    }
+    bits[slot / 64U].fetch_or(std::uint64_t{1} << (slot % 64U), std::memory_order_release);
+    if (latest == NO_BUCKET || bucket > latest) {
+        latestBucket_.store(bucket, std::memory_order_release);
+    }
+}
+
+std::size_t TrackHistoryStore::readSlot(std::size_t slot, std::int64_t start, std::int64_t end, bool latestOnly,
+                                        HistoryRows& out) const {
+    const Track& track = tracks_[slot];
+    const std::size_t base = slot * options_.samplesPerTrack;
+    const std::size_t cells = options_.maxTracks * options_.samplesPerTrack;
+    const std::size_t before = out.size();
+    int spins = 0;
+    for (;;) {
+        const std::uint64_t seq = track.seq.load(std::memory_order_acquire);
+        if ((seq & 1U) != 0U) {
+            backOff(spins);
+            continue;
+        }
+        const std::uint64_t head = track.head.load(std::memory_order_relaxed);
+        std::uint64_t tail = track.tail.load(std::memory_order_relaxed);
+        if (latestOnly && head != tail) {
+            tail = head - 1U;
+        }
+        if (head - tail <= options_.samplesPerTrack) {
+            for (std::uint64_t position = tail; position != head; ++position) {
+                const std::size_t cell = base + (position & mask_);
+                const std::int64_t time = times_[cell].load(std::memory_order_relaxed);
+                if (time < start || time > end) {
+                    continue;
+                }
+                out.trackIds.push_back(track.trackId);
+                out.times.push_back(time);
+                for (std::size_t column = 0U; column < options_.doubleColumns; ++column) {
+                    out.doubles.push_back(doubles_[column * cells + cell].load(std::memory_order_relaxed));
+                }
+                for (std::size_t column = 0U; column < options_.intColumns; ++column) {
+                    out.ints.push_back(ints_[column * cells + cell].load(std::memory_order_relaxed));
+                }
+            }
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (track.seq.load(std::memory_order_relaxed) == seq) {
+                return out.size() - before;
+            }
+        }
+        // Overlapped a write: drop what was copied and read again
+        out.trackIds.resize(before);
+        out.times.resize(before);
+        out.doubles.resize(before * options_.doubleColumns);
+        out.ints.resize(before * options_.intColumns);
+        readRetries_.fetch_add(1U, std::memory_order_relaxed);
+        backOff(spins);
+    }
+}
+
+bool TrackHistoryStore::readLatest(int trackId, HistoryRows& out) const {
+    const int slot = findSlot(trackId);
+    return slot >= 0 && readSlot(static_cast<std::size_t>(slot), EARLIEST, LATEST, true, out) > 0U;
+}
+
+std::size_t TrackHistoryStore::readTrack(int trackId, HistoryRows& out) const {
+    const int slot = findSlot(trackId);
+    return slot >= 0 ? readSlot(static_cast<std::size_t>(slot), EARLIEST, LATEST, false, out) : 0U;
+}
+
+std::size_t TrackHistoryStore::readRange(std::int64_t start, std::int64_t end, HistoryRows& out) const {
+    const std::int64_t latest = latestBucket_.load(std::memory_order_acquire);
+    const std::size_t count = trackCount_.load(std::memory_order_acquire);
+    if (start > end || latest == NO_BUCKET) {
+        return 0U;
+    }
+    const std::int64_t window = static_cast<std::int64_t>(options_.buckets);
+    const std::int64_t first = floorDiv(start, options_.bucketWidth);
+    const std::int64_t last = std::min(floorDiv(end, options_.bucketWidth), latest);
+    bool scanAll = first <= latest - window;
+
+    std::vector<std::uint64_t> candidates(words_, 0U);
+    for (std::int64_t bucket = first; !scanAll && bucket <= last; ++bucket) {
+        const std::size_t index = static_cast<std::size_t>(bucket % window + (bucket % window < 0 ? window : 0));
+        const Bucket& entry = bucketIndex_[index];
+        const std::int64_t epoch = entry.epoch.load(std::memory_order_acquire);
+        if (epoch != bucket) {
+            // Nothing written in this bucket yet, unless a writer is recycling the slot right now
+            scanAll = epoch == NO_BUCKET || epoch > bucket;
+            continue;
+        }
+        const std::atomic<std::uint64_t>* bits = &bucketBits_[index * words_];
+        for (std::size_t word = 0U; word < words_; ++word) {
+            candidates[word] |= bits[word].load(std::memory_order_relaxed);
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+        scanAll = entry.epoch.load(std::memory_order_relaxed) != bucket;
+    }
+
+    const std::size_t before = out.size();
+    for (std::size_t slot = 0U; slot < count; ++slot) {
+        if (scanAll || (candidates[slot / 64U] >> (slot % 64U) & 1U) != 0U) {
+            readSlot(slot, start, end, false, out);
+        }
+    }
+    return out.size() - before;
+}
+
+std::vector<int> TrackHistoryStore::activeTracks() const {
+    std::vector<int> ids;
+    const std::size_t count = trackCount_.load(std::memory_order_acquire);
+    for (std::size_t slot = 0U; slot < count; ++slot) {
+        const Track& track = tracks_[slot];
+        if (track.head.load(std::memory_order_acquire) != track.tail.load(std::memory_order_acquire)) {
+            ids.push_back(track.trackId);
+        }
+    }
+    std::sort(ids.begin(), ids.end());
+    return ids;
+}
+
+std::size_t TrackHistoryStore::evictSlot(std::size_t slot, std::int64_t cutoff) {
+    Track& track = tracks_[slot];
+    const std::size_t base = slot * options_.samplesPerTrack;
+    const std::uint64_t head = track.head.load(std::memory_order_relaxed);
+    const std::uint64_t tail = track.tail.load(std::memory_order_relaxed);
+    std::uint64_t newTail = tail;
+    while (newTail != head && times_[base + (newTail & mask_)].load(std::memory_order_relaxed) < cutoff) {
+        ++newTail;
+    }
+    if (newTail == tail) {
+        scheduleExpiry(slot);
+        return 0U;
+    }
+    const std::uint64_t seq = track.seq.load(std::memory_order_relaxed);
+    track.seq.store(seq + 1U, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    track.tail.store(newTail, std::memory_order_relaxed);
+    track.seq.store(seq + 2U, std::memory_order_release);
+
+    const std::size_t removed = newTail - tail;
+    records_.fetch_sub(removed, std::memory_order_relaxed);
+    evicted_.fetch_add(removed, std::memory_order_relaxed);
+    if (newTail == head) {
+        activeTracks_.fetch_sub(1U, std::memory_order_relaxed);
+    }
+    refreshOldest(slot);
+    scheduleExpiry(slot);
+    return removed;
+}
+
+void TrackHistoryStore::refreshOldest(std::size_t slot) {
+    Track& track = tracks_[slot];
+    const std::size_t base = slot * options_.samplesPerTrack;
+    const std::uint64_t head = track.head.load(std::memory_order_relaxed);
+    const std::uint64_t tail = track.tail.load(std::memory_order_relaxed);
+    if (tail == head) {
+        track.oldest = LATEST;
+    } else if (track.ordered) {
+        track.oldest = times_[base + (tail & mask_)].load(std::memory_order_relaxed);
+    } else {
+        // Out-of-order samples: the oldest may sit anywhere in this ring
+        ringScans_.fetch_add(1U, std::memory_order_relaxed);
+        std::int64_t oldest = LATEST;
+        for (std::uint64_t position = tail; position != head; ++position) {
+            oldest = std::min(oldest, times_[base + (position & mask_)].load(std::memory_order_relaxed));
+        }
+        track.oldest = oldest;
+    }
+    queueOldest(slot);
+}
+
+void TrackHistoryStore::queueOldest(std::size_t slot) {
+    std::uint32_t position = heapIndex_[slot];
+    if (tracks_[slot].oldest == LATEST) {
+        if (position != NOT_QUEUED) {
+            heapIndex_[slot] = NOT_QUEUED;
+            const std::uint32_t last = oldestHeap_.back();
+            oldestHeap_.pop_back();
+            if (last != slot) {
+                placeInHeap(last, position);
+            }
+        }
+    } else if (position == NOT_QUEUED) {
+        oldestHeap_.push_back(static_cast<std::uint32_t>(slot));
+        placeInHeap(static_cast<std::uint32_t>(slot), static_cast<std::uint32_t>(oldestHeap_.size() - 1U));
+    } else {
+        placeInHeap(static_cast<std::uint32_t>(slot), position);
+    }
+    oldestTime_.store(oldestHeap_.empty() ? LATEST : tracks_[oldestHeap_.front()].oldest,
+                      std::memory_order_relaxed);
+}
+
+void TrackHistoryStore::placeInHeap(std::uint32_t slot, std::uint32_t position) {
+    const std::int64_t key = tracks_[slot].oldest;
+    while (position > 0U) {
+        const std::uint32_t parent = (position - 1U) / 2U;
+        if (tracks_[oldestHeap_[parent]].oldest <= key) {
+            break;
+        }
+        oldestHeap_[position] = oldestHeap_[parent];
+        heapIndex_[oldestHeap_[position]] = position;
+        position = parent;
+    }
+    const std::size_t size = oldestHeap_.size();
+    for (;;) {
+        std::size_t child = position * 2U + 1U;
+        if (child >= size) {
+            break;
+        }
+        if (child + 1U < size && tracks_[oldestHeap_[child + 1U]].oldest < tracks_[oldestHeap_[child]].oldest) {
+            ++child;
+        }
+        if (key <= tracks_[oldestHeap_[child]].oldest) {
+            break;
+        }
+        oldestHeap_[position] = oldestHeap_[child];
+        heapIndex_[oldestHeap_[position]] = position;
+        position = static_cast<std::uint32_t>(child);
+    }
+    oldestHeap_[position] = slot;
+    heapIndex_[slot] = position;
+}
+
+void TrackHistoryStore::scheduleExpiry(std::size_t slot) {
+    const Track& track = tracks_[slot];
+    const std::uint64_t tail = track.tail.load(std::memory_order_relaxed);
+    if (tail == track.head.load(std::memory_order_relaxed)) {
+        expiry_->cancel(static_cast<std::uint32_t>(slot));
+        return;
+    }
+    const std::int64_t oldest = times_[slot * options_.samplesPerTrack + (tail & mask_)].load(std::memory_order_relaxed);
+    expiry_->schedule(static_cast<std::uint32_t>(slot), oldest);
+}
+
+ExpiryProgress TrackHistoryStore::expireBefore(std::int64_t cutoff, std::size_t maxTracks) {
+    std::lock_guard<std::mutex> lock(writeMutex_);
+    ExpiryProgress progress;
+    expired_.clear();
+    progress.done = expiry_->advance(cutoff, maxTracks, expired_);
+    for (const std::uint32_t slot : expired_) {
+        progress.removed += evictSlot(slot, cutoff);
+    }
+    return progress;
+}
+
+std::size_t TrackHistoryStore::evictTrackBefore(int trackId, std::int64_t cutoff) {
+    std::lock_guard<std::mutex> lock(writeMutex_);
+    const int slot = findSlot(trackId);
+    return slot >= 0 ? evictSlot(static_cast<std::size_t>(slot), cutoff) : 0U;
+}
+
+std::size_t TrackHistoryStore::evictBefore(std::int64_t cutoff) {
+    std::lock_guard<std::mutex> lock(writeMutex_);
+    const std::size_t count = trackCount_.load(std::memory_order_relaxed);
+    std::size_t removed = 0U;
+    for (std::size_t slot = 0U; slot < count; ++slot) {
+        removed += evictSlot(slot, cutoff);
+    }
+    return removed;
+}
+
+HistoryStats TrackHistoryStore::stats() const {
+    HistoryStats result;
+    result.records = records_.load(std::memory_order_relaxed);
+    result.activeTracks = activeTracks_.load(std::memory_order_relaxed);
+    result.appended = appended_.load(std::memory_order_relaxed);
+    result.overwritten = overwritten_.load(std::memory_order_relaxed);
+    result.evicted = evicted_.load(std::memory_order_relaxed);
+    result.rejected = rejected_.load(std::memory_order_relaxed);
+    result.readRetries = readRetries_.load(std::memory_order_relaxed);
+    result.ringScans = ringScans_.load(std::memory_order_relaxed);
+    if (result.records == 0U) {
+        return result;
+    }
+    result.newestTime = newestTime_.load(std::memory_order_relaxed);
+    const std::int64_t oldest = oldestTime_.load(std::memory_order_relaxed);
+    result.oldestTime = oldest == LATEST ? 0 : oldest;
+    return result;
+}
+
+} // namespace store
+} // namespace common
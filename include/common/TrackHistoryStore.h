@@ -0,0 +1,215 @@
+/**
+ * @file TrackHistoryStore.h
+ * @brief Fixed-capacity per-track history rings with lock-free readers
+ *
+ * Every track owns a ring of the last samplesPerTrack samples. A sample is
+ * a key time plus a fixed number of double and int64 columns; each column
+ * is stored contiguously per track (SoA), so time filters scan one dense
+ * int64 array and never touch the value columns of rejected rows.
+ *
+ * Writers are serialized by a mutex and never wait for readers. Readers
+ * take no lock: each track carries a sequence counter (odd while a write
+ * is in progress) and a read that overlapped a write is retried. All
+ * column cells are relaxed atomics, so a torn read is discarded rather
+ * than being undefined behaviour; on x86-64 they compile to plain moves.
+ *
+ * Range queries go through a time-bucket index: a ring of `buckets` slots
+ * of bucketWidth time units, each a bitset of the tracks that received a
+ * sample in that bucket. A query ORs the bitsets of the buckets it covers
+ * and scans only those tracks. Ranges older than the index window fall
+ * back to scanning every track.
+ *
+ * Expiry is driven by a hierarchical timing wheel (common/TimingWheel.h)
+ * holding one deadline per track: the time of its oldest sample. When
+ * the deadline passes, the expired prefix of that ring is dropped and the
+ * track is rescheduled at its new oldest sample, so each expiry pass only
+ * touches tracks that actually hold expired samples. expireBefore() does
+ * a bounded slice of that work per call and releases the writer lock in
+ * between, so appends interleave with a long cleanup.
+ *
+ * Record count, active track count, newest and oldest time are maintained
+ * on every write, so stats() never scans the columns. Each track keeps the
+ * time of its oldest sample and a min-heap over tracks yields the store's
+ * oldest time. When a ring overwrite or an eviction removes a track's
+ * oldest sample, its next sample takes over; only a track that received
+ * samples out of time order rescans its own ring.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace common {
+namespace timing {
+class TimingWheel;
+} // namespace timing
+
+namespace store {
+
+/// Shape and capacity of a store; all memory is allocated up front
+struct HistoryOptions {
+    std::size_t maxTracks = 1024U;
+    std::size_t samplesPerTrack = 256U;   ///< Rounded up to a power of two
+    std::size_t doubleColumns = 0U;
+    std::size_t intColumns = 0U;          ///< int64 columns besides the key time
+    std::int64_t bucketWidth = 1000;      ///< Time-index bucket width, in key time units
+    std::size_t buckets = 64U;            ///< Buckets kept in the time index
+    std::int64_t expiryResolution = 1;    ///< Expiry wheel tick, in key time units
+};
+
+/**
+ * @brief Rows copied out of the store, one column-major block per query
+ *
+ * doubles and ints are row-major inside the block (row * columns + column)
+ * so one row converts to a domain object with a single pointer walk.
+ */
+struct HistoryRows {
+    std::size_t doubleColumns = 0U;
+    std::size_t intColumns = 0U;
+    std::vector<int> trackIds;
+    std::vector<std::int64_t> times;
+    std::vector<double> doubles;
+    std::vector<std::int64_t> ints;
+
+    std::size_t size() const noexcept { return times.size(); }
+    const double* doublesAt(std::size_t row) const noexcept { return doubles.data() + row * doubleColumns; }
+    const std::int64_t* intsAt(std::size_t row) const noexcept { return ints.data() + row * intColumns; }
+    void clear() noexcept;
+};
+
+/// Counters maintained on the write path
+struct HistoryStats {
+    std::size_t records = 0U;
+    std::size_t activeTracks = 0U;
+    std::int64_t oldestTime = 0;          ///< 0 when empty
+    std::int64_t newestTime = 0;          ///< 0 when empty
+    std::uint64_t appended = 0U;
+    std::uint64_t overwritten = 0U;       ///< Samples pushed out by a full ring
+    std::uint64_t evicted = 0U;           ///< Samples removed by eviction or expiry
+    std::uint64_t rejected = 0U;          ///< Appends refused because maxTracks was reached
+    std::uint64_t readRetries = 0U;       ///< Reads repeated because they overlapped a write
+    std::uint64_t ringScans = 0U;         ///< Rings rescanned for their oldest sample (out-of-order tracks only)
+};
+
+/// Outcome of one expireBefore() slice
+struct ExpiryProgress {
+    std::size_t removed = 0U;
+    bool done = true;                     ///< false: more expired tracks remain for the same cutoff
+};
+
+/**
+ * @class TrackHistoryStore
+ * @brief Per-track SoA rings, a time-bucket index and incremental stats
+ */
+class TrackHistoryStore final {
+public:
+    /// @throws std::invalid_argument if a capacity is zero
+    explicit TrackHistoryStore(const HistoryOptions& options);
+    ~TrackHistoryStore();
+
+    TrackHistoryStore(const TrackHistoryStore&) = delete;
+    TrackHistoryStore& operator=(const TrackHistoryStore&) = delete;
+
+    /**
+     * @brief Appends one sample; a full ring drops its oldest sample
+     * @param doubles options.doubleColumns values
+     * @param ints options.intColumns values
+     * @return false if the track is new and maxTracks tracks already exist
+     */
+    bool append(int trackId, std::int64_t time, const double* doubles, const std::int64_t* ints);
+
+    /// Appends the newest sample of trackId to out; false if the track has none
+    bool readLatest(int trackId, HistoryRows& out) const;
+
+    /// Appends the history of trackId to out, oldest first; returns rows added
+    std::size_t readTrack(int trackId, HistoryRows& out) const;
+
+    /// Appends every sample with start <= time <= end to out, grouped by track; returns rows added
+    std::size_t readRange(std::int64_t start, std::int64_t end, HistoryRows& out) const;
+
+    /// Track ids that currently hold at least one sample, ascending
+    std::vector<int> activeTracks() const;
+
+    /// Removes every sample of trackId with time < cutoff from the front of its ring; returns samples removed
+    std::size_t evictTrackBefore(int trackId, std::int64_t cutoff);
+
+    /// Removes every sample with time < cutoff from the front of each ring; returns samples removed
+    std::size_t evictBefore(std::int64_t cutoff);
+
+    /**
+     * @brief Expires samples older than cutoff, visiting at most maxTracks tracks
+     *
+     * Only tracks whose oldest sample is due are visited. Call again with
+     * the same cutoff until done; samples within one expiry tick of the
+     * cutoff may survive until the next cutoff.
+     */
+    ExpiryProgress expireBefore(std::int64_t cutoff, std::size_t maxTracks);
+
+    HistoryStats stats() const;
+
+    /// An empty HistoryRows shaped for this store
+    HistoryRows makeRows() const;
+
+    const HistoryOptions& options() const noexcept { return options_; }
+
+private:
+    struct Track;
+    struct Bucket;
+
+    int findSlot(int trackId) const noexcept;
+    int findOrInsertSlot(int trackId);
+    void indexSample(std::size_t slot, std::int64_t time);
+    std::size_t evictSlot(std::size_t slot, std::int64_t cutoff);
+    void scheduleExpiry(std::size_t slot);
+    void refreshOldest(std::size_t slot);
+    void queueOldest(std::size_t slot);
+    void placeInHeap(std::uint32_t slot, std::uint32_t position);
+    std::size_t readSlot(std::size_t slot, std::int64_t start, std::int64_t end, bool latestOnly,
+                         HistoryRows& out) const;
+
+    HistoryOptions options_;
+    std::size_t mask_ = 0U;               ///< samplesPerTrack - 1
+    std::size_t words_ = 0U;              ///< 64-bit words per bucket bitset
+
+    std::unique_ptr<Track[]> tracks_;
+    std::atomic<std::size_t> trackCount_{0U};
+
+    // Open-addressed trackId -> slot table; keys are published after the slot is initialized
+    std::size_t tableMask_ = 0U;
+    std::unique_ptr<std::atomic<std::int64_t>[]> tableKeys_;
+    std::unique_ptr<std::atomic<std::uint32_t>[]> tableSlots_;
+
+    // Columns: [column][slot * samplesPerTrack + position]
+    std::unique_ptr<std::atomic<std::int64_t>[]> times_;
+    std::unique_ptr<std::atomic<double>[]> doubles_;
+    std::unique_ptr<std::atomic<std::int64_t>[]> ints_;
+
+    std::unique_ptr<Bucket[]> bucketIndex_;
+    std::unique_ptr<std::atomic<std::uint64_t>[]> bucketBits_;
+    std::atomic<std::int64_t> latestBucket_;
+
+    std::mutex writeMutex_;
+    std::unique_ptr<timing::TimingWheel> expiry_;
+    std::vector<std::uint32_t> expired_;
+    std::vector<std::uint32_t> oldestHeap_;   ///< Slots holding samples, min-heap on their oldest time
+    std::vector<std::uint32_t> heapIndex_;    ///< Position of each slot in oldestHeap_
+
+    std::atomic<std::size_t> records_{0U};
+    std::atomic<std::size_t> activeTracks_{0U};
+    std::atomic<std::int64_t> oldestTime_;
+    std::atomic<std::int64_t> newestTime_;
+    std::atomic<std::uint64_t> appended_{0U};
+    std::atomic<std::uint64_t> overwritten_{0U};
+    std::atomic<std::uint64_t> evicted_{0U};
+    std::atomic<std::uint64_t> rejected_{0U};
+    mutable std::atomic<std::uint64_t> readRetries_{0U};
+    std::atomic<std::uint64_t> ringScans_{0U};
+};
+
+} // namespace store
+} // namespace common
@@ -0,0 +1,259 @@
+/**
+ * @file TscClock.cpp
+ * @brief TscClock calibration, re-sync and clock_gettime fallback
+ */
+
+#include "common/TscClock.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <limits>
+#include <mutex>
+
+#if HEXAGON_TSC_CLOCK_X86
+#include <cpuid.h>
+#endif
+
+namespace common {
+namespace timing {
+
+namespace detail {
+TscState tscState;
+} // namespace detail
+
+namespace {
+
+/// Initial frequency measurement; refined at every re-sync over the whole run
+constexpr long CALIBRATION_NS = 10000000L;
+
+/// Errors above this are stepped instead of slewed
+constexpr std::int64_t STEP_THRESHOLD_NS = 1000000;
+
+constexpr int SAMPLE_ATTEMPTS = 5;
+
+/// One (cycles, CLOCK_REALTIME, CLOCK_MONOTONIC_RAW) triple
+struct ClockSample {
+    std::uint64_t cycles = 0U;
+    std::int64_t realNs = 0;
+    std::int64_t rawNs = 0;
+};
+
+struct Calibrator {
+    std::mutex mutex;                     ///< Serializes writers of detail::tscState
+    ClockSample anchor;                   ///< First sample; frequency is measured against it
+    double nsPerCycle = 0.0;
+    std::atomic<std::int64_t> intervalNs{1000000000};
+    TscCalibration stats;
+};
+
+Calibrator& calibrator() {
+    static Calibrator instance;
+    return instance;
+}
+
+std::once_flag initFlag;
+
+std::int64_t toNs(const timespec& ts) noexcept {
+    return static_cast<std::int64_t>(ts.tv_sec) * 1000000000 + static_cast<std::int64_t>(ts.tv_nsec);
+}
+
+std::int64_t realtimeNanos() noexcept {
+    timespec ts{};
+    clock_gettime(CLOCK_REALTIME, &ts);
+    return toNs(ts);
+}
+
+bool hasInvariantTsc() noexcept {
+#if HEXAGON_TSC_CLOCK_X86
+    unsigned int eax = 0U;
+    unsigned int ebx = 0U;
+    unsigned int ecx = 0U;
+    unsigned int edx = 0U;
+    if (__get_cpuid_max(0x80000000U, nullptr) < 0x80000007U) {
+        return false;
+    }
+    if (__get_cpuid(0x80000007U, &eax, &ebx, &ecx, &edx) == 0) {
+        return false;
+    }
+    return (edx & (1U << 8U)) != 0U;
+#else
+    return false;
+#endif
+}
+
+bool systemClockRequested() noexcept {
+    const char* value = std::getenv("HEXAGON_CLOCK");
+    return value != nullptr && std::strcmp(value, "system") == 0;
+}
+
+/// Reads both clocks between two counter reads; keeps the tightest bracket
+ClockSample takeSample() noexcept {
+    ClockSample best;
+    std::uint64_t bestWidth = std::numeric_limits<std::uint64_t>::max();
+    for (int attempt = 0; attempt < SAMPLE_ATTEMPTS; ++attempt) {
+        timespec real{};
+        timespec raw{};
+        const std::uint64_t before = TscClock::readCycles();
+        clock_gettime(CLOCK_REALTIME, &real);
+        clock_gettime(CLOCK_MONOTONIC_RAW, &raw);
+        const std::uint64_t after = TscClock::readCycles();
+        const std::uint64_t width = after - before;
+        if (width < bestWidth) {
+            bestWidth = width;
+            best.cycles = before + width / 2U;
+            best.realNs = toNs(real);
+            best.rawNs = toNs(raw);
+        }
+    }
+    return best;
+}
+
+/// Seqlock write of a new mapping; caller holds Calibrator::mutex
+void publish(std::uint64_t baseCycles, std::int64_t baseNs, double nsPerCycle, std::int64_t intervalNs) noexcept {
+    detail::TscState& state = detail::tscState;
+    const std::int64_t mult = std::llround(nsPerCycle * static_cast<double>(1LL << TscClock::SHIFT));
+    const std::int64_t maxDelta = std::numeric_limits<std::int64_t>::max() / (mult > 0 ? mult : 1);
+    std::uint64_t resyncCycles = static_cast<std::uint64_t>(static_cast<double>(intervalNs) / nsPerCycle);
+    if (resyncCycles > static_cast<std::uint64_t>(maxDelta / 2)) {
+        resyncCycles = static_cast<std::uint64_t>(maxDelta / 2);
+    }
+
+    const std::uint32_t seq = state.seq.load(std::memory_order_relaxed);
+    state.seq.store(seq + 1U, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    state.baseCycles.store(baseCycles, std::memory_order_relaxed);
+    state.baseNs.store(baseNs, std::memory_order_relaxed);
+    state.mult.store(mult, std::memory_order_relaxed);
+    state.maxDelta.store(maxDelta, std::memory_order_relaxed);
+    state.resyncCycles.store(resyncCycles, std::memory_order_relaxed);
+    state.seq.store(seq + 2U, std::memory_order_release);
+}
+
+/// Current mapping without deadline or overflow checks; caller holds Calibrator::mutex
+std::int64_t project(std::uint64_t cycles) noexcept {
+    const detail::TscState& state = detail::tscState;
+    const double delta = static_cast<double>(static_cast<std::int64_t>(
+        cycles - state.baseCycles.load(std::memory_order_relaxed)));
+    const double nsPerCycle = static_cast<double>(state.mult.load(std::memory_order_relaxed)) /
+                              static_cast<double>(1LL << TscClock::SHIFT);
+    return state.baseNs.load(std::memory_order_relaxed) + std::llround(delta * nsPerCycle);
+}
+
+/// Caller holds Calibrator::mutex
+void resyncLocked(Calibrator& cal) noexcept {
+    const ClockSample sample = takeSample();
+    if (sample.cycles > cal.anchor.cycles) {
+        cal.nsPerCycle = static_cast<double>(sample.rawNs - cal.anchor.rawNs) /
+                         static_cast<double>(sample.cycles - cal.anchor.cycles);
+    }
+    const std::int64_t intervalNs = cal.intervalNs.load(std::memory_order_relaxed);
+    const std::int64_t projected = project(sample.cycles);
+    const std::int64_t error = sample.realNs - projected;
+
+    if (error > STEP_THRESHOLD_NS || error < -STEP_THRESHOLD_NS) {
+        publish(sample.cycles, sample.realNs, cal.nsPerCycle, intervalNs);
+        ++cal.stats.steps;
+    } else {
+        // Continue from the projected value and absorb the error by the next re-sync
+        const double slewed = cal.nsPerCycle *
+            (1.0 + static_cast<double>(error) / static_cast<double>(intervalNs));
+        publish(sample.cycles, projected, slewed, intervalNs);
+    }
+    cal.stats.lastErrorNs = error;
+    cal.stats.cyclesPerMicro = 1000.0 / cal.nsPerCycle;
+    ++cal.stats.resyncs;
+}
+
+void initialize() noexcept {
+    Calibrator& cal = calibrator();
+    detail::TscState& state = detail::tscState;
+    if (systemClockRequested() || !hasInvariantTsc()) {
+        state.mode.store(detail::MODE_SYSTEM, std::memory_order_release);
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(cal.mutex);
+    cal.anchor = takeSample();
+    const timespec pause{0, CALIBRATION_NS};
+    nanosleep(&pause, nullptr);
+    const ClockSample second = takeSample();
+    if (second.cycles <= cal.anchor.cycles || second.rawNs <= cal.anchor.rawNs) {
+        state.mode.store(detail::MODE_SYSTEM, std::memory_order_release);
+        return;
+    }
+    cal.nsPerCycle = static_cast<double>(second.rawNs - cal.anchor.rawNs) /
+                     static_cast<double>(second.cycles - cal.anchor.cycles);
+    publish(second.cycles, second.realNs, cal.nsPerCycle, cal.intervalNs.load(std::memory_order_relaxed));
+    cal.stats.usingTsc = true;
+    cal.stats.cyclesPerMicro = 1000.0 / cal.nsPerCycle;
+    state.mode.store(detail::MODE_TSC, std::memory_order_release);
+}
+
+void ensureInitialized() noexcept {
+    if (detail::tscState.mode.load(std::memory_order_acquire) == detail::MODE_UNINITIALIZED) {
+        std::call_once(initFlag, initialize);
+    }
+}
+
+} // namespace
+
+namespace detail {
+
+std::int64_t slowNowNanos(std::uint64_t cycles) noexcept {
+    ensureInitialized();
+    if (tscState.mode.load(std::memory_order_acquire) != MODE_TSC) {
+        return realtimeNanos();
+    }
+
+    Calibrator& cal = calibrator();
+    std::unique_lock<std::mutex> lock(cal.mutex, std::try_to_lock);
+    if (lock.owns_lock()) {
+        const std::int64_t delta = static_cast<std::int64_t>(
+            cycles - tscState.baseCycles.load(std::memory_order_relaxed));
+        if (delta >= static_cast<std::int64_t>(tscState.resyncCycles.load(std::memory_order_relaxed))) {
+            resyncLocked(cal);
+        }
+        const std::int64_t after = static_cast<std::int64_t>(
+            cycles - tscState.baseCycles.load(std::memory_order_relaxed));
+        const std::int64_t maxDelta = tscState.maxDelta.load(std::memory_order_relaxed);
+        if (after <= maxDelta && after >= -maxDelta) {
+            return project(cycles);
+        }
+    }
+    // Another thread is re-syncing, or cycles is too far from the mapping to convert exactly
+    return realtimeNanos();
+}
+
+} // namespace detail
+
+void TscClock::resync() noexcept {
+    ensureInitialized();
+    if (detail::tscState.mode.load(std::memory_order_acquire) != detail::MODE_TSC) {
+        return;
+    }
+    Calibrator& cal = calibrator();
+    std::lock_guard<std::mutex> lock(cal.mutex);
+    resyncLocked(cal);
+}
+
+void TscClock::setResyncInterval(std::chrono::milliseconds interval) noexcept {
+    const std::int64_t ns = std::chrono::duration_cast<std::chrono::nanoseconds>(interval).count();
+    calibrator().intervalNs.store(ns > 0 ? ns : 1, std::memory_order_relaxed);
+}
+
+bool TscClock::usingTsc() noexcept {
+    ensureInitialized();
+    return detail::tscState.mode.load(std::memory_order_acquire) == detail::MODE_TSC;
+}
+
+TscCalibration TscClock::calibration() noexcept {
+    ensureInitialized();
+    Calibrator& cal = calibrator();
+    std::lock_guard<std::mutex> lock(cal.mutex);
+    return cal.stats;
+}
+
+} // namespace timing
+} // namespace common
@@ -0,0 +1,174 @@
+/**
+ * @file TscClock.h
+ * @brief Calibrated invariant-TSC wall clock for hop timestamps
+ *
+ * Every hop stamps each message with the epoch time in µs and computes
+ * delays against it, so the clock read sits on the per-sample path of all
+ * three hexagons. system_clock::now() goes through the vDSO and costs
+ * 20-30 ns, much more under virtualization or when the kernel falls back to
+ * a syscall. TscClock reads the time stamp counter and maps cycles to
+ * CLOCK_REALTIME nanoseconds with one multiply and shift:
+ *
+ *   ns = baseNs + ((cycles - baseCycles) * mult) >> SHIFT
+ *
+ * The mapping is published through a seqlock. Roughly once a second the
+ * first reader past the deadline re-syncs it: the TSC frequency is
+ * re-measured against CLOCK_MONOTONIC_RAW over the whole run, and the
+ * remaining error to CLOCK_REALTIME is slewed out over the next interval
+ * so the clock stays continuous while following NTP adjustments. Errors
+ * above one millisecond (the wall clock was stepped) are stepped too.
+ *
+ * Without an invariant TSC (CPUID 0x80000007 EDX bit 8), on non-x86
+ * targets, or with HEXAGON_CLOCK=system in the environment, every call
+ * falls back to clock_gettime(CLOCK_REALTIME).
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define HEXAGON_TSC_CLOCK_X86 1
+#else
+#define HEXAGON_TSC_CLOCK_X86 0
+#endif
+
+namespace common {
+namespace timing {
+
+/// Calibration state, for startup logs and tests
+struct TscCalibration {
+    bool usingTsc = false;           ///< false: clock_gettime fallback
+    double cyclesPerMicro = 0.0;     ///< Measured TSC frequency in MHz
+    std::int64_t lastErrorNs = 0;    ///< CLOCK_REALTIME minus TscClock at the last re-sync
+    std::uint64_t resyncs = 0;
+    std::uint64_t steps = 0;         ///< Re-syncs that stepped instead of slewing
+};
+
+namespace detail {
+
+enum : std::uint32_t {
+    MODE_UNINITIALIZED = 0,
+    MODE_TSC = 1,
+    MODE_SYSTEM = 2
+};
+
+/// Seqlock-published cycles-to-ns mapping; constant-initialized so it is usable during static init
+struct TscState {
+    std::atomic<std::uint32_t> mode{MODE_UNINITIALIZED};
+    std::atomic<std::uint32_t> seq{0};
+    std::atomic<std::uint64_t> baseCycles{0};
+    std::atomic<std::int64_t> baseNs{0};
+    std::atomic<std::int64_t> mult{0};
+    std::atomic<std::int64_t> maxDelta{0};     ///< Larger deltas would overflow the multiply
+    std::atomic<std::uint64_t> resyncCycles{0};
+};
+
+extern TscState tscState;
+
+/// Initializes on first use, serves the fallback and re-syncs; everything off the fast path
+std::int64_t slowNowNanos(std::uint64_t cycles) noexcept;
+
+} // namespace detail
+
+/**
+ * @class TscClock
+ * @brief Drop-in replacement for std::chrono::system_clock on hot paths
+ *
+ * time_since_epoch() is the Unix epoch like system_clock, so values mix
+ * freely with timestamps produced by other hosts and by system_clock.
+ */
+class TscClock final {
+public:
+    using rep = std::int64_t;
+    using period = std::nano;
+    using duration = std::chrono::nanoseconds;
+    using time_point = std::chrono::time_point<TscClock>;
+    static constexpr bool is_steady = false;
+
+    /// Fixed-point fraction bits of mult
+    static constexpr int SHIFT = 28;
+
+    static time_point now() noexcept {
+        return time_point(duration(nowNanos()));
+    }
+
+    /// Nanoseconds since the Unix epoch
+    static std::int64_t nowNanos() noexcept {
+        return toNanos(readCycles());
+    }
+
+    /// Microseconds since the Unix epoch, as used in the hop timestamp fields
+    static std::int64_t nowMicros() noexcept {
+        return nowNanos() / 1000;
+    }
+
+    /// Raw counter value; 0 when the TSC is not available
+    static std::uint64_t readCycles() noexcept {
+#if HEXAGON_TSC_CLOCK_X86
+        return __rdtsc();
+#else
+        return 0U;
+#endif
+    }
+
+    /**
+     * @brief Converts a counter value from readCycles() to epoch nanoseconds
+     *
+     * Lets callers take a cheap timestamp first and convert it later, off
+     * the critical section.
+     */
+    static std::int64_t toNanos(std::uint64_t cycles) noexcept {
+        detail::TscState& state = detail::tscState;
+        if (state.mode.load(std::memory_order_relaxed) != detail::MODE_TSC) {
+            return detail::slowNowNanos(cycles);
+        }
+        for (;;) {
+            const std::uint32_t seq = state.seq.load(std::memory_order_acquire);
+            if ((seq & 1U) != 0U) {
+                continue;
+            }
+            const std::uint64_t baseCycles = state.baseCycles.load(std::memory_order_relaxed);
+            const std::int64_t baseNs = state.baseNs.load(std::memory_order_relaxed);
+            const std::int64_t mult = state.mult.load(std::memory_order_relaxed);
+            const std::int64_t maxDelta = state.maxDelta.load(std::memory_order_relaxed);
+            const std::uint64_t resyncCycles = state.resyncCycles.load(std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (state.seq.load(std::memory_order_relaxed) != seq) {
+                continue;
+            }
+
+            // Signed: a counter read just before a re-sync on another core may precede baseCycles
+            const std::int64_t delta = static_cast<std::int64_t>(cycles - baseCycles);
+            if (delta >= static_cast<std::int64_t>(resyncCycles) || delta > maxDelta || delta < -maxDelta) {
+                return detail::slowNowNanos(cycles);
+            }
+            return baseNs + ((delta * mult) >> SHIFT);
+        }
+    }
+
+    /// Forces a re-sync against CLOCK_REALTIME now
+    static void resync() noexcept;
+
+    /// Re-sync period, 1 s by default; takes effect at the next re-sync
+    static void setResyncInterval(std::chrono::milliseconds interval) noexcept;
+
+    static bool usingTsc() noexcept;
+
+    static TscCalibration calibration() noexcept;
+
+    static std::time_t to_time_t(const time_point& tp) noexcept {
+        return tp.time_since_epoch().count() / 1000000000;
+    }
+
+    static std::chrono::system_clock::time_point toSystem(const time_point& tp) noexcept {
+        return std::chrono::system_clock::time_point(
+            std::chrono::duration_cast<std::chrono::system_clock::duration>(tp.time_since_epoch()));
+    }
+};
+
+} // namespace timing
+} // namespace common
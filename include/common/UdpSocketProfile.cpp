@@ -0,0 +1,132 @@
+/**
+ * @file UdpSocketProfile.cpp
+ * @brief UdpSocketProfile presets and x-service-metadata parsing
+ */
+
+#include "common/UdpSocketProfile.h"
+
+#include <sstream>
+#include <stdexcept>
+
+namespace common {
+namespace net {
+
+namespace {
+
+/// DSCP EF (46) and AF11 (10) in the IP_TOS byte
+constexpr int TOS_EF = 46 << 2;
+constexpr int TOS_AF11 = 10 << 2;
+
+/// SO_PRIORITY above 6 needs CAP_NET_ADMIN, and libzmq asserts when it fails
+constexpr int MAX_PRIORITY = 6;
+
+int parseInt(const std::string& text, const char* what, int min, int max) {
+    std::size_t used = 0U;
+    long value = 0;
+    try {
+        value = std::stol(text, &used, 0);
+    } catch (const std::exception&) {
+        used = 0U;
+    }
+    if (used == 0U || used != text.size()) {
+        throw std::invalid_argument(std::string("UdpSocketProfile: invalid ") + what + ": '" + text + "'");
+    }
+    if (value < min || value > max) {
+        throw std::invalid_argument(std::string("UdpSocketProfile: ") + what + " out of range: " + text);
+    }
+    return static_cast<int>(value);
+}
+
+bool parseBool(const std::string& text, const char* what) {
+    if (text == "true" || text == "1") {
+        return true;
+    }
+    if (text == "false" || text == "0") {
+        return false;
+    }
+    throw std::invalid_argument(std::string("UdpSocketProfile: invalid ") + what + ": '" + text + "'");
+}
+
+} // namespace
+
+UdpSocketProfile UdpSocketProfile::preset(const std::string& name) {
+    UdpSocketProfile profile;
+    profile.name = name;
+    if (name == "default") {
+        return profile;
+    }
+    if (name == "latency") {
+        profile.busyPollUs = 50;
+        profile.preferBusyPoll = true;
+        profile.sndbuf = 256 * 1024;
+        profile.rcvbuf = 512 * 1024;
+        profile.priority = MAX_PRIORITY;
+        profile.tos = TOS_EF;
+        profile.direct = true;
+        return profile;
+    }
+    if (name == "throughput") {
+        profile.sndbuf = 4 * 1024 * 1024;
+        profile.rcvbuf = 8 * 1024 * 1024;
+        profile.tos = TOS_AF11;
+        return profile;
+    }
+    throw std::invalid_argument("UdpSocketProfile: unknown socket_profile '" + name + "'");
+}
+
+UdpSocketProfile UdpSocketProfile::fromMetadata(const std::map<std::string, std::string>& metadata) {
+    const auto name = metadata.find("socket_profile");
+    UdpSocketProfile profile =
+        preset(name == metadata.end() || name->second.empty() ? std::string("default") : name->second);
+
+    const auto value = [&metadata](const char* key, std::string& out) {
+        const auto it = metadata.find(key);
+        if (it == metadata.end() || it->second.empty()) {
+            return false;
+        }
+        out = it->second;
+        return true;
+    };
+
+    std::string text;
+    if (value("socket_busy_poll_us", text)) {
+        profile.busyPollUs = parseInt(text, "socket_busy_poll_us", 0, 1000000);
+    }
+    if (value("socket_prefer_busy_poll", text)) {
+        profile.preferBusyPoll = parseBool(text, "socket_prefer_busy_poll");
+    }
+    if (value("socket_sndbuf", text)) {
+        profile.sndbuf = parseInt(text, "socket_sndbuf", -1, 1 << 30);
+    }
+    if (value("socket_rcvbuf", text)) {
+        profile.rcvbuf = parseInt(text, "socket_rcvbuf", -1, 1 << 30);
+    }
+    if (value("socket_priority", text)) {
+        profile.priority = parseInt(text, "socket_priority", 0, MAX_PRIORITY);
+    }
+    if (value("socket_tos", text)) {
+        profile.tos = parseInt(text, "socket_tos", 0, 255);
+    }
+    if (value("socket_multicast_loop", text)) {
+        profile.multicastLoop = parseBool(text, "socket_multicast_loop");
+    }
+    if (value("socket_incoming_cpu", text)) {
+        profile.incomingCpu = parseInt(text, "socket_incoming_cpu", -1, 4095);
+    }
+    if (value("socket_direct", text)) {
+        profile.direct = parseBool(text, "socket_direct");
+    }
+    return profile;
+}
+
+std::string UdpSocketProfile::toString() const {
+    std::ostringstream out;
+    out << name << " (busy_poll=" << busyPollUs << "us" << (preferBusyPoll ? " preferred" : "")
+        << " sndbuf=" << sndbuf << " rcvbuf=" << rcvbuf << " priority=" << priority
+        << " tos=0x" << std::hex << tos << std::dec << " multicast_loop=" << (multicastLoop ? 1 : 0)
+        << " incoming_cpu=" << incomingCpu << (direct ? " direct" : "") << ")";
+    return out.str();
+}
+
+} // namespace net
+} // namespace common
@@ -0,0 +1,75 @@
+/**
+ * @file UdpSocketProfile.h
+ * @brief Kernel socket knobs of a RADIO/DISH stream, picked per message type
+ *
+ * A profile bundles the UDP socket options libzmq applies when it creates
+ * the engine's socket: busy polling, buffer sizes, priority/TOS, multicast
+ * loopback, the receive CPU and whether the adapter's own thread drives the
+ * socket instead of a libzmq I/O thread. Each stream picks one in the
+ * x-service-metadata block of its zmq_messages schema:
+ * - "socket_profile": "default" | "latency" | "throughput"
+ * - optional overrides of single fields: "socket_busy_poll_us",
+ *   "socket_prefer_busy_poll", "socket_sndbuf", "socket_rcvbuf",
+ *   "socket_priority", "socket_tos", "socket_multicast_loop",
+ *   "socket_incoming_cpu", "socket_direct"
+ *
+ * "default" leaves every knob to the kernel, which is the previous
+ * behaviour. Applying a profile to a socket is in ZmqSocketProfile.h.
+ */
+
+#pragma once
+
+#include <map>
+#include <string>
+
+namespace common {
+namespace net {
+
+/**
+ * @struct UdpSocketProfile
+ * @brief Values for the libzmq UDP socket options; -1 keeps the kernel default
+ */
+struct UdpSocketProfile {
+    std::string name = "default";
+
+    int busyPollUs = 0;           ///< SO_BUSY_POLL in microseconds, 0 = off (DISH)
+    bool preferBusyPoll = false;  ///< SO_PREFER_BUSY_POLL, needs busyPollUs (DISH)
+    int sndbuf = -1;              ///< SO_SNDBUF in bytes (RADIO)
+    int rcvbuf = -1;              ///< SO_RCVBUF in bytes (DISH)
+    int priority = 0;             ///< SO_PRIORITY 0..6, 0 = unchanged
+    int tos = 0;                  ///< IP_TOS byte (DSCP << 2), 0 = unchanged
+    bool multicastLoop = true;    ///< IP_MULTICAST_LOOP, off only if no DISH shares the host (RADIO)
+    int incomingCpu = -1;         ///< SO_INCOMING_CPU, -1 = any (DISH)
+    bool direct = false;          ///< ZMQ_UDP_DIRECT: sendto/recvfrom on the adapter's thread
+
+    /**
+     * @brief Named preset
+     *
+     * - "default": kernel defaults
+     * - "latency": 50us busy poll with interrupts kept off, buffers sized
+     *   for one tick's burst, priority 6, DSCP EF and direct mode, so no
+     *   I/O thread sits between the adapter and the wire
+     * - "throughput": no busy poll, large buffers to ride out bursts, DSCP AF11
+     *
+     * The kernel caps buffer sizes at net.core.rmem_max / wmem_max.
+     *
+     * @throws std::invalid_argument for an unknown name
+     */
+    static UdpSocketProfile preset(const std::string& name);
+
+    /**
+     * @brief Builds the profile from x-service-metadata key/values
+     *
+     * Missing "socket_profile" selects "default"; socket_* keys override
+     * single fields of the preset.
+     *
+     * @throws std::invalid_argument on unknown names or out-of-range values
+     */
+    static UdpSocketProfile fromMetadata(const std::map<std::string, std::string>& metadata);
+
+    /// One-line summary for startup logs
+    std::string toString() const;
+};
+
+} // namespace net
+} // namespace common
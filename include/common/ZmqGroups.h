@@ -0,0 +1,68 @@
+/**
+ * @file ZmqGroups.h
+ * @brief Numeric RADIO/DISH groups on zmq sockets for partitioned TrackGroupSchemes
+ *
+ * ZMQ_GROUP_NUMERIC is a draft option of the bundled hexagon_c/libzmq. With
+ * any other libzmq these calls compile but throw, so a partitioned
+ * group_partitioning fails at socket setup instead of at build time.
+ */
+
+#pragma once
+
+#include <zmq.hpp>
+
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+namespace common {
+namespace groups {
+
+#ifndef ZMQ_GROUP_NUMERIC
+[[noreturn]] inline void throwNoNumericGroups() {
+    throw std::runtime_error("group_partitioning needs a libzmq with ZMQ_GROUP_NUMERIC (hexagon_c/libzmq, drafts on)");
+}
+#endif
+
+/**
+ * @brief Switches a RADIO or DISH socket to numeric group ids
+ *
+ * Call before bind()/connect() and before any join.
+ *
+ * @throws std::runtime_error if this libzmq build lacks ZMQ_GROUP_NUMERIC
+ */
+inline void enableNumericGroups(zmq::socket_t& socket) {
+#ifdef ZMQ_GROUP_NUMERIC
+    socket.set(zmq::sockopt::group_numeric, 1);
+#else
+    static_cast<void>(socket);
+    throwNoNumericGroups();
+#endif
+}
+
+/// Joins each id on a DISH socket set up with enableNumericGroups()
+inline void joinGroupIds(zmq::socket_t& socket, const std::vector<std::uint32_t>& groupIds) {
+#ifdef ZMQ_GROUP_NUMERIC
+    for (const std::uint32_t groupId : groupIds) {
+        socket.join_id(groupId);
+    }
+#else
+    static_cast<void>(socket);
+    static_cast<void>(groupIds);
+    throwNoNumericGroups();
+#endif
+}
+
+/// Addresses a RADIO message to a numeric group id
+inline void setGroupId(zmq::message_t& message, std::uint32_t groupId) {
+#ifdef ZMQ_GROUP_NUMERIC
+    message.set_group_id(groupId);
+#else
+    static_cast<void>(message);
+    static_cast<void>(groupId);
+    throwNoNumericGroups();
+#endif
+}
+
+} // namespace groups
+} // namespace common
@@ -0,0 +1,54 @@
+/**
+ * @file ZmqSocketProfile.h
+ * @brief Applies a UdpSocketProfile to a RADIO or DISH zmq::socket_t
+ */
+
+#pragma once
+
+#include "common/UdpSocketProfile.h"
+
+#include <zmq.hpp>
+
+namespace common {
+namespace net {
+
+/**
+ * @brief Sets the profile's options on socket
+ *
+ * libzmq applies them when the UDP engine opens its socket, so call this
+ * before bind()/connect(). Knobs the kernel refuses (e.g. SO_BUSY_POLL
+ * without CAP_NET_ADMIN on older kernels) are left at their defaults by
+ * libzmq; options this libzmq build lacks are skipped.
+ *
+ * With profile.direct the calling thread's send()/recv() do the sendto and
+ * recvfrom; blocking recv with rcvtimeo and dontwait loops work as before,
+ * zmq::poll on the socket does not (poll its ZMQ_FD instead).
+ *
+ * @throws zmq::error_t if libzmq rejects a value
+ */
+inline void applySocketProfile(zmq::socket_t& socket, const UdpSocketProfile& profile) {
+    socket.set(zmq::sockopt::sndbuf, profile.sndbuf);
+    socket.set(zmq::sockopt::rcvbuf, profile.rcvbuf);
+    socket.set(zmq::sockopt::tos, profile.tos);
+#ifdef ZMQ_MULTICAST_LOOP
+    socket.set(zmq::sockopt::multicast_loop, profile.multicastLoop);
+#endif
+#ifdef ZMQ_PRIORITY
+    socket.set(zmq::sockopt::priority, profile.priority);
+#endif
+#ifdef ZMQ_BUSY_POLL
+    socket.set(zmq::sockopt::busy_poll, profile.busyPollUs);
+#endif
+#ifdef ZMQ_PREFER_BUSY_POLL
+    socket.set(zmq::sockopt::prefer_busy_poll, profile.preferBusyPoll);
+#endif
+#ifdef ZMQ_INCOMING_CPU
+    socket.set(zmq::sockopt::incoming_cpu, profile.incomingCpu);
+#endif
+#ifdef ZMQ_UDP_DIRECT
+    socket.set(zmq::sockopt::udp_direct, profile.direct);
+#endif
+}
+
+} // namespace net
+} // namespace common
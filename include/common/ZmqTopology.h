@@ -0,0 +1,66 @@
+/**
+ * @file ZmqTopology.h
+ * @brief Places a zmq::context_t's I/O threads according to ThreadTopology
+ */
+
+#pragma once
+
+#include "common/ThreadTopology.h"
+
+#include <zmq.hpp>
+
+#include <string>
+
+#ifdef __linux__
+#include <sched.h>
+#endif
+
+namespace common {
+namespace topology {
+
+/**
+ * @brief Applies role's cpus, policy and priority to the context's I/O threads
+ *
+ * libzmq starts its threads with the first socket, so call this right after
+ * constructing the context and before creating any socket on it. numa_node
+ * is not applied to libzmq threads. The placement is recorded for report();
+ * effective cpus there are those of the probe thread.
+ */
+inline AppliedPlacement applyIoThreadPlacement(zmq::context_t& context, ThreadTopology& topology,
+                                               const std::string& role = "zmq_io") {
+    const RolePlacement placement = topology.placementFor(role);
+
+    // libzmq asserts if its threads cannot apply the placement, so only pass on what a probe thread managed
+    AppliedPlacement result = topology.probe(role);
+    result.numaNode = -1;
+    result.numaApplied = false;
+    if (placement.configured) {
+        try {
+            if (placement.ioThreads > 0) {
+                context.set(zmq::ctxopt::io_threads, placement.ioThreads);
+            }
+            if (result.affinityApplied) {
+                for (const int cpu : placement.cpus) {
+                    context.set(zmq::ctxopt::thread_affinity_cpu_add, cpu);
+                }
+            }
+#ifdef __linux__
+            if (result.schedApplied && placement.policy != SchedPolicy::Other) {
+                context.set(zmq::ctxopt::thread_sched_policy,
+                            placement.policy == SchedPolicy::Fifo ? SCHED_FIFO : SCHED_RR);
+                context.set(zmq::ctxopt::thread_priority, placement.priority);
+            }
+#endif
+        } catch (const zmq::error_t& e) {
+            result.error += (result.error.empty() ? "" : "; ") + std::string(e.what());
+        }
+        if (placement.numaNode >= 0) {
+            result.error += (result.error.empty() ? "" : "; ") + std::string("numa_node ignored for libzmq threads");
+        }
+    }
+    topology.recordApplied(result);
+    return result;
+}
+
+} // namespace topology
+} // namespace common